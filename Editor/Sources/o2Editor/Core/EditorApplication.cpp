@@ -20,6 +20,7 @@
 #include "o2/Utils/Debug/Debug.h"
 #include "o2/Utils/Editor/EditorScope.h"
 #include "o2/Utils/FileSystem/FileSystem.h"
+#include "o2/Utils/Memory/Allocators/FrameAllocator.h"
 #include "o2/Utils/System/Time/Time.h"
 #include "o2/Utils/System/Time/Timer.h"
 #include "o2/Utils/Tasks/TaskManager.h"
@@ -460,6 +461,7 @@ namespace Editor
 		o2Application.windowCaption = String("o2 Editor: ") + mLoadedScene +
 			"; FPS: " + (String)((int)o2Time.GetFPS()) +
 			" DC: " + (String)mDrawCalls +
+			" Frame: " + (String)(int)(o2FrameAllocator.GetLastFrameStatistics().usedBytes / 1024) + "kb" +
 			" Cursor: " + (String)o2Input.GetCursorPos() +
 			" JS: " + (String)(o2Scripts.GetUsedMemory() / 1024) + "kb";
 
@@ -26,6 +26,7 @@
 #include "o2Editor/Core/WindowsSystem/WindowsManager.h"
 #include "o2Editor/GameWindow/GameWindow.h"
 #include "o2Editor/LogWindow/LogWindow.h"
+#include "o2Editor/ProfilerWindow/ProfilerWindow.h"
 #include "o2Editor/PropertiesWindow/PropertiesWindow.h"
 #include "o2Editor/SceneWindow/SceneWindow.h"
 #include "o2Editor/TreeWindow/SceneTree.h"
@@ -77,6 +78,7 @@ namespace Editor
 		mMenuPanel->AddItem("View/Show Animation", [&]() { OnShowAnimationPressed(); });
 		mMenuPanel->AddItem("View/Show Log", [&]() { OnShowLogPressed(); });
 		mMenuPanel->AddItem("View/Show Game", [&]() { OnShowGamePressed(); });
+		mMenuPanel->AddItem("View/Show Profiler", [&]() { OnShowProfilerPressed(); });
 		mMenuPanel->AddItem("View/---");
 		mMenuPanel->AddItem("View/Reset layout", [&]() { OnResetLayoutPressed(); });
 
@@ -320,6 +322,13 @@ namespace Editor
 			window->Show();
 	}
 
+	void MenuPanel::OnShowProfilerPressed()
+	{
+		auto window = o2EditorWindows.GetWindow<ProfilerWindow>();
+		if (window)
+			window->Show();
+	}
+
 	void MenuPanel::OnResetLayoutPressed()
 	{
 		o2EditorWindows.SetDefaultWindowsLayout();
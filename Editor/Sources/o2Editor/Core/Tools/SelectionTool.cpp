@@ -2,6 +2,7 @@
 #include "SelectionTool.h"
 
 #include "o2/Render/Sprite.h"
+#include "o2/Scene/Actor.h"
 #include "o2/Scene/Scene.h"
 #include "o2/Utils/Editor/SceneEditableObject.h"
 #include "o2Editor/Core/Actions/Select.h"
@@ -84,9 +85,18 @@ namespace Editor
 			if (!o2EditorSceneScreen.GetSelectedObjects().IsEmpty())
 				startIdx = drawnObjects.IndexOf(o2EditorSceneScreen.GetSelectedObjects().Last()) - 1;
 
+			// Scene actors are checked precisely only when their world bounds from spatial index contains cursor
+			mActorsUnderCursor.Clear();
+			o2Scene.QueryPoint(sceneSpaceCursor, mActorsUnderCursor);
+
 			for (int i = startIdx; i >= 0; i--)
 			{
 				auto object = drawnObjects[i];
+
+				auto actor = dynamic_cast<Actor*>(object);
+				if (actor && actor->IsOnScene() && !mActorsUnderCursor.Contains(actor))
+					continue;
+
 				if (!object->IsLockedInHierarchy() && object->GetTransform().IsPointInside(sceneSpaceCursor))
 				{
 					mBeforeSelectingObjects = o2EditorSceneScreen.GetSelectedObjects();
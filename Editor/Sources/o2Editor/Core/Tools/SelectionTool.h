@@ -6,6 +6,7 @@ using namespace o2;
 
 namespace o2
 {
+	class Actor;
 	class Sprite;
 	class SceneEditableObject;
 }
@@ -32,6 +33,8 @@ namespace Editor
 		Vector<SceneEditableObject*> mCurrentSelectingObjects; // Current selecting objects (when cursor pressed, but not released yet)
 		Vector<SceneEditableObject*> mBeforeSelectingObjects;  // Before selection objects array
 
+		Vector<Actor*> mActorsUnderCursor; // Actors under cursor from scene spatial index. Buffer for picking
+
 		Vec2F mPressPoint;				 // Press point before selecting
 		bool  mSelectingObjects = false; // Is selecting objects now
 
@@ -91,6 +94,7 @@ CLASS_FIELDS_META(Editor::SelectionTool)
 	FIELD().PROTECTED().DEFAULT_VALUE(nullptr).NAME(mSelectionSprite);
 	FIELD().PROTECTED().NAME(mCurrentSelectingObjects);
 	FIELD().PROTECTED().NAME(mBeforeSelectingObjects);
+	FIELD().PROTECTED().NAME(mActorsUnderCursor);
 	FIELD().PROTECTED().NAME(mPressPoint);
 	FIELD().PROTECTED().DEFAULT_VALUE(false).NAME(mSelectingObjects);
 }
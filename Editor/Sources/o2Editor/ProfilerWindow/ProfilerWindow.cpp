@@ -0,0 +1,309 @@
+#include "o2Editor/stdafx.h"
+#include "ProfilerWindow.h"
+
+#include "o2/Application/Input.h"
+#include "o2/Render/Render.h"
+#include "o2/Render/Sprite.h"
+#include "o2/Render/Text.h"
+#include "o2/Scene/UI/UIManager.h"
+#include "o2/Scene/UI/WidgetLayer.h"
+#include "o2/Scene/UI/WidgetLayout.h"
+#include "o2/Scene/UI/Widgets/Button.h"
+#include "o2/Scene/UI/Widgets/Toggle.h"
+
+namespace Editor
+{
+	ProfilerWindow::ProfilerWindow()
+	{
+		InitializeWindow();
+	}
+
+	ProfilerWindow::~ProfilerWindow()
+	{}
+
+	void ProfilerWindow::InitializeWindow()
+	{
+		mWindow->caption = "Profiler";
+		mWindow->name = "profiler window";
+		mWindow->SetViewLayout(Layout::BothStretch(-2, 0, 0, 18));
+		mWindow->SetClippingLayout(Layout::BothStretch(-1, 0, 0, 18));
+
+		mTimeline = mnew TimelineView();
+		*mTimeline->layout = WidgetLayout::BothStretch(0, 20, 0, 0);
+		mWindow->AddChild(mTimeline);
+
+		Widget* downPanel = mnew Widget();
+		downPanel->AddLayer("back", mnew Sprite("ui/UI4_small_panel_down_back.png"),
+							Layout::BothStretch(-4, -5, -4, -5));
+		*downPanel->layout = WidgetLayout::HorStretch(VerAlign::Bottom, 0, 0, 20, 0);
+		mWindow->AddChild(downPanel);
+
+		mRecordToggle = o2UI.CreateWidget<Toggle>("menu record");
+		*mRecordToggle->layout = WidgetLayout::Based(BaseCorner::Left, Vec2F(20, 20), Vec2F(0, 0));
+		mRecordToggle->SetValue(o2Profiler.IsEnabled());
+		mRecordToggle->onToggleByUser = THIS_FUNC(OnRecordToggled);
+		downPanel->AddChild(mRecordToggle);
+
+		mPlayPauseToggle = o2UI.CreateWidget<Toggle>("menu play-stop");
+		*mPlayPauseToggle->layout = WidgetLayout::Based(BaseCorner::Left, Vec2F(20, 20), Vec2F(20, 0));
+		mPlayPauseToggle->SetValue(true);
+		mPlayPauseToggle->onToggleByUser = THIS_FUNC(OnPlayPauseToggled);
+		downPanel->AddChild(mPlayPauseToggle);
+
+		mTimeline->onPauseChanged = [&](bool paused) { mPlayPauseToggle->SetValue(!paused); };
+
+		auto saveButton = o2UI.CreateButton("Save trace", THIS_FUNC(OnSaveTracePressed));
+		*saveButton->layout = WidgetLayout::Based(BaseCorner::Left, Vec2F(100, 20), Vec2F(45, 0));
+		downPanel->AddChild(saveButton);
+	}
+
+	void ProfilerWindow::OnRecordToggled(bool value)
+	{
+		o2Profiler.SetEnabled(value);
+	}
+
+	void ProfilerWindow::OnPlayPauseToggled(bool value)
+	{
+		mTimeline->SetPaused(!value);
+	}
+
+	void ProfilerWindow::OnSaveTracePressed()
+	{
+		String path = "profiler_trace.json";
+		if (o2Profiler.SaveChromeTrace(path))
+			o2Debug.Log("Profiler trace saved to " + path + ", open it in chrome://tracing or Perfetto");
+		else
+			o2Debug.LogError("Can't save profiler trace to " + path);
+	}
+
+	ProfilerWindow::TimelineView::TimelineView():
+		Widget()
+	{
+		mRectSprite = mnew Sprite(Color4::White());
+
+		mText = mnew Text("stdFont.ttf");
+		mText->horAlign = HorAlign::Left;
+		mText->verAlign = VerAlign::Bottom;
+		mText->height = 8;
+
+		AddLayer("back", mnew Sprite("ui/UI4_dopesheet_back.png"), Layout::BothStretch(-3, -3, -3, -3))->transparency = 0.5f;
+	}
+
+	ProfilerWindow::TimelineView::~TimelineView()
+	{
+		delete mRectSprite;
+		delete mText;
+	}
+
+	void ProfilerWindow::TimelineView::Draw()
+	{
+		Widget::Draw();
+
+		RectF worldRect = layout->GetWorldRect();
+		o2Render.EnableScissorTest(worldRect);
+
+		RectF framesRect(worldRect.left, worldRect.top, worldRect.right, worldRect.top - mFramesHeight);
+		RectF zonesRect(worldRect.left, framesRect.bottom, worldRect.right, worldRect.bottom);
+
+		DrawFrames(framesRect);
+		DrawZones(zonesRect);
+
+		o2Render.DisableScissorTest();
+
+		CursorAreaEventsListener::OnDrawn();
+	}
+
+	void ProfilerWindow::TimelineView::Update(float dt)
+	{
+		Widget::Update(dt);
+
+		if (!mPaused && IsEnabledInHierarchy())
+			UpdateData();
+	}
+
+	void ProfilerWindow::TimelineView::SetPaused(bool paused)
+	{
+		if (mPaused == paused)
+			return;
+
+		mPaused = paused;
+		onPauseChanged(paused);
+	}
+
+	bool ProfilerWindow::TimelineView::IsPaused() const
+	{
+		return mPaused;
+	}
+
+	bool ProfilerWindow::TimelineView::IsUnderPoint(const Vec2F& point)
+	{
+		return Widget::IsUnderPoint(point);
+	}
+
+	String ProfilerWindow::TimelineView::GetCreateMenuCategory()
+	{
+		return "UI/Editor";
+	}
+
+	void ProfilerWindow::TimelineView::UpdateData()
+	{
+		mFrames = o2Profiler.GetFrames();
+		mThreads = o2Profiler.GetThreads();
+
+		if (!mPaused || mSelectedFrame < 0 || mSelectedFrame >= mFrames.Count())
+			mSelectedFrame = mFrames.Count() - 1;
+
+		if (mSelectedFrame >= 0)
+			mZones = o2Profiler.GetZones(mFrames[mSelectedFrame].begin, mFrames[mSelectedFrame].end);
+		else
+			mZones.Clear();
+	}
+
+	void ProfilerWindow::TimelineView::DrawFrames(const RectF& rect)
+	{
+		float barWidth = rect.Width()/(float)mFramesBarsCount;
+		float referenceHeight = rect.Height()*0.5f;
+
+		o2Render.DrawAALine(Vec2F(rect.left, rect.bottom + referenceHeight), Vec2F(rect.right, rect.bottom + referenceHeight),
+							mReferenceLineColor);
+
+		int firstFrame = Math::Max(0, mFrames.Count() - mFramesBarsCount);
+		for (int i = firstFrame; i < mFrames.Count(); i++)
+		{
+			float duration = (mFrames[i].end - mFrames[i].begin)/1000000000.0f;
+			float height = Math::Min(duration/mReferenceFrameTime*referenceHeight, rect.Height());
+			float left = rect.right - (mFrames.Count() - i)*barWidth;
+
+			DrawRect(RectF(left, rect.bottom + height, left + Math::Max(barWidth - 1.0f, 1.0f), rect.bottom),
+					 i == mSelectedFrame ? mSelectedFrameColor : mFrameColor);
+		}
+
+		if (mSelectedFrame >= 0)
+		{
+			const Profiler::Frame& frame = mFrames[mSelectedFrame];
+			String caption = "Frame " + (String)(int)frame.index + ": " +
+				(String)((frame.end - frame.begin)/1000000.0f) + " ms";
+
+			DrawCaption(caption, Vec2F(rect.left + 5.0f, rect.top - 12.0f), Color4(44, 62, 80));
+		}
+	}
+
+	void ProfilerWindow::TimelineView::DrawZones(const RectF& rect)
+	{
+		if (mSelectedFrame < 0)
+			return;
+
+		const Profiler::Frame& frame = mFrames[mSelectedFrame];
+		double frameDuration = (double)Math::Max(frame.end - frame.begin, (UInt64)1);
+		double timeToPixels = rect.Width()/frameDuration;
+
+		Vec2F cursorPos = o2Input.GetCursorPos();
+		const Profiler::Zone* hoveredZone = nullptr;
+		RectF hoveredZoneRect;
+
+		float laneTop = rect.top;
+		for (auto& thread : mThreads)
+		{
+			int maxDepth = -1;
+			for (auto& zone : mZones)
+			{
+				if (zone.threadId == thread.id)
+					maxDepth = Math::Max(maxDepth, zone.depth);
+			}
+
+			if (maxDepth < 0)
+				continue;
+
+			DrawCaption(thread.name, Vec2F(rect.left + 5.0f, laneTop - mThreadCaptionHeight + 4.0f), Color4(44, 62, 80));
+			laneTop -= mThreadCaptionHeight;
+
+			for (auto& zone : mZones)
+			{
+				if (zone.threadId != thread.id)
+					continue;
+
+				double begin = ((double)zone.begin - (double)frame.begin)*timeToPixels;
+				double end = ((double)zone.end - (double)frame.begin)*timeToPixels;
+
+				float top = laneTop - zone.depth*mZoneHeight;
+				RectF zoneRect(rect.left + (float)begin, top, rect.left + Math::Max((float)end, (float)begin + 1.0f),
+							   top - mZoneHeight + 1.0f);
+
+				DrawRect(zoneRect, GetZoneColor(zone.name));
+
+				if (zoneRect.Width() > 30.0f)
+					DrawCaption(zone.name, Vec2F(zoneRect.left + 2.0f, zoneRect.bottom + 3.0f), Color4(16, 20, 23));
+
+				if (zoneRect.IsInside(cursorPos))
+				{
+					hoveredZone = &zone;
+					hoveredZoneRect = zoneRect;
+				}
+			}
+
+			laneTop -= (maxDepth + 1)*mZoneHeight;
+		}
+
+		if (hoveredZone)
+		{
+			String caption = (String)hoveredZone->name + ": " + (String)((hoveredZone->end - hoveredZone->begin)/1000000.0f) + " ms";
+			o2Render.DrawAARectFrame(hoveredZoneRect, Color4::White());
+			DrawCaption(caption, cursorPos + Vec2F(10.0f, 10.0f), Color4::White());
+		}
+	}
+
+	void ProfilerWindow::TimelineView::DrawRect(const RectF& rect, const Color4& color)
+	{
+		mRectSprite->SetRect(rect);
+		mRectSprite->SetColor(color);
+		mRectSprite->Draw();
+	}
+
+	void ProfilerWindow::TimelineView::DrawCaption(const String& text, const Vec2F& position, const Color4& color)
+	{
+		mText->SetText(text);
+		mText->SetColor(color);
+		mText->SetPosition(position);
+		mText->Draw();
+	}
+
+	Color4 ProfilerWindow::TimelineView::GetZoneColor(const char* name)
+	{
+		UInt hash = 2166136261u;
+		for (const char* c = name; *c; c++)
+			hash = (hash ^ (UInt)*c)*16777619u;
+
+		return Color4(140 + (int)(hash%100), 140 + (int)((hash >> 8)%100), 140 + (int)((hash >> 16)%100), 255);
+	}
+
+	void ProfilerWindow::TimelineView::OnCursorPressed(const Input::Cursor& cursor)
+	{
+		SelectFrameAt(cursor.position);
+	}
+
+	void ProfilerWindow::TimelineView::OnCursorStillDown(const Input::Cursor& cursor)
+	{
+		SelectFrameAt(cursor.position);
+	}
+
+	void ProfilerWindow::TimelineView::SelectFrameAt(const Vec2F& position)
+	{
+		RectF worldRect = layout->GetWorldRect();
+		if (position.y < worldRect.top - mFramesHeight || mFrames.IsEmpty())
+			return;
+
+		float barWidth = worldRect.Width()/(float)mFramesBarsCount;
+		int frame = mFrames.Count() - 1 - (int)((worldRect.right - position.x)/barWidth);
+		if (frame < 0)
+			return;
+
+		SetPaused(true);
+
+		mSelectedFrame = frame;
+		mZones = o2Profiler.GetZones(mFrames[frame].begin, mFrames[frame].end);
+	}
+}
+
+DECLARE_CLASS(Editor::ProfilerWindow);
+
+DECLARE_CLASS(Editor::ProfilerWindow::TimelineView);
@@ -0,0 +1,211 @@
+#pragma once
+
+#include "o2/Events/CursorAreaEventsListener.h"
+#include "o2/Scene/UI/Widget.h"
+#include "o2/Utils/Debug/Profiler.h"
+#include "o2Editor/Core/WindowsSystem/IEditorWindow.h"
+
+using namespace o2;
+
+namespace o2
+{
+	class Sprite;
+	class Text;
+	class Toggle;
+}
+
+namespace Editor
+{
+	// -----------------------------------------------------------------------------------------------------
+	// Profiler window. Shows durations of last frames and timeline of selected frame zones, grouped by
+	// threads. Live view follows the last frame; clicking on frame pauses view on it. Trace can be saved as
+	// Chrome trace events JSON
+	// -----------------------------------------------------------------------------------------------------
+	class ProfilerWindow: public IEditorWindow
+	{
+		IOBJECT(ProfilerWindow);
+
+	public:
+		// ---------------------------------------------------------------------------------------------
+		// Profiler timeline view. Draws frames durations bars on top and zones of selected frame below,
+		// each thread has own lane, zones are placed by depth
+		// ---------------------------------------------------------------------------------------------
+		class TimelineView: public Widget, public CursorAreaEventsListener
+		{
+		public:
+			Function<void(bool)> onPauseChanged; // Called when view was paused or resumed
+
+		public:
+			// Default constructor
+			TimelineView();
+
+			// Destructor
+			~TimelineView();
+
+			// Draws frames and zones
+			void Draw() override;
+
+			// Updates frames and zones from profiler when view isn't paused
+			void Update(float dt) override;
+
+			// Sets view paused. Paused view keeps selected frame and doesn't update data
+			void SetPaused(bool paused);
+
+			// Returns is view paused
+			bool IsPaused() const;
+
+			// Returns true if point is in this object
+			bool IsUnderPoint(const Vec2F& point) override;
+
+			// Returns create menu category in editor
+			static String GetCreateMenuCategory();
+
+			SERIALIZABLE(TimelineView);
+
+		protected:
+			const int   mFramesBarsCount = 256;           // Count of frames bars in frames area
+			const float mFramesHeight = 60.0f;            // Height of frames durations bars area
+			const float mZoneHeight = 16.0f;              // Height of zone bar
+			const float mThreadCaptionHeight = 16.0f;     // Height of thread caption above thread zones
+			const float mReferenceFrameTime = 1.0f/60.0f; // Frame duration, drawn as half of frames area height
+
+			const Color4 mFrameColor = Color4(96, 125, 139);           // Frame bar color
+			const Color4 mSelectedFrameColor = Color4(235, 129, 52);   // Selected frame bar color
+			const Color4 mReferenceLineColor = Color4(16, 20, 23, 64); // Reference frame duration line color
+
+			Vector<Profiler::Frame>      mFrames;  // Last frames
+			Vector<Profiler::Zone>       mZones;   // Zones of selected frame
+			Vector<Profiler::ThreadInfo> mThreads; // Profiled threads
+
+			int  mSelectedFrame = -1; // Index of selected frame in mFrames
+			bool mPaused = false;     // Is view paused
+
+			Sprite* mRectSprite = nullptr; // Sprite, used for drawing bars
+			Text*   mText = nullptr;       // Text, used for drawing captions
+
+		protected:
+			// Gets last frames and selected frame zones from profiler
+			void UpdateData();
+
+			// Draws frames durations bars
+			void DrawFrames(const RectF& rect);
+
+			// Draws zones of selected frame by threads lanes
+			void DrawZones(const RectF& rect);
+
+			// Draws filled rectangle
+			void DrawRect(const RectF& rect, const Color4& color);
+
+			// Draws caption text at position
+			void DrawCaption(const String& text, const Vec2F& position, const Color4& color);
+
+			// Returns zone color, generated from name hash
+			static Color4 GetZoneColor(const char* name);
+
+			// Called when cursor pressed on this. Selects frame under cursor and pauses view
+			void OnCursorPressed(const Input::Cursor& cursor) override;
+
+			// Called when cursor stay down during frame. Selects frame under cursor
+			void OnCursorStillDown(const Input::Cursor& cursor) override;
+
+			// Selects frame under cursor position
+			void SelectFrameAt(const Vec2F& position);
+		};
+
+	public:
+		// Default constructor
+		ProfilerWindow();
+
+		// Destructor
+		~ProfilerWindow();
+
+	protected:
+		TimelineView* mTimeline = nullptr;        // Frames and zones timeline
+		Toggle*       mRecordToggle = nullptr;    // Profiler recording toggle
+		Toggle*       mPlayPauseToggle = nullptr; // Timeline live/paused toggle
+
+	protected:
+		// Initializes window
+		void InitializeWindow();
+
+		// Called when record toggled, enables or disables profiler
+		void OnRecordToggled(bool value);
+
+		// Called when play/pause toggled, pauses or resumes timeline
+		void OnPlayPauseToggled(bool value);
+
+		// Called when save trace button pressed. Saves Chrome trace
+		void OnSaveTracePressed();
+	};
+}
+
+CLASS_BASES_META(Editor::ProfilerWindow)
+{
+	BASE_CLASS(Editor::IEditorWindow);
+}
+END_META;
+CLASS_FIELDS_META(Editor::ProfilerWindow)
+{
+	FIELD().PROTECTED().DEFAULT_VALUE(nullptr).NAME(mTimeline);
+	FIELD().PROTECTED().DEFAULT_VALUE(nullptr).NAME(mRecordToggle);
+	FIELD().PROTECTED().DEFAULT_VALUE(nullptr).NAME(mPlayPauseToggle);
+}
+END_META;
+CLASS_METHODS_META(Editor::ProfilerWindow)
+{
+
+	FUNCTION().PUBLIC().CONSTRUCTOR();
+	FUNCTION().PROTECTED().SIGNATURE(void, InitializeWindow);
+	FUNCTION().PROTECTED().SIGNATURE(void, OnRecordToggled, bool);
+	FUNCTION().PROTECTED().SIGNATURE(void, OnPlayPauseToggled, bool);
+	FUNCTION().PROTECTED().SIGNATURE(void, OnSaveTracePressed);
+}
+END_META;
+
+CLASS_BASES_META(Editor::ProfilerWindow::TimelineView)
+{
+	BASE_CLASS(o2::Widget);
+	BASE_CLASS(o2::CursorAreaEventsListener);
+}
+END_META;
+CLASS_FIELDS_META(Editor::ProfilerWindow::TimelineView)
+{
+	FIELD().PUBLIC().NAME(onPauseChanged);
+	FIELD().PROTECTED().DEFAULT_VALUE(256).NAME(mFramesBarsCount);
+	FIELD().PROTECTED().DEFAULT_VALUE(60.0f).NAME(mFramesHeight);
+	FIELD().PROTECTED().DEFAULT_VALUE(16.0f).NAME(mZoneHeight);
+	FIELD().PROTECTED().DEFAULT_VALUE(16.0f).NAME(mThreadCaptionHeight);
+	FIELD().PROTECTED().DEFAULT_VALUE(1.0f/60.0f).NAME(mReferenceFrameTime);
+	FIELD().PROTECTED().DEFAULT_VALUE(Color4(96, 125, 139)).NAME(mFrameColor);
+	FIELD().PROTECTED().DEFAULT_VALUE(Color4(235, 129, 52)).NAME(mSelectedFrameColor);
+	FIELD().PROTECTED().DEFAULT_VALUE(Color4(16, 20, 23, 64)).NAME(mReferenceLineColor);
+	FIELD().PROTECTED().NAME(mFrames);
+	FIELD().PROTECTED().NAME(mZones);
+	FIELD().PROTECTED().NAME(mThreads);
+	FIELD().PROTECTED().DEFAULT_VALUE(-1).NAME(mSelectedFrame);
+	FIELD().PROTECTED().DEFAULT_VALUE(false).NAME(mPaused);
+	FIELD().PROTECTED().DEFAULT_VALUE(nullptr).NAME(mRectSprite);
+	FIELD().PROTECTED().DEFAULT_VALUE(nullptr).NAME(mText);
+}
+END_META;
+CLASS_METHODS_META(Editor::ProfilerWindow::TimelineView)
+{
+
+	FUNCTION().PUBLIC().CONSTRUCTOR();
+	FUNCTION().PUBLIC().SIGNATURE(void, Draw);
+	FUNCTION().PUBLIC().SIGNATURE(void, Update, float);
+	FUNCTION().PUBLIC().SIGNATURE(void, SetPaused, bool);
+	FUNCTION().PUBLIC().SIGNATURE(bool, IsPaused);
+	FUNCTION().PUBLIC().SIGNATURE(bool, IsUnderPoint, const Vec2F&);
+	FUNCTION().PUBLIC().SIGNATURE_STATIC(String, GetCreateMenuCategory);
+	FUNCTION().PROTECTED().SIGNATURE(void, UpdateData);
+	FUNCTION().PROTECTED().SIGNATURE(void, DrawFrames, const RectF&);
+	FUNCTION().PROTECTED().SIGNATURE(void, DrawZones, const RectF&);
+	FUNCTION().PROTECTED().SIGNATURE(void, DrawRect, const RectF&, const Color4&);
+	FUNCTION().PROTECTED().SIGNATURE(void, DrawCaption, const String&, const Vec2F&, const Color4&);
+	FUNCTION().PROTECTED().SIGNATURE_STATIC(Color4, GetZoneColor, const char*);
+	FUNCTION().PROTECTED().SIGNATURE(void, OnCursorPressed, const Input::Cursor&);
+	FUNCTION().PROTECTED().SIGNATURE(void, OnCursorStillDown, const Input::Cursor&);
+	FUNCTION().PROTECTED().SIGNATURE(void, SelectFrameAt, const Vec2F&);
+}
+END_META;
@@ -217,6 +217,8 @@ namespace Editor
 				if (!layer->visible)
 					continue;
 
+				layer->UpdateDrawablesOrder();
+
 				for (auto drw : layer->GetEnabledDrawables())
 					drw->Draw();
 			}
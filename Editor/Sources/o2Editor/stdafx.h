@@ -35,6 +35,7 @@
 #include "o2/Render/ParticlesEffects.h"
 #include "o2/Render/ParticlesEmitter.h"
 #include "o2/Render/ParticlesEmitterShapes.h"
+#include "o2/Render/ParticlesPool.h"
 #include "o2/Render/RectDrawable.h"
 #include "o2/Render/Texture.h"
 #include "o2/Render/TextureRef.h"
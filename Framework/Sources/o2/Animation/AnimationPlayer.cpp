@@ -3,6 +3,7 @@
 
 #include "o2/Animation/AnimationClip.h"
 #include "o2/Animation/AnimationState.h"
+#include "o2/Animation/BakedAnimationTrackPlayer.h"
 #include "o2/Utils/Debug/Debug.h"
 
 namespace o2
@@ -63,6 +64,24 @@ namespace o2
 		return mClip;
 	}
 
+	void AnimationPlayer::SetBakedClip(const BakedAnimationClip* clip)
+	{
+		// Empty baked clip hasn't tracks to play, so tracks aren't rebound for it
+		if (clip && clip->IsEmpty())
+			clip = nullptr;
+
+		if (mBakedClip == clip)
+			return;
+
+		mBakedClip = clip;
+		BindTracks(true);
+	}
+
+	const BakedAnimationClip* AnimationPlayer::GetBakedClip() const
+	{
+		return mBakedClip;
+	}
+
 	const Vector<IAnimationTrack::IPlayer*>& AnimationPlayer::GetTrackPlayers() const
 	{
 		return mTrackPlayers;
@@ -78,17 +97,30 @@ namespace o2
 
 		mTrackPlayers.Clear();
 
-		if (!mTarget || !mClip)
+		if (!mTarget || (!mClip && !mBakedClip))
 			return;
 
 		const ObjectType* type = dynamic_cast<const ObjectType*>(&mTarget->GetType());
 		void* castedTarget = type->DynamicCastFromIObject(mTarget);
 
-		for (auto track : mClip->mTracks)
-			BindTrack(type, castedTarget, track, errors);
+		if (mClip)
+		{
+			for (auto track : mClip->mTracks)
+				BindTrack(type, castedTarget, track, errors);
+		}
+
+		if (mBakedClip)
+		{
+			for (auto track : mBakedClip->GetTracks())
+			{
+				if (!mClip || !mClip->mTracks.Contains([&](IAnimationTrack* x) { return x->path == track->path; }))
+					BindBakedTrack(type, castedTarget, track, errors);
+			}
+		}
 
-		mLoop = mClip->mLoop;
-		mDuration = mClip->GetDuration();
+		// Baked clip keeps duration of source clip, remaining source tracks can be shorter
+		mLoop = mClip ? mClip->mLoop : mBakedClip->GetLoop();
+		mDuration = Math::Max(mClip ? mClip->GetDuration() : 0.0f, mBakedClip ? mBakedClip->GetDuration() : 0.0f);
 		mBeginTime = 0.0f;
 		mEndTime = mDuration;
 	}
@@ -120,11 +152,68 @@ namespace o2
 		}
 	}
 
+	void AnimationPlayer::BindBakedTrack(const ObjectType* type, void* castedTarget,
+										 const BakedAnimationClip::Track* track, bool errors)
+	{
+		const FieldInfo* fieldInfo = nullptr;
+		auto targetPtr = type->GetFieldPtr(castedTarget, track->path, fieldInfo);
+
+		if (!fieldInfo)
+		{
+			if (errors)
+				o2Debug.LogWarning("Can't find '" + track->path + "' for animating");
+
+			return;
+		}
+
+		const Type* fieldType = fieldInfo->GetType();
+		bool isProperty = fieldType->GetUsage() == Type::Usage::Property;
+		const Type* valueType = isProperty ? dynamic_cast<const PropertyType*>(fieldType)->GetValueType() : fieldType;
+
+		IAnimationTrack::IPlayer* trackPlayer = nullptr;
+		if (track->components == 1 && valueType == &TypeOf(float))
+			trackPlayer = mnew BakedAnimationTrackPlayer<float>(track);
+		else if (track->components == 2 && valueType == &TypeOf(Vec2F))
+			trackPlayer = mnew BakedAnimationTrackPlayer<Vec2F>(track);
+		else if (track->components == 4 && valueType == &TypeOf(Color4))
+			trackPlayer = mnew BakedAnimationTrackPlayer<Color4>(track);
+		else
+		{
+			if (errors)
+				o2Debug.LogWarning("Can't animate '" + track->path + "': value type doesn't match baked track");
+
+			return;
+		}
+
+		trackPlayer->mOwnerPlayer = this;
+
+		if (isProperty)
+			trackPlayer->SetTargetProxyVoid(fieldType->GetValueProxy(targetPtr));
+		else
+			trackPlayer->SetTargetVoid(targetPtr);
+
+		mTrackPlayers.Add(trackPlayer);
+
+		onTrackPlayerAdded(trackPlayer);
+	}
+
 	void AnimationPlayer::OnClipTrackAdded(IAnimationTrack* track)
 	{
 		const ObjectType* type = dynamic_cast<const ObjectType*>(&mTarget->GetType());
 		void* castedTarget = type->DynamicCastFromIObject(mTarget);
 
+		// Source track replaces baked track with same path
+		auto bakedPlayer = mTrackPlayers.FindOrDefault([&](IAnimationTrack::IPlayer* x) {
+			return !x->GetTrack() && x->GetTrackPath() == track->path;
+		});
+
+		if (bakedPlayer)
+		{
+			onTrackPlayerRemove(bakedPlayer);
+			mTrackPlayers.Remove(bakedPlayer);
+			delete bakedPlayer;
+		}
+
 		BindTrack(type, castedTarget, track, false);
 	}
 
@@ -135,8 +224,8 @@ namespace o2
 
 	void AnimationPlayer::OnClipDurationChanged(float duration)
 	{
-		mDuration = duration;
-		mEndTime = duration;
+		mDuration = mBakedClip ? Math::Max(duration, mBakedClip->GetDuration()) : duration;
+		mEndTime = mDuration;
 	}
 
 	void AnimationPlayer::Evaluate()
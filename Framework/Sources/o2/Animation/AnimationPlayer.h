@@ -1,4 +1,5 @@
 #pragma once
+#include "o2/Animation/BakedAnimationClip.h"
 #include "o2/Animation/IAnimation.h"
 #include "o2/Animation/Tracks/IAnimationTrack.h"
 
@@ -6,9 +7,9 @@ namespace o2
 {
 	class AnimationClip;
 
-	// ---------------------
-	// Animation clip player
-	// ---------------------
+	// ---------------------------------------------------------------------------------------------------------
+	// Animation clip player. Plays source clip tracks and baked clip tracks, which source tracks aren't in clip
+	// ---------------------------------------------------------------------------------------------------------
 	class AnimationPlayer: public IAnimation
 	{
 	public:
@@ -35,16 +36,24 @@ namespace o2
 		// Returns animation clip
 		AnimationClip* GetClip() const;
 
+		// Sets baked animation clip. Baked tracks are played when clip doesn't contain source tracks with same paths,
+		// source tracks are stripped from built animations. Empty baked clip is ignored
+		void SetBakedClip(const BakedAnimationClip* clip);
+
+		// Returns baked animation clip
+		const BakedAnimationClip* GetBakedClip() const;
+
 		// Returns track players list
 		const Vector<IAnimationTrack::IPlayer*>& GetTrackPlayers() const;
 
 		IOBJECT(AnimationPlayer);
 
 	protected:
-		AnimationClip*  mClip = nullptr;           // Animation clip
-		bool            mClipOwner = false;        // Is animation clip owned by this player
-		IObject*        mTarget = nullptr;         // Target object
-		AnimationState* mAnimationState = nullptr; // Animation state owner
+		AnimationClip*            mClip = nullptr;           // Animation clip
+		bool                      mClipOwner = false;        // Is animation clip owned by this player
+		const BakedAnimationClip* mBakedClip = nullptr;      // Baked animation clip
+		IObject*                  mTarget = nullptr;         // Target object
+		AnimationState*           mAnimationState = nullptr; // Animation state owner
 
 		Vector<IAnimationTrack::IPlayer*> mTrackPlayers; // Animation clip track players
 
@@ -58,6 +67,10 @@ namespace o2
 		// Binds animation track
 		void BindTrack(const ObjectType* type, void* castedTarget, IAnimationTrack* track, bool errors);
 
+		// Binds baked animation track
+		void BindBakedTrack(const ObjectType* type, void* castedTarget, const BakedAnimationClip::Track* track,
+							bool errors);
+
 		// Called when added new track in clip
 		void OnClipTrackAdded(IAnimationTrack* track);
 
@@ -83,6 +96,7 @@ CLASS_FIELDS_META(o2::AnimationPlayer)
 	FIELD().PUBLIC().NAME(onTrackPlayerRemove);
 	FIELD().PROTECTED().DEFAULT_VALUE(nullptr).NAME(mClip);
 	FIELD().PROTECTED().DEFAULT_VALUE(false).NAME(mClipOwner);
+	FIELD().PROTECTED().DEFAULT_VALUE(nullptr).NAME(mBakedClip);
 	FIELD().PROTECTED().DEFAULT_VALUE(nullptr).NAME(mTarget);
 	FIELD().PROTECTED().DEFAULT_VALUE(nullptr).NAME(mAnimationState);
 	FIELD().PROTECTED().NAME(mTrackPlayers);
@@ -96,10 +110,13 @@ CLASS_METHODS_META(o2::AnimationPlayer)
 	FUNCTION().PUBLIC().SIGNATURE(IObject*, GetTarget);
 	FUNCTION().PUBLIC().SIGNATURE(void, SetClip, AnimationClip*, bool);
 	FUNCTION().PUBLIC().SIGNATURE(AnimationClip*, GetClip);
+	FUNCTION().PUBLIC().SIGNATURE(void, SetBakedClip, const BakedAnimationClip*);
+	FUNCTION().PUBLIC().SIGNATURE(const BakedAnimationClip*, GetBakedClip);
 	FUNCTION().PUBLIC().SIGNATURE(const Vector<IAnimationTrack::IPlayer*>&, GetTrackPlayers);
 	FUNCTION().PROTECTED().SIGNATURE(void, Evaluate);
 	FUNCTION().PROTECTED().SIGNATURE(void, BindTracks, bool);
 	FUNCTION().PROTECTED().SIGNATURE(void, BindTrack, const ObjectType*, void*, IAnimationTrack*, bool);
+	FUNCTION().PROTECTED().SIGNATURE(void, BindBakedTrack, const ObjectType*, void*, const BakedAnimationClip::Track*, bool);
 	FUNCTION().PROTECTED().SIGNATURE(void, OnClipTrackAdded, IAnimationTrack*);
 	FUNCTION().PROTECTED().SIGNATURE(void, OnClipTrackRemove, IAnimationTrack*);
 	FUNCTION().PROTECTED().SIGNATURE(void, OnClipDurationChanged, float);
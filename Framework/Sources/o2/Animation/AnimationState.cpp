@@ -25,6 +25,7 @@ namespace o2
 	void AnimationState::SetAnimation(const AnimationAssetRef& animationAsset)
 	{
 		mAnimation = animationAsset;
+		player.SetBakedClip(mAnimation ? &mAnimation->baked : nullptr);
 		player.SetClip(mAnimation ? &mAnimation->animation : nullptr);
 	}
 
@@ -35,6 +36,7 @@ namespace o2
 
 	void AnimationState::OnAnimationChanged()
 	{
+		player.SetBakedClip(mAnimation ? &mAnimation->baked : nullptr);
 		player.SetClip(mAnimation ? &mAnimation->animation : nullptr);
 	}
 
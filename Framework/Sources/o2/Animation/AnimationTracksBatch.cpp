@@ -0,0 +1,373 @@
+#include "o2/stdafx.h"
+#include "AnimationTracksBatch.h"
+
+#include "o2/Utils/Math/Math.h"
+#include "o2/Utils/Tools/KeySearch.h"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#define O2_ANIMATION_SSE
+#include <emmintrin.h>
+#endif
+
+namespace o2
+{
+	static thread_local AnimationTracksBatch* recordingBatch = nullptr;
+
+	// Returns left index of approximation segment, that contains position. Approximation values are sorted by
+	// positions, so segment is found by count of positions less than position, like SearchKey does
+	template<typename _approximationType>
+	static int FindApproximationSegment(const _approximationType* values, int count, float position)
+	{
+		int less = 0;
+		int i = 0;
+
+#if defined(O2_ANIMATION_SSE)
+		static const int bitsCount[16] = { 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4 };
+
+		const __m128 pos = _mm_set1_ps(position);
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128 positions = _mm_set_ps(values[i + 3].position, values[i + 2].position,
+										  values[i + 1].position, values[i].position);
+
+			less += bitsCount[_mm_movemask_ps(_mm_cmplt_ps(positions, pos))];
+		}
+#endif
+
+		for (; i < count; i++)
+			less += values[i].position < position ? 1 : 0;
+
+		return Math::Clamp(less, 1, count - 1) - 1;
+	}
+
+	AnimationTracksBatch::AnimationTracksBatch()
+	{}
+
+	AnimationTracksBatch::~AnimationTracksBatch()
+	{
+		EndRecording();
+	}
+
+	void AnimationTracksBatch::BeginRecording()
+	{
+		recordingBatch = this;
+	}
+
+	void AnimationTracksBatch::EndRecording()
+	{
+		if (recordingBatch == this)
+			recordingBatch = nullptr;
+	}
+
+	AnimationTracksBatch* AnimationTracksBatch::GetRecording()
+	{
+		return recordingBatch;
+	}
+
+	void AnimationTracksBatch::Add(AnimationTrack<float>::Player* player)
+	{
+		mFloatPlayers.Add(player);
+	}
+
+	void AnimationTracksBatch::Add(AnimationTrack<Vec2F>::Player* player)
+	{
+		mVec2Players.Add(player);
+	}
+
+	void AnimationTracksBatch::Add(AnimationTrack<Color4>::Player* player)
+	{
+		mColorPlayers.Add(player);
+	}
+
+	void AnimationTracksBatch::Evaluate()
+	{
+		mLastEvaluatedCount = GetPlayersCount();
+
+		if (!mFloatPlayers.IsEmpty() || !mVec2Players.IsEmpty())
+		{
+			GatherCurves();
+			InterpolateSegments(mBatch.Data(), mBatchCapacity, mFloatPlayers.Count() + mVec2Players.Count(), 1);
+
+			ScatterCurvesGatherSplines();
+
+			if (!mVec2Players.IsEmpty())
+			{
+				InterpolateSegments(mBatch.Data(), mBatchCapacity, mVec2Players.Count(), 2);
+				ScatterSplines();
+			}
+		}
+
+		if (!mColorPlayers.IsEmpty())
+			EvaluateColors();
+
+		Clear();
+	}
+
+	void AnimationTracksBatch::Clear()
+	{
+		mFloatPlayers.Clear();
+		mVec2Players.Clear();
+		mColorPlayers.Clear();
+	}
+
+	int AnimationTracksBatch::GetPlayersCount() const
+	{
+		return mFloatPlayers.Count() + mVec2Players.Count() + mColorPlayers.Count();
+	}
+
+	int AnimationTracksBatch::GetLastEvaluatedCount() const
+	{
+		return mLastEvaluatedCount;
+	}
+
+	void AnimationTracksBatch::ReserveBatch(int count)
+	{
+		int capacity = (count + 3) & ~3;
+		if (capacity <= mBatchCapacity)
+			return;
+
+		mBatchCapacity = capacity;
+		mBatch.Resize(mBatchCapacity*ChannelsCount);
+	}
+
+	float* AnimationTracksBatch::GetChannel(Channel channel)
+	{
+		return mBatch.Data() + channel*mBatchCapacity;
+	}
+
+	template<typename _playerType, typename _valueType>
+	void AnimationTracksBatch::SetPlayerValue(_playerType* player, const _valueType& value)
+	{
+		player->mCurrentValue = value;
+		player->mPrevInDurationTime = player->mInDurationTime;
+
+		if (player->mTarget)
+		{
+			*player->mTarget = value;
+			player->mTargetDelegate();
+		}
+		else if (player->mTargetProxy)
+			player->mTargetProxy->SetValue(value);
+	}
+
+	void AnimationTracksBatch::GatherCurves()
+	{
+		int floatsCount = mFloatPlayers.Count();
+		ReserveBatch(floatsCount + mVec2Players.Count());
+
+		for (int i = 0; i < floatsCount; i++)
+		{
+			auto player = mFloatPlayers[i];
+			GatherCurveSegment(player->mTrack->curve, player->mInDurationTime,
+							   player->mInDurationTime > player->mPrevInDurationTime,
+							   player->mPrevKey, player->mPrevKeyApproximation, i);
+		}
+
+		for (int i = 0; i < mVec2Players.Count(); i++)
+		{
+			auto player = mVec2Players[i];
+			GatherCurveSegment(player->mTrack->timeCurve, player->mInDurationTime,
+							   player->mInDurationTime > player->mPrevInDurationTime,
+							   player->mPrevTimeKey, player->mPrevTimeKeyApproximation, floatsCount + i);
+		}
+	}
+
+	void AnimationTracksBatch::GatherCurveSegment(const Curve& curve, float position, bool direction, int& cacheKey,
+												  int& cacheKeyApprox, int idx)
+	{
+		float* ch[ChannelsCount];
+		for (int i = 0; i < ChannelsCount; i++)
+			ch[i] = GetChannel((Channel)i);
+
+		const auto& keys = curve.GetKeys();
+		int count = keys.Count();
+
+		// Constant value is written as segment with equal values
+		if (count < 2)
+		{
+			float value = count == 1 ? keys[0].value : 0.0f;
+
+			ch[Position][idx] = 0.0f; ch[BeginPosition][idx] = 0.0f; ch[EndPosition][idx] = 1.0f;
+			ch[BeginX][idx] = value;  ch[EndX][idx] = value;
+			return;
+		}
+
+		int keyLeftIdx = -1, keyRightIdx = -1;
+		SearchKey(keys, count, position, keyLeftIdx, keyRightIdx, direction, cacheKey);
+
+		const Curve::Key& rightKey = keys[keyRightIdx];
+		int segLeftIdx = FindApproximationSegment(rightKey.mApproxValues, Curve::Key::mApproxValuesCount, position);
+		cacheKeyApprox = segLeftIdx;
+
+		const ApproximationValue& segLeft = rightKey.mApproxValues[segLeftIdx];
+		const ApproximationValue& segRight = rightKey.mApproxValues[segLeftIdx + 1];
+
+		ch[Position][idx] = position;
+		ch[BeginPosition][idx] = segLeft.position; ch[EndPosition][idx] = segRight.position;
+		ch[BeginX][idx] = segLeft.value;           ch[EndX][idx] = segRight.value;
+	}
+
+	void AnimationTracksBatch::ScatterCurvesGatherSplines()
+	{
+		int floatsCount = mFloatPlayers.Count();
+
+		float* ch[ChannelsCount];
+		for (int i = 0; i < ChannelsCount; i++)
+			ch[i] = GetChannel((Channel)i);
+
+		for (int i = 0; i < floatsCount; i++)
+			SetPlayerValue(mFloatPlayers[i], ch[ResultX][i]);
+
+		// Splines segments are written from the beginning of batch, evaluated time curves are always after them
+		for (int i = 0; i < mVec2Players.Count(); i++)
+		{
+			auto player = mVec2Players[i];
+			const Spline& spline = player->mTrack->spline;
+			const auto& keys = spline.GetKeys();
+			int count = keys.Count();
+
+			float position = ch[ResultX][floatsCount + i]*spline.Length();
+			bool direction = player->mInDurationTime > player->mPrevInDurationTime;
+
+			int keyLeftIdx = -1, keyRightIdx = -1;
+			if (count > 1)
+			{
+				if (spline.IsClosed())
+					SearchKeyClosed(keys, count, position, keyLeftIdx, keyRightIdx, direction, player->mPrevSplineKey);
+				else
+					SearchKey(keys, count, position, keyLeftIdx, keyRightIdx, direction, player->mPrevSplineKey);
+			}
+
+			if (keyLeftIdx < 0)
+			{
+				Vec2F value = count == 1 ? keys[0].value : Vec2F();
+
+				ch[Position][i] = 0.0f; ch[BeginPosition][i] = 0.0f; ch[EndPosition][i] = 1.0f;
+				ch[BeginX][i] = value.x; ch[BeginY][i] = value.y;
+				ch[EndX][i] = value.x;   ch[EndY][i] = value.y;
+				continue;
+			}
+
+			const Spline::Key& rightKey = keys[keyRightIdx];
+			int segLeftIdx = FindApproximationSegment(rightKey.mApproxValues, Spline::Key::mApproxValuesCount, position);
+			player->mPrevSplineKeyApproximation = segLeftIdx;
+
+			const ApproximationVec2F& segLeft = rightKey.mApproxValues[segLeftIdx];
+			const ApproximationVec2F& segRight = rightKey.mApproxValues[segLeftIdx + 1];
+
+			ch[Position][i] = position;
+			ch[BeginPosition][i] = segLeft.position; ch[EndPosition][i] = segRight.position;
+			ch[BeginX][i] = segLeft.value.x;         ch[BeginY][i] = segLeft.value.y;
+			ch[EndX][i] = segRight.value.x;          ch[EndY][i] = segRight.value.y;
+		}
+	}
+
+	void AnimationTracksBatch::ScatterSplines()
+	{
+		const float* resultX = GetChannel(ResultX);
+		const float* resultY = GetChannel(ResultY);
+
+		for (int i = 0; i < mVec2Players.Count(); i++)
+			SetPlayerValue(mVec2Players[i], Vec2F(resultX[i], resultY[i]));
+	}
+
+	void AnimationTracksBatch::EvaluateColors()
+	{
+		int count = mColorPlayers.Count();
+
+		mColorsBegin.Resize(count);
+		mColorsEnd.Resize(count);
+		mColorsCoefs.Resize(count);
+		mColorsResult.Resize(count);
+
+		for (int i = 0; i < count; i++)
+		{
+			auto player = mColorPlayers[i];
+			const auto& keys = player->mTrack->GetKeys();
+			int keysCount = keys.Count();
+
+			mColorsCoefs[i] = 0.0f;
+
+			if (keysCount < 2)
+			{
+				mColorsBegin[i] = keysCount == 1 ? keys[0].value : Color4();
+				mColorsEnd[i] = mColorsBegin[i];
+				continue;
+			}
+
+			int keyLeftIdx = -1, keyRightIdx = -1;
+			SearchKey(keys, keysCount, player->mInDurationTime, keyLeftIdx, keyRightIdx,
+					  player->mInDurationTime > player->mPrevInDurationTime, player->mPrevKey);
+
+			const auto& leftKey = keys[keyLeftIdx];
+			const auto& rightKey = keys[keyRightIdx];
+
+			mColorsBegin[i] = leftKey.value;
+			mColorsEnd[i] = rightKey.value;
+			mColorsCoefs[i] = (player->mInDurationTime - leftKey.position)/(rightKey.position - leftKey.position);
+		}
+
+		InterpolateColors(mColorsBegin.Data(), mColorsEnd.Data(), mColorsCoefs.Data(), mColorsResult.Data(), count);
+
+		for (int i = 0; i < count; i++)
+			SetPlayerValue(mColorPlayers[i], mColorsResult[i]);
+	}
+
+	void AnimationTracksBatch::InterpolateSegments(float* batch, int capacity, int count, int components)
+	{
+		// Calculations order is the same as in Math::Lerp, so results are equal to tracks evaluation
+		float* ch[ChannelsCount];
+		for (int i = 0; i < ChannelsCount; i++)
+			ch[i] = batch + i*capacity;
+
+#if defined(O2_ANIMATION_SSE)
+		// Capacity is multiple of 4, tail values of last pack are calculated and ignored
+		for (int i = 0; i < count; i += 4)
+		{
+			__m128 begin = _mm_loadu_ps(ch[BeginPosition] + i);
+			__m128 coef = _mm_div_ps(_mm_sub_ps(_mm_loadu_ps(ch[Position] + i), begin),
+									 _mm_sub_ps(_mm_loadu_ps(ch[EndPosition] + i), begin));
+
+			__m128 bx = _mm_loadu_ps(ch[BeginX] + i);
+			_mm_storeu_ps(ch[ResultX] + i, _mm_add_ps(_mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(ch[EndX] + i), bx), coef), bx));
+
+			if (components > 1)
+			{
+				__m128 by = _mm_loadu_ps(ch[BeginY] + i);
+				_mm_storeu_ps(ch[ResultY] + i, _mm_add_ps(_mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(ch[EndY] + i), by), coef), by));
+			}
+		}
+#else
+		for (int i = 0; i < count; i++)
+		{
+			float coef = (ch[Position][i] - ch[BeginPosition][i])/(ch[EndPosition][i] - ch[BeginPosition][i]);
+			ch[ResultX][i] = Math::Lerp(ch[BeginX][i], ch[EndX][i], coef);
+
+			if (components > 1)
+				ch[ResultY][i] = Math::Lerp(ch[BeginY][i], ch[EndY][i], coef);
+		}
+#endif
+	}
+
+	void AnimationTracksBatch::InterpolateColors(const Color4* begin, const Color4* end, const float* coefs,
+												 Color4* result, int count)
+	{
+#if defined(O2_ANIMATION_SSE)
+		// Color channels are four integers, one color is interpolated by one pack. Multiplication result is
+		// truncated like in Color4 operator*
+		static_assert(sizeof(Color4) == sizeof(__m128i), "Color4 must be four integers");
+
+		for (int i = 0; i < count; i++)
+		{
+			__m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin + i));
+			__m128i e = _mm_loadu_si128(reinterpret_cast<const __m128i*>(end + i));
+			__m128 delta = _mm_mul_ps(_mm_cvtepi32_ps(_mm_sub_epi32(e, b)), _mm_set1_ps(coefs[i]));
+
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(result + i), _mm_add_epi32(_mm_cvttps_epi32(delta), b));
+		}
+#else
+		for (int i = 0; i < count; i++)
+			result[i] = Math::Lerp(begin[i], end[i], coefs[i]);
+#endif
+	}
+}
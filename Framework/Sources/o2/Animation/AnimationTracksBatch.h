@@ -0,0 +1,118 @@
+#pragma once
+
+#include "o2/Animation/Tracks/AnimationColor4Track.h"
+#include "o2/Animation/Tracks/AnimationFloatTrack.h"
+#include "o2/Animation/Tracks/AnimationVec2FTrack.h"
+#include "o2/Utils/Types/Containers/Vector.h"
+
+namespace o2
+{
+	// ------------------------------------------------------------------------------------------------------------
+	// Batched evaluation of float, Vec2F and Color4 animation tracks players. While batch is recording on thread,
+	// players evaluated on this thread don't calculate values, they are collected into per-type lists. Then all
+	// collected players are evaluated at once: keys are found by cached search, curves segments are found in keys
+	// approximations by SIMD comparison, segments are gathered into contiguous arrays and interpolated by packs of
+	// four with SIMD. Results are scattered into players and their targets in collecting order
+	// ------------------------------------------------------------------------------------------------------------
+	class AnimationTracksBatch
+	{
+	public:
+		// Default constructor
+		AnimationTracksBatch();
+
+		// Destructor. Stops recording
+		~AnimationTracksBatch();
+
+		// Starts collecting players evaluated on current thread
+		void BeginRecording();
+
+		// Stops collecting players on current thread
+		void EndRecording();
+
+		// Returns batch, that is recording on current thread, or null
+		static AnimationTracksBatch* GetRecording();
+
+		// Adds float track player for evaluation
+		void Add(AnimationTrack<float>::Player* player);
+
+		// Adds Vec2F track player for evaluation
+		void Add(AnimationTrack<Vec2F>::Player* player);
+
+		// Adds Color4 track player for evaluation
+		void Add(AnimationTrack<Color4>::Player* player);
+
+		// Evaluates collected players, assigns their targets and clears lists
+		void Evaluate();
+
+		// Removes collected players without evaluation
+		void Clear();
+
+		// Returns count of collected players
+		int GetPlayersCount() const;
+
+		// Returns count of players evaluated on last evaluation
+		int GetLastEvaluatedCount() const;
+
+	protected:
+		// ------------------------------------------------------------------------------------------
+		// Segments batch channels. Each channel is contiguous array of values for segments. Value is
+		// interpolated from begin to end by position between begin and end positions
+		// ------------------------------------------------------------------------------------------
+		enum Channel
+		{
+			Position, BeginPosition, EndPosition, BeginX, BeginY, EndX, EndY, ResultX, ResultY,
+
+			ChannelsCount
+		};
+
+	protected:
+		Vector<AnimationTrack<float>::Player*>  mFloatPlayers; // Collected float tracks players
+		Vector<AnimationTrack<Vec2F>::Player*>  mVec2Players;  // Collected Vec2F tracks players
+		Vector<AnimationTrack<Color4>::Player*> mColorPlayers; // Collected Color4 tracks players
+
+		Vector<float> mBatch;             // Segments channels values. Channel starts at channel index * batch capacity
+		int           mBatchCapacity = 0; // Capacity of one batch channel, multiple of 4
+
+		Vector<Color4> mColorsBegin;  // Color tracks left keys values
+		Vector<Color4> mColorsEnd;    // Color tracks right keys values
+		Vector<float>  mColorsCoefs;  // Color tracks interpolation coefficients
+		Vector<Color4> mColorsResult; // Color tracks interpolated values
+
+		int mLastEvaluatedCount = 0; // Count of players evaluated on last evaluation
+
+	protected:
+		// Reserves segments channels for count of segments
+		void ReserveBatch(int count);
+
+		// Returns pointer to segments channel values
+		float* GetChannel(Channel channel);
+
+		// Finds float curves segments for float players and Vec2F players time curves. Vec2F players segments are
+		// placed after float players segments
+		void GatherCurves();
+
+		// Writes float players values and finds Vec2F players splines segments by evaluated time curves
+		void ScatterCurvesGatherSplines();
+
+		// Writes Vec2F players values
+		void ScatterSplines();
+
+		// Evaluates Color4 players
+		void EvaluateColors();
+
+		// Finds curve segment for player position and writes it into batch at index
+		void GatherCurveSegment(const Curve& curve, float position, bool direction, int& cacheKey, int& cacheKeyApprox,
+								int idx);
+
+		// Sets player current value and assigns target
+		template<typename _playerType, typename _valueType>
+		static void SetPlayerValue(_playerType* player, const _valueType& value);
+
+		// Interpolates count of segments. Interpolates only X channel when components count is 1, or X and Y channels
+		static void InterpolateSegments(float* batch, int capacity, int count, int components);
+
+		// Interpolates count of colors by coefficients with colors integer rounding
+		static void InterpolateColors(const Color4* begin, const Color4* end, const float* coefs, Color4* result,
+									  int count);
+	};
+}
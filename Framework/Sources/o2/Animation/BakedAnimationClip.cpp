@@ -0,0 +1,397 @@
+#include "o2/stdafx.h"
+#include "BakedAnimationClip.h"
+
+#include "o2/Animation/AnimationClip.h"
+#include "o2/Animation/Tracks/AnimationColor4Track.h"
+#include "o2/Animation/Tracks/AnimationFloatTrack.h"
+#include "o2/Animation/Tracks/AnimationVec2FTrack.h"
+
+namespace o2
+{
+	bool BakedAnimationClip::Track::IsQuantized() const
+	{
+		return !quantizedValues.IsEmpty();
+	}
+
+	float BakedAnimationClip::Track::GetSampleValue(int sample, int component) const
+	{
+		int idx = sample*components + component;
+
+		if (quantizedValues.IsEmpty())
+			return values[idx];
+
+		UInt packed = quantizedValues[idx >> 1];
+		UInt quantized = (idx & 1) ? packed >> 16 : packed & 0xFFFF;
+
+		return rangeMin[component] + quantized*rangeScale[component];
+	}
+
+	void BakedAnimationClip::Track::Evaluate(float time, float* result, int& cacheKey) const
+	{
+		if (samplesCount < 2)
+		{
+			for (int i = 0; i < components; i++)
+				result[i] = samplesCount == 1 ? GetSampleValue(0, i) : 0.0f;
+
+			return;
+		}
+
+		int left = 0;
+		float coef = 0.0f;
+
+		if (times.IsEmpty())
+		{
+			float position = sampleInterval > 0.0f ? time/sampleInterval : 0.0f;
+			left = Math::Clamp((int)floorf(position), 0, samplesCount - 2);
+			coef = Math::Clamp01(position - (float)left);
+		}
+		else
+		{
+			left = Math::Clamp(cacheKey, 0, samplesCount - 2);
+
+			while (left > 0 && times[left] > time)
+				left--;
+
+			while (left < samplesCount - 2 && times[left + 1] < time)
+				left++;
+
+			cacheKey = left;
+			coef = Math::Clamp01((time - times[left])/(times[left + 1] - times[left]));
+		}
+
+		for (int i = 0; i < components; i++)
+			result[i] = Math::Lerp(GetSampleValue(left, i), GetSampleValue(left + 1, i), coef);
+	}
+
+	UInt64 BakedAnimationClip::Track::GetMemorySize() const
+	{
+		return sizeof(Track) + path.Length() +
+			(times.Count() + values.Count() + rangeMin.Count() + rangeScale.Count())*sizeof(float) +
+			quantizedValues.Count()*sizeof(UInt);
+	}
+
+	BakedAnimationClip::BakedAnimationClip()
+	{}
+
+	BakedAnimationClip::BakedAnimationClip(const BakedAnimationClip& other):
+		mDuration(other.mDuration), mLoop(other.mLoop)
+	{
+		for (auto track : other.mTracks)
+			mTracks.Add(mnew Track(*track));
+	}
+
+	BakedAnimationClip::~BakedAnimationClip()
+	{
+		Clear();
+	}
+
+	BakedAnimationClip& BakedAnimationClip::operator=(const BakedAnimationClip& other)
+	{
+		Clear();
+
+		for (auto track : other.mTracks)
+			mTracks.Add(mnew Track(*track));
+
+		mDuration = other.mDuration;
+		mLoop = other.mLoop;
+
+		return *this;
+	}
+
+	void BakedAnimationClip::Bake(const AnimationClip& clip, const AnimationBakeSettings& settings)
+	{
+		Clear();
+
+		mDuration = clip.GetDuration();
+		mLoop = clip.GetLoop();
+
+		for (auto track : clip.GetTracks())
+		{
+			if (auto bakedTrack = BakeTrack(track, settings))
+				mTracks.Add(bakedTrack);
+		}
+	}
+
+	bool BakedAnimationClip::IsTrackBakeable(const IAnimationTrack* track)
+	{
+		return dynamic_cast<const AnimationTrack<float>*>(track) || dynamic_cast<const AnimationTrack<Vec2F>*>(track) ||
+			dynamic_cast<const AnimationTrack<Color4>*>(track);
+	}
+
+	void BakedAnimationClip::Clear()
+	{
+		for (auto track : mTracks)
+			delete track;
+
+		mTracks.Clear();
+	}
+
+	bool BakedAnimationClip::IsEmpty() const
+	{
+		return mTracks.IsEmpty();
+	}
+
+	const Vector<BakedAnimationClip::Track*>& BakedAnimationClip::GetTracks() const
+	{
+		return mTracks;
+	}
+
+	float BakedAnimationClip::GetDuration() const
+	{
+		return mDuration;
+	}
+
+	Loop BakedAnimationClip::GetLoop() const
+	{
+		return mLoop;
+	}
+
+	float BakedAnimationClip::GetMaxError() const
+	{
+		float res = 0.0f;
+		for (auto track : mTracks)
+			res = Math::Max(res, track->maxError);
+
+		return res;
+	}
+
+	UInt64 BakedAnimationClip::GetMemorySize() const
+	{
+		UInt64 res = sizeof(BakedAnimationClip) + mTracks.Count()*sizeof(Track*);
+		for (auto track : mTracks)
+			res += track->GetMemorySize();
+
+		return res;
+	}
+
+	UInt64 BakedAnimationClip::GetSourceMemorySize(const AnimationClip& clip)
+	{
+		UInt64 res = sizeof(AnimationClip) + clip.GetTracks().Count()*sizeof(IAnimationTrack*);
+		for (auto track : clip.GetTracks())
+		{
+			res += track->GetType().GetSize() + track->path.Length();
+
+			if (auto floatTrack = dynamic_cast<const AnimationTrack<float>*>(track))
+				res += floatTrack->curve.GetKeys().Count()*sizeof(Curve::Key);
+			else if (auto vec2Track = dynamic_cast<const AnimationTrack<Vec2F>*>(track))
+			{
+				res += vec2Track->timeCurve.GetKeys().Count()*sizeof(Curve::Key) +
+					vec2Track->spline.GetKeys().Count()*sizeof(Spline::Key);
+			}
+			else if (auto colorTrack = dynamic_cast<const AnimationTrack<Color4>*>(track))
+				res += colorTrack->GetKeys().Count()*sizeof(AnimationTrack<Color4>::Key);
+		}
+
+		return res;
+	}
+
+	BakedAnimationClip::Track* BakedAnimationClip::BakeTrack(const IAnimationTrack* track,
+															 const AnimationBakeSettings& settings)
+	{
+		if (!IsTrackBakeable(track))
+			return nullptr;
+
+		Track* baked = mnew Track();
+		baked->path = track->path;
+		baked->loop = track->loop;
+		baked->duration = track->GetDuration();
+
+		if (dynamic_cast<const AnimationTrack<Vec2F>*>(track))
+			baked->components = 2;
+		else if (dynamic_cast<const AnimationTrack<Color4>*>(track))
+			baked->components = 4;
+
+		// Tolerance is shared between steps: half for resampling, quarters for samples reduction and quantization
+		float sampleRate = Math::Max(settings.sampleRate, 1.0f);
+		ResampleUniform(track, *baked, sampleRate);
+
+		while (sampleRate*2.0f <= settings.maxSampleRate && MeasureError(track, *baked) > settings.tolerance*0.5f)
+		{
+			sampleRate *= 2.0f;
+			ResampleUniform(track, *baked, sampleRate);
+		}
+
+		if (settings.reduceKeys)
+			ReduceSamples(*baked, settings.tolerance*0.25f);
+
+		if (settings.quantize)
+			QuantizeSamples(*baked, settings.tolerance*0.25f);
+
+		baked->maxError = MeasureError(track, *baked);
+
+		return baked;
+	}
+
+	void BakedAnimationClip::SampleTrack(const IAnimationTrack* track, float time, float* result)
+	{
+		if (auto floatTrack = dynamic_cast<const AnimationTrack<float>*>(track))
+			result[0] = floatTrack->GetValue(time);
+		else if (auto vec2Track = dynamic_cast<const AnimationTrack<Vec2F>*>(track))
+		{
+			Vec2F value = vec2Track->GetValue(time);
+			result[0] = value.x;
+			result[1] = value.y;
+		}
+		else if (auto colorTrack = dynamic_cast<const AnimationTrack<Color4>*>(track))
+		{
+			// Colors are stored normalized, so tolerance means the same for all tracks
+			Color4 value = colorTrack->GetValue(time);
+			result[0] = value.r/255.0f;
+			result[1] = value.g/255.0f;
+			result[2] = value.b/255.0f;
+			result[3] = value.a/255.0f;
+		}
+	}
+
+	void BakedAnimationClip::ResampleUniform(const IAnimationTrack* track, Track& baked, float sampleRate)
+	{
+		int samplesCount = baked.duration > 0.0f ? Math::Max(2, (int)ceilf(baked.duration*sampleRate) + 1) : 1;
+
+		baked.samplesCount = samplesCount;
+		baked.sampleInterval = samplesCount > 1 ? baked.duration/(float)(samplesCount - 1) : 0.0f;
+		baked.times.Clear();
+		baked.quantizedValues.Clear();
+		baked.rangeMin.Clear();
+		baked.rangeScale.Clear();
+		baked.values.Resize(samplesCount*baked.components);
+
+		for (int i = 0; i < samplesCount; i++)
+		{
+			float time = i == samplesCount - 1 ? baked.duration : baked.sampleInterval*i;
+			SampleTrack(track, time, baked.values.Data() + i*baked.components);
+		}
+	}
+
+	void BakedAnimationClip::ReduceSamples(Track& baked, float tolerance)
+	{
+		int samplesCount = baked.samplesCount;
+		int components = baked.components;
+		if (samplesCount <= 2)
+			return;
+
+		const Vector<float>& values = baked.values;
+
+		// Segment from anchor sample is extended while all samples inside it are interpolated with tolerance
+		Vector<int> keptSamples;
+		keptSamples.Add(0);
+
+		int anchor = 0;
+		for (int end = 2; end < samplesCount; end++)
+		{
+			bool fits = true;
+			for (int i = anchor + 1; i < end && fits; i++)
+			{
+				float coef = (float)(i - anchor)/(float)(end - anchor);
+				for (int j = 0; j < components && fits; j++)
+				{
+					float interpolated = Math::Lerp(values[anchor*components + j], values[end*components + j], coef);
+					fits = Math::Abs(interpolated - values[i*components + j]) <= tolerance;
+				}
+			}
+
+			if (!fits)
+			{
+				anchor = end - 1;
+				keptSamples.Add(anchor);
+			}
+		}
+
+		keptSamples.Add(samplesCount - 1);
+
+		if (keptSamples.Count() == samplesCount)
+			return;
+
+		Vector<float> times, keptValues;
+		times.Reserve(keptSamples.Count());
+		keptValues.Reserve(keptSamples.Count()*components);
+
+		for (auto sample : keptSamples)
+		{
+			times.Add(sample == samplesCount - 1 ? baked.duration : baked.sampleInterval*sample);
+
+			for (int j = 0; j < components; j++)
+				keptValues.Add(values[sample*components + j]);
+		}
+
+		baked.times = times;
+		baked.values = keptValues;
+		baked.samplesCount = keptSamples.Count();
+	}
+
+	bool BakedAnimationClip::QuantizeSamples(Track& baked, float tolerance)
+	{
+		int components = baked.components;
+		int valuesCount = baked.samplesCount*components;
+		if (valuesCount == 0)
+			return false;
+
+		Vector<float> rangeMin, rangeScale;
+		for (int j = 0; j < components; j++)
+		{
+			float minValue = baked.values[j], maxValue = baked.values[j];
+			for (int i = j; i < valuesCount; i += components)
+			{
+				minValue = Math::Min(minValue, baked.values[i]);
+				maxValue = Math::Max(maxValue, baked.values[i]);
+			}
+
+			float scale = (maxValue - minValue)/65535.0f;
+			if (scale*0.5f > tolerance)
+				return false;
+
+			rangeMin.Add(minValue);
+			rangeScale.Add(scale);
+		}
+
+		Vector<UInt> quantizedValues;
+		quantizedValues.Resize((valuesCount + 1)/2);
+		for (auto& packed : quantizedValues)
+			packed = 0;
+
+		for (int i = 0; i < valuesCount; i++)
+		{
+			int component = i%components;
+			float scale = rangeScale[component];
+			float normalized = scale > 0.0f ? (baked.values[i] - rangeMin[component])/scale : 0.0f;
+			UInt quantized = (UInt)Math::Clamp((int)roundf(normalized), 0, 65535);
+
+			quantizedValues[i >> 1] |= quantized << ((i & 1)*16);
+		}
+
+		baked.rangeMin = rangeMin;
+		baked.rangeScale = rangeScale;
+		baked.quantizedValues = quantizedValues;
+		baked.values.Clear();
+
+		return true;
+	}
+
+	float BakedAnimationClip::MeasureError(const IAnimationTrack* track, const Track& baked)
+	{
+		// Values are checked with millisecond step
+		int checks = Math::Clamp((int)(baked.duration*1000.0f), 256, 100000);
+
+		float source[4], result[4];
+		float error = 0.0f;
+		int cacheKey = 0;
+
+		for (int i = 0; i <= checks; i++)
+		{
+			float time = baked.duration*i/(float)checks;
+
+			SampleTrack(track, time, source);
+			baked.Evaluate(time, result, cacheKey);
+
+			for (int j = 0; j < baked.components; j++)
+				error = Math::Max(error, Math::Abs(source[j] - result[j]));
+		}
+
+		return error;
+	}
+}
+
+DECLARE_CLASS(o2::AnimationBakeSettings);
+
+DECLARE_CLASS(o2::BakedAnimationClip);
+
+DECLARE_CLASS(o2::BakedAnimationClip::Track);
@@ -0,0 +1,232 @@
+#pragma once
+
+#include "o2/Utils/Serialization/Serializable.h"
+#include "o2/Utils/Types/CommonTypes.h"
+
+namespace o2
+{
+	class AnimationClip;
+	class IAnimationTrack;
+
+	// -------------------------------------------------------------------------------------------------------
+	// Animation baking settings. Tracks are resampled uniformly, sample rate is doubled until error is less
+	// than tolerance or maximum sample rate is reached. Then samples are reduced and quantized with tolerance
+	// -------------------------------------------------------------------------------------------------------
+	class AnimationBakeSettings: public ISerializable
+	{
+	public:
+		bool  enabled = false;          // Is animation baked by assets builder @SERIALIZABLE
+		float sampleRate = 30.0f;       // Initial samples count per second @SERIALIZABLE
+		float maxSampleRate = 240.0f;   // Maximum samples count per second @SERIALIZABLE
+		float tolerance = 0.01f;        // Maximum allowed absolute error of baked values @SERIALIZABLE
+		bool  reduceKeys = true;        // Removes samples, that are interpolated by neighbours with tolerance @SERIALIZABLE
+		bool  quantize = true;          // Stores samples as 16 bit values, when quantization error is in tolerance @SERIALIZABLE
+		bool  stripSourceTracks = true; // Removes baked source tracks from built asset, not in editor @SERIALIZABLE
+
+		SERIALIZABLE(AnimationBakeSettings);
+	};
+
+	// ----------------------------------------------------------------------------------------------------------
+	// Baked animation clip. Contains float, Vec2F and Color4 tracks as plain linear interpolated samples without
+	// keys supports and approximations. Samples are uniform or keyframe-reduced with times, values are floats or
+	// quantized 16 bit integers in values range. Played by BakedAnimationPlayer or by AnimationPlayer instead of
+	// stripped source tracks
+	// ----------------------------------------------------------------------------------------------------------
+	class BakedAnimationClip: public ISerializable
+	{
+	public:
+		// -------------------------------------------------------------------------------------------
+		// Baked track. Sample values are stored by components: 1 for float, 2 for Vec2F, 4 for Color4
+		// -------------------------------------------------------------------------------------------
+		class Track: public ISerializable
+		{
+		public:
+			String path;                  // Animated value path @SERIALIZABLE
+			Loop   loop = Loop::None;     // Track loop type @SERIALIZABLE
+			float  duration = 0.0f;       // Track duration @SERIALIZABLE
+			int    components = 1;        // Value components count @SERIALIZABLE
+			int    samplesCount = 0;      // Samples count @SERIALIZABLE
+			float  sampleInterval = 0.0f; // Interval between uniform samples @SERIALIZABLE
+
+			Vector<float> times;           // Samples times. Empty when samples are uniform @SERIALIZABLE
+			Vector<float> values;          // Samples values, when samples aren't quantized @SERIALIZABLE
+			Vector<UInt>  quantizedValues; // Quantized samples values, two 16 bit values in each integer @SERIALIZABLE
+			Vector<float> rangeMin;        // Minimal values of components, used for quantization @SERIALIZABLE
+			Vector<float> rangeScale;      // Quantization steps of components @SERIALIZABLE
+
+			float maxError = 0.0f; // Maximum measured error of baked values @SERIALIZABLE
+
+		public:
+			// Returns true when samples are quantized
+			bool IsQuantized() const;
+
+			// Returns sample component value
+			float GetSampleValue(int sample, int component) const;
+
+			// Evaluates value components at time. Key is cached sample index for keyframes search
+			void Evaluate(float time, float* result, int& cacheKey) const;
+
+			// Returns used memory size in bytes
+			UInt64 GetMemorySize() const;
+
+			SERIALIZABLE(Track);
+		};
+
+	public:
+		// Default constructor
+		BakedAnimationClip();
+
+		// Copy-constructor
+		BakedAnimationClip(const BakedAnimationClip& other);
+
+		// Destructor
+		~BakedAnimationClip();
+
+		// Assign operator
+		BakedAnimationClip& operator=(const BakedAnimationClip& other);
+
+		// Bakes float, Vec2F and Color4 tracks of clip. Other tracks are skipped
+		void Bake(const AnimationClip& clip, const AnimationBakeSettings& settings);
+
+		// Returns true if track can be baked
+		static bool IsTrackBakeable(const IAnimationTrack* track);
+
+		// Removes all tracks
+		void Clear();
+
+		// Returns is clip hasn't tracks
+		bool IsEmpty() const;
+
+		// Returns tracks
+		const Vector<Track*>& GetTracks() const;
+
+		// Returns duration
+		float GetDuration() const;
+
+		// Returns loop type
+		Loop GetLoop() const;
+
+		// Returns maximum measured error of tracks values
+		float GetMaxError() const;
+
+		// Returns used memory size in bytes
+		UInt64 GetMemorySize() const;
+
+		// Returns estimated memory size of clip tracks keys in bytes, for comparison with baked clip
+		static UInt64 GetSourceMemorySize(const AnimationClip& clip);
+
+		SERIALIZABLE(BakedAnimationClip);
+
+	protected:
+		Vector<Track*> mTracks;            // Baked tracks @SERIALIZABLE
+		float          mDuration = 0.0f;   // Clip duration @SERIALIZABLE
+		Loop           mLoop = Loop::None; // Clip loop type @SERIALIZABLE
+
+	protected:
+		// Bakes track. Returns null when track can't be baked
+		static Track* BakeTrack(const IAnimationTrack* track, const AnimationBakeSettings& settings);
+
+		// Samples track value components at time
+		static void SampleTrack(const IAnimationTrack* track, float time, float* result);
+
+		// Resamples track uniformly with sample rate
+		static void ResampleUniform(const IAnimationTrack* track, Track& baked, float sampleRate);
+
+		// Removes samples, which are interpolated by neighbours with tolerance
+		static void ReduceSamples(Track& baked, float tolerance);
+
+		// Quantizes samples to 16 bit values. Returns false, when quantization error is greater than tolerance
+		static bool QuantizeSamples(Track& baked, float tolerance);
+
+		// Returns maximum error of baked track values relative to source track
+		static float MeasureError(const IAnimationTrack* track, const Track& baked);
+	};
+}
+
+CLASS_BASES_META(o2::AnimationBakeSettings)
+{
+	BASE_CLASS(o2::ISerializable);
+}
+END_META;
+CLASS_FIELDS_META(o2::AnimationBakeSettings)
+{
+	FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(false).NAME(enabled);
+	FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(30.0f).NAME(sampleRate);
+	FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(240.0f).NAME(maxSampleRate);
+	FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(0.01f).NAME(tolerance);
+	FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(true).NAME(reduceKeys);
+	FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(true).NAME(quantize);
+	FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(true).NAME(stripSourceTracks);
+}
+END_META;
+CLASS_METHODS_META(o2::AnimationBakeSettings)
+{
+}
+END_META;
+
+CLASS_BASES_META(o2::BakedAnimationClip)
+{
+	BASE_CLASS(o2::ISerializable);
+}
+END_META;
+CLASS_FIELDS_META(o2::BakedAnimationClip)
+{
+	FIELD().PROTECTED().SERIALIZABLE_ATTRIBUTE().NAME(mTracks);
+	FIELD().PROTECTED().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(0.0f).NAME(mDuration);
+	FIELD().PROTECTED().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(Loop::None).NAME(mLoop);
+}
+END_META;
+CLASS_METHODS_META(o2::BakedAnimationClip)
+{
+
+	FUNCTION().PUBLIC().CONSTRUCTOR();
+	FUNCTION().PUBLIC().CONSTRUCTOR(const BakedAnimationClip&);
+	FUNCTION().PUBLIC().SIGNATURE(void, Bake, const AnimationClip&, const AnimationBakeSettings&);
+	FUNCTION().PUBLIC().SIGNATURE_STATIC(bool, IsTrackBakeable, const IAnimationTrack*);
+	FUNCTION().PUBLIC().SIGNATURE(void, Clear);
+	FUNCTION().PUBLIC().SIGNATURE(bool, IsEmpty);
+	FUNCTION().PUBLIC().SIGNATURE(const Vector<Track*>&, GetTracks);
+	FUNCTION().PUBLIC().SIGNATURE(float, GetDuration);
+	FUNCTION().PUBLIC().SIGNATURE(Loop, GetLoop);
+	FUNCTION().PUBLIC().SIGNATURE(float, GetMaxError);
+	FUNCTION().PUBLIC().SIGNATURE(UInt64, GetMemorySize);
+	FUNCTION().PUBLIC().SIGNATURE_STATIC(UInt64, GetSourceMemorySize, const AnimationClip&);
+	FUNCTION().PROTECTED().SIGNATURE_STATIC(Track*, BakeTrack, const IAnimationTrack*, const AnimationBakeSettings&);
+	FUNCTION().PROTECTED().SIGNATURE_STATIC(void, SampleTrack, const IAnimationTrack*, float, float*);
+	FUNCTION().PROTECTED().SIGNATURE_STATIC(void, ResampleUniform, const IAnimationTrack*, Track&, float);
+	FUNCTION().PROTECTED().SIGNATURE_STATIC(void, ReduceSamples, Track&, float);
+	FUNCTION().PROTECTED().SIGNATURE_STATIC(bool, QuantizeSamples, Track&, float);
+	FUNCTION().PROTECTED().SIGNATURE_STATIC(float, MeasureError, const IAnimationTrack*, const Track&);
+}
+END_META;
+
+CLASS_BASES_META(o2::BakedAnimationClip::Track)
+{
+	BASE_CLASS(o2::ISerializable);
+}
+END_META;
+CLASS_FIELDS_META(o2::BakedAnimationClip::Track)
+{
+	FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().NAME(path);
+	FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(Loop::None).NAME(loop);
+	FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(0.0f).NAME(duration);
+	FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(1).NAME(components);
+	FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(0).NAME(samplesCount);
+	FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(0.0f).NAME(sampleInterval);
+	FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().NAME(times);
+	FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().NAME(values);
+	FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().NAME(quantizedValues);
+	FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().NAME(rangeMin);
+	FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().NAME(rangeScale);
+	FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(0.0f).NAME(maxError);
+}
+END_META;
+CLASS_METHODS_META(o2::BakedAnimationClip::Track)
+{
+
+	FUNCTION().PUBLIC().SIGNATURE(bool, IsQuantized);
+	FUNCTION().PUBLIC().SIGNATURE(float, GetSampleValue, int, int);
+	FUNCTION().PUBLIC().SIGNATURE(void, Evaluate, float, float*, int&);
+	FUNCTION().PUBLIC().SIGNATURE(UInt64, GetMemorySize);
+}
+END_META;
@@ -0,0 +1,166 @@
+#include "o2/stdafx.h"
+#include "BakedAnimationPlayer.h"
+
+#include "o2/Utils/Debug/Debug.h"
+#include "o2/Utils/ValueProxy.h"
+
+namespace o2
+{
+	BakedAnimationPlayer::BakedAnimationPlayer(IObject* target /*= nullptr*/, const BakedAnimationClip* clip /*= nullptr*/):
+		mTarget(target), mClip(clip)
+	{
+		BindTracks(true);
+	}
+
+	BakedAnimationPlayer::~BakedAnimationPlayer()
+	{
+		UnbindTracks();
+	}
+
+	void BakedAnimationPlayer::SetTarget(IObject* target, bool errors /*= true*/)
+	{
+		mTarget = target;
+		BindTracks(errors);
+	}
+
+	IObject* BakedAnimationPlayer::GetTarget() const
+	{
+		return mTarget;
+	}
+
+	void BakedAnimationPlayer::SetClip(const BakedAnimationClip* clip)
+	{
+		mClip = clip;
+		BindTracks(true);
+	}
+
+	const BakedAnimationClip* BakedAnimationPlayer::GetClip() const
+	{
+		return mClip;
+	}
+
+	void BakedAnimationPlayer::UnbindTracks()
+	{
+		for (auto& binding : mBindings)
+		{
+			if (binding.proxy)
+				delete binding.proxy;
+		}
+
+		mBindings.Clear();
+	}
+
+	void BakedAnimationPlayer::BindTracks(bool errors)
+	{
+		UnbindTracks();
+
+		if (!mTarget || !mClip)
+			return;
+
+		const ObjectType* type = dynamic_cast<const ObjectType*>(&mTarget->GetType());
+		void* castedTarget = type->DynamicCastFromIObject(mTarget);
+
+		for (auto track : mClip->GetTracks())
+			BindTrack(type, castedTarget, track, errors);
+
+		mLoop = mClip->GetLoop();
+		mDuration = mClip->GetDuration();
+		mBeginTime = 0.0f;
+		mEndTime = mDuration;
+	}
+
+	void BakedAnimationPlayer::BindTrack(const ObjectType* type, void* castedTarget,
+										 const BakedAnimationClip::Track* track, bool errors)
+	{
+		const FieldInfo* fieldInfo = nullptr;
+		auto targetPtr = type->GetFieldPtr(castedTarget, track->path, fieldInfo);
+
+		if (!fieldInfo)
+		{
+			if (errors)
+				o2Debug.LogWarning("Can't find '" + track->path + "' for animating");
+
+			return;
+		}
+
+		const Type* fieldType = fieldInfo->GetType();
+		bool isProperty = fieldType->GetUsage() == Type::Usage::Property;
+		const Type* valueType = isProperty ? dynamic_cast<const PropertyType*>(fieldType)->GetValueType() : fieldType;
+
+		const Type* trackValueType = track->components == 4 ? &TypeOf(Color4) :
+			track->components == 2 ? &TypeOf(Vec2F) : &TypeOf(float);
+
+		if (valueType != trackValueType)
+		{
+			if (errors)
+				o2Debug.LogWarning("Can't animate '" + track->path + "': value type doesn't match baked track");
+
+			return;
+		}
+
+		TrackBinding binding;
+		binding.track = track;
+
+		if (isProperty)
+			binding.proxy = fieldType->GetValueProxy(targetPtr);
+		else
+			binding.target = targetPtr;
+
+		mBindings.Add(binding);
+	}
+
+	void BakedAnimationPlayer::Evaluate()
+	{
+		float value[4];
+
+		for (auto& binding : mBindings)
+		{
+			auto track = binding.track;
+			track->Evaluate(GetTrackTime(track, mInDurationTime), value, binding.cacheKey);
+
+			if (track->components == 1)
+			{
+				if (binding.proxy)
+					static_cast<IValueProxy<float>*>(binding.proxy)->SetValue(value[0]);
+				else
+					*(float*)binding.target = value[0];
+			}
+			else if (track->components == 2)
+			{
+				Vec2F vec(value[0], value[1]);
+
+				if (binding.proxy)
+					static_cast<IValueProxy<Vec2F>*>(binding.proxy)->SetValue(vec);
+				else
+					*(Vec2F*)binding.target = vec;
+			}
+			else
+			{
+				Color4 color(Math::RoundToInt(value[0]*255.0f), Math::RoundToInt(value[1]*255.0f),
+							 Math::RoundToInt(value[2]*255.0f), Math::RoundToInt(value[3]*255.0f));
+
+				if (binding.proxy)
+					static_cast<IValueProxy<Color4>*>(binding.proxy)->SetValue(color);
+				else
+					*(Color4*)binding.target = color;
+			}
+		}
+	}
+
+	float BakedAnimationPlayer::GetTrackTime(const BakedAnimationClip::Track* track, float time)
+	{
+		float duration = track->duration;
+		if (track->loop == Loop::None || duration <= 0.0f)
+			return Math::Clamp(time, 0.0f, duration);
+
+		float loops;
+		float res = time > 0 ? modff(time/duration, &loops)*duration : (1.0f - modff(-time/duration, &loops))*duration;
+
+		if (track->loop == Loop::PingPong && (int)loops%2 == (time > 0 ? 1 : 0))
+			res = duration - res;
+
+		return Math::Clamp(res, 0.0f, duration);
+	}
+}
+
+DECLARE_CLASS(o2::BakedAnimationPlayer);
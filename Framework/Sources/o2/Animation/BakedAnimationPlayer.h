@@ -0,0 +1,102 @@
+#pragma once
+#include "o2/Animation/BakedAnimationClip.h"
+#include "o2/Animation/IAnimation.h"
+
+namespace o2
+{
+	class IAbstractValueProxy;
+
+	// --------------------------------------------------------------------------------------------------------
+	// Baked animation clip player. Tracks are bound to target fields once, evaluation is samples interpolation
+	// and direct assigning of values without curves and splines approximations
+	// --------------------------------------------------------------------------------------------------------
+	class BakedAnimationPlayer: public IAnimation
+	{
+	public:
+		// Default constructor
+		BakedAnimationPlayer(IObject* target = nullptr, const BakedAnimationClip* clip = nullptr);
+
+		// Destructor
+		~BakedAnimationPlayer();
+
+		// Sets animation target
+		// Bind all baked tracks to target's child fields (if it possible)
+		void SetTarget(IObject* target, bool errors = true);
+
+		// Returns animation's target
+		IObject* GetTarget() const;
+
+		// Sets baked animation clip
+		void SetClip(const BakedAnimationClip* clip);
+
+		// Returns baked animation clip
+		const BakedAnimationClip* GetClip() const;
+
+		IOBJECT(BakedAnimationPlayer);
+
+	protected:
+		// -------------------------------------------------------------------------
+		// Baked track binding. Value is assigned to target pointer or through proxy
+		// -------------------------------------------------------------------------
+		struct TrackBinding
+		{
+			const BakedAnimationClip::Track* track = nullptr;  // Baked track
+			void*                            target = nullptr; // Target value pointer
+			IAbstractValueProxy*             proxy = nullptr;  // Target value proxy, used for properties
+			int                              cacheKey = 0;     // Cached sample index for keyframes search
+
+			// Check equals operator
+			bool operator==(const TrackBinding& other) const { return track == other.track && target == other.target; }
+		};
+
+	protected:
+		const BakedAnimationClip* mClip = nullptr;   // Baked animation clip
+		IObject*                  mTarget = nullptr; // Target object
+
+		Vector<TrackBinding> mBindings; // Tracks bindings
+
+	protected:
+		// Evaluates all baked tracks by time
+		void Evaluate() override;
+
+		// Removes bindings and deletes proxies
+		void UnbindTracks();
+
+		// Binds clip tracks to target fields
+		void BindTracks(bool errors);
+
+		// Binds baked track
+		void BindTrack(const ObjectType* type, void* castedTarget, const BakedAnimationClip::Track* track, bool errors);
+
+		// Returns track time by animation time with track loop
+		static float GetTrackTime(const BakedAnimationClip::Track* track, float time);
+	};
+}
+
+CLASS_BASES_META(o2::BakedAnimationPlayer)
+{
+	BASE_CLASS(o2::IAnimation);
+}
+END_META;
+CLASS_FIELDS_META(o2::BakedAnimationPlayer)
+{
+	FIELD().PROTECTED().DEFAULT_VALUE(nullptr).NAME(mClip);
+	FIELD().PROTECTED().DEFAULT_VALUE(nullptr).NAME(mTarget);
+	FIELD().PROTECTED().NAME(mBindings);
+}
+END_META;
+CLASS_METHODS_META(o2::BakedAnimationPlayer)
+{
+
+	FUNCTION().PUBLIC().CONSTRUCTOR(IObject*, const BakedAnimationClip*);
+	FUNCTION().PUBLIC().SIGNATURE(void, SetTarget, IObject*, bool);
+	FUNCTION().PUBLIC().SIGNATURE(IObject*, GetTarget);
+	FUNCTION().PUBLIC().SIGNATURE(void, SetClip, const BakedAnimationClip*);
+	FUNCTION().PUBLIC().SIGNATURE(const BakedAnimationClip*, GetClip);
+	FUNCTION().PROTECTED().SIGNATURE(void, Evaluate);
+	FUNCTION().PROTECTED().SIGNATURE(void, UnbindTracks);
+	FUNCTION().PROTECTED().SIGNATURE(void, BindTracks, bool);
+	FUNCTION().PROTECTED().SIGNATURE(void, BindTrack, const ObjectType*, void*, const BakedAnimationClip::Track*, bool);
+	FUNCTION().PROTECTED().SIGNATURE_STATIC(float, GetTrackTime, const BakedAnimationClip::Track*, float);
+}
+END_META;
@@ -0,0 +1,30 @@
+#include "o2/stdafx.h"
+#include "BakedAnimationTrackPlayer.h"
+
+namespace o2
+{
+	template<>
+	float BakedAnimationTrackPlayer<float>::GetComponentsValue(const float* components)
+	{
+		return components[0];
+	}
+
+	template<>
+	Vec2F BakedAnimationTrackPlayer<Vec2F>::GetComponentsValue(const float* components)
+	{
+		return Vec2F(components[0], components[1]);
+	}
+
+	template<>
+	Color4 BakedAnimationTrackPlayer<Color4>::GetComponentsValue(const float* components)
+	{
+		return Color4(Math::RoundToInt(components[0]*255.0f), Math::RoundToInt(components[1]*255.0f),
+					  Math::RoundToInt(components[2]*255.0f), Math::RoundToInt(components[3]*255.0f));
+	}
+}
+
+DECLARE_TEMPLATE_CLASS(o2::BakedAnimationTrackPlayer<float>);
+
+DECLARE_TEMPLATE_CLASS(o2::BakedAnimationTrackPlayer<o2::Vec2F>);
+
+DECLARE_TEMPLATE_CLASS(o2::BakedAnimationTrackPlayer<o2::Color4>);
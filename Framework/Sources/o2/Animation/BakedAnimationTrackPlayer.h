@@ -0,0 +1,133 @@
+#pragma once
+#include "o2/Animation/BakedAnimationClip.h"
+#include "o2/Animation/Tracks/AnimationColor4Track.h"
+#include "o2/Animation/Tracks/AnimationFloatTrack.h"
+#include "o2/Animation/Tracks/AnimationVec2FTrack.h"
+
+namespace o2
+{
+	// -------------------------------------------------------------------------------------------------------------
+	// Baked track player. Plays baked track in animation player as regular track player, so animation states mix
+	// baked values same as source tracks values. Used for float, Vec2F and Color4 values
+	// -------------------------------------------------------------------------------------------------------------
+	template<typename _type>
+	class BakedAnimationTrackPlayer: public AnimationTrack<_type>::Player
+	{
+	public:
+		// Default constructor
+		BakedAnimationTrackPlayer() = default;
+
+		// Constructor with baked track
+		BakedAnimationTrackPlayer(const BakedAnimationClip::Track* track);
+
+		// Sets baked track
+		void SetBakedTrack(const BakedAnimationClip::Track* track);
+
+		// Returns baked track
+		const BakedAnimationClip::Track* GetBakedTrack() const;
+
+		// Returns animated value path
+		const String& GetTrackPath() const override;
+
+		IOBJECT(BakedAnimationTrackPlayer);
+
+	protected:
+		const BakedAnimationClip::Track* mBakedTrack = nullptr; // Baked track
+		int                              mCacheKey = 0;         // Cached sample index for keyframes search
+
+	protected:
+		// Evaluates value from baked track
+		void Evaluate() override;
+
+		// Returns value from baked value components
+		static _type GetComponentsValue(const float* components);
+	};
+
+	template<typename _type>
+	BakedAnimationTrackPlayer<_type>::BakedAnimationTrackPlayer(const BakedAnimationClip::Track* track)
+	{
+		SetBakedTrack(track);
+	}
+
+	template<typename _type>
+	void BakedAnimationTrackPlayer<_type>::SetBakedTrack(const BakedAnimationClip::Track* track)
+	{
+		mBakedTrack = track;
+		mCacheKey = 0;
+
+		if (track)
+		{
+			this->mLoop = track->loop;
+			this->mDuration = track->duration;
+			this->mBeginTime = 0;
+			this->mEndTime = this->mDuration;
+		}
+	}
+
+	template<typename _type>
+	const BakedAnimationClip::Track* BakedAnimationTrackPlayer<_type>::GetBakedTrack() const
+	{
+		return mBakedTrack;
+	}
+
+	template<typename _type>
+	const String& BakedAnimationTrackPlayer<_type>::GetTrackPath() const
+	{
+		return mBakedTrack ? mBakedTrack->path : String::empty;
+	}
+
+	template<typename _type>
+	void BakedAnimationTrackPlayer<_type>::Evaluate()
+	{
+		if (!mBakedTrack)
+			return;
+
+		float components[4];
+		mBakedTrack->Evaluate(this->mInDurationTime, components, mCacheKey);
+		this->mCurrentValue = GetComponentsValue(components);
+
+		if (this->mTarget)
+		{
+			*this->mTarget = this->mCurrentValue;
+			this->mTargetDelegate();
+		}
+		else if (this->mTargetProxy)
+			this->mTargetProxy->SetValue(this->mCurrentValue);
+	}
+
+	template<>
+	float BakedAnimationTrackPlayer<float>::GetComponentsValue(const float* components);
+
+	template<>
+	Vec2F BakedAnimationTrackPlayer<Vec2F>::GetComponentsValue(const float* components);
+
+	template<>
+	Color4 BakedAnimationTrackPlayer<Color4>::GetComponentsValue(const float* components);
+}
+
+META_TEMPLATES(typename _type)
+CLASS_BASES_META(o2::BakedAnimationTrackPlayer<_type>)
+{
+	BASE_CLASS(typename o2::AnimationTrack<_type>::Player);
+}
+END_META;
+META_TEMPLATES(typename _type)
+CLASS_FIELDS_META(o2::BakedAnimationTrackPlayer<_type>)
+{
+	FIELD().PROTECTED().DEFAULT_VALUE(nullptr).NAME(mBakedTrack);
+	FIELD().PROTECTED().DEFAULT_VALUE(0).NAME(mCacheKey);
+}
+END_META;
+META_TEMPLATES(typename _type)
+CLASS_METHODS_META(o2::BakedAnimationTrackPlayer<_type>)
+{
+
+	FUNCTION().PUBLIC().CONSTRUCTOR();
+	FUNCTION().PUBLIC().CONSTRUCTOR(const BakedAnimationClip::Track*);
+	FUNCTION().PUBLIC().SIGNATURE(void, SetBakedTrack, const BakedAnimationClip::Track*);
+	FUNCTION().PUBLIC().SIGNATURE(const BakedAnimationClip::Track*, GetBakedTrack);
+	FUNCTION().PUBLIC().SIGNATURE(const String&, GetTrackPath);
+	FUNCTION().PROTECTED().SIGNATURE(void, Evaluate);
+	FUNCTION().PROTECTED().SIGNATURE_STATIC(_type, GetComponentsValue, const float*);
+}
+END_META;
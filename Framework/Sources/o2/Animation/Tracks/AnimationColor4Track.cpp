@@ -2,6 +2,7 @@
 #include "AnimationColor4Track.h"
 
 #include "o2/Animation/AnimationState.h"
+#include "o2/Animation/AnimationTracksBatch.h"
 #include "o2/Scene/Components/AnimationComponent.h"
 #include "o2/Utils/Debug/Debug.h"
 #include "o2/Utils/Math/Interpolation.h"
@@ -385,6 +386,12 @@ namespace o2
 
 	void AnimationTrack<Color4>::Player::Evaluate()
 	{
+		if (auto batch = AnimationTracksBatch::GetRecording())
+		{
+			batch->Add(this);
+			return;
+		}
+
 		mCurrentValue = mTrack->GetValue(mInDurationTime, mInDurationTime > mPrevInDurationTime, 
 										 mPrevKey, mPrevKeyApproximation);
 
@@ -181,6 +181,8 @@ namespace o2
 
 			// Registering this in animatable value agent
 			void RegMixer(AnimationState* state, const String& path) override;
+
+			friend class AnimationTracksBatch;
 		};
 
 	public:
@@ -2,6 +2,7 @@
 #include "AnimationFloatTrack.h"
 
 #include "o2/Animation/AnimationState.h"
+#include "o2/Animation/AnimationTracksBatch.h"
 #include "o2/Scene/Components/AnimationComponent.h"
 
 namespace o2
@@ -290,6 +291,12 @@ namespace o2
 		if (!mTrack)
 			return;
 
+		if (auto batch = AnimationTracksBatch::GetRecording())
+		{
+			batch->Add(this);
+			return;
+		}
+
 		mCurrentValue = mTrack->curve.Evaluate(mInDurationTime, mInDurationTime > mPrevInDurationTime, mPrevKey, mPrevKeyApproximation);
 		mPrevInDurationTime = mInDurationTime;
 
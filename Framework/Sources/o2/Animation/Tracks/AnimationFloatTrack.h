@@ -205,6 +205,8 @@ namespace o2
 
 			// Registering this in value mixer
 			void RegMixer(AnimationState* state, const String& path) override;
+
+			friend class AnimationTracksBatch;
 		};
 
 	protected:
@@ -2,6 +2,7 @@
 #include "AnimationVec2FTrack.h"
 
 #include "o2/Animation/AnimationState.h"
+#include "o2/Animation/AnimationTracksBatch.h"
 #include "o2/Scene/Components/AnimationComponent.h"
 #include "o2/Utils/Debug/Debug.h"
 #include "o2/Utils/Math/Interpolation.h"
@@ -43,7 +44,7 @@ namespace o2
 										  int& cacheSplineKey, int& cacheSplineKeyApprox) const
 	{
 		float timePos = timeCurve.Evaluate(position, direction, cacheTimeKey, cacheTimeKeyApprox);
-		return spline.Evaluate(timePos*spline.Length(), direction, cacheSplineKey, cacheTimeKeyApprox);
+		return spline.Evaluate(timePos*spline.Length(), direction, cacheSplineKey, cacheSplineKeyApprox);
 	}
 
 	void AnimationTrack<Vec2F>::BeginKeysBatchChange()
@@ -190,6 +191,12 @@ namespace o2
 
 	void AnimationTrack<Vec2F>::Player::Evaluate()
 	{
+		if (auto batch = AnimationTracksBatch::GetRecording())
+		{
+			batch->Add(this);
+			return;
+		}
+
 		mCurrentValue = mTrack->GetValue(mInDurationTime, mInDurationTime > mPrevInDurationTime, 
 										 mPrevTimeKey, mPrevTimeKeyApproximation,
 										 mPrevSplineKey, mPrevSplineKeyApproximation);
@@ -23,6 +23,14 @@ namespace o2
 		}
 	}
 
+	const String& IAnimationTrack::IPlayer::GetTrackPath() const
+	{
+		if (auto track = GetTrack())
+			return track->path;
+
+		return String::empty;
+	}
+
 	void IAnimationTrack::IPlayer::ForceSetTime(float time, float duration)
 	{
 		float lastTime = mTime;
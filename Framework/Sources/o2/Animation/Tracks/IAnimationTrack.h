@@ -38,6 +38,9 @@ namespace o2
 			// Returns animation track
 			virtual IAnimationTrack* GetTrack() const { return nullptr; }
 
+			// Returns animated value path
+			virtual const String& GetTrackPath() const;
+
 			// Registering this in animation track agent
 			virtual void RegMixer(AnimationState* state, const String& path) {}
 
@@ -147,6 +150,7 @@ CLASS_METHODS_META(o2::IAnimationTrack::IPlayer)
 	FUNCTION().PUBLIC().SIGNATURE(void, SetTargetProxyVoid, void*);
 	FUNCTION().PUBLIC().SIGNATURE(void, SetTrack, IAnimationTrack*);
 	FUNCTION().PUBLIC().SIGNATURE(IAnimationTrack*, GetTrack);
+	FUNCTION().PUBLIC().SIGNATURE(const String&, GetTrackPath);
 	FUNCTION().PUBLIC().SIGNATURE(void, RegMixer, AnimationState*, const String&);
 	FUNCTION().PUBLIC().SIGNATURE(void, ForceSetTime, float, float);
 	FUNCTION().PUBLIC().SIGNATURE(const AnimationPlayer*, GetOwnerPlayer);
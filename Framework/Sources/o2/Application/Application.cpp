@@ -15,10 +15,13 @@
 #include "o2/Utils/Debug/Log/ConsoleLogStream.h"
 #include "o2/Utils/Debug/Log/FileLogStream.h"
 #include "o2/Utils/Debug/Log/LogStream.h"
+#include "o2/Utils/Debug/Profiler.h"
 #include "o2/Utils/Debug/StackTrace.h"
 #include "o2/Utils/FileSystem/FileSystem.h"
+#include "o2/Utils/Memory/Allocators/FrameAllocator.h"
 #include "o2/Utils/System/Time/Time.h"
 #include "o2/Utils/System/Time/Timer.h"
+#include "o2/Utils/Tasks/JobSystem.h"
 #include "o2/Utils/Tasks/TaskManager.h"
 
 #if IS_SCRIPTING_SUPPORTED
@@ -79,8 +82,13 @@ namespace o2
 	{
 		srand((UInt)time(NULL));
 
+		mProfiler = mnew Profiler();
+		mProfiler->SetCurrentThreadName("Main");
+
 		mTime = mnew Time();
 
+		mFrameAllocator = mnew FrameAllocator();
+
 		mLog = mnew LogStream("Application");
 		o2Debug.GetLog()->BindStream(mLog);
 
@@ -92,6 +100,8 @@ namespace o2
 
 		mTaskManager = mnew TaskManager();
 
+		mJobSystem = mnew JobSystem();
+
 		mTimer = mnew Timer();
 		mTimer->Reset();
 
@@ -123,10 +133,14 @@ namespace o2
 		delete mAssets;
 		delete mEventSystem;
 		delete mTaskManager;
+		delete mJobSystem;
+		delete mFrameAllocator;
 
 #if IS_SCRIPTING_SUPPORTED
 		delete mScriptingEngine;
 #endif
+
+		delete mProfiler;
 	}
 	
 	void Application::SetupGraphicsScaledCamera()
@@ -154,55 +168,86 @@ namespace o2
 			realdDt = maxFPSDeltaTime;
 		}
 
+		o2Profiler.BeginFrame();
+
 		float dt = Math::Clamp(realdDt, 0.001f, 0.05f);
 
-		mInput->PreUpdate();
+		{
+			PROFILE_SCOPE("Events");
+
+			mInput->PreUpdate();
 
-		mTime->Update(realdDt);
-		o2Debug.Update(dt);
-		mTaskManager->Update(dt);
-		UpdateEventSystem();
+			mTime->Update(realdDt);
+			o2Debug.Update(dt);
+			mTaskManager->Update(dt);
+			mAssets->UpdateStreaming();
+			UpdateEventSystem();
+		}
 
 		mRender->Begin();
 
-		OnUpdate(dt);
-		UpdateScene(dt);
+		{
+			PROFILE_SCOPE("Update");
+
+			OnUpdate(dt);
+			UpdateScene(dt);
+		}
 
-		mAccumulatedDT += dt;
-		float fixedDT = 1.0f/(float)fixedFPS;
-		while (mAccumulatedDT > fixedDT)
 		{
-			OnFixedUpdate(fixedDT);
-			FixedUpdateScene(fixedDT);
+			PROFILE_SCOPE("Fixed update");
+
+			mAccumulatedDT += dt;
+			float fixedDT = 1.0f/(float)fixedFPS;
+			while (mAccumulatedDT > fixedDT)
+			{
+				OnFixedUpdate(fixedDT);
+				FixedUpdateScene(fixedDT);
 
-			PreUpdatePhysics();
-			UpdatePhysics(fixedDT);
-			PostUpdatePhysics();
+				PreUpdatePhysics();
+				UpdatePhysics(fixedDT);
+				PostUpdatePhysics();
 
-			mAccumulatedDT -= fixedDT;
+				mAccumulatedDT -= fixedDT;
+			}
+
+			PostUpdateEventSystem();
 		}
 
-		PostUpdateEventSystem();
-		
-		mMainListenersLayer.OnBeginDraw();
-		SetupGraphicsScaledCamera();
-		mMainListenersLayer.camera = o2Render.GetCamera();
+		{
+			PROFILE_SCOPE("Draw");
+
+			mMainListenersLayer.OnBeginDraw();
+			SetupGraphicsScaledCamera();
+			mMainListenersLayer.camera = o2Render.GetCamera();
+
+			OnDraw();
+			DrawScene();
+
+			DrawUIManager();
+
+			o2Debug.Draw();
 
-		OnDraw();
-		DrawScene();
+			mMainListenersLayer.OnEndDraw();
+			mMainListenersLayer.OnDrawn(Camera::Default().GetBasis());
+		}
+
+		{
+			PROFILE_SCOPE("Render end");
+			mRender->End();
+		}
 
-		DrawUIManager();
+		{
+			PROFILE_SCOPE("Post update");
 
-		o2Debug.Draw();
+			mInput->Update(dt);
+			mUIManager->Update();
 
-		mMainListenersLayer.OnEndDraw();
-		mMainListenersLayer.OnDrawn(Camera::Default().GetBasis());
-		mRender->End();
+			mAssets->CheckAssetsUnload();
+		}
 
-		mInput->Update(dt);
-		mUIManager->Update();
+		o2FrameAllocator.Reset();
 
-		mAssets->CheckAssetsUnload();
+		o2Profiler.EndFrame();
 	}
 
 	void Application::DrawScene()
@@ -27,9 +27,12 @@ namespace o2
 	class Assets;
 	class EventSystem;
 	class FileSystem;
+	class FrameAllocator;
 	class Input;
+	class JobSystem;
 	class LogStream;
 	class PhysicsWorld;
+	class Profiler;
 	class ProjectConfig;
 	class Render;
 	class Scene;
@@ -205,19 +208,22 @@ namespace o2
 	protected:
 		bool mReady = false; // Is all systems is ready
 
-		Assets*        mAssets = nullptr;        // Assets
-		EventSystem*   mEventSystem = nullptr;   // Events processing system
-		FileSystem*    mFileSystem = nullptr;    // File system
-		Input*         mInput = nullptr;         // While application user input message
-		LogStream*     mLog = nullptr;           // Log stream with id "app", using only for application messages
-		PhysicsWorld*  mPhysics = nullptr;       // Physics
-		ProjectConfig* mProjectConfig = nullptr; // Project config
-		Render*        mRender = nullptr;        // Graphics render
-		Scene*         mScene = nullptr;         // Scene
-		TaskManager*   mTaskManager = nullptr;   // Tasks manager
-		Time*          mTime = nullptr;          // Time utilities
-		Timer*         mTimer = nullptr;         // Timer for detecting delta time for update
-		UIManager*     mUIManager = nullptr;     // UI manager
+		Assets*         mAssets = nullptr;         // Assets
+		EventSystem*    mEventSystem = nullptr;    // Events processing system
+		FileSystem*     mFileSystem = nullptr;     // File system
+		FrameAllocator* mFrameAllocator = nullptr; // Per-frame arena allocator for temporary data
+		Input*          mInput = nullptr;          // While application user input message
+		JobSystem*      mJobSystem = nullptr;      // Jobs system with worker threads pool
+		LogStream*      mLog = nullptr;            // Log stream with id "app", using only for application messages
+		PhysicsWorld*   mPhysics = nullptr;        // Physics
+		Profiler*       mProfiler = nullptr;       // CPU profiler
+		ProjectConfig*  mProjectConfig = nullptr;  // Project config
+		Render*         mRender = nullptr;         // Graphics render
+		Scene*          mScene = nullptr;          // Scene
+		TaskManager*    mTaskManager = nullptr;    // Tasks manager
+		Time*           mTime = nullptr;           // Time utilities
+		Timer*          mTimer = nullptr;          // Timer for detecting delta time for update
+		UIManager*      mUIManager = nullptr;      // UI manager
 
 #if IS_SCRIPTING_SUPPORTED
 		ScriptEngine*  mScriptingEngine = nullptr; // Scripting engine
@@ -4,6 +4,7 @@
 #include "o2/Assets/Assets.h"
 #include "o2/Utils/Debug/Debug.h"
 #include "o2/Utils/Debug/Log/LogStream.h"
+#include "o2/Utils/FileSystem/File.h"
 
 namespace o2
 {
@@ -35,6 +36,7 @@ namespace o2
 
 	Asset::~Asset()
 	{
+		ReleaseDecodedData();
 		o2Assets.RemoveAssetCache(this);
 	}
 
@@ -116,6 +118,12 @@ namespace o2
 	}
 
 	void Asset::Load(const AssetInfo& info)
+	{
+		ApplyInfo(info);
+		LoadData(GetBuiltFullPath());
+	}
+
+	void Asset::ApplyInfo(const AssetInfo& info)
 	{
 		auto oldPath = mInfo.path;
 		auto oldUID = mInfo.meta->mId;
@@ -123,8 +131,6 @@ namespace o2
 		mInfo = info;
 
 		o2Assets.UpdateAssetCache(this, oldPath, oldUID);
-
-		LoadData(GetBuiltFullPath());
 	}
 
 	void Asset::Save(const String& path, bool rebuildAssetsImmediately /*= true*/)
@@ -166,6 +172,23 @@ namespace o2
 		return mDirty;
 	}
 
+	Asset::LoadState Asset::GetLoadState() const
+	{
+		return mLoadState;
+	}
+
+	bool Asset::IsLoaded() const
+	{
+		return mLoadState == LoadState::Loaded;
+	}
+
+	UInt64 Asset::GetResidentSize() const
+	{
+		// Built data size is close to size of deserialized data for most assets
+		InFile file(GetBuiltFullPath());
+		return GetType().GetSize() + (file.IsOpened() ? file.GetDataSize() : 0);
+	}
+
 	const char* Asset::GetFileExtensions()
 	{
 		return "";
@@ -201,6 +224,37 @@ namespace o2
 		Deserialize(data);
 	}
 
+	bool Asset::DecodeData(const String& path)
+	{
+		mDecodedData = mnew DataDocument();
+		if (mDecodedData->LoadFromFile(path))
+			return true;
+
+		ReleaseDecodedData();
+		return false;
+	}
+
+	bool Asset::FinalizeData(const String& path)
+	{
+		if (mDecodedData)
+		{
+			Deserialize(*mDecodedData);
+			ReleaseDecodedData();
+		}
+		else
+			LoadData(path);
+
+		return true;
+	}
+
+	void Asset::ReleaseDecodedData()
+	{
+		if (mDecodedData)
+			delete mDecodedData;
+
+		mDecodedData = nullptr;
+	}
+
 	void Asset::SaveData(const String& path) const
 	{
 		DataDocument data;
@@ -213,4 +267,13 @@ namespace o2
 
 }
 
+ENUM_META(o2::Asset::LoadState)
+{
+	ENUM_ENTRY(Cancelled);
+	ENUM_ENTRY(Failed);
+	ENUM_ENTRY(Loaded);
+	ENUM_ENTRY(Loading);
+}
+END_ENUM_META;
+
 DECLARE_CLASS(o2::Asset);
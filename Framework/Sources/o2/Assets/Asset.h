@@ -19,6 +19,9 @@ namespace o2
 	public:
 		typedef AssetMeta MetaType;
 
+		// Asset loading state
+		enum class LoadState { Loaded, Loading, Failed, Cancelled };
+
 	public:
 		PROPERTIES(Asset);
 		PROPERTY(String, path, SetPath, GetPath); // Asset path property @EDITOR_IGNORE
@@ -80,6 +83,15 @@ namespace o2
 		// Returns is asset dirty
 		bool IsDirty() const;
 
+		// Returns loading state. Asset is loading while it is streaming
+		LoadState GetLoadState() const;
+
+		// Returns true when asset is loaded
+		bool IsLoaded() const;
+
+		// Returns approximate size of asset in memory in bytes. Used by assets cache budget
+		virtual UInt64 GetResidentSize() const;
+
 		// Returns extensions string (something like "ext1 ext2 ent asf")
 		static const char* GetFileExtensions();
 
@@ -104,6 +116,9 @@ namespace o2
 
 		bool mDirty = false; // Is asset was changed
 
+		LoadState     mLoadState = LoadState::Loaded; // Asset loading state
+		DataDocument* mDecodedData = nullptr;         // Data decoded on streaming thread, waits finalization
+
 	private:
 		// Hidden default constructor
 		Asset();
@@ -130,9 +145,23 @@ namespace o2
 		// Loads asset from path
 		void Load(const AssetInfo& info);
 
+		// Sets asset info and updates assets cache
+		void ApplyInfo(const AssetInfo& info);
+
 		// Loads asset data, using DataValue and serialization
 		virtual void LoadData(const String& path);
 
+		// Reads and decodes asset data on streaming thread, returns false when data can't be read. Must not access
+		// other assets and engine systems. Parses data document by default
+		virtual bool DecodeData(const String& path);
+
+		// Finalizes decoded data on main thread. Returns false when asset waits other streaming requests and must be
+		// finalized again later. Deserializes decoded document by default, or loads data when nothing was decoded
+		virtual bool FinalizeData(const String& path);
+
+		// Releases decoded data when loading is cancelled
+		virtual void ReleaseDecodedData();
+
 		// Saves asset data, using DataValue and serialization
 		virtual void SaveData(const String& path) const;
 
@@ -186,6 +215,8 @@ CLASS_FIELDS_META(o2::Asset)
 	FIELD().PUBLIC().DONT_DELETE_ATTRIBUTE().EDITOR_PROPERTY_ATTRIBUTE().EXPANDED_BY_DEFAULT_ATTRIBUTE().NO_HEADER_ATTRIBUTE().NAME(mMeta);
 	FIELD().PROTECTED().NAME(mInfo);
 	FIELD().PROTECTED().DEFAULT_VALUE(false).NAME(mDirty);
+	FIELD().PROTECTED().DEFAULT_VALUE(LoadState::Loaded).NAME(mLoadState);
+	FIELD().PROTECTED().DEFAULT_VALUE(nullptr).NAME(mDecodedData);
 }
 END_META;
 CLASS_METHODS_META(o2::Asset)
@@ -206,6 +237,9 @@ CLASS_METHODS_META(o2::Asset)
 	FUNCTION().PUBLIC().SIGNATURE(void, Save, bool);
 	FUNCTION().PUBLIC().SIGNATURE(void, SetDirty, bool);
 	FUNCTION().PUBLIC().SIGNATURE(bool, IsDirty);
+	FUNCTION().PUBLIC().SIGNATURE(LoadState, GetLoadState);
+	FUNCTION().PUBLIC().SIGNATURE(bool, IsLoaded);
+	FUNCTION().PUBLIC().SIGNATURE(UInt64, GetResidentSize);
 	FUNCTION().PUBLIC().SIGNATURE_STATIC(const char*, GetFileExtensions);
 	FUNCTION().PUBLIC().SIGNATURE_STATIC(String, GetEditorIcon);
 	FUNCTION().PUBLIC().SIGNATURE_STATIC(int, GetEditorSorting);
@@ -219,7 +253,11 @@ CLASS_METHODS_META(o2::Asset)
 	FUNCTION().PROTECTED().SIGNATURE(LogStream*, GetAssetsLogStream);
 	FUNCTION().PROTECTED().SIGNATURE(void, SetMeta, AssetMeta*);
 	FUNCTION().PROTECTED().SIGNATURE(void, Load, const AssetInfo&);
+	FUNCTION().PROTECTED().SIGNATURE(void, ApplyInfo, const AssetInfo&);
 	FUNCTION().PROTECTED().SIGNATURE(void, LoadData, const String&);
+	FUNCTION().PROTECTED().SIGNATURE(bool, DecodeData, const String&);
+	FUNCTION().PROTECTED().SIGNATURE(bool, FinalizeData, const String&);
+	FUNCTION().PROTECTED().SIGNATURE(void, ReleaseDecodedData);
 	FUNCTION().PROTECTED().SIGNATURE(void, SaveData, const String&);
 	FUNCTION().PROTECTED().SIGNATURE(void, OnUIDChanged, const UID&);
 }
@@ -246,3 +284,5 @@ CLASS_METHODS_META(o2::AssetWithDefaultMeta<T>)
 	FUNCTION().PUBLIC().SIGNATURE(Meta*, GetMeta);
 }
 END_META;
+
+PRE_ENUM_META(o2::Asset::LoadState);
@@ -13,7 +13,7 @@ namespace o2
 	}
 
 	AssetInfo::AssetInfo(const AssetInfo& other):
-		path(other.path), editTime(other.editTime), tree(other.tree), 
+		path(other.path), editTime(other.editTime), contentHash(other.contentHash), tree(other.tree), 
 		meta(other.meta ? other.meta->CloneAs<AssetMeta>() : nullptr),
 		mOwnChildren(false), mChildren(other.mChildren)
 	{}
@@ -57,6 +57,7 @@ namespace o2
 		meta = other.meta ? other.meta->CloneAs<AssetMeta>() : nullptr;
 		path = other.path;
 		editTime = other.editTime;
+		contentHash = other.contentHash;
 		tree = other.tree;
 		mChildren = other.mChildren;
 		mOwnChildren = false;
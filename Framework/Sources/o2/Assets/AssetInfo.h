@@ -14,8 +14,9 @@ namespace o2
 	{
 		const AssetsTree* tree = nullptr; // Owner asset tree
 		
-		String    path;     // Path of asset @SERIALIZABLE
-		TimeStamp editTime; // Asset edited time @SERIALIZABLE		
+		String    path;            // Path of asset @SERIALIZABLE
+		TimeStamp editTime;        // Asset edited time @SERIALIZABLE
+		UInt64    contentHash = 0; // Hash of source data, meta and converter version, detects changes in building @SERIALIZABLE
 
 		AssetMeta* meta = nullptr; // Asset meta data @SERIALIZABLE
 
@@ -89,6 +90,7 @@ CLASS_FIELDS_META(o2::AssetInfo)
 	FIELD().PUBLIC().DEFAULT_VALUE(nullptr).NAME(tree);
 	FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().NAME(path);
 	FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().NAME(editTime);
+	FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(0).NAME(contentHash);
 	FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(nullptr).NAME(meta);
 	FIELD().PUBLIC().DEFAULT_VALUE(nullptr).NAME(parent);
 	FIELD().PROTECTED().SERIALIZABLE_ATTRIBUTE().NAME(mChildren);
@@ -168,6 +168,16 @@ namespace o2
 		return mAssetPtr != nullptr;
 	}
 
+	Asset::LoadState AssetRef::GetLoadState() const
+	{
+		return mAssetPtr ? mAssetPtr->GetLoadState() : Asset::LoadState::Failed;
+	}
+
+	bool AssetRef::IsLoaded() const
+	{
+		return mAssetPtr && mAssetPtr->IsLoaded();
+	}
+
 	Asset* AssetRef::Get()
 	{
 		return mAssetPtr;
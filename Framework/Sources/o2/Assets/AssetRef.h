@@ -59,6 +59,12 @@ namespace o2
 		// Returns is reference is valid
 		bool IsValid() const;
 
+		// Returns asset loading state. Asset is loading while it is streaming, null reference is failed
+		Asset::LoadState GetLoadState() const;
+
+		// Returns true when reference is valid and asset is loaded
+		bool IsLoaded() const;
+
 		// Returns asset @SCRIPTABLE
 		Asset* Get();
 
@@ -260,6 +266,8 @@ CLASS_METHODS_META(o2::AssetRef)
 	FUNCTION().PUBLIC().CONSTRUCTOR(const String&);
 	FUNCTION().PUBLIC().CONSTRUCTOR(const UID&);
 	FUNCTION().PUBLIC().SIGNATURE(bool, IsValid);
+	FUNCTION().PUBLIC().SIGNATURE(Asset::LoadState, GetLoadState);
+	FUNCTION().PUBLIC().SIGNATURE(bool, IsLoaded);
 	FUNCTION().PUBLIC().SCRIPTABLE_ATTRIBUTE().SIGNATURE(Asset*, Get);
 	FUNCTION().PUBLIC().SIGNATURE(const Asset*, Get);
 	FUNCTION().PUBLIC().SIGNATURE(const Type&, GetAssetType);
@@ -6,6 +6,7 @@
 #include "o2/Assets/Types/FolderAsset.h"
 #include "o2/Assets/Builder/AssetsBuilder.h"
 #include "o2/Config/ProjectConfig.h"
+#include "o2/Render/Render.h"
 #include "o2/Utils/Debug/Debug.h"
 #include "o2/Utils/Debug/Log/LogStream.h"
 #include "o2/Utils/FileSystem/FileSystem.h"
@@ -21,6 +22,7 @@ namespace o2
 		o2Debug.GetLog()->BindStream(mLog);
 
 		mAssetsBuilder = mnew AssetsBuilder();
+		mStreamer = mnew AssetsStreamer();
 
 		LoadAssetTypes();
 
@@ -32,6 +34,7 @@ namespace o2
 
 	Assets::~Assets()
 	{
+		delete mStreamer;
 		delete mAssetsBuilder;
 	}
 
@@ -111,6 +114,12 @@ namespace o2
 			asset->Load(assetInfo);
 
 			cached = FindAssetCache(asset->GetUID());
+			mCacheStats.misses++;
+		}
+		else
+		{
+			UseAssetCache(cached);
+			CompleteAssetLoading(cached->asset);
 		}
 
 		return AssetRef(cached->asset, &cached->referencesCount);
@@ -133,11 +142,150 @@ namespace o2
 			asset->Load(assetInfo);
 
 			cached = FindAssetCache(id);
+			mCacheStats.misses++;
+		}
+		else
+		{
+			UseAssetCache(cached);
+			CompleteAssetLoading(cached->asset);
 		}
 
 		return AssetRef(cached->asset, &cached->referencesCount);
 	}
 
+	AssetRef Assets::LoadAssetAsync(const String& path, int priority /*= 0*/)
+	{
+		auto cached = FindAssetCache(path);
+
+		if (!cached)
+		{
+			auto& assetInfo = GetAssetInfo(path);
+			if (!assetInfo.IsValid())
+				return AssetRef();
+
+			cached = StreamAsset(assetInfo, priority);
+			mCacheStats.misses++;
+		}
+		else
+		{
+			UseAssetCache(cached);
+
+			if (cached->asset->GetLoadState() == Asset::LoadState::Cancelled)
+				StartAssetStreaming(cached->asset, priority);
+		}
+
+		AssetRef res(cached->asset, &cached->referencesCount);
+		SetAssetLoadingPriority(res, priority);
+
+		return res;
+	}
+
+	AssetRef Assets::LoadAssetAsync(const UID& id, int priority /*= 0*/)
+	{
+		auto cached = FindAssetCache(id);
+
+		if (!cached)
+		{
+			auto& assetInfo = GetAssetInfo(id);
+			if (!assetInfo.IsValid())
+			{
+				mLog->Error("Can't load asset by id - " + (String)id);
+				return AssetRef();
+			}
+
+			cached = StreamAsset(assetInfo, priority);
+			mCacheStats.misses++;
+		}
+		else
+		{
+			UseAssetCache(cached);
+
+			if (cached->asset->GetLoadState() == Asset::LoadState::Cancelled)
+				StartAssetStreaming(cached->asset, priority);
+		}
+
+		AssetRef res(cached->asset, &cached->referencesCount);
+		SetAssetLoadingPriority(res, priority);
+
+		return res;
+	}
+
+	TextureRef Assets::LoadTextureAsync(const String& fileName, int priority /*= 0*/)
+	{
+		TextureStreaming* streaming = nullptr;
+		if (mStreamingTextures.TryGetValue(fileName, streaming))
+		{
+			mStreamer->SetPriority(streaming->request, Math::Max(streaming->request->priority, priority));
+			return streaming->texture;
+		}
+
+		if (auto texture = o2Render.mTextures.FindOrDefault([&](Texture* tex) { return tex->GetFileName() == fileName; }))
+			return TextureRef(texture);
+
+		// Texture is registered with file name before loading, so it isn't loaded again by file name
+		streaming = mnew TextureStreaming();
+		streaming->fileName = fileName;
+		streaming->texture = TextureRef(mnew Texture());
+		streaming->texture->mFileName = fileName;
+
+		streaming->request = mStreamer->Add(
+			[streaming]() { streaming->decoded = streaming->bitmap.Load(streaming->fileName); },
+			[this, streaming]() { return FinalizeStreamedTexture(streaming); },
+			[this, streaming]() { CancelStreamedTexture(streaming); },
+			priority);
+
+		mStreamingTextures.Add(fileName, streaming);
+
+		return streaming->texture;
+	}
+
+	void Assets::SetAssetLoadingPriority(const AssetRef& asset, int priority)
+	{
+		AssetStreaming* streaming = nullptr;
+		if (mStreamingAssets.TryGetValue(asset.Get(), streaming))
+			mStreamer->SetPriority(streaming->request, priority);
+	}
+
+	void Assets::CancelAssetLoading(const AssetRef& asset)
+	{
+		AssetStreaming* streaming = nullptr;
+		if (mStreamingAssets.TryGetValue(asset.Get(), streaming))
+			mStreamer->Cancel(streaming->request);
+	}
+
+	void Assets::FinishAssetLoading(const AssetRef& asset)
+	{
+		if (asset)
+			CompleteAssetLoading(asset.Get());
+	}
+
+	void Assets::FinishTextureLoading(const String& fileName)
+	{
+		TextureStreaming* streaming = nullptr;
+		if (mStreamingTextures.TryGetValue(fileName, streaming))
+			mStreamer->Finish(streaming->request);
+	}
+
+	void Assets::SetStreamingFrameBudget(float budget)
+	{
+		mStreamingFrameBudget = budget;
+	}
+
+	float Assets::GetStreamingFrameBudget() const
+	{
+		return mStreamingFrameBudget;
+	}
+
+	AssetsStreamer::Stats Assets::GetStreamingStats() const
+	{
+		return mStreamer->GetStats();
+	}
+
+	void Assets::UpdateStreaming()
+	{
+		mStreamer->Update(mStreamingFrameBudget);
+	}
+
 	bool Assets::IsAssetExist(const String& path) const
 	{
 		return GetAssetInfo(path).meta->ID() != UID::empty;
@@ -331,6 +479,9 @@ namespace o2
 
 	void Assets::RebuildAssets(bool forcible /*= false*/)
 	{
+		// Built files are rewritten while rebuilding, so streaming requests are finished before
+		FinishStreaming();
+
 		auto oldAssetsTrees = mAssetsTrees;
 		mAssetsTrees.Clear();
 
@@ -457,7 +608,6 @@ namespace o2
 
 	void Assets::CheckAssetsUnload()
 	{
-		return;
 		const bool checkDuplications = false;
 		if (checkDuplications)
 		{
@@ -480,12 +630,125 @@ namespace o2
 			}
 		}
 
-		auto cachedAssets = mCachedAssets;
-		for (auto cached : cachedAssets)
+		// Released assets are added to the end of unused assets list, so least recently used assets are first
+		mCacheStats.cachedSize = 0;
+		mCacheStats.unusedSize = 0;
+
+		for (auto cached : mCachedAssets)
+		{
+			bool unused = cached->referencesCount <= 0 && (cached->unused || IsAssetUnloadable(cached->asset));
+			if (unused != cached->unused)
+			{
+				cached->unused = unused;
+
+				if (unused)
+				{
+					cached->residentSize = cached->asset->GetResidentSize();
+					mUnusedAssets.Add(cached);
+				}
+				else
+					mUnusedAssets.Remove(cached);
+			}
+			else if (cached->residentSize == 0 && cached->asset->GetLoadState() != Asset::LoadState::Loading)
+				cached->residentSize = cached->asset->GetResidentSize();
+
+			mCacheStats.cachedSize += cached->residentSize;
+			if (unused)
+				mCacheStats.unusedSize += cached->residentSize;
+		}
+
+		while (mCacheStats.cachedSize > mAssetsCacheBudget && !mUnusedAssets.IsEmpty())
+		{
+			AssetCache* cached = mUnusedAssets[0];
+			mUnusedAssets.RemoveAt(0);
+			cached->unused = false;
+
+			// Asset could be changed without references, it can't be loaded again
+			if (!IsAssetUnloadable(cached->asset))
+				continue;
+
+			mCacheStats.cachedSize -= cached->residentSize;
+			mCacheStats.unusedSize -= cached->residentSize;
+			mCacheStats.evictions++;
+
+			delete cached->asset;
+		}
+	}
+
+	void Assets::SetAssetsCacheBudget(UInt64 budget)
+	{
+		mAssetsCacheBudget = budget;
+	}
+
+	UInt64 Assets::GetAssetsCacheBudget() const
+	{
+		return mAssetsCacheBudget;
+	}
+
+	Assets::CacheStats Assets::GetAssetsCacheStats() const
+	{
+		CacheStats stats = mCacheStats;
+		stats.cachedCount = mCachedAssets.Count();
+		stats.unusedCount = mUnusedAssets.Count();
+		stats.budget = mAssetsCacheBudget;
+
+		return stats;
+	}
+
+	Map<const Type*, UInt64> Assets::GetAssetsCacheSizeByType() const
+	{
+		Map<const Type*, UInt64> res;
+		for (auto cached : mCachedAssets)
+			res[&cached->asset->GetType()] += cached->residentSize;
+
+		return res;
+	}
+
+	bool Assets::CheckAssetsCacheConsistency() const
+	{
+		bool consistent = true;
+
+		for (auto& cacheKV : mCachedAssetsByUID)
+		{
+			if (!mCachedAssets.Contains(cacheKV.second) || cacheKV.second->asset->GetUID() != cacheKV.first)
+			{
+				mLog->Error("Inconsistent asset cache by id: " + (String)cacheKV.first);
+				consistent = false;
+			}
+		}
+
+		for (auto& cacheKV : mCachedAssetsByPath)
 		{
-			if (cached->referencesCount <= 0)
-				delete cached->asset;
+			if (!mCachedAssets.Contains(cacheKV.second) || cacheKV.second->asset->GetPath() != cacheKV.first)
+			{
+				mLog->Error("Inconsistent asset cache by path: \"" + cacheKV.first + "\"");
+				consistent = false;
+			}
+		}
+
+		int unusedCount = 0;
+		for (auto cached : mCachedAssets)
+		{
+			if (!mCachedAssetsByUID.ContainsKey(cached->asset->GetUID()) ||
+				(!cached->asset->GetPath().IsEmpty() && !mCachedAssetsByPath.ContainsKey(cached->asset->GetPath())))
+			{
+				mLog->Error("Asset cache isn't registered: " + (String)cached->asset->GetUID() + " - \"" +
+							cached->asset->GetPath() + "\"");
+				consistent = false;
+			}
+
+			if (cached->unused)
+				unusedCount++;
+		}
+
+		if (unusedCount != mUnusedAssets.Count() || mUnusedAssets.Contains([&](AssetCache* cached) {
+			return !cached->unused || !mCachedAssets.Contains(cached); }))
+		{
+			mLog->Error("Inconsistent unused assets list");
+			consistent = false;
 		}
+
+		return consistent;
 	}
 
 	Assets::AssetCache* Assets::FindAssetCache(const String& path)
@@ -508,12 +771,27 @@ namespace o2
 		mCachedAssets.Clear();
 		mCachedAssetsByPath.Clear();
 		mCachedAssetsByUID.Clear();
+		mUnusedAssets.Clear();
 		mAssetsTrees.Clear();
 
 		for (auto cache : cached)
 		{
-			if (cache->referencesCount == 0)
-				delete cache->asset;
+			if (cache->referencesCount > 0)
+				continue;
+
+			// Streaming request refers to asset, so it's cancelled before deleting asset. Request can't be deleted
+			// while it's decoding, it's waited by finishing
+			AssetStreaming* streaming = nullptr;
+			if (mStreamingAssets.TryGetValue(cache->asset, streaming))
+			{
+				AssetsStreamer::Request* request = streaming->request;
+				mStreamer->Cancel(request);
+
+				if (mStreamingAssets.ContainsKey(cache->asset))
+					mStreamer->Finish(request);
+			}
+
+			delete cache->asset;
 		}
 	}
 
@@ -547,32 +825,43 @@ namespace o2
 	{
 		AssetCache* cached = nullptr;
 		auto fnd = mCachedAssetsByUID.find(asset->GetUID());
-		if (fnd != mCachedAssetsByUID.end()) {
+		if (fnd != mCachedAssetsByUID.end() && fnd->second->asset == asset)
 			cached = fnd->second;
-			mCachedAssetsByUID.erase(fnd);
-		}
+		else
+			cached = mCachedAssets.FindOrDefault([&](AssetCache* cache) { return cache->asset == asset; });
 
-		auto fnd2 = mCachedAssetsByPath.find(asset->GetPath());
-		if (fnd2 != mCachedAssetsByPath.end()) {
-			mCachedAssetsByPath.erase(fnd2);
+		if (!cached)
+		{
+			o2Debug.Log("Asset cache not found!");
+			return;
 		}
 
-		if (cached) {
-			mCachedAssets.Remove(cached);
-			delete cached;
+		if (cached->unused)
+			mUnusedAssets.Remove(cached);
+
+		mCachedAssets.Remove(cached);
+
+		// Maps entries of removed asset are moved to duplicated asset with same id or path, if it is cached
+		if (fnd != mCachedAssetsByUID.end() && fnd->second == cached)
+		{
+			auto duplicate = mCachedAssets.FindOrDefault([&](AssetCache* cache) { return cache->asset->GetUID() == asset->GetUID(); });
+			if (duplicate)
+				fnd->second = duplicate;
+			else
+				mCachedAssetsByUID.erase(fnd);
 		}
-		else {
-			for (auto cache : mCachedAssets)
-			{
-				if (cache->asset == asset)
-				{
-					mCachedAssets.Remove(cache);
-					break;
-				}
-			}
 
-			o2Debug.Log("Asset cache not found!");
+		auto fnd2 = mCachedAssetsByPath.find(asset->GetPath());
+		if (fnd2 != mCachedAssetsByPath.end() && fnd2->second == cached)
+		{
+			auto duplicate = mCachedAssets.FindOrDefault([&](AssetCache* cache) { return cache->asset->GetPath() == asset->GetPath(); });
+			if (duplicate)
+				fnd2->second = duplicate;
+			else
+				mCachedAssetsByPath.erase(fnd2);
 		}
+
+		delete cached;
 	}
 
 	Assets::AssetCache* Assets::UpdateAssetCache(Asset* asset, const String& oldPath, const UID& oldUID)
@@ -606,6 +895,127 @@ namespace o2
 		return cached;
 	}
 
+	void Assets::UseAssetCache(AssetCache* cached)
+	{
+		mCacheStats.hits++;
+
+		if (cached->unused)
+		{
+			cached->unused = false;
+			mUnusedAssets.Remove(cached);
+		}
+	}
+
+	bool Assets::IsAssetUnloadable(const Asset* asset) const
+	{
+		return asset->mLoadState != Asset::LoadState::Loading && !asset->mDirty && asset->mInfo.tree &&
+			asset->mInfo.tree->Find(asset->GetUID());
+	}
+
+	Assets::AssetCache* Assets::StreamAsset(const AssetInfo& info, int priority)
+	{
+		Asset* asset = (Asset*)info.meta->GetAssetType()->CreateSample();
+		asset->ApplyInfo(info);
+
+		StartAssetStreaming(asset, priority);
+
+		return FindAssetCache(asset->GetUID());
+	}
+
+	void Assets::StartAssetStreaming(Asset* asset, int priority)
+	{
+		asset->mLoadState = Asset::LoadState::Loading;
+
+		AssetStreaming* streaming = mnew AssetStreaming();
+		streaming->asset = asset;
+		streaming->path = asset->GetBuiltFullPath();
+
+		streaming->request = mStreamer->Add(
+			[streaming]() { streaming->decoded = streaming->asset->DecodeData(streaming->path); },
+			[this, streaming]() { return FinalizeStreamedAsset(streaming); },
+			[this, streaming]()
+			{
+				streaming->asset->ReleaseDecodedData();
+				streaming->asset->mLoadState = Asset::LoadState::Cancelled;
+				mStreamingAssets.Remove(streaming->asset);
+				delete streaming;
+			},
+			priority);
+
+		mStreamingAssets.Add(asset, streaming);
+	}
+
+	bool Assets::FinalizeStreamedAsset(AssetStreaming* streaming)
+	{
+		Asset* asset = streaming->asset;
+
+		if (streaming->decoded)
+		{
+			if (!asset->FinalizeData(streaming->path))
+				return false;
+
+			asset->mLoadState = Asset::LoadState::Loaded;
+		}
+		else
+		{
+			mLog->Error("Failed to load asset: can't read " + streaming->path);
+			asset->mLoadState = Asset::LoadState::Failed;
+		}
+
+		mStreamingAssets.Remove(asset);
+		delete streaming;
+
+		return true;
+	}
+
+	bool Assets::FinalizeStreamedTexture(TextureStreaming* streaming)
+	{
+		if (streaming->decoded)
+			streaming->texture->Create(&streaming->bitmap);
+		else
+			mLog->Error("Failed to load texture: can't read " + streaming->fileName);
+
+		// Same as loading from file, texture is ready even when file can't be loaded
+		streaming->texture->mReady = true;
+
+		mStreamingTextures.Remove(streaming->fileName);
+		delete streaming;
+
+		return true;
+	}
+
+	void Assets::CancelStreamedTexture(TextureStreaming* streaming)
+	{
+		// Cancelled texture isn't ready, it is unregistered from file name, so it is loaded again when requested
+		streaming->texture->mFileName = "";
+
+		mStreamingTextures.Remove(streaming->fileName);
+		delete streaming;
+	}
+
+	void Assets::CompleteAssetLoading(const Asset* asset)
+	{
+		AssetStreaming* streaming = nullptr;
+		if (mStreamingAssets.TryGetValue(asset, streaming))
+			mStreamer->Finish(streaming->request);
+
+		if (asset->mLoadState == Asset::LoadState::Cancelled)
+		{
+			Asset* cancelledAsset = const_cast<Asset*>(asset);
+			cancelledAsset->LoadData(cancelledAsset->GetBuiltFullPath());
+			cancelledAsset->mLoadState = Asset::LoadState::Loaded;
+		}
+	}
+
+	void Assets::FinishStreaming()
+	{
+		while (!mStreamingAssets.IsEmpty())
+			mStreamer->Finish(mStreamingAssets.begin()->second->request);
+
+		while (!mStreamingTextures.IsEmpty())
+			mStreamer->Finish(mStreamingTextures.begin()->second->request);
+	}
+
 	Assets::AssetCache::~AssetCache()
 	{
 		Assert(referencesCount == 0, "Some references not removed for asset");
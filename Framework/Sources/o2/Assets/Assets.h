@@ -2,7 +2,10 @@
 
 #include "o2/Assets/Asset.h"
 #include "o2/Assets/AssetInfo.h"
+#include "o2/Assets/AssetsStreamer.h"
 #include "o2/Assets/AssetsTree.h"
+#include "o2/Render/TextureRef.h"
+#include "o2/Utils/Bitmap/Bitmap.h"
 #include "o2/Utils/FileSystem/FileInfo.h"
 #include "o2/Utils/Property.h"
 #include "o2/Utils/Serialization/Serializable.h"
@@ -30,6 +33,22 @@ namespace o2
 	public:
 		Function<void(const Vector<UID>&)> onAssetsRebuilt; // Assets rebuilding event
 
+	public:
+		// ------------------------------------------------------
+		// Assets cache counters. Sizes are approximate, in bytes
+		// ------------------------------------------------------
+		struct CacheStats
+		{
+			int    cachedCount = 0; // Count of cached assets
+			int    unusedCount = 0; // Count of cached assets without references, that can be unloaded
+			UInt64 cachedSize = 0;  // Size of cached assets
+			UInt64 unusedSize = 0;  // Size of cached assets without references
+			UInt64 budget = 0;      // Assets cache budget
+			UInt64 hits = 0;        // Count of assets requests found in cache
+			UInt64 misses = 0;      // Count of assets requests, that created new assets
+			UInt64 evictions = 0;   // Count of unused assets unloaded by budget
+		};
+
 	public:
 		// Default constructor
 		Assets();
@@ -70,6 +89,41 @@ namespace o2
 		// Returns asset reference by id
 		AssetRef GetAssetRef(const UID& id);
 
+		// Returns asset reference by path and loads asset on streaming threads. Reference is valid immediately,
+		// asset can be used when it is loaded
+		AssetRef LoadAssetAsync(const String& path, int priority = 0);
+
+		// Returns asset reference by id and loads asset on streaming threads. Reference is valid immediately,
+		// asset can be used when it is loaded
+		AssetRef LoadAssetAsync(const UID& id, int priority = 0);
+
+		// Returns texture reference and loads texture on streaming threads. Texture can be used when it is ready
+		TextureRef LoadTextureAsync(const String& fileName, int priority = 0);
+
+		// Sets loading asset priority. Greater priority assets are loaded earlier
+		void SetAssetLoadingPriority(const AssetRef& asset, int priority);
+
+		// Cancels asset loading. Cancelled asset is loaded synchronously when it is requested by GetAssetRef
+		void CancelAssetLoading(const AssetRef& asset);
+
+		// Finishes asset loading on calling thread
+		void FinishAssetLoading(const AssetRef& asset);
+
+		// Finishes texture loading on calling thread, if texture with file name is streaming
+		void FinishTextureLoading(const String& fileName);
+
+		// Sets time in seconds for finalizing streamed assets on main thread per frame
+		void SetStreamingFrameBudget(float budget);
+
+		// Returns time in seconds for finalizing streamed assets on main thread per frame
+		float GetStreamingFrameBudget() const;
+
+		// Returns streaming counters of queued, loading, waiting finalization, finished and cancelled requests
+		AssetsStreamer::Stats GetStreamingStats() const;
+
+		// Finalizes streamed assets within frame budget. Called by application each frame
+		void UpdateStreaming();
+
 		// Creates asset type _asset_type
 		template<typename _asset_type, typename ... _args>
 		AssetRef CreateAsset(_args ... args);
@@ -128,21 +182,65 @@ namespace o2
 		// Returns main tree
 		const AssetsTree& GetAssetsTree() const;
 
-		// Checks assets with zero references and removes them
+		// Checks assets with zero references and unloads least recently used of them while cache size exceeds budget
 		void CheckAssetsUnload();
 
+		// Sets assets cache budget in bytes. Unused assets are unloaded while cached assets size exceeds budget
+		void SetAssetsCacheBudget(UInt64 budget);
+
+		// Returns assets cache budget in bytes
+		UInt64 GetAssetsCacheBudget() const;
+
+		// Returns assets cache counters. Sizes are updated by CheckAssetsUnload
+		CacheStats GetAssetsCacheStats() const;
+
+		// Returns approximate size of cached assets in bytes by assets types
+		Map<const Type*, UInt64> GetAssetsCacheSizeByType() const;
+
+		// Checks that cached assets maps and unused assets list match cached assets. Logs errors, returns false on mismatch
+		bool CheckAssetsCacheConsistency() const;
+
 		// Makes unique asset name from first path variant
 		String MakeUniqueAssetName(const String& path);
 
 	protected:
+		// ---------------------------------------------------------------------------------------------------------
+		// Cached asset. Assets without references are kept in unused assets list, least recently released are first
+		// ---------------------------------------------------------------------------------------------------------
 		struct AssetCache
 		{
 			Asset* asset;
 			int    referencesCount;
 
+			UInt64 residentSize = 0; // Approximate asset size, measured when asset is loaded and when it is released
+			bool   unused = false;   // Is asset in unused assets list
+
 			~AssetCache();
 		};
 
+		// ---------------------------------------------------------------------------
+		// Streaming asset. Decoded flag is written on streaming thread while decoding
+		// ---------------------------------------------------------------------------
+		struct AssetStreaming
+		{
+			Asset*                   asset = nullptr;   // Streaming asset
+			String                   path;              // Asset built data path
+			bool                     decoded = false;   // Is asset data decoded successfully
+			AssetsStreamer::Request* request = nullptr; // Streaming request
+		};
+
+		// ---------------------------------------------------------------------------------------------------
+		// Streaming texture. Bitmap is decoded on streaming thread, texture is created from it on main thread
+		// ---------------------------------------------------------------------------------------------------
+		struct TextureStreaming
+		{
+			TextureRef               texture;           // Streaming texture, not ready until finalization
+			String                   fileName;          // Texture file name
+			Bitmap                   bitmap;            // Decoded bitmap
+			bool                     decoded = false;   // Is bitmap decoded successfully
+			AssetsStreamer::Request* request = nullptr; // Streaming request
+		};
+
 	protected:
 		AssetsTree*         mMainAssetsTree; // Main assets tree
 		Vector<AssetsTree*> mAssetsTrees;    // Assets trees
@@ -156,6 +254,15 @@ namespace o2
 		Map<String, AssetCache*> mCachedAssetsByPath; // Current cached assets by path
 		Map<UID, AssetCache*>    mCachedAssetsByUID;  // Current cached assets by uid
 
+		Vector<AssetCache*> mUnusedAssets;                      // Cached assets without references, least recently used first
+		UInt64              mAssetsCacheBudget = 256*1024*1024; // Assets cache budget in bytes
+		CacheStats          mCacheStats;                        // Assets cache counters
+
+		AssetsStreamer*                    mStreamer;                      // Assets streamer
+		float                              mStreamingFrameBudget = 0.004f; // Finalizing time per frame in seconds
+		Map<const Asset*, AssetStreaming*> mStreamingAssets;               // Streaming assets
+		Map<String, TextureStreaming*>     mStreamingTextures;             // Streaming textures by file names
+
 	protected:
 		// Loads asset infos
 		void LoadAssetsTree();
@@ -181,6 +288,34 @@ namespace o2
 		// Updates asset chached path and id
 		AssetCache* UpdateAssetCache(Asset* asset, const String& oldPath, const UID& oldUID);
 
+		// Counts cache hit and removes asset from unused assets, it is used again
+		void UseAssetCache(AssetCache* cached);
+
+		// Returns true when asset without references can be unloaded: it isn't loading, isn't changed and can be
+		// loaded again from built assets
+		bool IsAssetUnloadable(const Asset* asset) const;
+
+		// Creates asset by info and starts it's streaming
+		AssetCache* StreamAsset(const AssetInfo& info, int priority);
+
+		// Starts asset streaming
+		void StartAssetStreaming(Asset* asset, int priority);
+
+		// Finalizes streamed asset. Returns false when asset waits other streaming requests
+		bool FinalizeStreamedAsset(AssetStreaming* streaming);
+
+		// Creates streamed texture from decoded bitmap
+		bool FinalizeStreamedTexture(TextureStreaming* streaming);
+
+		// Unregisters cancelled streaming texture
+		void CancelStreamedTexture(TextureStreaming* streaming);
+
+		// Finishes loading of streaming asset, loads cancelled asset synchronously
+		void CompleteAssetLoading(const Asset* asset);
+
+		// Finishes all streaming requests
+		void FinishStreaming();
+
 		// Removes asset by info
 		bool RemoveAsset(const AssetInfo& info, bool rebuildAssets = true);
 
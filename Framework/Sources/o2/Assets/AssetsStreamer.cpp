@@ -0,0 +1,285 @@
+#include "o2/stdafx.h"
+#include "AssetsStreamer.h"
+
+#include <limits>
+
+#include "o2/Utils/Debug/Profiler.h"
+#include "o2/Utils/System/Time/Timer.h"
+
+namespace o2
+{
+	AssetsStreamer::AssetsStreamer(int threadsCount /*= 2*/)
+	{
+		for (int i = 0; i < threadsCount; i++)
+			mThreads.emplace_back(&AssetsStreamer::StreamingThread, this, i);
+	}
+
+	AssetsStreamer::~AssetsStreamer()
+	{
+		CancelAll();
+
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			mStopping = true;
+		}
+		mQueuedCondition.notify_all();
+
+		for (auto& thread : mThreads)
+			thread.join();
+	}
+
+	AssetsStreamer::Request* AssetsStreamer::Add(const Function<void()>& decode, const Function<bool()>& finalize,
+												 const Function<void()>& cancel, int priority /*= 0*/)
+	{
+		Request* request = mnew Request();
+		request->decode = decode;
+		request->finalize = finalize;
+		request->cancel = cancel;
+		request->priority = priority;
+
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			request->order = mRequestsOrder++;
+			mQueued.Add(request);
+		}
+		mQueuedCondition.notify_one();
+
+		return request;
+	}
+
+	void AssetsStreamer::SetPriority(Request* request, int priority)
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		request->priority = priority;
+	}
+
+	void AssetsStreamer::Cancel(Request* request)
+	{
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+
+			// Decoding and finalizing requests are deleted when they are returned to main thread
+			if (request->finalizing || (!RemoveRequest(mQueued, request) && !RemoveRequest(mDecoded, request)))
+			{
+				request->cancelled = true;
+				return;
+			}
+		}
+
+		DeleteCancelled(request);
+	}
+
+	void AssetsStreamer::Finish(Request* request)
+	{
+		if (request->finalizing)
+			return;
+
+		bool queued;
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			request->priority = std::numeric_limits<int>::max();
+			queued = RemoveRequest(mQueued, request);
+		}
+
+		if (queued)
+		{
+			request->decode();
+
+			std::lock_guard<std::mutex> lock(mMutex);
+			mDecoded.Add(request);
+		}
+		else
+		{
+			std::unique_lock<std::mutex> lock(mMutex);
+			mDecodedCondition.wait(lock, [&]() { return mDecoded.Contains(request); });
+		}
+
+		while (!FinalizeRequest(request))
+			ProcessRequests(request);
+	}
+
+	void AssetsStreamer::CancelAll()
+	{
+		Vector<Request*> cancelled;
+
+		{
+			std::unique_lock<std::mutex> lock(mMutex);
+			mDecodedCondition.wait(lock, [&]() { return mInFlightCount == 0; });
+
+			cancelled.Add(mQueued);
+			cancelled.Add(mDecoded.FindAll([](Request* request) { return !request->finalizing; }));
+
+			mQueued.Clear();
+			mDecoded.RemoveAll([](Request* request) { return !request->finalizing; });
+		}
+
+		for (auto request : cancelled)
+			DeleteCancelled(request);
+	}
+
+	void AssetsStreamer::Update(float timeBudget)
+	{
+		FinalizeRequests(timeBudget, {});
+	}
+
+	AssetsStreamer::Stats AssetsStreamer::GetStats() const
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+
+		Stats stats;
+		stats.queued = mQueued.Count();
+		stats.inFlight = mInFlightCount;
+		stats.decoded = mDecoded.Count();
+		stats.finished = mFinishedCount;
+		stats.cancelled = mCancelledCount;
+
+		return stats;
+	}
+
+	void AssetsStreamer::StreamingThread(int threadIndex)
+	{
+		o2Profiler.SetCurrentThreadName("Assets streaming " + (String)threadIndex);
+
+		while (true)
+		{
+			Request* request = nullptr;
+			{
+				std::unique_lock<std::mutex> lock(mMutex);
+				mQueuedCondition.wait(lock, [&]() { return mStopping || !mQueued.IsEmpty(); });
+
+				if (mStopping)
+					return;
+
+				request = FindFirstRequest(mQueued);
+				RemoveRequest(mQueued, request);
+				mInFlightCount++;
+			}
+
+			request->decode();
+
+			{
+				std::lock_guard<std::mutex> lock(mMutex);
+				mInFlightCount--;
+				mDecoded.Add(request);
+			}
+			mDecodedCondition.notify_all();
+		}
+	}
+
+	AssetsStreamer::Request* AssetsStreamer::FindFirstRequest(const Vector<Request*>& requests,
+															  const Vector<Request*>& skip /*= {}*/)
+	{
+		Request* res = nullptr;
+		for (auto request : requests)
+		{
+			if (request->finalizing || skip.Contains(request))
+				continue;
+
+			if (!res || request->priority > res->priority ||
+				(request->priority == res->priority && request->order < res->order))
+			{
+				res = request;
+			}
+		}
+
+		return res;
+	}
+
+	bool AssetsStreamer::RemoveRequest(Vector<Request*>& requests, Request* request)
+	{
+		int idx = requests.IndexOf(request);
+		if (idx < 0)
+			return false;
+
+		requests.RemoveAt(idx);
+		return true;
+	}
+
+	void AssetsStreamer::ProcessRequests(Request* finishing)
+	{
+		Request* request = nullptr;
+		{
+			std::unique_lock<std::mutex> lock(mMutex);
+			request = FindFirstRequest(mQueued);
+
+			if (request)
+				RemoveRequest(mQueued, request);
+			else if (mInFlightCount > 0)
+				mDecodedCondition.wait(lock);
+		}
+
+		if (request)
+		{
+			request->decode();
+
+			std::lock_guard<std::mutex> lock(mMutex);
+			mDecoded.Add(request);
+		}
+
+		// Finishing request is finalized only by Finish, otherwise it would be deleted while Finish uses it
+		FinalizeRequests(std::numeric_limits<float>::max(), { finishing });
+	}
+
+	void AssetsStreamer::FinalizeRequests(float timeBudget, Vector<Request*> waiting)
+	{
+		Timer timer;
+
+		while (timer.GetTime() < timeBudget)
+		{
+			Request* request = nullptr;
+			{
+				std::lock_guard<std::mutex> lock(mMutex);
+				request = FindFirstRequest(mDecoded, waiting);
+			}
+
+			if (!request)
+				break;
+
+			if (!FinalizeRequest(request))
+				waiting.Add(request);
+		}
+	}
+
+	bool AssetsStreamer::FinalizeRequest(Request* request)
+	{
+		if (!request->cancelled)
+		{
+			// Finalization can request and finish other assets, so request is marked to not be finalized again
+			request->finalizing = true;
+			bool finished = request->finalize();
+			request->finalizing = false;
+
+			if (!finished)
+				return false;
+
+			{
+				std::lock_guard<std::mutex> lock(mMutex);
+				RemoveRequest(mDecoded, request);
+				mFinishedCount++;
+			}
+
+			delete request;
+			return true;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			RemoveRequest(mDecoded, request);
+		}
+
+		DeleteCancelled(request);
+		return true;
+	}
+
+	void AssetsStreamer::DeleteCancelled(Request* request)
+	{
+		request->cancel();
+
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			mCancelledCount++;
+		}
+
+		delete request;
+	}
+}
@@ -0,0 +1,116 @@
+#pragma once
+
+#include "o2/Utils/Function/Function.h"
+#include "o2/Utils/Types/Containers/Vector.h"
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace o2
+{
+	// -----------------------------------------------------------------------------------------------------------
+	// Assets streamer. Requests are decoded on streaming threads by priority: reading files and decoding data.
+	// Decoded requests are finalized on main thread with frame time budget, higher priority requests first
+	// -----------------------------------------------------------------------------------------------------------
+	class AssetsStreamer
+	{
+	public:
+		// --------------------------------------------------------------------------------------------------------
+		// Streaming request. Decode function is called on streaming thread, finalize function is called on main
+		// thread until it returns true. Cancel function is called on main thread when request is cancelled
+		// --------------------------------------------------------------------------------------------------------
+		struct Request
+		{
+			Function<void()> decode;   // Reads and decodes data
+			Function<bool()> finalize; // Finalizes decoded data, returns false when waits other requests
+			Function<void()> cancel;   // Releases decoded data
+
+			int    priority = 0;       // Request priority, greater is earlier
+			UInt64 order = 0;          // Adding order, requests with same priority are processed in adding order
+			bool   cancelled = false;  // Is request cancelled while decoding or finalizing
+			bool   finalizing = false; // Is request finalizing now. Used only on main thread
+		};
+
+		// ---------------------------------------
+		// Streaming counters for instrumentation
+		// ---------------------------------------
+		struct Stats
+		{
+			int queued = 0;    // Count of requests waiting for decoding
+			int inFlight = 0;  // Count of requests decoding on streaming threads
+			int decoded = 0;   // Count of decoded requests waiting for finalization
+			int finished = 0;  // Count of finished requests
+			int cancelled = 0; // Count of cancelled requests
+		};
+
+	public:
+		// Constructor. Creates streaming threads
+		AssetsStreamer(int threadsCount = 2);
+
+		// Destructor. Cancels requests and stops streaming threads
+		~AssetsStreamer();
+
+		// Adds request with priority
+		Request* Add(const Function<void()>& decode, const Function<bool()>& finalize, const Function<void()>& cancel,
+					 int priority = 0);
+
+		// Sets request priority
+		void SetPriority(Request* request, int priority);
+
+		// Cancels request. Request is deleted immediately or after decoding
+		void Cancel(Request* request);
+
+		// Finishes request on main thread without time budget: decodes request if it isn't started or waits decoding,
+		// and finalizes it. Other requests are processed while request waits them
+		void Finish(Request* request);
+
+		// Cancels all requests, waits decoding requests
+		void CancelAll();
+
+		// Finalizes decoded requests by priority until time budget in seconds is spent
+		void Update(float timeBudget);
+
+		// Returns streaming counters
+		Stats GetStats() const;
+
+	protected:
+		Vector<std::thread> mThreads; // Streaming threads
+
+		mutable std::mutex      mMutex;            // Requests lists and counters mutex
+		std::condition_variable mQueuedCondition;  // Notifies streaming threads when request queued or streamer stops
+		std::condition_variable mDecodedCondition; // Notifies main thread when request decoded
+
+		Vector<Request*> mQueued;  // Requests waiting for decoding
+		Vector<Request*> mDecoded; // Decoded requests waiting for finalization
+
+		int    mInFlightCount = 0;  // Count of decoding requests
+		int    mFinishedCount = 0;  // Count of finished requests
+		int    mCancelledCount = 0; // Count of cancelled requests
+		UInt64 mRequestsOrder = 0;  // Order of next added request
+		bool   mStopping = false;   // Is streamer stopping, streaming threads must exit
+
+	protected:
+		// Streaming thread function
+		void StreamingThread(int threadIndex);
+
+		// Returns request with greatest priority, skipping finalizing requests and requests from skip list.
+		// Returns null when there are no requests
+		static Request* FindFirstRequest(const Vector<Request*>& requests, const Vector<Request*>& skip = {});
+
+		// Removes request from list, returns false if list doesn't contain it
+		static bool RemoveRequest(Vector<Request*>& requests, Request* request);
+
+		// Decodes one queued request on main thread or waits decoding by streaming threads, then finalizes decoded
+		// requests except finishing request. Used while finishing request
+		void ProcessRequests(Request* finishing);
+
+		// Finalizes decoded requests by priority until time budget in seconds is spent, skips waiting requests
+		void FinalizeRequests(float timeBudget, Vector<Request*> waiting);
+
+		// Finalizes decoded request, returns true when request is finished and deleted
+		bool FinalizeRequest(Request* request);
+
+		// Calls cancel function and deletes request
+		void DeleteCancelled(Request* request);
+	};
+}
@@ -0,0 +1,91 @@
+#include "o2/stdafx.h"
+#include "AnimationAssetConverter.h"
+
+#include "o2/Animation/BakedAnimationClip.h"
+#include "o2/Assets/Builder/AssetsBuilder.h"
+#include "o2/Assets/Types/AnimationAsset.h"
+#include "o2/EngineSettings.h"
+#include "o2/Utils/Debug/Log/LogStream.h"
+#include "o2/Utils/FileSystem/FileSystem.h"
+
+namespace o2
+{
+	Vector<const Type*> AnimationAssetConverter::GetProcessingAssetsTypes() const
+	{
+		Vector<const Type*> res;
+		res.Add(&TypeOf(AnimationAsset));
+		return res;
+	}
+
+	bool AnimationAssetConverter::IsConvertThreadSafe() const
+	{
+		return true;
+	}
+
+	void AnimationAssetConverter::ConvertAsset(const AssetInfo& node)
+	{
+		String sourceAssetPath = mAssetsBuilder->GetSourceAssetsPath() + node.path;
+		String buildedAssetPath = mAssetsBuilder->GetBuiltAssetsPath() + node.path;
+
+		DataDocument data;
+		data.LoadFromFile(sourceAssetPath);
+
+		AnimationBakeSettings settings;
+		if (auto settingsData = data.FindMember("bakeSettings"))
+			settingsData->Get(settings);
+
+		if (!settings.enabled)
+		{
+			o2FileSystem.FileCopy(sourceAssetPath, buildedAssetPath);
+			o2FileSystem.SetFileEditDate(buildedAssetPath, node.editTime);
+			return;
+		}
+
+		AnimationClip clip;
+		if (auto clipData = data.FindMember("animation"))
+			clipData->Get(clip);
+
+		BakedAnimationClip baked;
+		baked.Bake(clip, settings);
+
+		if (baked.GetMaxError() > settings.tolerance)
+		{
+			mAssetsBuilder->LogWarning("Animation " + node.path + " baked with error " + (String)baked.GetMaxError() +
+									   ", greater than tolerance " + (String)settings.tolerance);
+		}
+
+		data.RemoveMember("baked");
+		data.AddMember("baked").Set(baked);
+
+		// Editor loads built animations for editing and saves them into sources, so source tracks are kept there.
+		// Animation player plays baked tracks instead of stripped source tracks
+		if (settings.stripSourceTracks && !IS_EDITOR)
+		{
+			for (auto track : baked.GetTracks())
+				clip.RemoveTrack(track->path);
+
+			data.RemoveMember("animation");
+			data.AddMember("animation").Set(clip);
+		}
+
+		data.SaveToFile(buildedAssetPath);
+		o2FileSystem.SetFileEditDate(buildedAssetPath, node.editTime);
+	}
+
+	void AnimationAssetConverter::RemoveAsset(const AssetInfo& node)
+	{
+		String buildedAssetPath = mAssetsBuilder->GetBuiltAssetsPath() + node.path;
+
+		o2FileSystem.FileDelete(buildedAssetPath);
+	}
+
+	void AnimationAssetConverter::MoveAsset(const AssetInfo& nodeFrom, const AssetInfo& nodeTo)
+	{
+		String fullPathFrom = mAssetsBuilder->GetBuiltAssetsPath() + nodeFrom.path;
+		String fullPathTo = mAssetsBuilder->GetBuiltAssetsPath() + nodeTo.path;
+
+		o2FileSystem.FileMove(fullPathFrom, fullPathTo);
+	}
+}
+
+DECLARE_CLASS(o2::AnimationAssetConverter);
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "IAssetConverter.h"
+
+namespace o2
+{
+	// ------------------------------------------------------------------------------------------------------
+	// Animation assets converter. Copies animation without changes, or bakes it when baking is enabled in
+	// asset bake settings. Baked clip is stored in built asset, baked source tracks are removed from it
+	// outside of editor
+	// ------------------------------------------------------------------------------------------------------
+	class AnimationAssetConverter: public IAssetConverter
+	{
+	public:
+		// Returns vector of processing assets types
+		Vector<const Type*> GetProcessingAssetsTypes() const;
+
+		// Returns true, converter bakes and writes only own built asset
+		bool IsConvertThreadSafe() const;
+
+		// Copies or bakes asset
+		void ConvertAsset(const AssetInfo& node);
+
+		// Removes asset
+		void RemoveAsset(const AssetInfo& node);
+
+		// Moves asset to new path
+		void MoveAsset(const AssetInfo& nodeFrom, const AssetInfo& nodeTo);
+
+		IOBJECT(AnimationAssetConverter);
+	};
+}
+
+CLASS_BASES_META(o2::AnimationAssetConverter)
+{
+	BASE_CLASS(o2::IAssetConverter);
+}
+END_META;
+CLASS_FIELDS_META(o2::AnimationAssetConverter)
+{
+}
+END_META;
+CLASS_METHODS_META(o2::AnimationAssetConverter)
+{
+
+	FUNCTION().PUBLIC().SIGNATURE(Vector<const Type*>, GetProcessingAssetsTypes);
+	FUNCTION().PUBLIC().SIGNATURE(bool, IsConvertThreadSafe);
+	FUNCTION().PUBLIC().SIGNATURE(void, ConvertAsset, const AssetInfo&);
+	FUNCTION().PUBLIC().SIGNATURE(void, RemoveAsset, const AssetInfo&);
+	FUNCTION().PUBLIC().SIGNATURE(void, MoveAsset, const AssetInfo&, const AssetInfo&);
+}
+END_META;
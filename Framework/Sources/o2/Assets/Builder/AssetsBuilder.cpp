@@ -4,13 +4,16 @@
 #include "o2/Assets/Types/AtlasAsset.h"
 #include "o2/Assets/Types/FolderAsset.h"
 #include "o2/Assets/Assets.h"
+#include "o2/Assets/Builder/AnimationAssetConverter.h"
 #include "o2/Assets/Builder/AtlasAssetConverter.h"
 #include "o2/Assets/Builder/FolderAssetConverter.h"
 #include "o2/Assets/Builder/ImageAssetConverter.h"
 #include "o2/Utils/Debug/Debug.h"
 #include "o2/Utils/Debug/Log/LogStream.h"
+#include "o2/Utils/FileSystem/File.h"
 #include "o2/Utils/FileSystem/FileSystem.h"
 #include "o2/Utils/System/Time/Timer.h"
+#include "o2/Utils/Tasks/JobSystem.h"
 
 namespace o2
 {
@@ -62,9 +65,11 @@ namespace o2
         mBuiltAssetsTree->log = mLog;
 
 		ProcessRemovedAssets();
+		CalculateContentHashes();
 		ProcessNewAssets();
 		ProcessModifiedAssets();
 		ConvertersPostProcess();
+		LogConvertersStats();
 
 		if (!mModifiedAssets.IsEmpty())
 		{
@@ -88,6 +93,22 @@ namespace o2
 		return mBuiltAssetsPath;
 	}
 
+	void AssetsBuilder::LogWarning(const String& message)
+	{
+		std::lock_guard<std::mutex> lock(mLogMutex);
+		mLog->Warning(message);
+	}
+
+	void AssetsBuilder::SetParallelBuilding(bool enabled)
+	{
+		mParallelBuilding = enabled;
+	}
+
+	bool AssetsBuilder::IsParallelBuilding() const
+	{
+		return mParallelBuilding && JobSystem::IsSingletonInitialzed() && o2Jobs.GetThreadsCount() > 1;
+	}
+
 	void AssetsBuilder::InitializeConverters()
 	{
 		auto converterTypes = TypeOf(IAssetConverter).GetDerivedTypes();
@@ -221,9 +242,12 @@ namespace o2
 
 		mSourceAssetsTree.SortAssets();
 
-		// in first pass processing folders, in second - files
+		// in first pass processing folders, in second - files. Converting tasks of pass are launched together,
+		// built tree is updated in assets order after converting
 		for (int pass = 0; pass < 2; pass++)
 		{
+			Vector<ConvertTask> tasks;
+
 			for (auto sourceAssetInfo : mSourceAssetsTree.allAssets)
 			{
 				bool isFolder = sourceAssetInfo->meta->GetAssetType() == folderType;
@@ -235,17 +259,19 @@ namespace o2
 				if (fnd != mBuiltAssetsTree->allAssetsByUID.end()) 
 				{
 					auto builtAssetInfo = fnd->second;
+					bool isModified = sourceAssetInfo->contentHash != builtAssetInfo->contentHash;
 
 					if (sourceAssetInfo->path == builtAssetInfo->path)
 					{
-						if (sourceAssetInfo->editTime != builtAssetInfo->editTime ||
-							!sourceAssetInfo->meta->IsEqual(builtAssetInfo->meta))
+						if (isModified)
 						{
-							GetAssetConverter(sourceAssetInfo->meta->GetAssetType())->ConvertAsset(*sourceAssetInfo);
-
-							mModifiedAssets.Add(sourceAssetInfo->meta->ID());
+							ConvertTask task;
+							task.asset = sourceAssetInfo;
+							task.converter = GetAssetConverter(sourceAssetInfo->meta->GetAssetType());
+							tasks.Add(task);
 
 							builtAssetInfo->editTime = sourceAssetInfo->editTime;
+							builtAssetInfo->contentHash = sourceAssetInfo->contentHash;
 							delete builtAssetInfo->meta;
 							builtAssetInfo->meta = sourceAssetInfo->meta->CloneAs<AssetMeta>();
 
@@ -254,8 +280,7 @@ namespace o2
 					}
 					else
 					{
-						if (sourceAssetInfo->editTime != builtAssetInfo->editTime ||
-							!sourceAssetInfo->meta->IsEqual(builtAssetInfo->meta))
+						if (isModified)
 						{
 							GetAssetConverter(builtAssetInfo->meta->GetAssetType())->RemoveAsset(*builtAssetInfo);
 
@@ -265,14 +290,16 @@ namespace o2
 
 							builtAssetInfo->path = sourceAssetInfo->path;
 							builtAssetInfo->editTime = sourceAssetInfo->editTime;
+							builtAssetInfo->contentHash = sourceAssetInfo->contentHash;
 
 							delete builtAssetInfo->meta;
 							builtAssetInfo->meta = sourceAssetInfo->meta->CloneAs<AssetMeta>();
 
-							GetAssetConverter(sourceAssetInfo->meta->GetAssetType())->ConvertAsset(*sourceAssetInfo);
-
-							mModifiedAssets.Add(sourceAssetInfo->meta->ID());
-							mBuiltAssetsTree->AddAsset(builtAssetInfo);
+							ConvertTask task;
+							task.asset = sourceAssetInfo;
+							task.converter = GetAssetConverter(sourceAssetInfo->meta->GetAssetType());
+							task.builtAsset = builtAssetInfo;
+							tasks.Add(task);
 						}
 						else
 						{
@@ -293,6 +320,16 @@ namespace o2
 					}
 				}
 			}
+
+			ConvertAssets(tasks);
+
+			for (auto& task : tasks)
+			{
+				mModifiedAssets.Add(task.asset->meta->ID());
+
+				if (task.builtAsset)
+					mBuiltAssetsTree->AddAsset(task.builtAsset);
+			}
 		}
 	}
 
@@ -305,6 +342,8 @@ namespace o2
 		// in first pass skipping files (only folders), in second - folders
 		for (int pass = 0; pass < 2; pass++)
 		{
+			Vector<ConvertTask> tasks;
+
 			for (auto sourceAssetInfoIt = mSourceAssetsTree.allAssets.Begin(); sourceAssetInfoIt != mSourceAssetsTree.allAssets.End(); ++sourceAssetInfoIt)
 			{
 				auto sourceAssetInfo = *sourceAssetInfoIt;
@@ -321,7 +360,17 @@ namespace o2
 				if (!isNew)
 					continue;
 
-				GetAssetConverter(sourceAssetInfo->meta->GetAssetType())->ConvertAsset(*sourceAssetInfo);
+				ConvertTask task;
+				task.asset = sourceAssetInfo;
+				task.converter = GetAssetConverter(sourceAssetInfo->meta->GetAssetType());
+				tasks.Add(task);
+			}
+
+			ConvertAssets(tasks);
+
+			for (auto& task : tasks)
+			{
+				auto sourceAssetInfo = task.asset;
 
 				mModifiedAssets.Add(sourceAssetInfo->meta->ID());
 
@@ -330,6 +379,7 @@ namespace o2
 				AssetInfo* newBuiltAsset = mnew AssetInfo();
 				newBuiltAsset->path = sourceAssetInfo->path;
 				newBuiltAsset->editTime = sourceAssetInfo->editTime;
+				newBuiltAsset->contentHash = sourceAssetInfo->contentHash;
 				newBuiltAsset->meta = sourceAssetInfo->meta->CloneAs<AssetMeta>();
 
 				mBuiltAssetsTree->AddAsset(newBuiltAsset);
@@ -345,6 +395,115 @@ namespace o2
 		mModifiedAssets.Add(mStdAssetConverter.AssetsPostProcess());
 	}
 
+	// Accumulates FNV-1a hash of data
+	static UInt64 HashData(UInt64 hash, const void* data, UInt size)
+	{
+		const UInt8* bytes = (const UInt8*)data;
+		for (UInt i = 0; i < size; i++)
+		{
+			hash ^= bytes[i];
+			hash *= 1099511628211ULL;
+		}
+
+		return hash;
+	}
+
+	void AssetsBuilder::CalculateContentHashes()
+	{
+		auto& assets = mSourceAssetsTree.allAssets;
+		auto calculateHashes = [&](int begin, int end)
+		{
+			for (int i = begin; i < end; i++)
+				assets[i]->contentHash = CalculateContentHash(*assets[i]);
+		};
+
+		if (!IsParallelBuilding())
+		{
+			calculateHashes(0, assets.Count());
+			return;
+		}
+
+		int batchSize = Math::Max(1, assets.Count()/(o2Jobs.GetThreadsCount()*4));
+		o2Jobs.ParallelFor(assets.Count(), batchSize, calculateHashes);
+	}
+
+	UInt64 AssetsBuilder::CalculateContentHash(const AssetInfo& asset)
+	{
+		UInt64 hash = 14695981039346656037ULL;
+
+		IAssetConverter* converter = GetAssetConverter(asset.meta->GetAssetType());
+		const String& converterName = converter->GetType().GetName();
+		int converterVersion = converter->GetVersion();
+
+		hash = HashData(hash, converterName.Data(), converterName.Length());
+		hash = HashData(hash, &converterVersion, sizeof(converterVersion));
+
+		DataDocument metaData;
+		metaData = asset.meta;
+		String metaString = metaData.SaveAsString();
+		hash = HashData(hash, metaString.Data(), metaString.Length());
+
+		if (asset.meta->GetAssetType() != &TypeOf(FolderAsset))
+		{
+			InFile file(mSourceAssetsPath + asset.path);
+			if (file.IsOpened())
+			{
+				Vector<UInt8> data;
+				data.Resize(file.GetDataSize());
+				UInt size = file.ReadFullData(data.Data());
+
+				hash = HashData(hash, data.Data(), size);
+			}
+		}
+
+		return hash;
+	}
+
+	void AssetsBuilder::ConvertAssets(Vector<ConvertTask>& tasks)
+	{
+		auto convert = [](ConvertTask& task)
+		{
+			Timer timer;
+			task.converter->ConvertAsset(*task.asset);
+			task.time = timer.GetTime();
+		};
+
+		// Thread safe converters tasks are converted by jobs, other tasks are converted on calling thread in order
+		Vector<ConvertTask*> parallelTasks;
+		for (auto& task : tasks)
+		{
+			if (task.converter->IsConvertThreadSafe() && IsParallelBuilding())
+				parallelTasks.Add(&task);
+			else
+				convert(task);
+		}
+
+		if (!parallelTasks.IsEmpty())
+		{
+			o2Jobs.ParallelFor(parallelTasks.Count(), 1, [&](int begin, int end)
+			{
+				for (int i = begin; i < end; i++)
+					convert(*parallelTasks[i]);
+			});
+		}
+
+		for (auto& task : tasks)
+		{
+			auto& stats = mConvertersStats[task.converter];
+			stats.count++;
+			stats.time += task.time;
+		}
+	}
+
+	void AssetsBuilder::LogConvertersStats()
+	{
+		for (auto& statsKV : mConvertersStats)
+		{
+			mLog->Out("Converter " + statsKV.first->GetType().GetName() + ": " + (String)statsKV.second.count +
+					  " assets for " + (String)statsKV.second.time + " seconds");
+		}
+	}
+
 	void AssetsBuilder::GenerateMeta(const Type& assetType, const String& metaFullPath)
 	{
 		auto assetTypeSample = (Asset*)assetType.CreateSample();
@@ -370,6 +529,7 @@ namespace o2
 	void AssetsBuilder::Reset()
 	{
 		mModifiedAssets.Clear();
+		mConvertersStats.Clear();
 		mSourceAssetsTree.Clear();
 		mBuiltAssetsTree->Clear();
 
@@ -5,6 +5,7 @@
 #include "o2/Assets/AssetsTree.h"
 #include "o2/Assets/Builder/StdAssetConverter.h"
 #include "o2/Utils/Types/String.h"
+#include <mutex>
 
 namespace o2
 {
@@ -33,8 +34,41 @@ namespace o2
 		// Returns built assets path in building
 		const String& GetBuiltAssetsPath() const;
 
+		// Outputs warning into builder log. Can be called by converters from converting jobs
+		void LogWarning(const String& message);
+
+		// Sets converting and hashing assets by jobs enabled. Enabled by default
+		void SetParallelBuilding(bool enabled);
+
+		// Returns true when parallel building is enabled and jobs system is available
+		bool IsParallelBuilding() const;
+
 	protected:
-		LogStream* mLog; // Asset builder log stream
+		// -------------------------------------------------------------------------------------------
+		// Asset converting task. Tasks of one pass are converted together, in parallel when possible
+		// -------------------------------------------------------------------------------------------
+		struct ConvertTask
+		{
+			const AssetInfo* asset = nullptr;      // Source asset info
+			IAssetConverter* converter = nullptr;  // Asset converter
+			AssetInfo*       builtAsset = nullptr; // Moved built asset info, added into built tree after converting
+			float            time = 0.0f;          // Converting time in seconds
+
+			bool operator==(const ConvertTask& other) const { return asset == other.asset; }
+		};
+
+		// ------------------------------------
+		// Converter statistics of one building
+		// ------------------------------------
+		struct ConverterStats
+		{
+			int   count = 0;   // Converted assets count
+			float time = 0.0f; // Summary converting time in seconds
+		};
+
+	protected:
+		LogStream* mLog;      // Asset builder log stream
+		std::mutex mLogMutex; // Log mutex, converters log from converting jobs
 
 		String     mSourceAssetsPath;     // Source assets path
 		AssetsTree mSourceAssetsTree;     // Source assets tree
@@ -48,6 +82,10 @@ namespace o2
 		Map<const Type*, IAssetConverter*> mAssetConverters;   // Assets converters by type
 		StdAssetConverter                  mStdAssetConverter; // Standard assets converter
 
+		Map<IAssetConverter*, ConverterStats> mConvertersStats; // Converters timing statistics of current building
+
+		bool mParallelBuilding = true; // Is converting and hashing assets by jobs enabled
+
 	protected:
 		// Initializes converters
 		void InitializeConverters();
@@ -69,6 +107,18 @@ namespace o2
 
 		// Launches converters post process
 		void ConvertersPostProcess();
+
+		// Calculates content hashes of source assets. Hashes are calculated in parallel when possible
+		void CalculateContentHashes();
+
+		// Returns hash of asset source data, serialized meta, converter type and version
+		UInt64 CalculateContentHash(const AssetInfo& asset);
+
+		// Converts assets by tasks and collects converters statistics. Thread safe converters are launched by jobs
+		void ConvertAssets(Vector<ConvertTask>& tasks);
+
+		// Outputs converters timing statistics into log
+		void LogConvertersStats();
 		
 		// Processes folder for missing metas
 		void ProcessMissingMetasCreation(FolderInfo& folder);
@@ -82,6 +132,7 @@ namespace o2
 		// Resets builder
 		void Reset();
 
+		friend class AnimationAssetConverter;
 		friend class AtlasAssetConverter;
 	};
 }
@@ -7,6 +7,8 @@
 #include "o2/Utils/Bitmap/Bitmap.h"
 #include "o2/Utils/Debug/Log/LogStream.h"
 #include "o2/Utils/FileSystem/FileSystem.h"
+#include "o2/Utils/System/Time/Timer.h"
+#include "o2/Utils/Tasks/JobSystem.h"
 
 namespace o2
 {
@@ -184,13 +186,25 @@ namespace o2
 		auto meta = (AtlasAsset::Meta*)atlasInfo->meta;
 
 		RectsPacker packer(meta->windows.maxSize);
+		packer.SetAlgorithm(meta->packer);
+
 		float imagesBorder = (float)meta->border;
 
-		// Initialize pack images
+		// Runs func for range [0, count) by jobs if they are available, or on calling thread
+		auto parallelFor = [&](int count, const Function<void(int, int)>& func)
+		{
+			if (count > 1 && mAssetsBuilder->IsParallelBuilding())
+				o2Jobs.ParallelFor(count, 1, func);
+			else
+				func(0, count);
+		};
+
+		Timer timer;
+
+		// Find images infos
 		Vector<ImagePackDef> packImages;
 		for (auto img : images)
 		{
-			// Find image info
 			AssetInfo* imgInfo = nullptr;
 			mAssetsBuilder->mBuiltAssetsTree->allAssetsByUID.TryGetValue(img.id, imgInfo);
 			if (!imgInfo)
@@ -199,38 +213,56 @@ namespace o2
 				continue;
 			}
 
-			String assetFullPath = mAssetsBuilder->GetSourceAssetsPath() + imgInfo->path;
+			ImagePackDef imagePackDef;
+			imagePackDef.assetInfo = imgInfo;
+			imagePackDef.bitmap = mnew Bitmap();
+
+			packImages.Add(imagePackDef);
+		}
+
+		// Load bitmaps. Images are independent, errors are logged after loading
+		Vector<UInt8> loaded;
+		loaded.Resize(packImages.Count());
 
-			// Load bitmap
-			Bitmap* bitmap = mnew Bitmap();
-			if (!bitmap->Load(assetFullPath))
+		parallelFor(packImages.Count(), [&](int begin, int end)
+		{
+			for (int i = begin; i < end; i++)
 			{
-				mAssetsBuilder->mLog->Error("Can't load bitmap for image asset: " + imgInfo->path);
-				delete bitmap;
-				continue;
+				String assetFullPath = mAssetsBuilder->GetSourceAssetsPath() + packImages[i].assetInfo->path;
+				loaded[i] = packImages[i].bitmap->Load(assetFullPath) ? 1 : 0;
 			}
+		});
 
-			// Create packing rect
-			RectsPacker::Rect* packRect = packer.AddRect(bitmap->GetSize() +
-														 Vec2F(imagesBorder*2.0f, imagesBorder*2.0f));
-
-			ImagePackDef imagePackDef;
-			imagePackDef.assetInfo = imgInfo;
-			imagePackDef.bitmap = bitmap;
-			imagePackDef.packRect = packRect;
+		for (int i = packImages.Count() - 1; i >= 0; i--)
+		{
+			if (loaded[i])
+				continue;
 
-			packImages.Add(imagePackDef);
+			mAssetsBuilder->mLog->Error("Can't load bitmap for image asset: " + packImages[i].assetInfo->path);
+			delete packImages[i].bitmap;
+			packImages.RemoveAt(i);
 		}
 
+		// Create packing rects
+		for (auto& imgDef : packImages)
+			imgDef.packRect = packer.AddRect(imgDef.bitmap->GetSize() + Vec2F(imagesBorder*2.0f, imagesBorder*2.0f));
+
+		float loadingTime = timer.GetDeltaTime();
+
 		// Try to pack
 		if (!packer.Pack())
 		{
 			mAssetsBuilder->mLog->Error("Atlas " + atlasInfo->path + " packing failed");
+
+			for (auto& imgDef : packImages)
+				delete imgDef.bitmap;
+
 			return;
 		}
-		else mAssetsBuilder->mLog->Out("Atlas " + atlasInfo->path + " successfully packed");
 
-		// Initialize bitmaps and pages
+		float packingTime = timer.GetDeltaTime();
+
+		// Initialize pages
 		int pagesCount = packer.GetPagesCount();
 		Vector<Bitmap*> resAtlasBitmaps;
 		Vector<AtlasAsset::Page> resAtlasPages;
@@ -241,37 +273,64 @@ namespace o2
 			atlasPage.mSize = packer.GetMaxSize();
 			resAtlasPages.Add(atlasPage);
 
-			Bitmap* newBitmap = mnew Bitmap(PixelFormat::R8G8B8A8, packer.GetMaxSize());
-			newBitmap->Fill(Color4(255, 255, 255, 0));
-
-			resAtlasBitmaps.Add(newBitmap);
+			resAtlasBitmaps.Add(mnew Bitmap(PixelFormat::R8G8B8A8, packer.GetMaxSize()));
 		}
 
-		// Save image assets data and fill pages
-		for (auto imgDef : packImages)
+		// Save image assets data
+		for (auto& imgDef : packImages)
 		{
 			imgDef.packRect->rect.left += imagesBorder;
 			imgDef.packRect->rect.right -= imagesBorder;
 			imgDef.packRect->rect.top -= imagesBorder;
 			imgDef.packRect->rect.bottom += imagesBorder;
 
-			resAtlasBitmaps[imgDef.packRect->page]->CopyImage(imgDef.bitmap,
-															  imgDef.packRect->rect.LeftBottom());
-
 			resAtlasPages[imgDef.packRect->page].mImagesRects.Add(imgDef.assetInfo->meta->ID(),
 																  imgDef.packRect->rect);
 
 			SaveImageAsset(imgDef);
 		}
 
+		// Fill pages. Packed rectangles don't intersect, so images are copied in parallel
+		parallelFor(pagesCount, [&](int begin, int end)
+		{
+			for (int i = begin; i < end; i++)
+				resAtlasBitmaps[i]->Fill(Color4(255, 255, 255, 0));
+		});
+
+		parallelFor(packImages.Count(), [&](int begin, int end)
+		{
+			for (int i = begin; i < end; i++)
+			{
+				auto& imgDef = packImages[i];
+				resAtlasBitmaps[imgDef.packRect->page]->CopyImage(imgDef.bitmap, imgDef.packRect->rect.LeftBottom());
+			}
+		});
+
+		for (auto& imgDef : packImages)
+			delete imgDef.bitmap;
+
+		float composingTime = timer.GetDeltaTime();
+
 		// Save pages bitmaps
-		for (int i = 0; i < pagesCount; i++)
+		parallelFor(pagesCount, [&](int begin, int end)
 		{
-			resAtlasBitmaps[i]->Save(mAssetsBuilder->GetBuiltAssetsPath() + atlasInfo->path + (String)i + ".png",
-									 Bitmap::ImageType::Png);
+			for (int i = begin; i < end; i++)
+			{
+				resAtlasBitmaps[i]->Save(mAssetsBuilder->GetBuiltAssetsPath() + atlasInfo->path + (String)i + ".png",
+										 Bitmap::ImageType::Png);
+			}
+		});
 
-			delete resAtlasBitmaps[i];
-		}
+		for (auto bitmap : resAtlasBitmaps)
+			delete bitmap;
+
+		float savingTime = timer.GetDeltaTime();
+
+		mAssetsBuilder->mLog->Out("Atlas " + atlasInfo->path + " successfully packed: " + (String)packImages.Count() +
+								  " images, " + (String)pagesCount + " pages, efficiency " +
+								  (String)packer.GetPackingEfficiency() + ". Loading " + (String)loadingTime +
+								  " sec, packing " + (String)packingTime + " sec, composing " + (String)composingTime +
+								  " sec, saving " + (String)savingTime + " sec");
 
 		// Save atlas data
 		String atlasFullPath = mAssetsBuilder->GetSourceAssetsPath() + atlasInfo->path;
@@ -10,6 +10,16 @@ namespace o2
 		return Vector<const Type*>();
 	}
 
+	int IAssetConverter::GetVersion() const
+	{
+		return 1;
+	}
+
+	bool IAssetConverter::IsConvertThreadSafe() const
+	{
+		return false;
+	}
+
 	void IAssetConverter::ConvertAsset(const AssetInfo& node)
 	{}
 
@@ -23,6 +23,12 @@ namespace o2
 		// Returns vector of processing assets types
 		virtual Vector<const Type*> GetProcessingAssetsTypes() const;
 
+		// Returns converter version. Increase it when converted data changes, built assets are converted again
+		virtual int GetVersion() const;
+
+		// Returns true when converter can convert different assets at the same time from jobs
+		virtual bool IsConvertThreadSafe() const;
+
 		// Converts asset by path
 		virtual void ConvertAsset(const AssetInfo& node);
 
@@ -63,6 +69,8 @@ CLASS_METHODS_META(o2::IAssetConverter)
 {
 
 	FUNCTION().PUBLIC().SIGNATURE(Vector<const Type*>, GetProcessingAssetsTypes);
+	FUNCTION().PUBLIC().SIGNATURE(int, GetVersion);
+	FUNCTION().PUBLIC().SIGNATURE(bool, IsConvertThreadSafe);
 	FUNCTION().PUBLIC().SIGNATURE(void, ConvertAsset, const AssetInfo&);
 	FUNCTION().PUBLIC().SIGNATURE(void, RemoveAsset, const AssetInfo&);
 	FUNCTION().PUBLIC().SIGNATURE(void, MoveAsset, const AssetInfo&, const AssetInfo&);
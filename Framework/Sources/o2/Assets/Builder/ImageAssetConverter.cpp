@@ -15,6 +15,11 @@ namespace o2
 		return res;
 	}
 
+	bool ImageAssetConverter::IsConvertThreadSafe() const
+	{
+		return true;
+	}
+
 	void ImageAssetConverter::ConvertAsset(const AssetInfo& node)
 	{
 		String sourceAssetPath = mAssetsBuilder->GetSourceAssetsPath() + node.path;
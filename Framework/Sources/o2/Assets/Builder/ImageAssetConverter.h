@@ -13,6 +13,9 @@ namespace o2
 		// Returns vector of processing assets types
 		Vector<const Type*> GetProcessingAssetsTypes() const;
 
+		// Returns true, converter writes only own built asset
+		bool IsConvertThreadSafe() const;
+
 		// Converts image
 		void ConvertAsset(const AssetInfo& node);
 
@@ -39,6 +42,7 @@ CLASS_METHODS_META(o2::ImageAssetConverter)
 {
 
 	FUNCTION().PUBLIC().SIGNATURE(Vector<const Type*>, GetProcessingAssetsTypes);
+	FUNCTION().PUBLIC().SIGNATURE(bool, IsConvertThreadSafe);
 	FUNCTION().PUBLIC().SIGNATURE(void, ConvertAsset, const AssetInfo&);
 	FUNCTION().PUBLIC().SIGNATURE(void, RemoveAsset, const AssetInfo&);
 	FUNCTION().PUBLIC().SIGNATURE(void, MoveAsset, const AssetInfo&, const AssetInfo&);
@@ -17,6 +17,11 @@ namespace o2
 		return res;
 	}
 
+	bool StdAssetConverter::IsConvertThreadSafe() const
+	{
+		return true;
+	}
+
 	void StdAssetConverter::ConvertAsset(const AssetInfo& node)
 	{
 		String sourceAssetPath = mAssetsBuilder->GetSourceAssetsPath() + node.path;
@@ -6,7 +6,8 @@
 namespace o2
 {
 	AnimationAsset::AnimationAsset(const AnimationAsset& other):
-		AssetWithDefaultMeta<AnimationAsset>(other), animation(other.animation)
+		AssetWithDefaultMeta<AnimationAsset>(other), animation(other.animation),
+		bakeSettings(other.bakeSettings), baked(other.baked)
 	{}
 
 	AnimationAsset::AnimationAsset(const AnimationClip& clip):
@@ -17,6 +18,8 @@ namespace o2
 	{
 		Asset::operator=(other);
 		animation = other.animation;
+		bakeSettings = other.bakeSettings;
+		baked = other.baked;
 
 		return *this;
 	}
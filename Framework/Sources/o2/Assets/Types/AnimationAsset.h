@@ -1,6 +1,7 @@
 #pragma once
 
 #include "o2/Animation/AnimationClip.h"
+#include "o2/Animation/BakedAnimationClip.h"
 #include "o2/Assets/Asset.h"
 #include "o2/Assets/AssetRef.h"
 #include "o2/Utils/Editor/Attributes/ExpandedByDefaultAttribute.h"
@@ -15,6 +16,9 @@ namespace o2
 	public:
 		AnimationClip animation; // Asset data @SERIALIZABLE @EXPANDED_BY_DEFAULT
 
+		AnimationBakeSettings bakeSettings; // Baking settings, used by assets builder @SERIALIZABLE
+		BakedAnimationClip    baked;        // Baked animation, filled by assets builder, played instead of stripped tracks @SERIALIZABLE @EDITOR_IGNORE
+
 	public:
 		// Default constructor
 		AnimationAsset() = default;
@@ -59,6 +63,8 @@ END_META;
 CLASS_FIELDS_META(o2::AnimationAsset)
 {
 	FIELD().PUBLIC().EXPANDED_BY_DEFAULT_ATTRIBUTE().SERIALIZABLE_ATTRIBUTE().NAME(animation);
+	FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().NAME(bakeSettings);
+	FIELD().PUBLIC().EDITOR_IGNORE_ATTRIBUTE().SERIALIZABLE_ATTRIBUTE().NAME(baked);
 }
 END_META;
 CLASS_METHODS_META(o2::AnimationAsset)
@@ -13,7 +13,7 @@ namespace o2
 
 		Meta* otherMeta = (Meta*)other;
 		return ios == otherMeta->ios && android == otherMeta->android && macOS == otherMeta->macOS &&
-			windows == otherMeta->windows && Math::Equals(border, otherMeta->border);
+			windows == otherMeta->windows && Math::Equals(border, otherMeta->border) && packer == otherMeta->packer;
 	}
 
 	UInt AtlasAsset::Page::ID() const
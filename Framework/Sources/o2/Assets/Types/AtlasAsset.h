@@ -2,6 +2,7 @@
 
 #include "o2/Assets/Asset.h"
 #include "o2/Render/TextureRef.h"
+#include "o2/Utils/Tools/RectPacker.h"
 #include "o2/Utils/Types/Ref.h"
 #include "o2/Assets/Types/ImageAsset.h"
 
@@ -96,6 +97,8 @@ namespace o2
 			PlatformMeta windows; // Windows specified meta @SERIALIZABLE
 			int          border;  // Images pack border @SERIALIZABLE
 
+			RectsPacker::Algorithm packer = RectsPacker::Algorithm::MaxRects; // Images packing algorithm @SERIALIZABLE
+
 		public:
 			// Returns true if other meta is equal to this
 			bool IsEqual(AssetMeta* other) const override;
@@ -217,6 +220,7 @@ CLASS_FIELDS_META(o2::AtlasAsset::Meta)
 	FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().NAME(macOS);
 	FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().NAME(windows);
 	FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().NAME(border);
+	FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(RectsPacker::Algorithm::MaxRects).NAME(packer);
 }
 END_META;
 CLASS_METHODS_META(o2::AtlasAsset::Meta)
@@ -81,20 +81,38 @@ namespace o2
 		}
 	}
 
+	UInt64 BinaryAsset::GetResidentSize() const
+	{
+		return GetType().GetSize() + mDataSize;
+	}
+
 	const char* BinaryAsset::GetFileExtensions()
 	{
 		return "bin";
 	}
 
 	void BinaryAsset::LoadData(const String& path)
+	{
+		if (!DecodeData(path))
+			GetAssetsLogStream()->Error("Failed to load binary asset data: can't open file " + path);
+	}
+
+	bool BinaryAsset::DecodeData(const String& path)
 	{
 		InFile file(path);
 		if (!file.IsOpened())
-			GetAssetsLogStream()->Error("Failed to load binary asset data: can't open file " + path);
+			return false;
 
 		mDataSize = file.GetDataSize();
 		mData = mnew char[mDataSize];
 		file.ReadFullData(mData);
+
+		return true;
+	}
+
+	bool BinaryAsset::FinalizeData(const String& path)
+	{
+		return true;
 	}
 
 	void BinaryAsset::SaveData(const String& path) const
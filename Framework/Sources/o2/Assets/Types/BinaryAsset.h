@@ -37,6 +37,9 @@ namespace o2
 		// Sets data and size
 		void SetData(char* data, UInt size);
 
+		// Returns size of asset with data
+		UInt64 GetResidentSize() const override;
+
 		// Returns extensions string
 		static const char* GetFileExtensions();
 
@@ -53,6 +56,12 @@ namespace o2
 		// Loads asset data, using DataValue and serialization
 		void LoadData(const String& path) override;
 
+		// Reads data on streaming thread
+		bool DecodeData(const String& path) override;
+
+		// Returns true, data is already read
+		bool FinalizeData(const String& path) override;
+
 		// Saves asset data, using DataValue and serialization
 		void SaveData(const String& path) const override;
 
@@ -83,9 +92,12 @@ CLASS_METHODS_META(o2::BinaryAsset)
 	FUNCTION().PUBLIC().SIGNATURE(char*, GetData);
 	FUNCTION().PUBLIC().SIGNATURE(UInt, GetDataSize);
 	FUNCTION().PUBLIC().SIGNATURE(void, SetData, char*, UInt);
+	FUNCTION().PUBLIC().SIGNATURE(UInt64, GetResidentSize);
 	FUNCTION().PUBLIC().SIGNATURE_STATIC(const char*, GetFileExtensions);
 	FUNCTION().PUBLIC().SIGNATURE_STATIC(int, GetEditorSorting);
 	FUNCTION().PROTECTED().SIGNATURE(void, LoadData, const String&);
+	FUNCTION().PROTECTED().SIGNATURE(bool, DecodeData, const String&);
+	FUNCTION().PROTECTED().SIGNATURE(bool, FinalizeData, const String&);
 	FUNCTION().PROTECTED().SIGNATURE(void, SaveData, const String&);
 }
 END_META;
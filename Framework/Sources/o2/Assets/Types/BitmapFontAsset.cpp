@@ -39,6 +39,11 @@ namespace o2
 		if (!mFont)
 			mFont = mnew BitmapFont(path);
 	}
+
+	bool BitmapFontAsset::DecodeData(const String& path)
+	{
+		return true;
+	}
 }
 DECLARE_TEMPLATE_CLASS(o2::DefaultAssetMeta<o2::BitmapFontAsset>);
 DECLARE_TEMPLATE_CLASS(o2::Ref<o2::BitmapFontAsset>);
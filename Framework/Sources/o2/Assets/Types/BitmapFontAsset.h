@@ -53,6 +53,9 @@ namespace o2
 		// Loads data
 		void LoadData(const String& path) override;
 
+		// Returns true, nothing is decoded on streaming thread. Font is created by render on finalization
+		bool DecodeData(const String& path) override;
+
 		friend class Assets;
 	};
 
@@ -78,6 +81,7 @@ CLASS_METHODS_META(o2::BitmapFontAsset)
 	FUNCTION().PUBLIC().SIGNATURE_STATIC(const char*, GetFileExtensions);
 	FUNCTION().PUBLIC().SIGNATURE_STATIC(int, GetEditorSorting);
 	FUNCTION().PROTECTED().SIGNATURE(void, LoadData, const String&);
+	FUNCTION().PROTECTED().SIGNATURE(bool, DecodeData, const String&);
 }
 END_META;
 
@@ -31,6 +31,17 @@ namespace o2
 		data.LoadFromFile(path);
 	}
 
+	bool DataAsset::DecodeData(const String& path)
+	{
+		data.Clear();
+		return data.LoadFromFile(path);
+	}
+
+	bool DataAsset::FinalizeData(const String& path)
+	{
+		return true;
+	}
+
 	void DataAsset::SaveData(const String& path) const
 	{
 		data.SaveToFile(path);
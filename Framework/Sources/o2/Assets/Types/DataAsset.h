@@ -41,6 +41,12 @@ namespace o2
 		// Loads data
 		void LoadData(const String& path) override;
 
+		// Reads data on streaming thread
+		bool DecodeData(const String& path) override;
+
+		// Returns true, data is already read
+		bool FinalizeData(const String& path) override;
+
 		// Saves data
 		void SaveData(const String& path) const override;
 
@@ -70,6 +76,8 @@ CLASS_METHODS_META(o2::DataAsset)
 	FUNCTION().PUBLIC().SIGNATURE_STATIC(int, GetEditorSorting);
 	FUNCTION().PUBLIC().SIGNATURE_STATIC(bool, IsAvailableToCreateFromEditor);
 	FUNCTION().PROTECTED().SIGNATURE(void, LoadData, const String&);
+	FUNCTION().PROTECTED().SIGNATURE(bool, DecodeData, const String&);
+	FUNCTION().PROTECTED().SIGNATURE(bool, FinalizeData, const String&);
 	FUNCTION().PROTECTED().SIGNATURE(void, SaveData, const String&);
 }
 END_META;
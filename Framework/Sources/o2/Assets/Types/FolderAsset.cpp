@@ -31,6 +31,11 @@ namespace o2
 	void FolderAsset::LoadData(const String& path)
 	{}
 
+	bool FolderAsset::DecodeData(const String& path)
+	{
+		return true;
+	}
+
 	void FolderAsset::SaveData(const String& path) const
 	{
 		if (!o2FileSystem.IsFolderExist(path))
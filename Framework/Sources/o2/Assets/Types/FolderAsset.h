@@ -38,6 +38,9 @@ namespace o2
 		// Loads data
 		void LoadData(const String& path) override;
 
+		// Returns true, nothing is decoded on streaming thread. Folder hasn't data
+		bool DecodeData(const String& path) override;
+
 		// Saves asset data
 		void SaveData(const String& path) const override;
 
@@ -66,6 +69,7 @@ CLASS_METHODS_META(o2::FolderAsset)
 	FUNCTION().PUBLIC().SIGNATURE_STATIC(int, GetEditorSorting);
 	FUNCTION().PUBLIC().SIGNATURE_STATIC(bool, IsAvailableToCreateFromEditor);
 	FUNCTION().PROTECTED().SIGNATURE(void, LoadData, const String&);
+	FUNCTION().PROTECTED().SIGNATURE(bool, DecodeData, const String&);
 	FUNCTION().PROTECTED().SIGNATURE(void, SaveData, const String&);
 }
 END_META;
@@ -1,6 +1,8 @@
 #include "o2/stdafx.h"
 #include "ImageAsset.h"
 
+#include <limits>
+
 #include "o2/Assets/Types/AtlasAsset.h"
 #include "o2/Assets/Assets.h"
 #include "o2/Utils/Bitmap/Bitmap.h"
@@ -133,6 +135,18 @@ namespace o2
 		return AtlasAsset::GetPageTextureRef(o2Assets.GetAssetInfo(GetAtlas()), GetAtlasPage());
 	}
 
+	UInt64 ImageAsset::GetResidentSize() const
+	{
+		UInt64 res = GetType().GetSize();
+		if (mBitmap)
+		{
+			int bytesPerPixel = mBitmap->GetFormat() == PixelFormat::R8G8B8 ? 3 : 4;
+			res += (UInt64)mBitmap->GetSize().x*mBitmap->GetSize().y*bytesPerPixel;
+		}
+
+		return res;
+	}
+
 	ImageAsset::Meta* ImageAsset::GetMeta() const
 	{
 		return (Meta*)mInfo.meta;
@@ -143,6 +157,24 @@ namespace o2
 		return "png jpg bmp";
 	}
 
+	bool ImageAsset::FinalizeData(const String& path)
+	{
+		if (mDecodedData)
+		{
+			Asset::FinalizeData(path);
+
+			// Image is already finalizing, so texture is streamed before other waiting requests
+			auto& atlasInfo = o2Assets.GetAssetInfo(GetAtlas());
+			if (atlasInfo.IsValid())
+			{
+				mAtlasPageTexture = o2Assets.LoadTextureAsync(AtlasAsset::GetPageTextureFileName(atlasInfo, mAtlasPage),
+															  std::numeric_limits<int>::max());
+			}
+		}
+
+		return !mAtlasPageTexture || mAtlasPageTexture->IsReady();
+	}
+
 	void ImageAsset::SaveData(const String& path) const
 	{
 		if (mBitmap)
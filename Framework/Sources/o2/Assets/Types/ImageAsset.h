@@ -87,6 +87,9 @@ namespace o2
 		// Returns atlas texture reference
 		TextureRef GetAtlasTextureRef() const;
 
+		// Returns approximate size of image in memory with loaded bitmap. Atlas page texture isn't counted, it is shared
+		UInt64 GetResidentSize() const override;
+
 		// Returns meta information
 		Meta* GetMeta() const;
 
@@ -137,7 +140,12 @@ namespace o2
 		UInt  mAtlasPage; // Owner atlas page index @SERIALIZABLE
 		RectI mAtlasRect; // Owner atlas rectangle @SERIALIZABLE
 
+		TextureRef mAtlasPageTexture; // Atlas page texture, requested when image is streamed. Keeps it loaded with image
+
 	protected:
+		// Finalizes decoded data and requests atlas page texture streaming. Returns true when texture is ready
+		bool FinalizeData(const String& path) override;
+
 		// Saves data
 		void SaveData(const String& path) const override;
 
@@ -171,6 +179,7 @@ CLASS_FIELDS_META(o2::ImageAsset)
 	FIELD().PROTECTED().DEFAULT_VALUE(nullptr).NAME(mBitmap);
 	FIELD().PROTECTED().SERIALIZABLE_ATTRIBUTE().NAME(mAtlasPage);
 	FIELD().PROTECTED().SERIALIZABLE_ATTRIBUTE().NAME(mAtlasRect);
+	FIELD().PROTECTED().NAME(mAtlasPageTexture);
 }
 END_META;
 CLASS_METHODS_META(o2::ImageAsset)
@@ -192,8 +201,10 @@ CLASS_METHODS_META(o2::ImageAsset)
 	FUNCTION().PUBLIC().SIGNATURE(float, GetWidth);
 	FUNCTION().PUBLIC().SIGNATURE(float, GetHeight);
 	FUNCTION().PUBLIC().SIGNATURE(TextureRef, GetAtlasTextureRef);
+	FUNCTION().PUBLIC().SIGNATURE(UInt64, GetResidentSize);
 	FUNCTION().PUBLIC().SIGNATURE(Meta*, GetMeta);
 	FUNCTION().PUBLIC().SIGNATURE_STATIC(const char*, GetFileExtensions);
+	FUNCTION().PROTECTED().SIGNATURE(bool, FinalizeData, const String&);
 	FUNCTION().PROTECTED().SIGNATURE(void, SaveData, const String&);
 	FUNCTION().PROTECTED().SIGNATURE(void, LoadBitmap);
 }
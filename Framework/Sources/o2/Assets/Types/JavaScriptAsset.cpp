@@ -52,6 +52,11 @@ namespace o2
 	{
 	}
 
+	bool JavaScriptAsset::DecodeData(const String& path)
+	{
+		return true;
+	}
+
 	void JavaScriptAsset::SaveData(const String& path) const
 	{
 	}
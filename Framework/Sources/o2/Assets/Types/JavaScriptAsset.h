@@ -44,6 +44,9 @@ namespace o2
 		// Loads data
 		void LoadData(const String& path) override;
 
+		// Returns true, nothing is decoded on streaming thread. Script is loaded on finalization
+		bool DecodeData(const String& path) override;
+
 		// Saves data
 		void SaveData(const String& path) const override;
 
@@ -74,6 +77,7 @@ CLASS_METHODS_META(o2::JavaScriptAsset)
 	FUNCTION().PUBLIC().SIGNATURE_STATIC(int, GetEditorSorting);
 	FUNCTION().PUBLIC().SIGNATURE_STATIC(bool, IsAvailableToCreateFromEditor);
 	FUNCTION().PROTECTED().SIGNATURE(void, LoadData, const String&);
+	FUNCTION().PROTECTED().SIGNATURE(bool, DecodeData, const String&);
 	FUNCTION().PROTECTED().SIGNATURE(void, SaveData, const String&);
 }
 END_META;
@@ -108,6 +108,11 @@ namespace o2
 		GetMeta()->mAsset = this;
 	}
 
+	bool VectorFontAsset::DecodeData(const String& path)
+	{
+		return true;
+	}
+
 	void VectorFontAsset::SaveData(const String& path) const
 	{}
 
@@ -88,6 +88,9 @@ namespace o2
 		// Loads data
 		void LoadData(const String& path) override;
 
+		// Returns true, nothing is decoded on streaming thread. Font is created by render on finalization
+		bool DecodeData(const String& path) override;
+
 		// Saves asset data, using DataValue and serialization
 		void SaveData(const String& path) const override;
 
@@ -129,6 +132,7 @@ CLASS_METHODS_META(o2::VectorFontAsset)
 	FUNCTION().PUBLIC().SIGNATURE_STATIC(const char*, GetFileExtensions);
 	FUNCTION().PUBLIC().SIGNATURE_STATIC(int, GetEditorSorting);
 	FUNCTION().PROTECTED().SIGNATURE(void, LoadData, const String&);
+	FUNCTION().PROTECTED().SIGNATURE(bool, DecodeData, const String&);
 	FUNCTION().PROTECTED().SIGNATURE(void, SaveData, const String&);
 	FUNCTION().PROTECTED().SIGNATURE(void, UpdateFontEffects);
 }
@@ -15,6 +15,12 @@
 #define RENDER_DEBUG false
 #endif
 
+// Enables CPU profiler zones
+#define IS_PROFILER_ENABLED false
+
+// Enables CPU profiler zones in frequently called code, like per widget functions
+#define IS_DETAILED_PROFILER_ENABLED false
+
 // Describes that engine running as editor
 #define IS_EDITOR true
 
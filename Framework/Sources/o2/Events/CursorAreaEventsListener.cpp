@@ -25,6 +25,11 @@ namespace o2
 		return false;
 	}
 
+	RectF CursorAreaEventsListener::GetCursorAreaBounds() const
+	{
+		return RectF(-FLT_MAX, FLT_MAX, FLT_MAX, -FLT_MAX);
+	}
+
 	bool CursorAreaEventsListener::IsScrollable() const
 	{
 		return false;
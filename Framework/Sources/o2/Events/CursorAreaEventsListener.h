@@ -36,6 +36,10 @@ namespace o2
 		// Returns true if point is in this object
 		virtual bool IsUnderPoint(const Vec2F& point);
 
+		// Returns rectangle, that contains all points under this object. Used by listeners layer hit-testing index,
+		// must be overridden together with IsUnderPoint. Unbounded by default
+		virtual RectF GetCursorAreaBounds() const;
+
 		// Returns is listener scrollable
 		virtual bool IsScrollable() const;
 
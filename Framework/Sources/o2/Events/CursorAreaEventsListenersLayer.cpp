@@ -63,6 +63,7 @@ namespace o2
 	{
 		cursorEventAreaListeners.Reverse();
 		mDragListeners.Reverse();
+		InvalidateHitTestIndex();
 
 		mLastUnderCursorListeners = mUnderCursorListeners;
 		mUnderCursorListeners.Clear();
@@ -120,6 +121,7 @@ namespace o2
 	{
 		cursorEventAreaListeners.Clear();
 		mDragListeners.Clear();
+		InvalidateHitTestIndex();
 	}
 
 	void CursorAreaEventListenersLayer::BreakCursorEvent()
@@ -150,6 +152,8 @@ namespace o2
 
 		for (auto& kv : mLastUnderCursorListeners)
 			kv.second.RemoveAll([&](auto x) { return x == listener; });
+
+		InvalidateHitTestIndex();
 	}
 
 	void CursorAreaEventListenersLayer::UnregDragListener(DragableObject* listener)
@@ -161,7 +165,7 @@ namespace o2
 	{
 		Vector<CursorAreaEventsListener*> res;
 		Vec2F localCursorPos = ToLocal(cursorPos);
-		for (auto listener : cursorEventAreaListeners)
+		for (auto listener : GetListenersInBounds(localCursorPos))
 		{
 			if (!listener->IsUnderPoint(localCursorPos) || !listener->mScissorRect.IsInside(localCursorPos) || !listener->mInteractable)
 				continue;
@@ -180,6 +184,11 @@ namespace o2
 		return drawnTransform.IsPointInside(point);
 	}
 
+	RectF CursorAreaEventListenersLayer::GetCursorAreaBounds() const
+	{
+		return drawnTransform.AABB();
+	}
+
 	bool CursorAreaEventListenersLayer::IsInputTransparent() const
 	{
 		return isTransparent;
@@ -204,11 +213,182 @@ namespace o2
 		return localCursor;
 	}
 
+	const CursorAreaEventListenersLayer::HitTestIndex& CursorAreaEventListenersLayer::GetHitTestIndex() const
+	{
+		if (mHitTestIndex.listenersCount != cursorEventAreaListeners.Count())
+			const_cast<CursorAreaEventListenersLayer*>(this)->BuildHitTestIndex();
+
+		return mHitTestIndex;
+	}
+
+	void CursorAreaEventListenersLayer::BuildHitTestIndex()
+	{
+		HitTestIndex& index = mHitTestIndex;
+		int count = cursorEventAreaListeners.Count();
+
+		index.listenersCount = count;
+		index.bounds.Resize(count);
+		index.clippedBounds.Resize(count);
+		index.cellsListeners.Clear();
+		index.commonListeners.Clear();
+
+		for (int i = 0; i < count; i++)
+		{
+			auto listener = cursorEventAreaListeners[i];
+			index.bounds[i] = listener->GetCursorAreaBounds();
+			index.clippedBounds[i] = index.bounds[i].GetIntersection(listener->mScissorRect);
+		}
+
+		// Cursor is usually inside screen, so only screen area is divided into cells
+		Vec2F halfResolution = (Vec2F)o2Render.GetResolution()*0.5f;
+		Vec2F screenCorners[4] = {
+			ScreenToLocal(Vec2F(-halfResolution.x, -halfResolution.y)), ScreenToLocal(Vec2F(halfResolution.x, -halfResolution.y)),
+			ScreenToLocal(Vec2F(halfResolution.x, halfResolution.y)), ScreenToLocal(Vec2F(-halfResolution.x, halfResolution.y))
+		};
+
+		index.area = RectF::Bound(screenCorners, 4);
+
+		if (index.area.Width() < FLT_EPSILON || index.area.Height() < FLT_EPSILON)
+		{
+			index.cellsCount = Vec2I();
+			return;
+		}
+
+		// About one listener per cell in average
+		const int maxCellsBySide = 32;
+		int cellsBySide = Math::Clamp((int)Math::Sqrt((float)count), 1, maxCellsBySide);
+		int cellsCount = cellsBySide*cellsBySide;
+
+		index.cellsCount = Vec2I(cellsBySide, cellsBySide);
+		index.cellSize = index.area.Size()/(float)cellsBySide;
+
+		index.cellsOffsets.Resize(cellsCount + 1);
+		for (int i = 0; i <= cellsCount; i++)
+			index.cellsOffsets[i] = 0;
+
+		// First pass counts listeners in cells, second pass writes listeners into cells ranges. Listeners are written
+		// in listeners order, so each cell is sorted by indices
+		for (int pass = 0; pass < 2; pass++)
+		{
+			for (int i = 0; i < count; i++)
+			{
+				Vec2I minCell, maxCell;
+				if (!GetBoundsCells(index, index.clippedBounds[i], minCell, maxCell))
+					continue;
+
+				int coveredCells = (maxCell.x - minCell.x + 1)*(maxCell.y - minCell.y + 1);
+				if (coveredCells*4 > cellsCount)
+				{
+					if (pass == 1)
+						index.commonListeners.Add(i);
+
+					continue;
+				}
+
+				for (int y = minCell.y; y <= maxCell.y; y++)
+				{
+					for (int x = minCell.x; x <= maxCell.x; x++)
+					{
+						int cell = y*cellsBySide + x;
+
+						if (pass == 0)
+							index.cellsOffsets[cell + 1]++;
+						else
+							index.cellsListeners[index.cellsOffsets[cell]++] = i;
+					}
+				}
+			}
+
+			if (pass == 0)
+			{
+				for (int i = 0; i < cellsCount; i++)
+					index.cellsOffsets[i + 1] += index.cellsOffsets[i];
+
+				index.cellsListeners.Resize(index.cellsOffsets[cellsCount]);
+			}
+		}
+
+		// Writing moved offsets to the ends of cells, move them back to the beginnings
+		for (int i = cellsCount; i > 0; i--)
+			index.cellsOffsets[i] = index.cellsOffsets[i - 1];
+
+		index.cellsOffsets[0] = 0;
+	}
+
+	void CursorAreaEventListenersLayer::InvalidateHitTestIndex()
+	{
+		mHitTestIndex.listenersCount = -1;
+	}
+
+	const Vector<CursorAreaEventsListener*>& CursorAreaEventListenersLayer::GetListenersInBounds(const Vec2F& point) const
+	{
+		const HitTestIndex& index = GetHitTestIndex();
+		Vector<CursorAreaEventsListener*>& res = mListenersInBounds;
+		res.Clear();
+
+		// Point outside indexed area is checked with all listeners bounds
+		if (index.cellsCount.x == 0 || !IsInsideBounds(index.area, point))
+		{
+			for (int i = 0; i < index.listenersCount; i++)
+			{
+				if (IsInsideBounds(index.clippedBounds[i], point))
+					res.Add(cursorEventAreaListeners[i]);
+			}
+
+			return res;
+		}
+
+		int cellX = Math::Clamp((int)((point.x - index.area.left)/index.cellSize.x), 0, index.cellsCount.x - 1);
+		int cellY = Math::Clamp((int)((point.y - index.area.bottom)/index.cellSize.y), 0, index.cellsCount.y - 1);
+		int cell = cellY*index.cellsCount.x + cellX;
+
+		// Cell and common listeners are merged by indices to keep listeners order
+		int cellIdx = index.cellsOffsets[cell], cellEnd = index.cellsOffsets[cell + 1];
+		int commonIdx = 0, commonEnd = index.commonListeners.Count();
+
+		while (cellIdx < cellEnd || commonIdx < commonEnd)
+		{
+			int idx;
+			if (commonIdx == commonEnd || (cellIdx < cellEnd && index.cellsListeners[cellIdx] < index.commonListeners[commonIdx]))
+				idx = index.cellsListeners[cellIdx++];
+			else
+				idx = index.commonListeners[commonIdx++];
+
+			if (IsInsideBounds(index.clippedBounds[idx], point))
+				res.Add(cursorEventAreaListeners[idx]);
+		}
+
+		return res;
+	}
+
+	bool CursorAreaEventListenersLayer::GetBoundsCells(const HitTestIndex& index, const RectF& bounds, Vec2I& minCell,
+													   Vec2I& maxCell)
+	{
+		if (!bounds.IsIntersects(index.area))
+			return false;
+
+		// Bounds can be unbounded, so they are clamped by indexed area before converting into cells
+		RectF clamped = bounds.GetIntersection(index.area);
+		Vec2F maxCellf = (Vec2F)(index.cellsCount - Vec2I(1, 1));
+
+		minCell.x = (int)Math::Clamp((clamped.left - index.area.left)/index.cellSize.x, 0.0f, maxCellf.x);
+		minCell.y = (int)Math::Clamp((clamped.bottom - index.area.bottom)/index.cellSize.y, 0.0f, maxCellf.y);
+		maxCell.x = (int)Math::Clamp((clamped.right - index.area.left)/index.cellSize.x, 0.0f, maxCellf.x);
+		maxCell.y = (int)Math::Clamp((clamped.top - index.area.bottom)/index.cellSize.y, 0.0f, maxCellf.y);
+
+		return true;
+	}
+
+	bool CursorAreaEventListenersLayer::IsInsideBounds(const RectF& bounds, const Vec2F& point)
+	{
+		return point.x >= bounds.left && point.x <= bounds.right && point.y >= bounds.bottom && point.y <= bounds.top;
+	}
+
 	void CursorAreaEventListenersLayer::ProcessCursorTracing(const Input::Cursor& cursor)
 	{
 		auto localCursor = ConvertLocalCursor(cursor);
 
-		for (auto listener : cursorEventAreaListeners)
+		for (auto listener : GetListenersInBounds(localCursor.position))
 		{
 			if (!listener->IsUnderPoint(localCursor.position) || !listener->mScissorRect.IsInside(localCursor.position))
 				continue;
@@ -257,10 +437,19 @@ namespace o2
 	{
 		auto localCursor = ConvertLocalCursor(cursor);
 
+		// Listener can't be under cursor outside its bounds. Index becomes invalid when listeners are changed by callbacks
+		const HitTestIndex& index = GetHitTestIndex();
+
+		int idx = 0;
 		for (auto listener : cursorEventAreaListeners)
 		{
-			if (!listener->IsUnderPoint(localCursor.position))
+			bool inBounds = index.listenersCount != cursorEventAreaListeners.Count() ||
+				IsInsideBounds(index.bounds[idx], localCursor.position);
+
+			if (!inBounds || !listener->IsUnderPoint(localCursor.position))
 				listener->OnCursorPressedOutside(localCursor);
+
+			idx++;
 		}
 
 		if (!mUnderCursorListeners.ContainsKey(localCursor.id))
@@ -329,10 +518,19 @@ namespace o2
 	{
 		auto localCursor = ConvertLocalCursor(cursor);
 
+		// Listener can't be under cursor outside its bounds. Index becomes invalid when listeners are changed by callbacks
+		const HitTestIndex& index = GetHitTestIndex();
+
+		int idx = 0;
 		for (auto listener : cursorEventAreaListeners)
 		{
-			if (!listener->IsUnderPoint(localCursor.position))
+			bool inBounds = index.listenersCount != cursorEventAreaListeners.Count() ||
+				IsInsideBounds(index.bounds[idx], localCursor.position);
+
+			if (!inBounds || !listener->IsUnderPoint(localCursor.position))
 				listener->OnCursorReleasedOutside(localCursor);
+
+			idx++;
 		}
 
 		if (mPressedListeners.ContainsKey(localCursor.id))
@@ -66,9 +66,32 @@ namespace o2
 		// Returns true if point is in this object
 		bool IsUnderPoint(const Vec2F& point) override;
 
+		// Returns drawn transform bounds
+		RectF GetCursorAreaBounds() const override;
+
 		// Returns true when input events can be handled by down listeners
 		bool IsInputTransparent() const override;
 
+	private:
+		// --------------------------------------------------------------------------------------------------------------
+		// Listeners hit-testing index. Grid over screen rectangle in layer coordinates, each cell contains indices of
+		// listeners, which bounds intersect the cell, in listeners order. Listeners covering big part of grid are stored
+		// in common list and checked for each point. Built when listeners are requested by point, valid until listeners
+		// are changed
+		// --------------------------------------------------------------------------------------------------------------
+		struct HitTestIndex
+		{
+			RectF         area;                // Indexed area, screen rectangle in layer coordinates
+			Vec2I         cellsCount;          // Count of cells by axes
+			Vec2F         cellSize;            // Cell size
+			Vector<RectF> bounds;              // Listeners bounds by listeners indices
+			Vector<RectF> clippedBounds;       // Listeners bounds clipped by scissor rectangles
+			Vector<int>   cellsOffsets;        // Offsets of cells in cellsListeners, last offset is cellsListeners count
+			Vector<int>   cellsListeners;      // Listeners indices of all cells
+			Vector<int>   commonListeners;     // Listeners indices, checked for each point in area
+			int           listenersCount = -1; // Count of indexed listeners, -1 when index isn't built
+		};
+
 	private:
 		bool mEnabled = false;
 
@@ -85,6 +108,9 @@ namespace o2
 
 		Vector<DragableObject*> mDragListeners; // Drag events listeners
 
+		HitTestIndex                              mHitTestIndex;      // Listeners hit-testing index
+		mutable Vector<CursorAreaEventsListener*> mListenersInBounds; // Listeners in bounds buffer, reused by cursor queries
+
 	private:
 		// Called when cursor enters this object
 		void OnCursorEnter(const Input::Cursor& cursor) override;
@@ -95,6 +121,25 @@ namespace o2
 		// Converts cursor to local coordinates
 		Input::Cursor ConvertLocalCursor(const Input::Cursor& cursor) const;
 
+		// Returns hit-testing index, builds it when listeners has changed
+		const HitTestIndex& GetHitTestIndex() const;
+
+		// Builds hit-testing index by listeners bounds
+		void BuildHitTestIndex();
+
+		// Marks hit-testing index invalid, it will be rebuilt on next request
+		void InvalidateHitTestIndex();
+
+		// Returns listeners which clipped bounds contain point, in listeners order. Listeners must be checked by
+		// IsUnderPoint. Result is stored in layer buffer and valid until next call
+		const Vector<CursorAreaEventsListener*>& GetListenersInBounds(const Vec2F& point) const;
+
+		// Returns range of index cells intersecting bounds. Returns false when bounds are outside indexed area
+		static bool GetBoundsCells(const HitTestIndex& index, const RectF& bounds, Vec2I& minCell, Vec2I& maxCell);
+
+		// Returns true when point is inside bounds or on bounds border
+		static bool IsInsideBounds(const RectF& bounds, const Vec2F& point);
+
 		// processes cursor tracing for cursor
 		void ProcessCursorTracing(const Input::Cursor& cursor);
 
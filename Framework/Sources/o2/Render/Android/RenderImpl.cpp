@@ -12,6 +12,7 @@
 #include "Render/Texture.h"
 #include "Utils/Debug/Debug.h"
 #include "Utils/Debug/Log/LogStream.h"
+#include "Utils/Debug/Profiler.h"
 #include "Utils/Math/Geometry.h"
 #include "Utils/Math/Interpolation.h"
 #include "Application/Input.h"
@@ -24,6 +25,8 @@ namespace o2
 		mVertexBufferSize = USHRT_MAX;
 		mIndexBufferSize = USHRT_MAX;
 
+		mDrawCommandsBackend.render = this;
+
 		mLog = mnew LogStream("Render");
 		o2Debug.GetLog()->BindStream(mLog);
 
@@ -264,7 +267,7 @@ namespace o2
 		preRender.Clear();
 	}
 
-	void Render::DrawPrimitives()
+	void Render::DrawBufferedPrimitives()
 	{
 		if (mLastDrawVertex < 1)
 			return;
@@ -521,31 +524,23 @@ namespace o2
 		}
 	}
 
-	void Render::DrawBuffer(PrimitiveType primitiveType, Vertex2* vertices, UInt verticesCount,
-							UInt16* indexes, UInt elementsCount, const TextureRef& texture)
+	void Render::DrawBufferImmediate(PrimitiveType primitiveType, const Vertex* vertices, UInt verticesCount,
+									 const UInt16* indexes, UInt elementsCount, Texture* texture)
 	{
-		if (!mReady)
-			return;
-
-		mDrawingDepth += 1.0f;
-
-		if (mClippingEverything)
-			return;
-
 		UInt indexesCount;
 		if (primitiveType == PrimitiveType::Line)
 			indexesCount = elementsCount*2;
 		else
 			indexesCount = elementsCount*3;
 
-		if (mLastDrawTexture != texture.mTexture ||
+		if (mLastDrawTexture != texture ||
 			mLastDrawVertex + verticesCount >= mVertexBufferSize ||
 			mLastDrawIdx + indexesCount >= mIndexBufferSize ||
 			mCurrentPrimitiveType != primitiveType)
 		{
-			DrawPrimitives();
+			DrawBufferedPrimitives();
 
-			mLastDrawTexture = texture.mTexture;
+			mLastDrawTexture = texture;
 			mCurrentPrimitiveType = primitiveType;
 
 			if (mLastDrawTexture)
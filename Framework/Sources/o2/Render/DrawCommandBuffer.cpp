@@ -0,0 +1,200 @@
+#include "o2/stdafx.h"
+#include "DrawCommandBuffer.h"
+
+namespace o2
+{
+	bool DrawCommand::IsBatchableWith(const DrawCommand& other) const
+	{
+		return texture == other.texture && primitiveType == other.primitiveType &&
+			scissorEnabled == other.scissorEnabled && (!scissorEnabled || scissorRect == other.scissorRect);
+	}
+
+	DrawCommandBuffer::DrawCommandBuffer()
+	{}
+
+	void DrawCommandBuffer::Add(PrimitiveType primitiveType, const Vertex* vertices, UInt verticesCount,
+								const UInt16* indexes, UInt elementsCount, Texture* texture, bool scissorEnabled,
+								const RectI& scissorRect)
+	{
+		if (verticesCount == 0)
+			return;
+
+		DrawCommand& command = mCommands.Add(DrawCommand());
+		command.texture = texture;
+		command.primitiveType = primitiveType;
+		command.scissorEnabled = scissorEnabled;
+		command.scissorRect = scissorRect;
+		command.elementsCount = elementsCount;
+		command.verticesCount = verticesCount;
+		command.indexesCount = primitiveType == PrimitiveType::Line ? elementsCount*2 : elementsCount*3;
+		command.vertexOffset = mVertices.Count();
+		command.indexOffset = mIndexes.Count();
+
+		mVertices.insert(mVertices.end(), vertices, vertices + verticesCount);
+		mIndexes.insert(mIndexes.end(), indexes, indexes + command.indexesCount);
+
+		float left = vertices[0].x, right = vertices[0].x, bottom = vertices[0].y, top = vertices[0].y;
+		for (UInt i = 1; i < verticesCount; i++)
+		{
+			const Vertex& v = vertices[i];
+			left = Math::Min(left, v.x); right = Math::Max(right, v.x);
+			bottom = Math::Min(bottom, v.y); top = Math::Max(top, v.y);
+		}
+
+		command.bounds = RectF(left, top, right, bottom);
+	}
+
+	void DrawCommandBuffer::Submit(IDrawCommandsBackend& backend, bool reorder /*= true*/)
+	{
+		mSubmitting = true;
+
+		BuildBatches(reorder);
+
+		for (auto& batch : mBatches)
+		{
+			for (int i = batch.firstCommand; i >= 0; i = mNextCommands[i])
+			{
+				const DrawCommand& command = mCommands[i];
+				backend.Draw(command, mVertices.Data() + command.vertexOffset, mIndexes.Data() + command.indexOffset);
+			}
+		}
+
+		backend.Flush();
+
+		mSubmitting = false;
+	}
+
+	void DrawCommandBuffer::BuildBatches(bool reorder)
+	{
+		mBatches.Clear();
+		mNextCommands.Clear();
+		mNextCommands.Resize(mCommands.Count());
+
+		mLastStatistics = Statistics();
+		mLastStatistics.commandsCount = mCommands.Count();
+
+		for (int i = 0; i < mCommands.Count(); i++)
+		{
+			const DrawCommand& command = mCommands[i];
+			mNextCommands[i] = -1;
+
+			if (i == 0 || !command.IsBatchableWith(mCommands[i - 1]))
+				mLastStatistics.unsortedBatchesCount++;
+
+			// Search batch with same state back from the last one. Stop on first batch which overlaps
+			// command, because command can't be drawn before it
+			int targetBatch = -1;
+			int lookBackLimit = reorder ? Math::Max(0, mBatches.Count() - mLookBackDepth) : Math::Max(0, mBatches.Count() - 1);
+			for (int j = mBatches.Count() - 1; j >= lookBackLimit; j--)
+			{
+				const Batch& batch = mBatches[j];
+				if (mCommands[batch.firstCommand].IsBatchableWith(command))
+				{
+					targetBatch = j;
+					break;
+				}
+
+				if (batch.bounds.IsIntersects(command.bounds))
+					break;
+			}
+
+			if (targetBatch >= 0)
+			{
+				Batch& batch = mBatches[targetBatch];
+				mNextCommands[batch.lastCommand] = i;
+				batch.lastCommand = i;
+				batch.bounds = batch.bounds.Expand(command.bounds);
+			}
+			else
+			{
+				Batch& batch = mBatches.Add(Batch());
+				batch.firstCommand = i;
+				batch.lastCommand = i;
+				batch.bounds = command.bounds;
+			}
+		}
+
+		mLastStatistics.batchesCount = mBatches.Count();
+	}
+
+	void DrawCommandBuffer::Clear()
+	{
+		mCommands.Clear();
+		mVertices.Clear();
+		mIndexes.Clear();
+	}
+
+	bool DrawCommandBuffer::IsEmpty() const
+	{
+		return mCommands.IsEmpty();
+	}
+
+	bool DrawCommandBuffer::IsSubmitting() const
+	{
+		return mSubmitting;
+	}
+
+	const Vector<DrawCommand>& DrawCommandBuffer::GetCommands() const
+	{
+		return mCommands;
+	}
+
+	void DrawCommandBuffer::SetLookBackDepth(int depth)
+	{
+		mLookBackDepth = Math::Max(1, depth);
+	}
+
+	int DrawCommandBuffer::GetLookBackDepth() const
+	{
+		return mLookBackDepth;
+	}
+
+	const DrawCommandBuffer::Statistics& DrawCommandBuffer::GetLastStatistics() const
+	{
+		return mLastStatistics;
+	}
+
+	DrawCommandsCounterBackend::DrawCommandsCounterBackend(UInt vertexBufferSize /*= USHRT_MAX*/,
+														   UInt indexBufferSize /*= USHRT_MAX*/):
+		mVertexBufferSize(vertexBufferSize), mIndexBufferSize(indexBufferSize)
+	{}
+
+	void DrawCommandsCounterBackend::Draw(const DrawCommand& command, const Vertex* vertices, const UInt16* indexes)
+	{
+		commandsCount++;
+
+		if (mLastTexture != command.texture ||
+			mVerticesCount + command.verticesCount >= mVertexBufferSize ||
+			mIndexesCount + command.indexesCount >= mIndexBufferSize ||
+			mLastPrimitiveType != command.primitiveType)
+		{
+			Flush();
+
+			mLastTexture = command.texture;
+			mLastPrimitiveType = command.primitiveType;
+		}
+
+		if (command.primitiveType != PrimitiveType::Line)
+			trianglesCount += command.elementsCount;
+
+		mVerticesCount += command.verticesCount;
+		mIndexesCount += command.indexesCount;
+	}
+
+	void DrawCommandsCounterBackend::Flush()
+	{
+		if (mVerticesCount < 1)
+			return;
+
+		flushesCount++;
+		mVerticesCount = mIndexesCount = 0;
+	}
+
+	void DrawCommandsCounterBackend::Reset()
+	{
+		flushesCount = trianglesCount = commandsCount = 0;
+		mVerticesCount = mIndexesCount = 0;
+		mLastTexture = nullptr;
+		mLastPrimitiveType = PrimitiveType::Polygon;
+	}
+}
@@ -0,0 +1,164 @@
+#pragma once
+
+#include "o2/Utils/Math/Rect.h"
+#include "o2/Utils/Math/Vertex.h"
+#include "o2/Utils/Types/CommonTypes.h"
+#include "o2/Utils/Types/Containers/Vector.h"
+
+namespace o2
+{
+	class Texture;
+
+	// -------------------------------------------------------------------------------------------
+	// Recorded draw command. Stores render state and span of vertices and indexes in command buffer
+	// -------------------------------------------------------------------------------------------
+	struct DrawCommand
+	{
+		Texture*      texture = nullptr;                      // Drawing texture, null when drawing without texture
+		PrimitiveType primitiveType = PrimitiveType::Polygon; // Type of drawing primitives
+		RectI         scissorRect;                            // Summary scissor rectangle at drawing moment
+		bool          scissorEnabled = false;                 // Is scissor test enabled at drawing moment
+		RectF         bounds;                                 // Bounding rectangle of command vertices
+
+		UInt vertexOffset = 0;  // First vertex in buffer vertices
+		UInt verticesCount = 0; // Count of vertices
+		UInt indexOffset = 0;   // First index in buffer indexes
+		UInt indexesCount = 0;  // Count of indexes. Indexes are relative to first command's vertex
+		UInt elementsCount = 0; // Count of primitives: triangles or lines
+
+	public:
+		// Returns true when command can be drawn in one batch with other command
+		bool IsBatchableWith(const DrawCommand& other) const;
+	};
+
+	// ---------------------------------------------------------------------------
+	// Draw commands backend interface. Receives commands from buffer in draw order
+	// ---------------------------------------------------------------------------
+	class IDrawCommandsBackend
+	{
+	public:
+		// Virtual destructor
+		virtual ~IDrawCommandsBackend() {}
+
+		// Draws command. Backend can accumulate commands and send them to draw in one batch
+		virtual void Draw(const DrawCommand& command, const Vertex* vertices, const UInt16* indexes) = 0;
+
+		// Sends accumulated commands to draw
+		virtual void Flush() = 0;
+	};
+
+	// -----------------------------------------------------------------------------------------------
+	// Per-frame draw commands buffer. Records draw commands and submits them into backend, merging
+	// commands with same texture and primitive type into runs. Command can be moved earlier only when
+	// it doesn't overlap any command drawn between, so the result image is the same as without sorting
+	// -----------------------------------------------------------------------------------------------
+	class DrawCommandBuffer
+	{
+	public:
+		// ---------------------
+		// Submission statistics
+		// ---------------------
+		struct Statistics
+		{
+			int commandsCount = 0;        // Count of submitted commands
+			int batchesCount = 0;         // Count of batches after merging
+			int unsortedBatchesCount = 0; // Count of batches in original drawing order
+		};
+
+	public:
+		// Constructor
+		DrawCommandBuffer();
+
+		// Records draw command. Copies vertices and indexes into buffer
+		void Add(PrimitiveType primitiveType, const Vertex* vertices, UInt verticesCount,
+				 const UInt16* indexes, UInt elementsCount, Texture* texture, bool scissorEnabled,
+				 const RectI& scissorRect);
+
+		// Sorts commands and sends them into backend. Doesn't clear buffer
+		void Submit(IDrawCommandsBackend& backend, bool reorder = true);
+
+		// Removes all recorded commands
+		void Clear();
+
+		// Returns true when there are no recorded commands
+		bool IsEmpty() const;
+
+		// Returns true when buffer is sending commands to backend now
+		bool IsSubmitting() const;
+
+		// Returns recorded commands
+		const Vector<DrawCommand>& GetCommands() const;
+
+		// Sets count of batches to look back when searching batch to merge command
+		void SetLookBackDepth(int depth);
+
+		// Returns count of batches to look back when searching batch to merge command
+		int GetLookBackDepth() const;
+
+		// Returns statistics of last submission
+		const Statistics& GetLastStatistics() const;
+
+	protected:
+		// --------------------------------------------------------
+		// Batch of merged commands with summary bounding rectangle
+		// --------------------------------------------------------
+		struct Batch
+		{
+			int   firstCommand = -1; // First command index in chain
+			int   lastCommand = -1;  // Last command index in chain
+			RectF bounds;            // Summary bounds of all commands in batch
+		};
+
+	protected:
+		Vector<DrawCommand> mCommands; // Recorded commands in drawing order
+		Vector<Vertex>      mVertices; // Recorded commands vertices
+		Vector<UInt16>      mIndexes;  // Recorded commands indexes
+
+		Vector<Batch> mBatches;      // Batches buffer, used when submitting
+		Vector<int>   mNextCommands; // Next command in batch chain for each command, used when submitting
+
+		int mLookBackDepth = 64; // Count of batches to look back when searching batch to merge command
+
+		bool mSubmitting = false; // True when sending commands to backend
+
+		Statistics mLastStatistics; // Statistics of last submission
+
+	protected:
+		// Builds batches from commands
+		void BuildBatches(bool reorder);
+	};
+
+	// -------------------------------------------------------------------------------------------------
+	// CPU-only draw commands backend. Doesn't draw anything, counts flushes that render would do instead.
+	// Uses the same batching rules as render: flush on texture or primitive type change and buffers overflow
+	// -------------------------------------------------------------------------------------------------
+	class DrawCommandsCounterBackend: public IDrawCommandsBackend
+	{
+	public:
+		int flushesCount = 0;   // Count of flushes, equals to draw calls count
+		int trianglesCount = 0; // Count of triangles drawn
+		int commandsCount = 0;  // Count of received commands
+
+	public:
+		// Constructor. Vertex and index buffer sizes are same as render buffers by default
+		DrawCommandsCounterBackend(UInt vertexBufferSize = USHRT_MAX, UInt indexBufferSize = USHRT_MAX);
+
+		// Counts command, checks flush
+		void Draw(const DrawCommand& command, const Vertex* vertices, const UInt16* indexes) override;
+
+		// Counts flush if something is accumulated
+		void Flush() override;
+
+		// Resets counters
+		void Reset();
+
+	protected:
+		UInt mVertexBufferSize; // Maximum size of vertex buffer
+		UInt mIndexBufferSize;  // Maximum size of index buffer
+
+		Texture*      mLastTexture = nullptr;                      // Texture of accumulated commands
+		PrimitiveType mLastPrimitiveType = PrimitiveType::Polygon; // Primitive type of accumulated commands
+		UInt          mVerticesCount = 0;                          // Accumulated vertices count
+		UInt          mIndexesCount = 0;                           // Accumulated indexes count
+	};
+}
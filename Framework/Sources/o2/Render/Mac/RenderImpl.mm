@@ -15,6 +15,7 @@
 #include "o2/Render/Texture.h"
 #include "o2/Utils/Debug/Debug.h"
 #include "o2/Utils/Debug/Log/LogStream.h"
+#include "o2/Utils/Debug/Profiler.h"
 #include "o2/Utils/Math/Geometry.h"
 #include "o2/Utils/Math/Interpolation.h"
 #include "o2/Application/Input.h"
@@ -86,6 +87,8 @@ namespace o2
 	{
 		RenderDevice::Initialize();
 		
+		mDrawCommandsBackend.render = this;
+
 		mLog = mnew LogStream("Render");
 		o2Debug.GetLog()->BindStream(mLog);
 		
@@ -177,31 +180,23 @@ namespace o2
 		preRender.Clear();
 	}
 	
-	void Render::DrawBuffer(PrimitiveType primitiveType, Vertex2* vertices, UInt verticesCount,
-							UInt16* indexes, UInt elementsCount, const TextureRef& texture)
+	void Render::DrawBufferImmediate(PrimitiveType primitiveType, const Vertex* vertices, UInt verticesCount,
+									 const UInt16* indexes, UInt elementsCount, Texture* texture)
 	{
-		if (!mReady)
-			return;
-		
-		mDrawingDepth += 1.0f;
-		
-		if (mClippingEverything)
-			return;
-		
 		UInt indexesCount;
 		if (primitiveType == PrimitiveType::Line)
 			indexesCount = elementsCount*2;
 		else
 			indexesCount = elementsCount*3;
 		
-		if (mLastDrawTexture != texture.mTexture ||
+		if (mLastDrawTexture != texture ||
 			mLastDrawVertex + verticesCount >= mVertexBufferSize ||
 			mLastDrawIdx + indexesCount >= mIndexBufferSize ||
 			mCurrentPrimitiveType != primitiveType)
 		{
-			DrawPrimitives();
+			DrawBufferedPrimitives();
 			
-			mLastDrawTexture = texture.mTexture;
+			mLastDrawTexture = texture;
 			mCurrentPrimitiveType = primitiveType;
 		}
 		
@@ -266,7 +261,7 @@ namespace o2
 		dst.columns[3][0] = origin[12]; dst.columns[3][1] = origin[13]; dst.columns[3][2] = origin[14]; dst.columns[3][3] = origin[15];
 	}
 	
-	void Render::DrawPrimitives()
+	void Render::DrawBufferedPrimitives()
 	{
 		if (mLastDrawVertex < 1)
 			return;
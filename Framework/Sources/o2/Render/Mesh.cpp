@@ -102,4 +102,19 @@ namespace o2
 	{
 		return mMaxPolyCount;
 	}
+
+	RectF Mesh::GetVerticesRect() const
+	{
+		if (vertexCount == 0)
+			return RectF();
+
+		float left = vertices[0].x, right = vertices[0].x, bottom = vertices[0].y, top = vertices[0].y;
+		for (UInt i = 1; i < vertexCount; i++)
+		{
+			left = Math::Min(left, vertices[i].x); right = Math::Max(right, vertices[i].x);
+			bottom = Math::Min(bottom, vertices[i].y); top = Math::Max(top, vertices[i].y);
+		}
+
+		return RectF(left, top, right, bottom);
+	}
 }
@@ -64,6 +64,9 @@ namespace o2
 		// Returns max polygons count
 		UInt GetMaxPolyCount() const;
 
+		// Returns rectangle, bounding current vertices
+		RectF GetVerticesRect() const;
+
 	protected:
 		TextureRef mTexture; // Texture
 
@@ -8,16 +8,14 @@ namespace o2
 	void ParticlesEffect::Update(float dt, ParticlesEmitter* emitter)
 	{}
 
-	Vector<Particle>& ParticlesEffect::GetParticlesDirect(ParticlesEmitter* emitter)
+	ParticlesPool& ParticlesEffect::GetParticlesDirect(ParticlesEmitter* emitter)
 	{
 		return emitter->mParticles;
 	}
 
 	void ParticlesGravityEffect::Update(float dt, ParticlesEmitter* emitter)
 	{
-		Vec2F v = gravity*dt;
-		for (auto& p : GetParticlesDirect(emitter))
-			p.velocity += v;
+		GetParticlesDirect(emitter).AddVelocity(gravity*dt);
 	}
 }
 
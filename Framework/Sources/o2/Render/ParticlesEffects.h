@@ -1,22 +1,22 @@
 #pragma once
 
 #include "o2/Utils/Serialization/Serializable.h"
-#include "o2/Render/Particle.h"
+#include "o2/Render/ParticlesPool.h"
 
 namespace o2
 {
 	class ParticlesEmitter;
 
-	// -------------------------------
-	// Particles effect base interface
-	// -------------------------------
+	// -------------------------------------------------------------------------------------------
+	// Particles effect base interface. Effects are applied to particles pool channels, by batches
+	// -------------------------------------------------------------------------------------------
 	class ParticlesEffect: public ISerializable
 	{
 		SERIALIZABLE(ParticlesEffect);
 
 	public:
 		virtual void Update(float dt, ParticlesEmitter* emitter);
-		Vector<Particle>& GetParticlesDirect(ParticlesEmitter* emitter);
+		ParticlesPool& GetParticlesDirect(ParticlesEmitter* emitter);
 	};
 
 	class ParticlesGravityEffect : public ParticlesEffect
@@ -44,7 +44,7 @@ CLASS_METHODS_META(o2::ParticlesEffect)
 {
 
 	FUNCTION().PUBLIC().SIGNATURE(void, Update, float, ParticlesEmitter*);
-	FUNCTION().PUBLIC().SIGNATURE(Vector<Particle>&, GetParticlesDirect, ParticlesEmitter*);
+	FUNCTION().PUBLIC().SIGNATURE(ParticlesPool&, GetParticlesDirect, ParticlesEmitter*);
 }
 END_META;
 
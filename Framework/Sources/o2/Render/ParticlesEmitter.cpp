@@ -11,7 +11,9 @@ namespace o2
 		IRectDrawable()
 	{
 		mShape = mnew CircleParticlesEmitterShape();
+		SetRandomSeed(0);
 		mParticlesMesh = mnew Mesh(NoTexture(), mParticlesNumLimit*4, mParticlesNumLimit*2);
+		UpdateMeshIndexes();
 		mLastTransform = mTransform;
 	}
 
@@ -41,6 +43,10 @@ namespace o2
 		image(this), shape(this)
 	{
 		mParticlesMesh = mnew Mesh(NoTexture(), mParticlesNumLimit*4, mParticlesNumLimit*2);
+		UpdateMeshIndexes();
+
+		// Copy with not explicit seed gets own random sequence
+		SetRandomSeed(other.mRandomSeed);
 
 		for (auto effect : other.mEffects)
 			AddEffect(effect->CloneAs<ParticlesEffect>());
@@ -53,18 +59,7 @@ namespace o2
 		RemoveAllEffects();
 		delete mShape;
 
-		int idx = 0;
-		for (auto& particle : mParticles)
-		{
-			if (particle.alive)
-			{
-				mDeadParticles.Add(idx);
-				particle.alive = false;
-			}
-
-			idx++;
-		}
-		mNumAliveParticles = 0;
+		mParticles.Clear();
 
 		IRectDrawable::operator=(other);
 
@@ -104,9 +99,12 @@ namespace o2
 		mEmitParticlesColorA = other.mEmitParticlesColorA;
 		mEmitParticlesColorB = other.mEmitParticlesColorB;
 
+		SetRandomSeed(other.mRandomSeed);
+
 		mParticlesMesh->vertexCount = 0;
 		mParticlesMesh->polyCount = 0;
 		mParticlesMesh->Resize(mParticlesNumLimit*4, mParticlesNumLimit*2);
+		UpdateMeshIndexes();
 
 		mLastTransform = mTransform;
 
@@ -160,36 +158,29 @@ namespace o2
 		float halfAngleSpeedRange = mEmitParticlesAngleSpeedRange*0.5f;
 		while (mEmitTimeBuffer > particlesDelay)
 		{
-			if (mNumAliveParticles < mParticlesNumLimit)
+			if (mParticles.GetCount() < mParticlesNumLimit)
 			{
-				Particle* p;
-
-				if (mDeadParticles.IsEmpty())
-				{
-					mParticles.Add(Particle());
-					p = &mParticles.Last();
-				}
-				else p = &mParticles[mDeadParticles.PopBack()];
+				Particle p;
 
-				p->position = Local2WorldPoint(mShape->GetEmittinPoint());
-				p->angle = mEmitParticlesAngle + Math::Random(-halfAngleRange, halfAngleRange);
+				p.position = Local2WorldPoint(mShape->GetEmittinPoint(mRandom));
+				p.angle = mEmitParticlesAngle + mRandom.Range(-halfAngleRange, halfAngleRange);
 
-				p->size.Set(mEmitParticlesSize.x + Math::Random(-halfSizeRange.x, halfSizeRange.x),
-							mEmitParticlesSize.y + Math::Random(-halfSizeRange.y, halfSizeRange.y));
+				p.size.Set(mEmitParticlesSize.x + mRandom.Range(-halfSizeRange.x, halfSizeRange.x),
+						   mEmitParticlesSize.y + mRandom.Range(-halfSizeRange.y, halfSizeRange.y));
 
-				p->velocity = Vec2F::Rotated(mEmitParticlesMoveDirection + Math::Random(-halfDirRange, halfDirRange))*
-					(mEmitParticlesSpeed + Math::Random(-halfSpeedRange, halfSpeedRange));
+				p.velocity = Vec2F::Rotated(mEmitParticlesMoveDirection + mRandom.Range(-halfDirRange, halfDirRange))*
+					(mEmitParticlesSpeed + mRandom.Range(-halfSpeedRange, halfSpeedRange));
 
-				p->angleSpeed = mEmitParticlesAngleSpeed + Math::Random(-halfAngleSpeedRange, halfAngleSpeedRange);
+				p.angleSpeed = mEmitParticlesAngleSpeed + mRandom.Range(-halfAngleSpeedRange, halfAngleSpeedRange);
 
-				p->color.r = Math::Random(mEmitParticlesColorA.r, mEmitParticlesColorB.r);
-				p->color.g = Math::Random(mEmitParticlesColorA.g, mEmitParticlesColorB.g);
-				p->color.b = Math::Random(mEmitParticlesColorA.b, mEmitParticlesColorB.b);
-				p->color.a = Math::Random(mEmitParticlesColorA.a, mEmitParticlesColorB.a);
-				p->time = mParticlesLifetime;
-				p->alive = true;
+				p.color.r = mRandom.Range(mEmitParticlesColorA.r, mEmitParticlesColorB.r);
+				p.color.g = mRandom.Range(mEmitParticlesColorA.g, mEmitParticlesColorB.g);
+				p.color.b = mRandom.Range(mEmitParticlesColorA.b, mEmitParticlesColorB.b);
+				p.color.a = mRandom.Range(mEmitParticlesColorA.a, mEmitParticlesColorB.a);
+				p.time = mParticlesLifetime;
+				p.alive = true;
 
-				mNumAliveParticles++;
+				mParticles.Add(p);
 			}
 
 			mEmitTimeBuffer -= particlesDelay;
@@ -207,38 +198,17 @@ namespace o2
 
 	void ParticlesEmitter::UpdateParticles(float dt)
 	{
-		int idx = 0;
-		for (auto& particle : mParticles)
-		{
-			if (!particle.alive)
-			{
-				idx++;
-				continue;
-			}
-
-			particle.position += particle.velocity*dt;
-			particle.angle += particle.angleSpeed*dt;
-			particle.time -= dt;
-
-			if (particle.time < 0)
-			{
-				particle.alive = false;
-				mDeadParticles.Add(idx);
-				mNumAliveParticles--;
-			}
-
-			idx++;
-		}
+		mParticles.Integrate(dt);
+		mParticles.RemoveExpired();
 	}
 
 	void ParticlesEmitter::UpdateMesh()
 	{
 		if (mParticlesMesh->GetMaxVertexCount() < (UInt)mParticlesNumLimit*4)
+		{
 			mParticlesMesh->Resize(mParticlesNumLimit*4, mParticlesNumLimit*2);
-
-		mParticlesMesh->vertexCount = 0;
-		mParticlesMesh->polyCount = 0;
-		int polyIndex = 0;
+			UpdateMeshIndexes();
+		}
 
 		Vec2F invTexSize(1.0f, 1.0f);
 		if (mParticlesMesh->GetTexture())
@@ -256,31 +226,29 @@ namespace o2
 		float uvUp = 1.0f - textureSrcRect.bottom*invTexSize.y;
 		float uvDown = 1.0f - textureSrcRect.top*invTexSize.y;
 
-		for (auto& particle : mParticles)
+		int count = Math::Min(mParticles.GetCount(), mParticlesNumLimit);
+		mParticles.BuildQuads(0, count, mParticlesMesh->vertices, uvLeft, uvRight, uvUp, uvDown);
+
+		mParticlesMesh->vertexCount = count*4;
+		mParticlesMesh->polyCount = count*2;
+	}
+
+	void ParticlesEmitter::UpdateMeshIndexes()
+	{
+		UInt16* indexes = mParticlesMesh->indexes;
+		int count = mParticlesMesh->GetMaxPolyCount()/2;
+
+		for (int i = 0; i < count; i++)
 		{
-			if (!particle.alive)
-				continue;
-
-			float sn = Math::Sin(particle.angle), cs = Math::Cos(particle.angle);
-			Vec2F hs = particle.size*0.5f;
-			Vec2F xv(cs*hs.x, sn*hs.x);
-			Vec2F yv(-sn*hs.y, cs*hs.y);
-			Vec2F o(particle.position);
-			ULong colr = particle.color.ARGB();
-
-			mParticlesMesh->vertices[mParticlesMesh->vertexCount++].Set(o - xv + yv, colr, uvLeft, uvUp);
-			mParticlesMesh->vertices[mParticlesMesh->vertexCount++].Set(o + xv + yv, colr, uvRight, uvUp);
-			mParticlesMesh->vertices[mParticlesMesh->vertexCount++].Set(o + xv - yv, colr, uvRight, uvDown);
-			mParticlesMesh->vertices[mParticlesMesh->vertexCount++].Set(o - xv - yv, colr, uvLeft, uvDown);
-
-			mParticlesMesh->indexes[polyIndex++] = mParticlesMesh->vertexCount - 4;
-			mParticlesMesh->indexes[polyIndex++] = mParticlesMesh->vertexCount - 3;
-			mParticlesMesh->indexes[polyIndex++] = mParticlesMesh->vertexCount - 2;
-
-			mParticlesMesh->indexes[polyIndex++] = mParticlesMesh->vertexCount - 4;
-			mParticlesMesh->indexes[polyIndex++] = mParticlesMesh->vertexCount - 2;
-			mParticlesMesh->indexes[polyIndex++] = mParticlesMesh->vertexCount - 1;
-			mParticlesMesh->polyCount += 2;
+			UInt16 vertex = (UInt16)(i*4);
+
+			*indexes++ = vertex;
+			*indexes++ = vertex + 1;
+			*indexes++ = vertex + 2;
+
+			*indexes++ = vertex;
+			*indexes++ = vertex + 2;
+			*indexes++ = vertex + 3;
 		}
 	}
 
@@ -290,12 +258,25 @@ namespace o2
 			return;
 
 		Basis change = mLastTransform.Inverted()*mTransform;
-		for (auto& particle : mParticles)
-			particle.position = change.Transform(particle.position);
+		mParticles.TransformPositions(change);
 
 		mLastTransform = mTransform;
 	}
 
+	void ParticlesEmitter::OnDeserialized(const DataValue& node)
+	{
+		IRectDrawable::OnDeserialized(node);
+		mParticlesNumLimit = Math::Clamp(mParticlesNumLimit, 0, maxParticlesLimit);
+		SetRandomSeed(mRandomSeed);
+	}
+
+	void ParticlesEmitter::OnDeserializedDelta(const DataValue& node, const IObject& origin)
+	{
+		IRectDrawable::OnDeserializedDelta(node, origin);
+		mParticlesNumLimit = Math::Clamp(mParticlesNumLimit, 0, maxParticlesLimit);
+		SetRandomSeed(mRandomSeed);
+	}
+
 	void ParticlesEmitter::SetPlaying(bool playing)
 	{
 		mPlaying = playing;
@@ -380,20 +361,9 @@ namespace o2
 
 	void ParticlesEmitter::SetMaxParticles(int count)
 	{
-		mParticlesNumLimit = count;
+		mParticlesNumLimit = Math::Clamp(count, 0, maxParticlesLimit);
 
-		int idx = 0;
-		while (mNumAliveParticles > mParticlesNumLimit)
-		{
-			if (mParticles[idx].alive)
-			{
-				mParticles[idx].alive = false;
-				mDeadParticles.Add(idx);
-				mNumAliveParticles--;
-			}
-
-			idx++;
-		}
+		mParticles.Truncate(mParticlesNumLimit);
 	}
 
 	int ParticlesEmitter::GetMaxParticles() const
@@ -403,15 +373,15 @@ namespace o2
 
 	int ParticlesEmitter::GetParticlesCount() const
 	{
-		return mNumAliveParticles;
+		return mParticles.GetCount();
 	}
 
 	bool ParticlesEmitter::IsAliveParticles() const
 	{
-		return mNumAliveParticles > 0;
+		return mParticles.GetCount() > 0;
 	}
 
-	const Vector<Particle>& ParticlesEmitter::GetParticles() const
+	const ParticlesPool& ParticlesEmitter::GetParticles() const
 	{
 		return mParticles;
 	}
@@ -597,6 +567,17 @@ namespace o2
 		mEmitParticlesColorA = colorA;
 		mEmitParticlesColorB = colorB;
 	}
+
+	void ParticlesEmitter::SetRandomSeed(UInt seed)
+	{
+		mRandomSeed = seed;
+		mRandom.SetSeed(seed != 0 ? seed : (UInt)Math::Random());
+	}
+
+	UInt ParticlesEmitter::GetRandomSeed() const
+	{
+		return mRandomSeed;
+	}
 }
 
 DECLARE_CLASS(o2::ParticlesEmitter);
@@ -4,6 +4,7 @@
 #include "o2/Render/Particle.h"
 #include "o2/Render/ParticlesEffects.h"
 #include "o2/Render/ParticlesEmitterShapes.h"
+#include "o2/Render/ParticlesPool.h"
 #include "o2/Render/RectDrawable.h"
 #include "o2/Utils/Math/Curve.h"
 
@@ -47,6 +48,9 @@ namespace o2
 		PROPERTY(ImageAssetRef, image, SetImage, GetImage);          // Particle image property
 		PROPERTY(ParticlesEmitterShape*, shape, SetShape, GetShape); // Emitting shape property @EDITOR_IGNORE
 
+	public:
+		static constexpr int maxParticlesLimit = 0x10000/4; // Max particles count, limited by 16 bit mesh indexes, 4 vertices per particle
+
 	public:
 		// Default constructor
 		ParticlesEmitter();
@@ -112,7 +116,7 @@ namespace o2
 		// Removes all effects
 		void RemoveAllEffects();
 
-		// Set particles limit number
+		// Set particles limit number, clamped by maxParticlesLimit
 		void SetMaxParticles(int count);
 
 		// Returns particles limit number
@@ -124,8 +128,8 @@ namespace o2
 		// Returns has alive particles
 		bool IsAliveParticles() const;
 
-		// Returns particles list
-		const Vector<Particle>& GetParticles() const;
+		// Returns particles pool
+		const ParticlesPool& GetParticles() const;
 
 		// Sets particles relativity
 		void SetParticlesRelativity(bool relative);
@@ -235,6 +239,12 @@ namespace o2
 		// Sets emitting color A and B
 		void SetEmitParticlesColor(const Color4& colorA, const Color4& colorB);
 
+		// Sets random generator seed and restarts particles random sequence. Zero means new random sequence each restart
+		void SetRandomSeed(UInt seed);
+
+		// Returns random generator seed, zero when sequence is random
+		UInt GetRandomSeed() const;
+
 	protected:
 		ImageAssetRef          mImageAsset;      // Particle sprite image @SERIALIZABLE
 		ParticlesEmitterShape* mShape = nullptr; // Particles emitting shape @SERIALIZABLE @EDITOR_PROPERTY 
@@ -270,13 +280,14 @@ namespace o2
 		Color4 mEmitParticlesColorA; // Emitting particles color A (particle emitting with color in range from this and ColorB)  @SERIALIZABLE
 		Color4 mEmitParticlesColorB; // Emitting particles color B (particle emitting with color in range from this and ColorA) @SERIALIZABLE
 
-		float            mCurrentTime = 0;         // Current working time in seconds
-		float            mEmitTimeBuffer = 0;      // Emitting next particle time buffer
-		Mesh*            mParticlesMesh = nullptr; // Particles mesh
-		Vector<Particle> mParticles;               // Working particles
-		Vector<int>      mDeadParticles;           // Dead particles indexes
-		int              mNumAliveParticles = 0;   // Count of current alive particles
-		Basis            mLastTransform;           // Last transformation
+		UInt            mRandomSeed = 0; // Particles random generator seed. Random sequence is used when zero @SERIALIZABLE
+		RandomGenerator mRandom;         // Particles random generator. Each emitter has own, so particles don't depend on update threads
+
+		float         mCurrentTime = 0;         // Current working time in seconds
+		float         mEmitTimeBuffer = 0;      // Emitting next particle time buffer
+		Mesh*         mParticlesMesh = nullptr; // Particles mesh
+		ParticlesPool mParticles;               // Working particles, compacted
+		Basis         mLastTransform;           // Last transformation
 
 	protected:
 		// Emits particles hen updating
@@ -290,10 +301,19 @@ namespace o2
 
 		// Updates mesh geometry
 		void UpdateMesh(); 
+
+		// Fills mesh indexes for particles quads. Indexes are same for each frame, they are filled once after resize
+		void UpdateMeshIndexes();
 		
 		// Called when basis was changed, updates particles positions from last transform
 		void BasisChanged() override;
 
+		// Called when object was deserialized, clamps particles limit and restarts random generator with seed
+		void OnDeserialized(const DataValue& node) override;
+
+		// Called when object was deserialized as delta, clamps particles limit and restarts random generator with seed
+		void OnDeserializedDelta(const DataValue& node, const IObject& origin) override;
+
 		friend class ParticlesEffect;
 	};
 
@@ -356,12 +376,12 @@ CLASS_FIELDS_META(o2::ParticlesEmitter)
 	FIELD().PROTECTED().DEFAULT_VALUE(0).NAME(mEmitParticlesAngleSpeedRange);
 	FIELD().PROTECTED().SERIALIZABLE_ATTRIBUTE().NAME(mEmitParticlesColorA);
 	FIELD().PROTECTED().SERIALIZABLE_ATTRIBUTE().NAME(mEmitParticlesColorB);
+	FIELD().PROTECTED().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(0).NAME(mRandomSeed);
+	FIELD().PROTECTED().NAME(mRandom);
 	FIELD().PROTECTED().DEFAULT_VALUE(0).NAME(mCurrentTime);
 	FIELD().PROTECTED().DEFAULT_VALUE(0).NAME(mEmitTimeBuffer);
 	FIELD().PROTECTED().DEFAULT_VALUE(nullptr).NAME(mParticlesMesh);
 	FIELD().PROTECTED().NAME(mParticles);
-	FIELD().PROTECTED().NAME(mDeadParticles);
-	FIELD().PROTECTED().DEFAULT_VALUE(0).NAME(mNumAliveParticles);
 	FIELD().PROTECTED().NAME(mLastTransform);
 }
 END_META;
@@ -390,7 +410,7 @@ CLASS_METHODS_META(o2::ParticlesEmitter)
 	FUNCTION().PUBLIC().SIGNATURE(int, GetMaxParticles);
 	FUNCTION().PUBLIC().SIGNATURE(int, GetParticlesCount);
 	FUNCTION().PUBLIC().SIGNATURE(bool, IsAliveParticles);
-	FUNCTION().PUBLIC().SIGNATURE(const Vector<Particle>&, GetParticles);
+	FUNCTION().PUBLIC().SIGNATURE(const ParticlesPool&, GetParticles);
 	FUNCTION().PUBLIC().SIGNATURE(void, SetParticlesRelativity, bool);
 	FUNCTION().PUBLIC().SIGNATURE(bool, IsParticlesRelative);
 	FUNCTION().PUBLIC().SIGNATURE(void, SetLoop, bool);
@@ -427,10 +447,15 @@ CLASS_METHODS_META(o2::ParticlesEmitter)
 	FUNCTION().PUBLIC().SIGNATURE(Color4, GetEmitParticlesColorB);
 	FUNCTION().PUBLIC().SIGNATURE(void, SetEmitParticlesColor, const Color4&);
 	FUNCTION().PUBLIC().SIGNATURE(void, SetEmitParticlesColor, const Color4&, const Color4&);
+	FUNCTION().PUBLIC().SIGNATURE(void, SetRandomSeed, UInt);
+	FUNCTION().PUBLIC().SIGNATURE(UInt, GetRandomSeed);
 	FUNCTION().PROTECTED().SIGNATURE(void, UpdateEmitting, float);
 	FUNCTION().PROTECTED().SIGNATURE(void, UpdateEffects, float);
 	FUNCTION().PROTECTED().SIGNATURE(void, UpdateParticles, float);
 	FUNCTION().PROTECTED().SIGNATURE(void, UpdateMesh);
+	FUNCTION().PROTECTED().SIGNATURE(void, UpdateMeshIndexes);
 	FUNCTION().PROTECTED().SIGNATURE(void, BasisChanged);
+	FUNCTION().PROTECTED().SIGNATURE(void, OnDeserialized, const DataValue&);
+	FUNCTION().PROTECTED().SIGNATURE(void, OnDeserializedDelta, const DataValue&, const IObject&);
 }
 END_META;
@@ -3,20 +3,20 @@
 
 namespace o2
 {
-	Vec2F ParticlesEmitterShape::GetEmittinPoint()
+	Vec2F ParticlesEmitterShape::GetEmittinPoint(RandomGenerator& random)
 	{
 		return Vec2F();
 	}
 
-	Vec2F CircleParticlesEmitterShape::GetEmittinPoint()
+	Vec2F CircleParticlesEmitterShape::GetEmittinPoint(RandomGenerator& random)
 	{
-		return Vec2F::Rotated(Math::Random(0.0f, Math::PI()*2.0f))*radius;
+		return Vec2F::Rotated(random.Range(0.0f, Math::PI()*2.0f))*radius;
 	}
 
-	Vec2F SquareParticlesEmitterShape::GetEmittinPoint()
+	Vec2F SquareParticlesEmitterShape::GetEmittinPoint(RandomGenerator& random)
 	{
 		Vec2F hs = size*0.5f;
-		return Vec2F(Math::Random(-hs.x, hs.x), Math::Random(-hs.y, hs.y));
+		return Vec2F(random.Range(-hs.x, hs.x), random.Range(-hs.y, hs.y));
 	}
 }
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "o2/Utils/Math/RandomGenerator.h"
 #include "o2/Utils/Serialization/Serializable.h"
 
 namespace o2
@@ -13,7 +14,7 @@ namespace o2
 
 	public:
 		virtual ~ParticlesEmitterShape() {}
-		virtual Vec2F GetEmittinPoint();
+		virtual Vec2F GetEmittinPoint(RandomGenerator& random);
 	};
 
 	// ---------------------------------
@@ -26,7 +27,7 @@ namespace o2
 	public:
 		float radius = 0;
 
-		Vec2F GetEmittinPoint() override;
+		Vec2F GetEmittinPoint(RandomGenerator& random) override;
 	};
 
 	// ---------------------------------
@@ -39,7 +40,7 @@ namespace o2
 	public:
 		Vec2F size;
 
-		Vec2F GetEmittinPoint() override;
+		Vec2F GetEmittinPoint(RandomGenerator& random) override;
 	};
 }
 
@@ -55,7 +56,7 @@ END_META;
 CLASS_METHODS_META(o2::ParticlesEmitterShape)
 {
 
-	FUNCTION().PUBLIC().SIGNATURE(Vec2F, GetEmittinPoint);
+	FUNCTION().PUBLIC().SIGNATURE(Vec2F, GetEmittinPoint, RandomGenerator&);
 }
 END_META;
 
@@ -72,7 +73,7 @@ END_META;
 CLASS_METHODS_META(o2::CircleParticlesEmitterShape)
 {
 
-	FUNCTION().PUBLIC().SIGNATURE(Vec2F, GetEmittinPoint);
+	FUNCTION().PUBLIC().SIGNATURE(Vec2F, GetEmittinPoint, RandomGenerator&);
 }
 END_META;
 
@@ -89,6 +90,6 @@ END_META;
 CLASS_METHODS_META(o2::SquareParticlesEmitterShape)
 {
 
-	FUNCTION().PUBLIC().SIGNATURE(Vec2F, GetEmittinPoint);
+	FUNCTION().PUBLIC().SIGNATURE(Vec2F, GetEmittinPoint, RandomGenerator&);
 }
 END_META;
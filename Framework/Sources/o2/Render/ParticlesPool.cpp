@@ -0,0 +1,283 @@
+#include "o2/stdafx.h"
+#include "ParticlesPool.h"
+
+#include <cstring>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#define O2_PARTICLES_SSE
+#include <xmmintrin.h>
+#endif
+
+namespace o2
+{
+	ParticlesPool::ParticlesPool()
+	{}
+
+	int ParticlesPool::Add(const Particle& particle)
+	{
+		if (mCount == mCapacity)
+			Reserve(Math::Max(mCapacity*2, 64));
+
+		mColors.Add(particle.color);
+		Set(mCount, particle);
+
+		return mCount++;
+	}
+
+	void ParticlesPool::Remove(int idx)
+	{
+		int last = mCount - 1;
+		if (idx != last)
+		{
+			float* channels = mChannels.Data();
+			for (int i = 0; i < ChannelsCount; i++)
+				channels[i*mCapacity + idx] = channels[i*mCapacity + last];
+
+			mColors[idx] = mColors[last];
+		}
+
+		mColors.PopBack();
+		mCount--;
+	}
+
+	void ParticlesPool::Truncate(int count)
+	{
+		if (count >= mCount)
+			return;
+
+		mColors.Resize(count);
+		mCount = count;
+	}
+
+	void ParticlesPool::Clear()
+	{
+		mColors.Clear();
+		mCount = 0;
+	}
+
+	void ParticlesPool::Reserve(int count)
+	{
+		int capacity = (count + 3) & ~3;
+		if (capacity <= mCapacity)
+			return;
+
+		Vector<float> channels;
+		channels.Resize(capacity*ChannelsCount);
+
+		for (int i = 0; i < ChannelsCount && mCount > 0; i++)
+			memcpy(channels.Data() + i*capacity, mChannels.Data() + i*mCapacity, mCount*sizeof(float));
+
+		mChannels = channels;
+		mCapacity = capacity;
+		mColors.Reserve(capacity);
+	}
+
+	int ParticlesPool::GetCount() const
+	{
+		return mCount;
+	}
+
+	Particle ParticlesPool::Get(int idx) const
+	{
+		Particle res;
+		res.position.Set(GetChannel(PositionX)[idx], GetChannel(PositionY)[idx]);
+		res.velocity.Set(GetChannel(VelocityX)[idx], GetChannel(VelocityY)[idx]);
+		res.angle = GetChannel(Angle)[idx];
+		res.angleSpeed = GetChannel(AngleSpeed)[idx];
+		res.size.Set(GetChannel(SizeX)[idx], GetChannel(SizeY)[idx]);
+		res.color = mColors[idx];
+		res.time = GetChannel(Time)[idx];
+		res.alive = true;
+
+		return res;
+	}
+
+	void ParticlesPool::Set(int idx, const Particle& particle)
+	{
+		GetChannel(PositionX)[idx] = particle.position.x;
+		GetChannel(PositionY)[idx] = particle.position.y;
+		GetChannel(VelocityX)[idx] = particle.velocity.x;
+		GetChannel(VelocityY)[idx] = particle.velocity.y;
+		GetChannel(Angle)[idx] = particle.angle;
+		GetChannel(AngleSpeed)[idx] = particle.angleSpeed;
+		GetChannel(SizeX)[idx] = particle.size.x;
+		GetChannel(SizeY)[idx] = particle.size.y;
+		GetChannel(Time)[idx] = particle.time;
+		mColors[idx] = particle.color;
+	}
+
+	float* ParticlesPool::GetChannel(Channel channel)
+	{
+		return mChannels.Data() + channel*mCapacity;
+	}
+
+	const float* ParticlesPool::GetChannel(Channel channel) const
+	{
+		return const_cast<ParticlesPool*>(this)->GetChannel(channel);
+	}
+
+	Color4* ParticlesPool::GetColors()
+	{
+		return mColors.Data();
+	}
+
+	const Color4* ParticlesPool::GetColors() const
+	{
+		return const_cast<ParticlesPool*>(this)->GetColors();
+	}
+
+	void ParticlesPool::Integrate(float dt)
+	{
+		float* px = GetChannel(PositionX), *py = GetChannel(PositionY);
+		float* vx = GetChannel(VelocityX), *vy = GetChannel(VelocityY);
+		float* angle = GetChannel(Angle), *angleSpeed = GetChannel(AngleSpeed);
+		float* time = GetChannel(Time);
+
+#if defined(O2_PARTICLES_SSE)
+		const __m128 dtv = _mm_set1_ps(dt);
+
+		// Capacity is multiple of 4, tail values of last pack are calculated and ignored
+		for (int i = 0; i < mCount; i += 4)
+		{
+			_mm_storeu_ps(px + i, _mm_add_ps(_mm_loadu_ps(px + i), _mm_mul_ps(_mm_loadu_ps(vx + i), dtv)));
+			_mm_storeu_ps(py + i, _mm_add_ps(_mm_loadu_ps(py + i), _mm_mul_ps(_mm_loadu_ps(vy + i), dtv)));
+			_mm_storeu_ps(angle + i, _mm_add_ps(_mm_loadu_ps(angle + i), _mm_mul_ps(_mm_loadu_ps(angleSpeed + i), dtv)));
+			_mm_storeu_ps(time + i, _mm_sub_ps(_mm_loadu_ps(time + i), dtv));
+		}
+#else
+		for (int i = 0; i < mCount; i++)
+		{
+			px[i] += vx[i]*dt;
+			py[i] += vy[i]*dt;
+			angle[i] += angleSpeed[i]*dt;
+			time[i] -= dt;
+		}
+#endif
+	}
+
+	void ParticlesPool::RemoveExpired()
+	{
+		const float* time = GetChannel(Time);
+
+		int idx = 0;
+		while (idx < mCount)
+		{
+			if (time[idx] < 0)
+				Remove(idx);
+			else
+				idx++;
+		}
+	}
+
+	void ParticlesPool::AddVelocity(const Vec2F& delta)
+	{
+		float* vx = GetChannel(VelocityX), *vy = GetChannel(VelocityY);
+
+#if defined(O2_PARTICLES_SSE)
+		const __m128 dx = _mm_set1_ps(delta.x), dy = _mm_set1_ps(delta.y);
+
+		for (int i = 0; i < mCount; i += 4)
+		{
+			_mm_storeu_ps(vx + i, _mm_add_ps(_mm_loadu_ps(vx + i), dx));
+			_mm_storeu_ps(vy + i, _mm_add_ps(_mm_loadu_ps(vy + i), dy));
+		}
+#else
+		for (int i = 0; i < mCount; i++)
+		{
+			vx[i] += delta.x;
+			vy[i] += delta.y;
+		}
+#endif
+	}
+
+	void ParticlesPool::TransformPositions(const Basis& basis)
+	{
+		float* px = GetChannel(PositionX), *py = GetChannel(PositionY);
+
+#if defined(O2_PARTICLES_SSE)
+		const __m128 xx = _mm_set1_ps(basis.xv.x), xy = _mm_set1_ps(basis.xv.y);
+		const __m128 yx = _mm_set1_ps(basis.yv.x), yy = _mm_set1_ps(basis.yv.y);
+		const __m128 ox = _mm_set1_ps(basis.origin.x), oy = _mm_set1_ps(basis.origin.y);
+
+		for (int i = 0; i < mCount; i += 4)
+		{
+			__m128 x = _mm_loadu_ps(px + i), y = _mm_loadu_ps(py + i);
+			_mm_storeu_ps(px + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(xx, x), _mm_mul_ps(yx, y)), ox));
+			_mm_storeu_ps(py + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(xy, x), _mm_mul_ps(yy, y)), oy));
+		}
+#else
+		for (int i = 0; i < mCount; i++)
+			basis.Transform(px[i], py[i]);
+#endif
+	}
+
+	void ParticlesPool::BuildQuads(int begin, int count, Vertex* vertices, float uvLeft, float uvRight, float uvUp,
+								   float uvDown) const
+	{
+		const float* px = GetChannel(PositionX), *py = GetChannel(PositionY);
+		const float* angle = GetChannel(Angle);
+		const float* sizeX = GetChannel(SizeX), *sizeY = GetChannel(SizeY);
+
+		int end = begin + count;
+
+		// Corners are calculated by packs of four particles, then written into vertices. Last pack can read values
+		// after channel end, they are still inside channels buffer and ignored
+		alignas(16) float cx[4][4], cy[4][4];
+		alignas(16) float sn[4], cs[4];
+
+		for (int i = begin; i < end; i += 4)
+		{
+			int packCount = Math::Min(4, end - i);
+
+			for (int j = 0; j < packCount; j++)
+			{
+				sn[j] = Math::Sin(angle[i + j]);
+				cs[j] = Math::Cos(angle[i + j]);
+			}
+
+			for (int j = packCount; j < 4; j++)
+				sn[j] = cs[j] = 0.0f;
+
+#if defined(O2_PARTICLES_SSE)
+			const __m128 half = _mm_set1_ps(0.5f);
+
+			__m128 snv = _mm_load_ps(sn), csv = _mm_load_ps(cs);
+			__m128 hsx = _mm_mul_ps(_mm_loadu_ps(sizeX + i), half), hsy = _mm_mul_ps(_mm_loadu_ps(sizeY + i), half);
+			__m128 ox = _mm_loadu_ps(px + i), oy = _mm_loadu_ps(py + i);
+
+			__m128 xvx = _mm_mul_ps(csv, hsx), xvy = _mm_mul_ps(snv, hsx);
+			__m128 yvx = _mm_sub_ps(_mm_setzero_ps(), _mm_mul_ps(snv, hsy)), yvy = _mm_mul_ps(csv, hsy);
+
+			// Corners order: o - xv + yv, o + xv + yv, o + xv - yv, o - xv - yv
+			_mm_store_ps(cx[0], _mm_add_ps(_mm_sub_ps(ox, xvx), yvx)); _mm_store_ps(cy[0], _mm_add_ps(_mm_sub_ps(oy, xvy), yvy));
+			_mm_store_ps(cx[1], _mm_add_ps(_mm_add_ps(ox, xvx), yvx)); _mm_store_ps(cy[1], _mm_add_ps(_mm_add_ps(oy, xvy), yvy));
+			_mm_store_ps(cx[2], _mm_sub_ps(_mm_add_ps(ox, xvx), yvx)); _mm_store_ps(cy[2], _mm_sub_ps(_mm_add_ps(oy, xvy), yvy));
+			_mm_store_ps(cx[3], _mm_sub_ps(_mm_sub_ps(ox, xvx), yvx)); _mm_store_ps(cy[3], _mm_sub_ps(_mm_sub_ps(oy, xvy), yvy));
+#else
+			for (int j = 0; j < packCount; j++)
+			{
+				float hsx = sizeX[i + j]*0.5f, hsy = sizeY[i + j]*0.5f;
+				float xvx = cs[j]*hsx, xvy = sn[j]*hsx;
+				float yvx = -sn[j]*hsy, yvy = cs[j]*hsy;
+				float ox = px[i + j], oy = py[i + j];
+
+				cx[0][j] = ox - xvx + yvx; cy[0][j] = oy - xvy + yvy;
+				cx[1][j] = ox + xvx + yvx; cy[1][j] = oy + xvy + yvy;
+				cx[2][j] = ox + xvx - yvx; cy[2][j] = oy + xvy - yvy;
+				cx[3][j] = ox - xvx - yvx; cy[3][j] = oy - xvy - yvy;
+			}
+#endif
+
+			for (int j = 0; j < packCount; j++)
+			{
+				Color32Bit color = mColors[i + j].ARGB();
+				Vertex* quad = vertices + (i + j - begin)*4;
+
+				quad[0].Set(cx[0][j], cy[0][j], color, uvLeft, uvUp);
+				quad[1].Set(cx[1][j], cy[1][j], color, uvRight, uvUp);
+				quad[2].Set(cx[2][j], cy[2][j], color, uvRight, uvDown);
+				quad[3].Set(cx[3][j], cy[3][j], color, uvLeft, uvDown);
+			}
+		}
+	}
+}
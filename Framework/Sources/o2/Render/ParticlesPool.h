@@ -0,0 +1,90 @@
+#pragma once
+
+#include "o2/Render/Particle.h"
+#include "o2/Utils/Math/Basis.h"
+#include "o2/Utils/Math/Vertex.h"
+#include "o2/Utils/Types/Containers/Vector.h"
+
+namespace o2
+{
+	// -----------------------------------------------------------------------------------------------------------
+	// Structure of arrays particles pool. Particles parameters are stored in contiguous channels, alive particles
+	// are always compacted at the beginning: removed particle is replaced by last one. Integration, effects and
+	// quads generation are kernels over channels, processing particles by packs of four with SIMD
+	// -----------------------------------------------------------------------------------------------------------
+	class ParticlesPool
+	{
+	public:
+		// ----------------------------------------------------------------------------
+		// Particles channels. Each channel is contiguous array of values for particles
+		// ----------------------------------------------------------------------------
+		enum Channel
+		{
+			PositionX, PositionY, VelocityX, VelocityY, Angle, AngleSpeed, SizeX, SizeY, Time,
+
+			ChannelsCount
+		};
+
+	public:
+		// Default constructor
+		ParticlesPool();
+
+		// Adds particle and returns its index
+		int Add(const Particle& particle);
+
+		// Removes particle by index. Last particle is moved to its place
+		void Remove(int idx);
+
+		// Removes particles after count
+		void Truncate(int count);
+
+		// Removes all particles
+		void Clear();
+
+		// Reserves channels for count of particles
+		void Reserve(int count);
+
+		// Returns particles count
+		int GetCount() const;
+
+		// Returns particle by index
+		Particle Get(int idx) const;
+
+		// Sets particle by index
+		void Set(int idx, const Particle& particle);
+
+		// Returns pointer to channel values
+		float* GetChannel(Channel channel);
+
+		// Returns pointer to channel values
+		const float* GetChannel(Channel channel) const;
+
+		// Returns particles colors
+		Color4* GetColors();
+
+		// Returns particles colors
+		const Color4* GetColors() const;
+
+		// Moves and rotates particles by their speeds and decreases their lifetimes
+		void Integrate(float dt);
+
+		// Removes particles with expired lifetime
+		void RemoveExpired();
+
+		// Adds value to velocities of all particles
+		void AddVelocity(const Vec2F& delta);
+
+		// Transforms positions of all particles by basis
+		void TransformPositions(const Basis& basis);
+
+		// Writes quads vertices of count particles from begin into vertices. Each particle is 4 vertices
+		void BuildQuads(int begin, int count, Vertex* vertices, float uvLeft, float uvRight, float uvUp,
+						float uvDown) const;
+
+	protected:
+		Vector<float>  mChannels;     // Channels values. Channel starts at channel index * capacity
+		Vector<Color4> mColors;       // Particles colors
+		int            mCount = 0;    // Particles count
+		int            mCapacity = 0; // Capacity of one channel, multiple of 4
+	};
+}
@@ -9,8 +9,10 @@
 #include "o2/Render/Texture.h"
 #include "o2/Utils/Debug/Debug.h"
 #include "o2/Utils/Debug/Log/LogStream.h"
+#include "o2/Utils/Debug/Profiler.h"
 #include "o2/Utils/Math/Geometry.h"
 #include "o2/Utils/Math/Interpolation.h"
+#include "o2/Utils/Memory/Allocators/FrameAllocator.h"
 #include "o2/Application/Input.h"
 
 namespace o2
@@ -89,51 +91,36 @@ namespace o2
 
 	void Render::DrawFilledPolygon(const Vertex* verticies, int vertexCount)
 	{
-		static Mesh mesh(TextureRef(), 1024, 1024);
-
 		int polyCount = vertexCount - 2;
-		if (mesh.GetMaxVertexCount() < vertexCount || mesh.GetMaxPolyCount() < polyCount)
-			mesh.Resize(vertexCount, polyCount);
-
-		memcpy(mesh.vertices, verticies, sizeof(Vertex)*vertexCount);
+		if (polyCount <= 0)
+			return;
 
+		UInt16* indexes = o2FrameAllocator.AllocateArray<UInt16>(polyCount*3);
 		for (int i = 2; i < vertexCount; i++)
 		{
 			int ii = (i - 2)*3;
-			mesh.indexes[ii] = i - 1;
-			mesh.indexes[ii + 1] = i;
-			mesh.indexes[ii + 2] = 0;
+			indexes[ii] = i - 1;
+			indexes[ii + 1] = i;
+			indexes[ii + 2] = 0;
  		}
 
-		mesh.vertexCount = vertexCount;
-		mesh.polyCount = polyCount;
-		mesh.Draw();
+		// Vertices are only read, buffer copies them
+		DrawBuffer(PrimitiveType::Polygon, const_cast<Vertex*>(verticies), vertexCount, indexes, polyCount, TextureRef());
 	}
 
 	void Render::DrawFilledPolygon(const Vector<Vec2F>& points, const Color4& color /*= Color4::White()*/)
 	{
-		static Mesh mesh(TextureRef(), 1024, 1024);
-
 		int vertexCount = points.Count();
-		int polyCount = points.Count() - 2;
-		if (mesh.GetMaxVertexCount() < points.Count() || mesh.GetMaxPolyCount() < polyCount)
-			mesh.Resize(points.Count(), polyCount);
+		if (vertexCount < 3)
+			return;
 
-		ULong dcolor = color.ABGR();
-		for (int i = 0; i < points.Count(); i++)
-			mesh.vertices[i] = Vertex(points[i], dcolor, 0.0f, 0.0f);
+		Vertex* vertices = o2FrameAllocator.AllocateArray<Vertex>(vertexCount);
 
-		for (int i = 2; i < points.Count(); i++)
-		{
-			int ii = (i - 2)*3;
-			mesh.indexes[ii] = i - 1;
-			mesh.indexes[ii + 1] = i;
-			mesh.indexes[ii + 2] = 0;
-		}
+		ULong dcolor = color.ABGR();
+		for (int i = 0; i < vertexCount; i++)
+			vertices[i] = Vertex(points[i], dcolor, 0.0f, 0.0f);
 
-		mesh.vertexCount = vertexCount;
-		mesh.polyCount = polyCount;
-		mesh.Draw();
+		DrawFilledPolygon(vertices, vertexCount);
 	}
 
 	RectI Render::CalculateScreenSpaceScissorRect(const RectF& cameraSpaceScissorRect) const
@@ -196,12 +183,11 @@ namespace o2
 							float width /*= 1.0f*/, LineType lineType /*= LineType::Solid*/)
 	{
 		ULong dcolor = color.ABGR();
-		Vertex* v = mnew Vertex[points.Count()];
+		Vertex* v = o2FrameAllocator.AllocateArray<Vertex>(points.Count());
 		for (int i = 0; i < points.Count(); i++)
 			v[i] = Vertex(points[i], dcolor, 0, 0);
 
 		DrawAAPolyLine(v, points.Count(), width, lineType);
-		delete[] v;
 	}
 
 	void Render::DrawAAArrow(const Vec2F& a, const Vec2F& b, const Color4& color /*= Color4::White()*/,
@@ -268,7 +254,7 @@ namespace o2
 							  int segCount /*= 20*/,
 							  float width /*= 1.0f*/, LineType lineType /*= LineType::Solid*/)
 	{
-		Vertex* v = mnew Vertex[segCount + 1];
+		Vertex* v = o2FrameAllocator.AllocateArray<Vertex>(segCount + 1);
 		ULong dcolor = color.ABGR();
 
 		float angleSeg = 2.0f*Math::PI() / (float)(segCount - 1);
@@ -279,7 +265,6 @@ namespace o2
 		}
 
 		DrawAAPolyLine(v, segCount + 1, width, lineType);
-		delete[] v;
 	}
 
 	void Render::DrawAABezierCurve(const Vec2F& p1, const Vec2F& p2, const Vec2F& p3, const Vec2F& p4,
@@ -343,12 +328,11 @@ namespace o2
 	void Render::DrawLine(const Vector<Vec2F>& points, const Color4& color /*= Color4::White()*/)
 	{
 		ULong dcolor = color.ABGR();
-		Vertex* v = mnew Vertex[points.Count()];
+		Vertex* v = o2FrameAllocator.AllocateArray<Vertex>(points.Count());
 		for (int i = 0; i < points.Count(); i++)
 			v[i] = Vertex(points[i], dcolor, 0, 0);
 
 		DrawPolyLine(v, points.Count());
-		delete[] v;
 	}
 
 	void Render::DrawArrow(const Vec2F& a, const Vec2F& b, const Color4& color /*= Color4::White()*/,
@@ -409,16 +393,8 @@ namespace o2
 	void Render::DrawCircle(const Vec2F& pos, float radius /*= 5*/, const Color4& color /*= Color4::White()*/,
 							int segCount /*= 20*/)
 	{
-		static int vertexBufferSize = segCount + 1;
-		static Vertex* vertexBuffer = mnew Vertex[vertexBufferSize];
-
 		int vertexCount = segCount + 1;
-		if (vertexCount > vertexBufferSize)
-		{
-			delete[] vertexBuffer;
-			vertexBufferSize = vertexCount;
-			vertexBuffer = mnew Vertex[vertexBufferSize];
-		}
+		Vertex* vertexBuffer = o2FrameAllocator.AllocateArray<Vertex>(vertexCount);
 
 		ULong dcolor = color.ABGR();
 
@@ -435,16 +411,8 @@ namespace o2
 	void Render::DrawFilledCircle(const Vec2F& pos, float radius /*= 5*/, const Color4& color /*= Color4::White()*/, 
 								  int segCount /*= 20*/)
 	{
-		static int vertexBufferSize = segCount + 1;
-		static Vertex* vertexBuffer = mnew Vertex[vertexBufferSize];
-
 		int vertexCount = segCount + 1;
-		if (vertexCount > vertexBufferSize)
-		{
-			delete[] vertexBuffer;
-			vertexBufferSize = vertexCount;
-			vertexBuffer = mnew Vertex[vertexBufferSize];
-		}
+		Vertex* vertexBuffer = o2FrameAllocator.AllocateArray<Vertex>(vertexCount);
 
 		ULong dcolor = color.ABGR();
 
@@ -555,6 +523,73 @@ namespace o2
 				   mesh->indexes, mesh->polyCount, mesh->mTexture);
 	}
 
+	void Render::DrawBuffer(PrimitiveType primitiveType, Vertex* vertices, UInt verticesCount,
+							UInt16* indexes, UInt elementsCount, const TextureRef& texture)
+	{
+		if (!mReady)
+			return;
+
+		mDrawingDepth += 1.0f;
+
+		if (mClippingEverything)
+			return;
+
+		if (mDeferredDrawing)
+		{
+			bool scissorEnabled = !mStackScissors.IsEmpty() && !mStackScissors.Last().mRenderTarget;
+			RectI scissorRect = scissorEnabled ? mStackScissors.Last().mSummaryScissorRect : RectI();
+
+			mDrawCommands.Add(primitiveType, vertices, verticesCount, indexes, elementsCount, texture.mTexture,
+							  scissorEnabled, scissorRect);
+			return;
+		}
+
+		DrawBufferImmediate(primitiveType, vertices, verticesCount, indexes, elementsCount, texture.mTexture);
+	}
+
+	void Render::DrawPrimitives()
+	{
+		PROFILE_SCOPE("Render::DrawPrimitives");
+
+		if (!mDrawCommands.IsEmpty() && !mDrawCommands.IsSubmitting())
+		{
+			mDrawCommands.Submit(mDrawCommandsBackend);
+			mDrawCommands.Clear();
+		}
+
+		DrawBufferedPrimitives();
+	}
+
+	void Render::SetDeferredDrawing(bool enabled)
+	{
+		if (mDeferredDrawing == enabled)
+			return;
+
+		DrawPrimitives();
+		mDeferredDrawing = enabled;
+	}
+
+	bool Render::IsDeferredDrawing() const
+	{
+		return mDeferredDrawing;
+	}
+
+	const DrawCommandBuffer& Render::GetDrawCommandBuffer() const
+	{
+		return mDrawCommands;
+	}
+
+	void Render::DrawCommandsBackend::Draw(const DrawCommand& command, const Vertex* vertices, const UInt16* indexes)
+	{
+		render->DrawBufferImmediate(command.primitiveType, vertices, command.verticesCount, indexes,
+									command.elementsCount, command.texture);
+	}
+
+	void Render::DrawCommandsBackend::Flush()
+	{
+		render->DrawBufferedPrimitives();
+	}
+
 	void Render::DrawMeshWire(Mesh* mesh, const Color4& color /*= Color4::White()*/)
 	{
 		auto dcolor = color.ABGR();
@@ -587,28 +622,35 @@ namespace o2
 								LineType lineType /*= LineType::Solid*/,
 								bool scaleToScreenSpace /*= true*/)
 	{
-		static Mesh mesh(mSolidLineTexture, 1024, 1024);
+		if (count < 2)
+			return;
 
 		TextureRef texture = lineType == LineType::Solid ? mSolidLineTexture : mDashLineTexture;
 		Vec2I texSize = lineType == LineType::Solid ? Vec2I(1, 1) : mDashLineTexture->GetSize();
 
+		// Buffers are allocated with exact size, so mesh creation doesn't reallocate them
+		UInt maxVertexCount = count*4;
+		UInt maxPolyCount = (count - 1)*6;
+		Vertex* meshVertices = o2FrameAllocator.AllocateArray<Vertex>(maxVertexCount);
+		UInt16* meshIndexes = o2FrameAllocator.AllocateArray<UInt16>(maxPolyCount*3);
+		UInt vertexCount = 0, polyCount = 0;
+
 		if (scaleToScreenSpace)
 		{
 			Geometry::CreatePolyLineMesh(vertices, count,
-										 mesh.vertices, mesh.vertexCount, mesh.mMaxVertexCount,
-										 mesh.indexes, mesh.polyCount, mesh.mMaxPolyCount,
+										 meshVertices, vertexCount, maxVertexCount,
+										 meshIndexes, polyCount, maxPolyCount,
 										 width - 0.5f, 0.5f, 0.5f, texSize, mInvViewScale);
 		}
 		else
 		{
 			Geometry::CreatePolyLineMesh(vertices, count,
-										 mesh.vertices, mesh.vertexCount, mesh.mMaxVertexCount,
-										 mesh.indexes, mesh.polyCount, mesh.mMaxPolyCount,
+										 meshVertices, vertexCount, maxVertexCount,
+										 meshIndexes, polyCount, maxPolyCount,
 										 width, 0.5f, 0.5f, texSize, Vec2F(1, 1));
 		}
 
-		mesh.SetTexture(texture);
-		mesh.Draw();
+		DrawBuffer(PrimitiveType::Polygon, meshVertices, vertexCount, meshIndexes, polyCount, texture);
 	}
 
 	TextureRef Render::GetRenderTexture() const
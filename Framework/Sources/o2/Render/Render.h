@@ -14,6 +14,7 @@
 #endif
 
 #include "o2/Render/Camera.h"
+#include "o2/Render/DrawCommandBuffer.h"
 #include "o2/Render/TextureRef.h"
 #include "o2/Utils/Math/Vertex.h"
 #include "o2/Utils/Singleton.h"
@@ -247,6 +248,16 @@ namespace o2
 		void DrawBuffer(PrimitiveType primitiveType, Vertex* vertices, UInt verticesCount,
 						UInt16* indexes, UInt elementsCount, const TextureRef& texture);
 
+		// Enables or disables deferred drawing. In deferred mode draw calls are recorded into command buffer
+		// and merged by texture before sending to GPU on next state change or frame end
+		void SetDeferredDrawing(bool enabled);
+
+		// Returns true when deferred drawing is enabled
+		bool IsDeferredDrawing() const;
+
+		// Returns deferred draw commands buffer
+		const DrawCommandBuffer& GetDrawCommandBuffer() const;
+
 		// Draws mesh wire
 		void DrawMeshWire(Mesh* mesh, const Color4& color = Color4::White());
 
@@ -278,6 +289,23 @@ namespace o2
 		// Returns scissor infos at current frame
 		const Vector<ScissorInfo>& GetScissorInfos() const;
 
+	protected:
+		// ----------------------------------------------------------------
+		// Draw commands backend, draws commands from buffer by this render
+		// ----------------------------------------------------------------
+		class DrawCommandsBackend: public IDrawCommandsBackend
+		{
+		public:
+			Render* render = nullptr; // Owner render
+
+		public:
+			// Draws command immediately
+			void Draw(const DrawCommand& command, const Vertex* vertices, const UInt16* indexes) override;
+
+			// Sends buffers to draw
+			void Flush() override;
+		};
+
 	protected:
 		PrimitiveType mCurrentPrimitiveType; // Type of drawing primitives for next DIP
 
@@ -314,6 +342,10 @@ namespace o2
 
 		float mDrawingDepth; // Current drawing depth, increments after each drawing drawables
 
+		bool                mDeferredDrawing = false; // True when draw calls are recorded into commands buffer
+		DrawCommandBuffer   mDrawCommands;            // Deferred draw commands buffer
+		DrawCommandsBackend mDrawCommandsBackend;     // Backend for drawing commands from buffer
+
 		FT_Library mFreeTypeLib; // FreeType library, for rendering fonts
 
 		Vector<Sprite*> mSprites; // All sprites
@@ -346,9 +378,16 @@ namespace o2
 		// Called when target frame or window was resized
 		void OnFrameResized();
 
-		// Send buffers to draw
+		// Sends deferred commands and buffers to draw
 		void DrawPrimitives();
 
+		// Send buffers to draw. Implemented by platform render
+		void DrawBufferedPrimitives();
+
+		// Puts data into buffers, sends them to draw when texture or primitive type changes. Implemented by platform render
+		void DrawBufferImmediate(PrimitiveType primitiveType, const Vertex* vertices, UInt verticesCount,
+								 const UInt16* indexes, UInt elementsCount, Texture* texture);
+
 		// Sets orthographic view matrix by view size
 		void SetupViewMatrix(const Vec2I& viewSize);
 
@@ -371,6 +410,7 @@ namespace o2
 		void OnAssetsRebuilded(const Vector<UID>& changedAssets);
 
 		friend class Application;
+		friend class Assets;
 		friend class BitmapFont;
 		friend class BitmapFontAsset;
 		friend class Font;
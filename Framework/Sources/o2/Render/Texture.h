@@ -133,6 +133,7 @@ namespace o2
 
 		int mRefs = 0; // Texture references
 
+		friend class Assets;
 		friend class Render;
 		friend class TextureRef;
 	};
@@ -22,6 +22,10 @@ namespace o2
 
 	TextureRef::TextureRef(const String& fileName)
 	{
+		// Streaming texture is registered with file name before loading, it must be ready for synchronous request
+		if (Assets::IsSingletonInitialzed())
+			o2Assets.FinishTextureLoading(fileName);
+
 		mTexture = o2Render.mTextures.FindOrDefault([&](Texture* tex) { return tex->GetFileName() == fileName; });
 
 		if (!mTexture)
@@ -21,7 +21,7 @@ namespace o2
 				   PixelFormat format = PixelFormat::R8G8B8A8,
 				   Texture::Usage usage = Texture::Usage::Default);
 
-		// Constructor from file @SCRIPTABLE
+		// Constructor from file. Finishes texture streaming by file name @SCRIPTABLE
 		TextureRef(const String& fileName);
 
 		// Constructor from bitmap
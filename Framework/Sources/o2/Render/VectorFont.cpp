@@ -33,7 +33,8 @@ namespace o2
 	}
 
 	VectorFont::VectorFont(const VectorFont& other) :
-		Font(), mFreeTypeFace(other.mFreeTypeFace)
+		Font(), mFreeTypeFace(other.mFreeTypeFace), mDistanceFieldMode(other.mDistanceFieldMode),
+		mDistanceFieldHeight(other.mDistanceFieldHeight), mDistanceFieldSpread(other.mDistanceFieldSpread)
 	{
 		mTexture = TextureRef(Vec2I(512, 512));
 		mTextureSrcRect.Set(0, 0, 512, 512);
@@ -58,6 +59,74 @@ namespace o2
 		return "(Unknown error)";
 	}
 
+	// Calculates squared distances to nearest feature in one row by lower envelope of parabolas
+	static void DistanceTransform1D(const double* f, int n, double* d, int* v, double* z)
+	{
+		int k = 0;
+		v[0] = 0;
+		z[0] = -DBL_MAX;
+		z[1] = DBL_MAX;
+
+		for (int q = 1; q < n; q++)
+		{
+			double s = ((f[q] + q*q) - (f[v[k]] + v[k]*v[k]))/(2*q - 2*v[k]);
+			while (s <= z[k])
+			{
+				k--;
+				s = ((f[q] + q*q) - (f[v[k]] + v[k]*v[k]))/(2*q - 2*v[k]);
+			}
+
+			k++;
+			v[k] = q;
+			z[k] = s;
+			z[k + 1] = DBL_MAX;
+		}
+
+		k = 0;
+		for (int q = 0; q < n; q++)
+		{
+			while (z[k + 1] < q)
+				k++;
+
+			d[q] = (q - v[k])*(q - v[k]) + f[v[k]];
+		}
+	}
+
+	// Calculates squared euclidean distances to nearest pixels, where inside equals to feature
+	static void DistanceTransform2D(const Vector<UInt8>& inside, bool feature, const Vec2I& size, Vector<double>& result)
+	{
+		const double far = 1e20;
+
+		int maxSize = Math::Max(size.x, size.y);
+		Vector<double> f, d, z;
+		Vector<int> v;
+		f.Resize(maxSize);
+		d.Resize(maxSize);
+		z.Resize(maxSize + 1);
+		v.Resize(maxSize);
+
+		result.Resize(size.x*size.y);
+		for (int i = 0; i < size.x*size.y; i++)
+			result[i] = (inside[i] != 0) == feature ? 0.0 : far;
+
+		for (int x = 0; x < size.x; x++)
+		{
+			for (int y = 0; y < size.y; y++)
+				f[y] = result[y*size.x + x];
+
+			DistanceTransform1D(f.Data(), size.y, d.Data(), v.Data(), z.Data());
+
+			for (int y = 0; y < size.y; y++)
+				result[y*size.x + x] = d[y];
+		}
+
+		for (int y = 0; y < size.y; y++)
+		{
+			DistanceTransform1D(result.Data() + y*size.x, size.x, d.Data(), v.Data(), z.Data());
+			memcpy(result.Data() + y*size.x, d.Data(), size.x*sizeof(double));
+		}
+	}
+
 	bool VectorFont::Load(const String& fileName)
 	{
 		InFile file(fileName);
@@ -203,6 +272,40 @@ namespace o2
 		onCharactersRebuilt();
 	}
 
+	void VectorFont::SetDistanceFieldMode(bool enabled, int referenceHeight /*= 64*/, int spread /*= 16*/)
+	{
+		if (referenceHeight != mDistanceFieldHeight || spread != mDistanceFieldSpread)
+			mDistanceFields.Clear();
+
+		mDistanceFieldMode = enabled;
+		mDistanceFieldHeight = referenceHeight;
+		mDistanceFieldSpread = spread;
+
+		if (!enabled)
+			mDistanceFields.Clear();
+
+		Reset();
+	}
+
+	bool VectorFont::IsDistanceFieldMode() const
+	{
+		return mDistanceFieldMode;
+	}
+
+	UInt VectorFont::GetDistanceFieldsMemorySize() const
+	{
+		UInt res = 0;
+		for (auto& glyphKV : mDistanceFields)
+			res += glyphKV.second.distances.Count()*sizeof(UInt8);
+
+		return res;
+	}
+
+	UInt VectorFont::GetUsedAtlasMemorySize() const
+	{
+		return mLastPackLinePos*mTexture->GetSize().x*4;
+	}
+
 	void VectorFont::UpdateCharacters(Vector<wchar_t>& newCharacters, int height)
 	{
 		RenderNewCharacters(newCharacters, height);
@@ -213,6 +316,12 @@ namespace o2
 	{
 		if (!mFreeTypeFace)
 			return;
+
+		if (mDistanceFieldMode)
+		{
+			RenderDistanceFieldCharacters(newCharacters, height);
+			return;
+		}
 		
 		Vec2I dpi = o2Render.GetDPI();
 		FT_Set_Char_Size(mFreeTypeFace, 0, height * 64, dpi.x, dpi.y);
@@ -269,6 +378,143 @@ namespace o2
 		}
 	}
 
+	void VectorFont::RenderDistanceFieldCharacters(Vector<wchar_t>& newCharacters, int height)
+	{
+		float scale = (float)height/(float)mDistanceFieldHeight;
+		float invScale = 1.0f/scale;
+		float spread = (float)mDistanceFieldSpread;
+		float distanceScale = spread*scale/127.0f;
+
+		Vec2I border;
+		for (auto effect : mEffects)
+		{
+			Vec2I effectExt = effect->GetSizeExtend();
+			border.x = Math::Max(border.x, effectExt.x);
+			border.y = Math::Max(border.y, effectExt.y);
+		}
+
+		border += Vec2I(2, 2);
+
+		int symbolsHeight = Math::CeilToInt((GetDistanceFieldGlyph('A').glyphSize.y*scale + border.y*2)*1.25f);
+
+		Vector<float> distances;
+
+		for (auto ch : newCharacters)
+		{
+			CharDef newCharDef;
+
+			const DistanceFieldGlyph& glyph = GetDistanceFieldGlyph(ch);
+
+			Vec2I glyphSize(Math::CeilToInt(glyph.glyphSize.x*scale), Math::CeilToInt(glyph.glyphSize.y*scale));
+
+			Bitmap* newBitmap = mnew Bitmap(PixelFormat::R8G8B8A8, glyphSize + border*2);
+			UInt8* newBitmapData = newBitmap->GetData();
+			Vec2I newBitmapSize = newBitmap->GetSize();
+
+			distances.Resize(newBitmapSize.x*newBitmapSize.y);
+
+			// Pixels centers are mapped into distance field pixels at reference height, coverage is taken from
+			// distance to edge in target pixels
+			for (int y = 0; y < newBitmapSize.y; y++)
+			{
+				float fieldY = (y - border.y + 0.5f)*invScale + spread - 0.5f;
+
+				for (int x = 0; x < newBitmapSize.x; x++)
+				{
+					float fieldX = (x - border.x + 0.5f)*invScale + spread - 0.5f;
+					float distance = (glyph.Sample(fieldX, fieldY) - 128.0f)*distanceScale;
+
+					int idx = y*newBitmapSize.x + x;
+					distances[idx] = distance;
+
+					Color4 c(255, 255, 255, Math::RoundToInt(Math::Clamp01(distance + 0.5f)*255.0f));
+					ULong cl = c.ABGR();
+					memcpy(&newBitmapData[idx*4], &cl, 4);
+				}
+			}
+
+			for (auto effect : mEffects)
+			{
+				if (!effect->ProcessDistanceField(newBitmap, distances.Data()))
+					effect->Process(newBitmap);
+			}
+
+			newCharDef.bitmap = newBitmap;
+			newCharDef.character.mId = ch;
+			newCharDef.character.mHeight = height;
+			newCharDef.character.mSize = newBitmapSize;
+			newCharDef.character.mAdvance = glyph.advance*scale;
+			newCharDef.character.mOrigin = glyph.origin*scale + (Vec2F)border;
+
+			PackCharacter(newCharDef, symbolsHeight);
+		}
+	}
+
+	const VectorFont::DistanceFieldGlyph& VectorFont::GetDistanceFieldGlyph(wchar_t ch)
+	{
+		auto fnd = mDistanceFields.find(ch);
+		if (fnd != mDistanceFields.End())
+			return fnd->second;
+
+		Vec2I dpi = o2Render.GetDPI();
+		FT_Set_Char_Size(mFreeTypeFace, 0, mDistanceFieldHeight*64, dpi.x, dpi.y);
+
+		FT_Load_Char(mFreeTypeFace, ch, FT_LOAD_RENDER);
+		auto ftGlyph = mFreeTypeFace->glyph;
+
+		DistanceFieldGlyph& glyph = mDistanceFields[ch];
+		glyph.glyphSize.Set(ftGlyph->bitmap.width, ftGlyph->bitmap.rows);
+		glyph.size = glyph.glyphSize + Vec2I(mDistanceFieldSpread, mDistanceFieldSpread)*2;
+		glyph.advance = ftGlyph->advance.x/64.0f;
+		glyph.origin.x = -ftGlyph->metrics.horiBearingX/64.0f;
+		glyph.origin.y = (ftGlyph->metrics.height - ftGlyph->metrics.horiBearingY)/64.0f;
+
+		// Glyph coverage is placed with spread borders, rows are flipped from top to bottom into bottom to top
+		int pixelsCount = glyph.size.x*glyph.size.y;
+		int pitch = Math::Abs(ftGlyph->bitmap.pitch);
+
+		Vector<UInt8> inside;
+		inside.Resize(pixelsCount);
+		for (int i = 0; i < pixelsCount; i++)
+			inside[i] = 0;
+
+		for (int y = 0; y < glyph.glyphSize.y; y++)
+		{
+			int row = mDistanceFieldSpread + glyph.glyphSize.y - 1 - y;
+			for (int x = 0; x < glyph.glyphSize.x; x++)
+				inside[row*glyph.size.x + x + mDistanceFieldSpread] = ftGlyph->bitmap.buffer[y*pitch + x] >= 128 ? 1 : 0;
+		}
+
+		// Distances between pixels centers are shifted by half of pixel, so edge is between inside and outside pixels
+		Vector<double> outsideDistances, insideDistances;
+		DistanceTransform2D(inside, true, glyph.size, outsideDistances);
+		DistanceTransform2D(inside, false, glyph.size, insideDistances);
+
+		glyph.distances.Resize(pixelsCount);
+		for (int i = 0; i < pixelsCount; i++)
+		{
+			float distance = inside[i] ? (float)sqrt(insideDistances[i]) - 0.5f : 0.5f - (float)sqrt(outsideDistances[i]);
+			glyph.distances[i] = (UInt8)Math::Clamp(Math::RoundToInt(128.0f + distance/mDistanceFieldSpread*127.0f), 0, 255);
+		}
+
+		return glyph;
+	}
+
+	float VectorFont::DistanceFieldGlyph::Sample(float x, float y) const
+	{
+		x = Math::Clamp(x, 0.0f, (float)(size.x - 1));
+		y = Math::Clamp(y, 0.0f, (float)(size.y - 1));
+
+		int x0 = (int)x, y0 = (int)y;
+		int x1 = Math::Min(x0 + 1, size.x - 1), y1 = Math::Min(y0 + 1, size.y - 1);
+		float tx = x - x0, ty = y - y0;
+
+		float bottom = Math::Lerp((float)distances[y0*size.x + x0], (float)distances[y0*size.x + x1], tx);
+		float top = Math::Lerp((float)distances[y1*size.x + x0], (float)distances[y1*size.x + x1], tx);
+
+		return Math::Lerp(bottom, top, ty);
+	}
+
 	void VectorFont::PackCharacter(CharDef& character, int height)
 	{
 		PackLine* packLine = nullptr;
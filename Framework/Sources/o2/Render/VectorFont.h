@@ -29,6 +29,10 @@ namespace o2
 			// Processes glyph bitmap
 			virtual void Process(Bitmap* bitmap) {};
 
+			// Processes glyph bitmap by glyph distances in bitmap pixels, positive inside glyph. Distances are stored
+			// for each bitmap pixel. Returns false when effect doesn't use distances, then Process is called
+			virtual bool ProcessDistanceField(Bitmap* bitmap, const float* distances) { return false; }
+
 			// Returns needs extending size for glyph bitmap
 			virtual Vec2I GetSizeExtend() const { return Vec2I(); };
 
@@ -88,6 +92,21 @@ namespace o2
 		// Removes all cached characters
 		void Reset();
 
+		// Sets signed distance field glyphs mode. Each glyph is rendered once at reference height into single channel
+		// distance field, characters of all heights and their effects are built from it without rasterization.
+		// Limitation: render has no distance threshold draw path, so atlas still stores coverage of each height and
+		// atlas memory is the same as in rasterized mode. Only FreeType rasterization is shared between heights
+		void SetDistanceFieldMode(bool enabled, int referenceHeight = 64, int spread = 16);
+
+		// Returns is signed distance field glyphs mode enabled
+		bool IsDistanceFieldMode() const;
+
+		// Returns memory size of cached glyphs distance fields in bytes
+		UInt GetDistanceFieldsMemorySize() const;
+
+		// Returns memory size of atlas area used by packed characters in bytes
+		UInt GetUsedAtlasMemorySize() const;
+
 	protected:
 		struct PackLine;
 
@@ -119,6 +138,25 @@ namespace o2
 			bool operator==(const PackLine& other) const { return false; }
 		};
 
+		// --------------------------------------------------------------------------------------------------------
+		// Glyph signed distance field at reference height. Distances are stored in 8 bits in range of spread,
+		// 128 is glyph edge, greater values are inside glyph. Rows are stored from bottom to top, like glyph bitmaps
+		// --------------------------------------------------------------------------------------------------------
+		struct DistanceFieldGlyph
+		{
+			Vec2I         glyphSize; // Glyph size without spread borders
+			Vec2I         size;      // Distance field size, glyph size with spread borders
+			Vec2F         origin;    // Glyph origin relative to glyph left bottom corner
+			float         advance;   // Glyph advance
+			Vector<UInt8> distances; // Distances values
+
+		public:
+			// Returns bilinear interpolated distance value at position in distance field pixels
+			float Sample(float x, float y) const;
+
+			bool operator==(const DistanceFieldGlyph& other) const { return false; }
+		};
+
 	protected:
 		String  mFileName;     // Source file name
 		FT_Face mFreeTypeFace; // Free Type font face
@@ -130,6 +168,11 @@ namespace o2
 
 		mutable Map<int, float> mHeights; // Cached line heights
 
+		bool                             mDistanceFieldMode = false; // Is glyphs built from distance fields
+		int                              mDistanceFieldHeight = 64;  // Reference height of glyphs distance fields
+		int                              mDistanceFieldSpread = 16;  // Distance fields range in pixels at reference height
+		Map<wchar_t, DistanceFieldGlyph> mDistanceFields;            // Cached glyphs distance fields, one for all heights
+
 	protected:
 		// Updates characters set
 		void UpdateCharacters(Vector<wchar_t>& newCharacters, int height);
@@ -137,6 +180,12 @@ namespace o2
 		// Renders new characters
 		void RenderNewCharacters(Vector<wchar_t>& newCharacters, int height);
 
+		// Builds new characters from glyphs distance fields, scaled to height
+		void RenderDistanceFieldCharacters(Vector<wchar_t>& newCharacters, int height);
+
+		// Returns glyph distance field. Renders glyph at reference height and builds distance field when it isn't cached
+		const DistanceFieldGlyph& GetDistanceFieldGlyph(wchar_t ch);
+
 		// Packs character in line 
 		void PackCharacter(CharDef& character, int height);
 	};
@@ -161,6 +210,7 @@ CLASS_METHODS_META(o2::VectorFont::Effect)
 {
 
 	FUNCTION().PUBLIC().SIGNATURE(void, Process, Bitmap*);
+	FUNCTION().PUBLIC().SIGNATURE(bool, ProcessDistanceField, Bitmap*, const float*);
 	FUNCTION().PUBLIC().SIGNATURE(Vec2I, GetSizeExtend);
 	FUNCTION().PUBLIC().SIGNATURE(bool, IsEqual, Effect*);
 }
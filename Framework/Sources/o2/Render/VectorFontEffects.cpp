@@ -5,6 +5,22 @@
 
 namespace o2
 {
+	// Blends color with coverage under glyph bitmap pixel
+	static void BlendUnderPixel(UInt8* pixel, const Color4& color, float coverage)
+	{
+		float topAlpha = pixel[3]/255.0f;
+		float bottomAlpha = color.AF()*coverage*(1.0f - topAlpha);
+		float alpha = topAlpha + bottomAlpha;
+
+		if (alpha < FLT_EPSILON)
+			return;
+
+		pixel[0] = (UInt8)Math::RoundToInt((pixel[0]*topAlpha + color.r*bottomAlpha)/alpha);
+		pixel[1] = (UInt8)Math::RoundToInt((pixel[1]*topAlpha + color.g*bottomAlpha)/alpha);
+		pixel[2] = (UInt8)Math::RoundToInt((pixel[2]*topAlpha + color.b*bottomAlpha)/alpha);
+		pixel[3] = (UInt8)Math::RoundToInt(alpha*255.0f);
+	}
+
 	FontStrokeEffect::FontStrokeEffect(float radius /*= 1.0f*/, const Color4& color /*= Color4::Black()*/,
 									   int alphaThreshold /*= 100*/):
 		radius(radius), color(color), alphaThreshold(alphaThreshold)
@@ -15,6 +31,17 @@ namespace o2
 		bitmap->Outline(radius, color, alphaThreshold);
 	}
 
+	bool FontStrokeEffect::ProcessDistanceField(Bitmap* bitmap, const float* distances)
+	{
+		Vec2I size = bitmap->GetSize();
+		UInt8* data = bitmap->GetData();
+
+		for (int i = 0; i < size.x*size.y; i++)
+			BlendUnderPixel(data + i*4, color, Math::Clamp01(distances[i] + radius + 0.5f));
+
+		return true;
+	}
+
 	Vec2I FontStrokeEffect::GetSizeExtend() const
 	{
 		return Vec2F::One()*radius;
@@ -92,6 +119,34 @@ namespace o2
 		bitmap->BlendImage(&shadow, offset);
 	}
 
+	bool FontShadowEffect::ProcessDistanceField(Bitmap* bitmap, const float* distances)
+	{
+		Vec2I size = bitmap->GetSize();
+		UInt8* data = bitmap->GetData();
+
+		float invSoftness = 1.0f/(Math::Max(blurRadius, 0.5f)*2.0f);
+
+		// Rows are stored from bottom to top, shadow offset is directed down
+		for (int y = 0; y < size.y; y++)
+		{
+			int sourceY = y + offset.y;
+			if (sourceY < 0 || sourceY >= size.y)
+				continue;
+
+			for (int x = 0; x < size.x; x++)
+			{
+				int sourceX = x - offset.x;
+				if (sourceX < 0 || sourceX >= size.x)
+					continue;
+
+				float coverage = Math::Clamp01(distances[sourceY*size.x + sourceX]*invSoftness + 0.5f);
+				BlendUnderPixel(data + (y*size.x + x)*4, color, coverage);
+			}
+		}
+
+		return true;
+	}
+
 	Vec2I FontShadowEffect::GetSizeExtend() const
 	{
 		return offset + (Vec2I)(Vec2F::One()*blurRadius);
@@ -21,6 +21,9 @@ namespace o2
 		// Process bitmap with glyph
 		void Process(Bitmap* bitmap) override;
 
+		// Process bitmap with glyph by distances. Stroke is glyph shape expanded by radius
+		bool ProcessDistanceField(Bitmap* bitmap, const float* distances) override;
+
 		// Returns bitmap extending size
 		Vec2I GetSizeExtend() const override;
 
@@ -96,6 +99,9 @@ namespace o2
 		// Process bitmap with glyph
 		void Process(Bitmap* bitmap) override;
 
+		// Process bitmap with glyph by distances. Shadow is glyph shape with edge smoothed by blur radius
+		bool ProcessDistanceField(Bitmap* bitmap, const float* distances) override;
+
 		// Returns bitmap extending size
 		Vec2I GetSizeExtend() const override;
 
@@ -123,6 +129,7 @@ CLASS_METHODS_META(o2::FontStrokeEffect)
 
 	FUNCTION().PUBLIC().CONSTRUCTOR(float, const Color4&, int);
 	FUNCTION().PUBLIC().SIGNATURE(void, Process, Bitmap*);
+	FUNCTION().PUBLIC().SIGNATURE(bool, ProcessDistanceField, Bitmap*, const float*);
 	FUNCTION().PUBLIC().SIGNATURE(Vec2I, GetSizeExtend);
 	FUNCTION().PUBLIC().SIGNATURE(bool, IsEqual, VectorFont::Effect*);
 }
@@ -189,6 +196,7 @@ CLASS_METHODS_META(o2::FontShadowEffect)
 
 	FUNCTION().PUBLIC().CONSTRUCTOR(float, const Vec2I, const Color4&);
 	FUNCTION().PUBLIC().SIGNATURE(void, Process, Bitmap*);
+	FUNCTION().PUBLIC().SIGNATURE(bool, ProcessDistanceField, Bitmap*, const float*);
 	FUNCTION().PUBLIC().SIGNATURE(Vec2I, GetSizeExtend);
 	FUNCTION().PUBLIC().SIGNATURE(bool, IsEqual, VectorFont::Effect*);
 }
@@ -503,6 +503,7 @@ namespace o2
 					lastIdx++;
 
 				o2Scene.mRootActors.RemoveAt(lastIdx);
+				o2Scene.OnActorsHierarchyChanged();
 			}
 		}
 	}
@@ -539,6 +540,9 @@ namespace o2
 
 		UpdateResEnabledInHierarchy();
 
+		if (IsOnScene() && Scene::IsSingletonInitialzed())
+			o2Scene.OnActorsHierarchyChanged();
+
 		if (mParent && mParent->IsOnScene() != IsOnScene())
 		{
 			if (mParent->IsOnScene())
@@ -638,7 +642,7 @@ namespace o2
 		return nullptr;
 	}
 
-	const Vector<Actor*>& Actor::GetChildren() const
+	const Actor::ChildrenVector& Actor::GetChildren() const
 	{
 		return mChildren;
 	}
@@ -650,6 +654,9 @@ namespace o2
 		actor->mParent = nullptr;
 		mChildren.Remove(actor);
 
+		if (IsOnScene() && Scene::IsSingletonInitialzed())
+			o2Scene.OnActorsHierarchyChanged();
+
 		actor->OnParentChanged(oldParent);
 		OnChildRemoved(actor);
 		OnChildrenChanged();
@@ -677,6 +684,9 @@ namespace o2
 
 		mChildren.Clear();
 
+		if (IsOnScene() && Scene::IsSingletonInitialzed())
+			o2Scene.OnActorsHierarchyChanged();
+
 		OnChildrenChanged();
 	}
 
@@ -699,6 +709,9 @@ namespace o2
 		component->SetOwnerActor(this);
 		mComponents.Add(component);
 
+		if (IsOnScene() && Scene::IsSingletonInitialzed())
+			o2Scene.OnActorComponentsChanged();
+
 		OnComponentAdded(component);
 		OnChanged();
 
@@ -712,6 +725,9 @@ namespace o2
 		mComponents.Remove(component);
 		component->mOwner = nullptr;
 
+		if (IsOnScene() && Scene::IsSingletonInitialzed())
+			o2Scene.OnActorComponentsChanged();
+
 		if (release)
 			delete component;
 
@@ -723,6 +739,9 @@ namespace o2
 		auto components = mComponents;
 		mComponents.Clear();
 
+		if (IsOnScene() && Scene::IsSingletonInitialzed())
+			o2Scene.OnActorComponentsChanged();
+
 		for (auto component : components)
 		{
 			OnComponentRemoving(component);
@@ -794,7 +813,7 @@ namespace o2
 #endif
 
 
-	const Vector<Component*>& Actor::GetComponents() const
+	const Actor::ComponentsVector& Actor::GetComponents() const
 	{
 		return mComponents;
 	}
@@ -9,6 +9,7 @@
 #include "o2/Utils/Editor/Attributes/EditorPropertyAttribute.h"
 #include "o2/Utils/Editor/SceneEditableObject.h"
 #include "o2/Utils/Singleton.h"
+#include "o2/Utils/Types/Containers/SmallVector.h"
 #include "o2/Utils/Types/UID.h"
 
 #if IS_SCRIPTING_SUPPORTED
@@ -45,6 +46,9 @@ namespace o2
 	public:
 		enum class State { InScene, NotInScene, WaitingAddToScene, Destroying };
 
+		typedef SmallVector<Actor*, 4> ChildrenVector;       // Children actors array type
+		typedef SmallVector<Component*, 4> ComponentsVector; // Components array type
+
 	public:
 		PROPERTIES(Actor);
 		PROPERTY(ActorAssetRef, prototype, SetPrototype, GetPrototype); // Prototype asset reference property @EDITOR_IGNORE
@@ -210,7 +214,7 @@ namespace o2
 		_type* FindChildByType(bool searchInChildren = true);
 
 		// Returns children array @SCRIPTABLE
-		const Vector<Actor*>& GetChildren() const;
+		const ChildrenVector& GetChildren() const;
 
 		// Returns all children actors with their children
 		virtual void GetAllChildrenActors(Vector<Actor*>& actors);
@@ -268,7 +272,7 @@ namespace o2
 		Vector<_type*> GetComponentsInChildren() const;
 
 		// Returns all components @SCRIPTABLE
-		const Vector<Component*>& GetComponents() const;
+		const ComponentsVector& GetComponents() const;
 
 		// Sets layer by name @SCRIPTABLE
 		void SetLayer(const String& layerName);
@@ -341,10 +345,10 @@ namespace o2
 		String      mLayerName = String("Default"); // Scene layer name @SERIALIZABLE
 		SceneLayer* mLayer = nullptr;       // Scene layer. Empty when actor isn't on scene
 
-		Actor* mParent = nullptr; // Parent actor 
-		Vector<Actor*> mChildren; // Children actors 
+		Actor*         mParent = nullptr; // Parent actor 
+		ChildrenVector mChildren;         // Children actors. Most actors have few children, they are stored inline
 
-		Vector<Component*> mComponents; // Components vector 
+		ComponentsVector mComponents; // Components vector. Stored inline for few components
 
 		bool mEnabled = true;               // Is actor enabled
 		bool mResEnabled = true;            // Is actor really enabled. 
@@ -625,6 +629,7 @@ namespace o2
 		friend class ActorRef;
 		friend class ActorRefResolver;
 		friend class ActorTransform;
+		friend class ActorTransformsStore;
 		friend class Component;
 		friend class ComponentRef;
 		friend class DrawableComponent;
@@ -705,7 +710,12 @@ namespace o2
 		for (auto comp : mComponents)
 		{
 			if (comp->GetType().IsBasedOn(TypeOf(_type)))
-				return dynamic_cast<_type*>(comp);
+			{
+				if constexpr (IsStaticDownCastable<_type, Component>::value)
+					return static_cast<_type*>(comp);
+				else
+					return dynamic_cast<_type*>(comp);
+			}
 		}
 
 		return nullptr;
@@ -839,7 +849,7 @@ CLASS_METHODS_META(o2::Actor)
 	FUNCTION().PUBLIC().SCRIPTABLE_ATTRIBUTE().SIGNATURE(Actor*, GetChild, const String&);
 	FUNCTION().PUBLIC().SCRIPTABLE_ATTRIBUTE().SIGNATURE(Actor*, FindChild, const String&);
 	FUNCTION().PUBLIC().SIGNATURE(Actor*, FindChild, const Function<bool(const Actor* child)>&);
-	FUNCTION().PUBLIC().SCRIPTABLE_ATTRIBUTE().SIGNATURE(const Vector<Actor*>&, GetChildren);
+	FUNCTION().PUBLIC().SCRIPTABLE_ATTRIBUTE().SIGNATURE(const ChildrenVector&, GetChildren);
 	FUNCTION().PUBLIC().SIGNATURE(void, GetAllChildrenActors, Vector<Actor*>&);
 	FUNCTION().PUBLIC().SCRIPTABLE_ATTRIBUTE().SIGNATURE(void, RemoveChild, Actor*, bool);
 	FUNCTION().PUBLIC().SCRIPTABLE_ATTRIBUTE().SIGNATURE(void, RemoveAllChildren, bool);
@@ -851,7 +861,7 @@ CLASS_METHODS_META(o2::Actor)
 	FUNCTION().PUBLIC().SIGNATURE(Component*, GetComponent, const Type*);
 	FUNCTION().PUBLIC().SIGNATURE(Component*, GetComponent, SceneUID);
 	FUNCTION().PUBLIC().SCRIPTABLE_ATTRIBUTE().SIGNATURE(Component*, GetComponent, const ScriptValue&);
-	FUNCTION().PUBLIC().SCRIPTABLE_ATTRIBUTE().SIGNATURE(const Vector<Component*>&, GetComponents);
+	FUNCTION().PUBLIC().SCRIPTABLE_ATTRIBUTE().SIGNATURE(const ComponentsVector&, GetComponents);
 	FUNCTION().PUBLIC().SCRIPTABLE_ATTRIBUTE().SIGNATURE(void, SetLayer, const String&);
 	FUNCTION().PUBLIC().SCRIPTABLE_ATTRIBUTE().SIGNATURE(SceneLayer*, GetLayer);
 	FUNCTION().PUBLIC().SCRIPTABLE_ATTRIBUTE().SIGNATURE(const String&, GetLayerName);
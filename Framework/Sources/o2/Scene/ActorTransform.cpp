@@ -3,6 +3,7 @@
 
 #include "o2/Application/Input.h"
 #include "o2/Scene/Actor.h"
+#include "o2/Scene/Scene.h"
 
 namespace o2
 {
@@ -748,6 +749,9 @@ namespace o2
 			mData->worldNonSizedTransform = mData->nonSizedTransform;
 			mData->worldTransform = mData->transform;
 		}
+
+		if (mData->spatialIndexItem >= 0)
+			o2Scene.OnActorTransformUpdated(mData->spatialIndexItem, mData->worldTransform.AABB());
 	}
 
 	void ActorTransform::CheckParentInvTransform()
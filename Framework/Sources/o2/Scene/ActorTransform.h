@@ -461,6 +461,8 @@ namespace o2
 		Vec2F GetParentPosition() const;
 
 		friend class Actor;
+		friend class ActorTransformsStore;
+		friend class Scene;
 		friend class WidgetLayout;
 	};
 
@@ -494,6 +496,8 @@ namespace o2
 
 		Actor* owner = nullptr; // Owner actor 
 
+		int spatialIndexItem = -1; // Item of actor in scene spatial index, -1 when actor isn't on scene
+
 		SERIALIZABLE(ActorTransformData);
 
 		// Returns is serialize enabled; used to turn off fields serialization
@@ -713,6 +717,7 @@ CLASS_FIELDS_META(o2::ActorTransformData)
 	FIELD().PUBLIC().NAME(parentTransform);
 	FIELD().PUBLIC().NAME(parentInvTransformActualFrame);
 	FIELD().PUBLIC().DEFAULT_VALUE(nullptr).NAME(owner);
+	FIELD().PUBLIC().DEFAULT_VALUE(-1).NAME(spatialIndexItem);
 }
 END_META;
 CLASS_METHODS_META(o2::ActorTransformData)
@@ -0,0 +1,359 @@
+#include "o2/stdafx.h"
+#include "ActorTransformsStore.h"
+
+#include "o2/Scene/Actor.h"
+#include "o2/Scene/ActorTransform.h"
+#include "o2/Scene/Scene.h"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#define O2_TRANSFORMS_SSE
+#include <xmmintrin.h>
+#endif
+
+namespace o2
+{
+	ActorTransformsStore::ActorTransformsStore()
+	{}
+
+	void ActorTransformsStore::Build(const Vector<Actor*>& rootActors)
+	{
+		Clear();
+
+		const Type& plainTransformType = TypeOf(ActorTransform);
+
+		auto addEntry = [&](Actor* actor, int parent)
+		{
+			mActors.Add(actor);
+			mData.Add(actor->transform->mData);
+			mParents.Add(parent);
+			mExternalChildren.Add(0);
+		};
+
+		for (auto actor : rootActors)
+		{
+			if (&actor->transform->GetType() == &plainTransformType)
+				addEntry(actor, -1);
+		}
+
+		// Each level contains children of previous level, so parents are always before children
+		int levelBegin = 0;
+		mLevels.Add(0);
+		while (levelBegin < mActors.Count())
+		{
+			int levelEnd = mActors.Count();
+			mLevels.Add(levelEnd);
+
+			for (int i = levelBegin; i < levelEnd; i++)
+			{
+				for (auto child : mActors[i]->mChildren)
+				{
+					if (&child->transform->GetType() == &plainTransformType)
+						addEntry(child, i);
+					else
+						mExternalChildren[i] = 1;
+				}
+			}
+
+			levelBegin = levelEnd;
+		}
+
+		mDirty.Resize(mActors.Count());
+		mNeedRebuild = false;
+	}
+
+	void ActorTransformsStore::Invalidate()
+	{
+		mNeedRebuild = true;
+	}
+
+	bool ActorTransformsStore::IsNeedRebuild() const
+	{
+		return mNeedRebuild;
+	}
+
+	void ActorTransformsStore::Update()
+	{
+		mLastUpdatedCount = 0;
+
+		int count = mActors.Count();
+		for (int i = 0; i < count; i++)
+		{
+			int parent = mParents[i];
+			mDirty[i] = mData[i]->updateFrame == 0 || (parent >= 0 && mDirty[parent]);
+		}
+
+		for (int level = 0; level < mLevels.Count() - 1; level++)
+		{
+			if (mNeedRebuild)
+			{
+				// Hierarchy was changed from transform update callback. Leave rest transforms dirty,
+				// they will be updated by actors
+				for (int i = mLevels[level]; i < count; i++)
+				{
+					if (mDirty[i])
+						mData[i]->updateFrame = 0;
+				}
+
+				break;
+			}
+
+			mDirtyEntries.Clear();
+			for (int i = mLevels[level]; i < mLevels[level + 1]; i++)
+			{
+				if (mDirty[i])
+					mDirtyEntries.Add(i);
+			}
+
+			if (mDirtyEntries.IsEmpty())
+				continue;
+
+			GatherBatch();
+			CalculateBatch(mBatch.Data(), mBatchCapacity, mDirtyEntries.Count());
+			ScatterBatch();
+
+			mLastUpdatedCount += mDirtyEntries.Count();
+		}
+	}
+
+	void ActorTransformsStore::Clear()
+	{
+		mActors.Clear();
+		mData.Clear();
+		mParents.Clear();
+		mExternalChildren.Clear();
+		mLevels.Clear();
+		mDirty.Clear();
+		mDirtyEntries.Clear();
+		mNeedRebuild = true;
+	}
+
+	int ActorTransformsStore::GetActorsCount() const
+	{
+		return mActors.Count();
+	}
+
+	int ActorTransformsStore::GetLastUpdatedCount() const
+	{
+		return mLastUpdatedCount;
+	}
+
+	void ActorTransformsStore::ReserveBatch(int count)
+	{
+		int capacity = (count + 3) & ~3;
+		if (capacity <= mBatchCapacity)
+			return;
+
+		mBatchCapacity = capacity;
+		mBatch.Resize(mBatchCapacity*ChannelsCount);
+	}
+
+	float* ActorTransformsStore::GetChannel(Channel channel)
+	{
+		return mBatch.Data() + channel*mBatchCapacity;
+	}
+
+	void ActorTransformsStore::GatherBatch()
+	{
+		ReserveBatch(mDirtyEntries.Count());
+
+		float* ch[ChannelsCount];
+		for (int i = 0; i < ChannelsCount; i++)
+			ch[i] = GetChannel((Channel)i);
+
+		static const Basis identity = Basis::Identity();
+
+		for (int i = 0; i < mDirtyEntries.Count(); i++)
+		{
+			int entry = mDirtyEntries[i];
+			const ActorTransformData* data = mData[entry];
+
+			ch[PositionX][i] = data->position.x; ch[PositionY][i] = data->position.y;
+			ch[ScaleX][i] = data->scale.x;       ch[ScaleY][i] = data->scale.y;
+			ch[SizeX][i] = data->size.x;         ch[SizeY][i] = data->size.y;
+			ch[PivotX][i] = data->pivot.x;       ch[PivotY][i] = data->pivot.y;
+			ch[Sin][i] = sinf(data->angle);      ch[Cos][i] = cosf(data->angle);
+			ch[Shear][i] = data->shear;
+
+			int parent = mParents[entry];
+			const Basis& parentBasis = parent >= 0 ? mData[parent]->worldNonSizedTransform : identity;
+
+			ch[ParentXX][i] = parentBasis.xv.x;     ch[ParentXY][i] = parentBasis.xv.y;
+			ch[ParentYX][i] = parentBasis.yv.x;     ch[ParentYY][i] = parentBasis.yv.y;
+			ch[ParentOX][i] = parentBasis.origin.x; ch[ParentOY][i] = parentBasis.origin.y;
+		}
+	}
+
+	void ActorTransformsStore::ScatterBatch()
+	{
+		float* ch[ChannelsCount];
+		for (int i = 0; i < ChannelsCount; i++)
+			ch[i] = GetChannel((Channel)i);
+
+		for (int i = 0; i < mDirtyEntries.Count(); i++)
+		{
+			int entry = mDirtyEntries[i];
+			ActorTransformData* data = mData[entry];
+			Actor* actor = mActors[entry];
+
+			data->nonSizedTransform.Set(data->position, Vec2F(ch[LocalXX][i], ch[LocalXY][i]), Vec2F(ch[LocalYX][i], ch[LocalYY][i]));
+			data->transform.Set(Vec2F(ch[SizedOX][i], ch[SizedOY][i]), Vec2F(ch[SizedXX][i], ch[SizedXY][i]),
+								Vec2F(ch[SizedYX][i], ch[SizedYY][i]));
+
+			Vec2F leftBottom = data->position - data->size*data->pivot;
+			Vec2F rightTop = leftBottom + data->size;
+			data->rectangle.left = leftBottom.x;
+			data->rectangle.right = rightTop.x;
+			data->rectangle.bottom = leftBottom.y;
+			data->rectangle.top = rightTop.y;
+
+			int parent = mParents[entry];
+			if (parent >= 0)
+			{
+				const ActorTransformData* parentData = mData[parent];
+				data->parentRectangle = parentData->worldRectangle;
+				data->parentRectangePosition = data->parentRectangle.LeftBottom() + parentData->size*parentData->pivot;
+				data->parentTransform = parentData->worldNonSizedTransform;
+			}
+			else
+			{
+				data->parentRectangle.left = 0; data->parentRectangle.right = 0;
+				data->parentRectangle.bottom = 0; data->parentRectangle.top = 0;
+				data->parentRectangePosition = Vec2F();
+				data->parentTransform = Basis::Identity();
+			}
+
+			data->worldRectangle.left   = data->parentRectangePosition.x + data->rectangle.left;
+			data->worldRectangle.right  = data->parentRectangePosition.x + data->rectangle.right;
+			data->worldRectangle.bottom = data->parentRectangePosition.y + data->rectangle.bottom;
+			data->worldRectangle.top    = data->parentRectangePosition.y + data->rectangle.top;
+
+			data->worldNonSizedTransform.Set(Vec2F(ch[WorldOX][i], ch[WorldOY][i]), Vec2F(ch[WorldXX][i], ch[WorldXY][i]),
+											 Vec2F(ch[WorldYX][i], ch[WorldYY][i]));
+			data->worldTransform.Set(Vec2F(ch[WorldSizedOX][i], ch[WorldSizedOY][i]), Vec2F(ch[WorldSizedXX][i], ch[WorldSizedXY][i]),
+									 Vec2F(ch[WorldSizedYX][i], ch[WorldSizedYY][i]));
+
+			if (data->spatialIndexItem >= 0)
+				o2Scene.OnActorTransformUpdated(data->spatialIndexItem, data->worldTransform.AABB());
+
+			data->updateFrame = data->dirtyFrame;
+
+			// Children with custom transforms are updated by actors, mark them dirty as actor does
+			if (mExternalChildren[entry])
+			{
+				for (auto child : actor->mChildren)
+					child->transform->SetDirty(true);
+			}
+
+			actor->OnTransformUpdated();
+		}
+	}
+
+	void ActorTransformsStore::CalculateBatch(float* batch, int capacity, int count)
+	{
+		// Calculations order is the same as in Basis::Build and Basis multiplication, so results are
+		// equal to ActorTransform::Update
+		float* ch[ChannelsCount];
+		for (int i = 0; i < ChannelsCount; i++)
+			ch[i] = batch + i*capacity;
+
+#if defined(O2_TRANSFORMS_SSE)
+		const __m128 one = _mm_set1_ps(1.0f);
+		const __m128 signMask = _mm_set1_ps(-0.0f);
+
+		// Capacity is multiple of 4, tail values of last pack are calculated and ignored
+		for (int i = 0; i < count; i += 4)
+		{
+			__m128 px = _mm_loadu_ps(ch[PositionX] + i), py = _mm_loadu_ps(ch[PositionY] + i);
+			__m128 sx = _mm_loadu_ps(ch[ScaleX] + i),    sy = _mm_loadu_ps(ch[ScaleY] + i);
+			__m128 sn = _mm_loadu_ps(ch[Sin] + i),       cs = _mm_loadu_ps(ch[Cos] + i);
+			__m128 shear = _mm_loadu_ps(ch[Shear] + i);
+			__m128 sshift = _mm_sqrt_ps(_mm_sub_ps(one, _mm_mul_ps(shear, shear)));
+
+			// Local non sized basis
+			__m128 lxx = _mm_mul_ps(sx, cs), lxy = _mm_mul_ps(sn, sx);
+			__m128 y0x = _mm_mul_ps(_mm_xor_ps(sn, signMask), sy), y0y = _mm_mul_ps(cs, sy);
+			__m128 lyx = _mm_add_ps(_mm_mul_ps(sshift, y0x), _mm_mul_ps(shear, y0y));
+			__m128 lyy = _mm_sub_ps(_mm_mul_ps(sshift, y0y), _mm_mul_ps(shear, y0x));
+
+			_mm_storeu_ps(ch[LocalXX] + i, lxx); _mm_storeu_ps(ch[LocalXY] + i, lxy);
+			_mm_storeu_ps(ch[LocalYX] + i, lyx); _mm_storeu_ps(ch[LocalYY] + i, lyy);
+
+			// Sized basis with pivot offset
+			__m128 szx = _mm_loadu_ps(ch[SizeX] + i),  szy = _mm_loadu_ps(ch[SizeY] + i);
+			__m128 pvx = _mm_loadu_ps(ch[PivotX] + i), pvy = _mm_loadu_ps(ch[PivotY] + i);
+
+			__m128 sxx = _mm_mul_ps(lxx, szx), sxy = _mm_mul_ps(lxy, szx);
+			__m128 syx = _mm_mul_ps(lyx, szy), syy = _mm_mul_ps(lyy, szy);
+			__m128 sox = _mm_sub_ps(_mm_sub_ps(px, _mm_mul_ps(sxx, pvx)), _mm_mul_ps(syx, pvy));
+			__m128 soy = _mm_sub_ps(_mm_sub_ps(py, _mm_mul_ps(sxy, pvx)), _mm_mul_ps(syy, pvy));
+
+			_mm_storeu_ps(ch[SizedXX] + i, sxx); _mm_storeu_ps(ch[SizedXY] + i, sxy);
+			_mm_storeu_ps(ch[SizedYX] + i, syx); _mm_storeu_ps(ch[SizedYY] + i, syy);
+			_mm_storeu_ps(ch[SizedOX] + i, sox); _mm_storeu_ps(ch[SizedOY] + i, soy);
+
+			// World bases: local*parent
+			__m128 pxx = _mm_loadu_ps(ch[ParentXX] + i), pxy = _mm_loadu_ps(ch[ParentXY] + i);
+			__m128 pyx = _mm_loadu_ps(ch[ParentYX] + i), pyy = _mm_loadu_ps(ch[ParentYY] + i);
+			__m128 pox = _mm_loadu_ps(ch[ParentOX] + i), poy = _mm_loadu_ps(ch[ParentOY] + i);
+
+			_mm_storeu_ps(ch[WorldXX] + i, _mm_add_ps(_mm_mul_ps(lxx, pxx), _mm_mul_ps(lxy, pyx)));
+			_mm_storeu_ps(ch[WorldXY] + i, _mm_add_ps(_mm_mul_ps(lxx, pxy), _mm_mul_ps(lxy, pyy)));
+			_mm_storeu_ps(ch[WorldYX] + i, _mm_add_ps(_mm_mul_ps(lyx, pxx), _mm_mul_ps(lyy, pyx)));
+			_mm_storeu_ps(ch[WorldYY] + i, _mm_add_ps(_mm_mul_ps(lyx, pxy), _mm_mul_ps(lyy, pyy)));
+			_mm_storeu_ps(ch[WorldOX] + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(px, pxx), _mm_mul_ps(py, pyx)), pox));
+			_mm_storeu_ps(ch[WorldOY] + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(px, pxy), _mm_mul_ps(py, pyy)), poy));
+
+			_mm_storeu_ps(ch[WorldSizedXX] + i, _mm_add_ps(_mm_mul_ps(sxx, pxx), _mm_mul_ps(sxy, pyx)));
+			_mm_storeu_ps(ch[WorldSizedXY] + i, _mm_add_ps(_mm_mul_ps(sxx, pxy), _mm_mul_ps(sxy, pyy)));
+			_mm_storeu_ps(ch[WorldSizedYX] + i, _mm_add_ps(_mm_mul_ps(syx, pxx), _mm_mul_ps(syy, pyx)));
+			_mm_storeu_ps(ch[WorldSizedYY] + i, _mm_add_ps(_mm_mul_ps(syx, pxy), _mm_mul_ps(syy, pyy)));
+			_mm_storeu_ps(ch[WorldSizedOX] + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(sox, pxx), _mm_mul_ps(soy, pyx)), pox));
+			_mm_storeu_ps(ch[WorldSizedOY] + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(sox, pxy), _mm_mul_ps(soy, pyy)), poy));
+		}
+#else
+		for (int i = 0; i < count; i++)
+		{
+			float px = ch[PositionX][i], py = ch[PositionY][i];
+			float sx = ch[ScaleX][i], sy = ch[ScaleY][i];
+			float sn = ch[Sin][i], cs = ch[Cos][i];
+			float shear = ch[Shear][i];
+			float sshift = Math::Sqrt(1.0f - shear*shear);
+
+			// Local non sized basis
+			float lxx = sx*cs, lxy = sn*sx;
+			float y0x = -sn*sy, y0y = cs*sy;
+			float lyx = sshift*y0x + shear*y0y;
+			float lyy = sshift*y0y - shear*y0x;
+
+			ch[LocalXX][i] = lxx; ch[LocalXY][i] = lxy;
+			ch[LocalYX][i] = lyx; ch[LocalYY][i] = lyy;
+
+			// Sized basis with pivot offset
+			float szx = ch[SizeX][i], szy = ch[SizeY][i];
+			float pvx = ch[PivotX][i], pvy = ch[PivotY][i];
+
+			float sxx = lxx*szx, sxy = lxy*szx;
+			float syx = lyx*szy, syy = lyy*szy;
+			float sox = px - sxx*pvx - syx*pvy;
+			float soy = py - sxy*pvx - syy*pvy;
+
+			ch[SizedXX][i] = sxx; ch[SizedXY][i] = sxy;
+			ch[SizedYX][i] = syx; ch[SizedYY][i] = syy;
+			ch[SizedOX][i] = sox; ch[SizedOY][i] = soy;
+
+			// World bases: local*parent
+			float pxx = ch[ParentXX][i], pxy = ch[ParentXY][i];
+			float pyx = ch[ParentYX][i], pyy = ch[ParentYY][i];
+			float pox = ch[ParentOX][i], poy = ch[ParentOY][i];
+
+			ch[WorldXX][i] = lxx*pxx + lxy*pyx; ch[WorldXY][i] = lxx*pxy + lxy*pyy;
+			ch[WorldYX][i] = lyx*pxx + lyy*pyx; ch[WorldYY][i] = lyx*pxy + lyy*pyy;
+			ch[WorldOX][i] = px*pxx + py*pyx + pox; ch[WorldOY][i] = px*pxy + py*pyy + poy;
+
+			ch[WorldSizedXX][i] = sxx*pxx + sxy*pyx; ch[WorldSizedXY][i] = sxx*pxy + sxy*pyy;
+			ch[WorldSizedYX][i] = syx*pxx + syy*pyx; ch[WorldSizedYY][i] = syx*pxy + syy*pyy;
+			ch[WorldSizedOX][i] = sox*pxx + soy*pyx + pox; ch[WorldSizedOY][i] = sox*pxy + soy*pyy + poy;
+		}
+#endif
+	}
+}
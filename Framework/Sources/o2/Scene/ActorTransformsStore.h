@@ -0,0 +1,93 @@
+#pragma once
+
+#include "o2/Utils/Types/CommonTypes.h"
+#include "o2/Utils/Types/Containers/Vector.h"
+
+namespace o2
+{
+	class Actor;
+	class ActorTransformData;
+
+	// -------------------------------------------------------------------------------------------------
+	// Structure of arrays actors transforms storage. Keeps actors hierarchy flattened by depth levels,
+	// parents are always before children. Updates dirty transforms in one flat pass level by level: gathers
+	// transforms parameters into contiguous arrays and calculates bases by packs of four with SIMD.
+	// Actors with custom transforms (widgets layouts) and their children aren't stored, they are updated
+	// by actors as usual
+	// -------------------------------------------------------------------------------------------------
+	class ActorTransformsStore
+	{
+	public:
+		// Default constructor
+		ActorTransformsStore();
+
+		// Rebuilds storage from actors hierarchies
+		void Build(const Vector<Actor*>& rootActors);
+
+		// Marks storage as outdated, it must be rebuilt before next update
+		void Invalidate();
+
+		// Returns true when storage must be rebuilt
+		bool IsNeedRebuild() const;
+
+		// Updates dirty transforms and their children transforms
+		void Update();
+
+		// Removes all actors
+		void Clear();
+
+		// Returns stored actors count
+		int GetActorsCount() const;
+
+		// Returns count of transforms updated on last update
+		int GetLastUpdatedCount() const;
+
+	protected:
+		// ---------------------------------------------------------------------
+		// Batch channels. Each channel is contiguous array of values for entries
+		// ---------------------------------------------------------------------
+		enum Channel
+		{
+			PositionX, PositionY, ScaleX, ScaleY, Sin, Cos, Shear, SizeX, SizeY, PivotX, PivotY,
+			ParentXX, ParentXY, ParentYX, ParentYY, ParentOX, ParentOY,
+			LocalXX, LocalXY, LocalYX, LocalYY,
+			SizedXX, SizedXY, SizedYX, SizedYY, SizedOX, SizedOY,
+			WorldXX, WorldXY, WorldYX, WorldYY, WorldOX, WorldOY,
+			WorldSizedXX, WorldSizedXY, WorldSizedYX, WorldSizedYY, WorldSizedOX, WorldSizedOY,
+
+			ChannelsCount
+		};
+
+	protected:
+		Vector<Actor*>              mActors;           // Stored actors in levels order
+		Vector<ActorTransformData*> mData;             // Actors transforms data
+		Vector<int>                 mParents;          // Parent entry index, -1 for roots
+		Vector<UInt8>               mExternalChildren; // Is actor has children which aren't stored
+		Vector<int>                 mLevels;           // First entry of each hierarchy level. Last value is entries count
+
+		Vector<UInt8> mDirty;        // Dirty flags of entries on current update
+		Vector<int>   mDirtyEntries; // Dirty entries of updating level
+
+		Vector<float> mBatch;             // Batch channels values. Channel starts at channel index * batch capacity
+		int           mBatchCapacity = 0; // Capacity of one batch channel, multiple of 4
+
+		bool mNeedRebuild = true;   // Is storage outdated
+		int  mLastUpdatedCount = 0; // Count of transforms updated on last update
+
+	protected:
+		// Reserves batch channels for count of entries
+		void ReserveBatch(int count);
+
+		// Returns pointer to batch channel values
+		float* GetChannel(Channel channel);
+
+		// Copies dirty entries parameters and parents world bases into batch
+		void GatherBatch();
+
+		// Writes calculated batch bases into transforms data and notifies actors
+		void ScatterBatch();
+
+		// Calculates local, sized and world bases for batch entries
+		static void CalculateBatch(float* batch, int capacity, int count);
+	};
+}
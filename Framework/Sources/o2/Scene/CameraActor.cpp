@@ -12,7 +12,8 @@ namespace o2
 	{}
 
 	CameraActor::CameraActor(const CameraActor& other):
-		Actor(other), mType(other.mType), mFixedOrFittedSize(other.mFixedOrFittedSize), mUnits(other.mUnits)
+		Actor(other), cullDrawables(other.cullDrawables), mType(other.mType), mFixedOrFittedSize(other.mFixedOrFittedSize),
+		mUnits(other.mUnits)
 	{}
 
 	CameraActor::~CameraActor()
@@ -27,6 +28,7 @@ namespace o2
 		mType = other.mType;
 		mFixedOrFittedSize = other.mFixedOrFittedSize;
 		mUnits = other.mUnits;
+		cullDrawables = other.cullDrawables;
 
 		return *this;
 	}
@@ -48,10 +50,28 @@ namespace o2
 
 		listenersLayer.camera = o2Render.GetCamera();
 
+		mDrawnDrawablesCount = 0;
+		mCulledDrawablesCount = 0;
+
+		RectF cameraRect = o2Render.GetCamera().GetAxisAlignedRect();
+		RectF drawableBounds;
+
 		for (auto layer : drawLayers.GetLayers())
 		{
+			layer->UpdateDrawablesOrder();
+
 			for (auto comp : layer->mEnabledDrawables)
+			{
+				if (cullDrawables && comp->GetDrawableWorldBounds(drawableBounds) &&
+					!drawableBounds.IsIntersects(cameraRect))
+				{
+					mCulledDrawablesCount++;
+					continue;
+				}
+
 				comp->Draw();
+				mDrawnDrawablesCount++;
+			}
 		}
 
 		o2Render.SetCamera(prevCamera);
@@ -119,6 +139,16 @@ namespace o2
 		return mUnits;
 	}
 
+	int CameraActor::GetDrawnDrawablesCount() const
+	{
+		return mDrawnDrawablesCount;
+	}
+
+	int CameraActor::GetCulledDrawablesCount() const
+	{
+		return mCulledDrawablesCount;
+	}
+
 	void CameraActor::OnAddToScene()
 	{
 		o2Scene.OnCameraAddedOnScene(this);
@@ -19,6 +19,8 @@ namespace o2
 		bool   fillBackground = true;       // Is background filling with solid color @SERIALIZABLE
 		Color4 fillColor = Color4::White(); // Background fill color @SERIALIZABLE
 
+		bool cullDrawables = true; // Is drawables outside of camera rectangle skipped @SERIALIZABLE
+
 		CursorAreaEventListenersLayer listenersLayer;
 
 	public:
@@ -64,6 +66,12 @@ namespace o2
 		// Returns current camera units
 		Units GetUnits() const;
 
+		// Returns count of drawables drawn at last frame
+		int GetDrawnDrawablesCount() const;
+
+		// Returns count of drawables culled at last frame
+		int GetCulledDrawablesCount() const;
+
 		SERIALIZABLE(CameraActor);
 
 	protected:
@@ -71,6 +79,9 @@ namespace o2
 		Vec2F mFixedOrFittedSize;          // Fitted or fixed types size @SERIALIZABLE
 		Units mUnits = Units::Centimeters; // Physical camera units @SERIALIZABLE
 
+		int mDrawnDrawablesCount = 0;  // Count of drawables drawn at last frame
+		int mCulledDrawablesCount = 0; // Count of drawables culled at last frame
+
 	protected:
 		// Called when actor has added to scene
 		void OnAddToScene() override;
@@ -92,10 +103,13 @@ CLASS_FIELDS_META(o2::CameraActor)
 	FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().NAME(drawLayers);
 	FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(true).NAME(fillBackground);
 	FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(Color4::White()).NAME(fillColor);
+	FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(true).NAME(cullDrawables);
 	FIELD().PUBLIC().NAME(listenersLayer);
 	FIELD().PROTECTED().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(Type::Default).NAME(mType);
 	FIELD().PROTECTED().SERIALIZABLE_ATTRIBUTE().NAME(mFixedOrFittedSize);
 	FIELD().PROTECTED().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(Units::Centimeters).NAME(mUnits);
+	FIELD().PROTECTED().DEFAULT_VALUE(0).NAME(mDrawnDrawablesCount);
+	FIELD().PROTECTED().DEFAULT_VALUE(0).NAME(mCulledDrawablesCount);
 }
 END_META;
 CLASS_METHODS_META(o2::CameraActor)
@@ -113,6 +127,8 @@ CLASS_METHODS_META(o2::CameraActor)
 	FUNCTION().PUBLIC().SIGNATURE(Type, GetCameraType);
 	FUNCTION().PUBLIC().SIGNATURE(const Vec2F&, GetFittedOrFixedSize);
 	FUNCTION().PUBLIC().SIGNATURE(Units, GetUnits);
+	FUNCTION().PUBLIC().SIGNATURE(int, GetDrawnDrawablesCount);
+	FUNCTION().PUBLIC().SIGNATURE(int, GetCulledDrawablesCount);
 	FUNCTION().PROTECTED().SIGNATURE(void, OnAddToScene);
 	FUNCTION().PROTECTED().SIGNATURE(void, OnRemoveFromScene);
 }
@@ -202,6 +202,11 @@ namespace o2
 	void Component::FixedUpdate(float dt)
 	{}
 
+	bool Component::IsUpdateThreadSafe() const
+	{
+		return false;
+	}
+
 // 	void ComponentDataValueConverter::ToData(void* object, DataValue& data)
 // 	{
 // 		Component* value = *(Component**)object;
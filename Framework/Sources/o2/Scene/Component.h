@@ -42,6 +42,10 @@ namespace o2
 		// Updates component with fixed delta time
 		virtual void FixedUpdate(float dt);
 
+		// Returns true when component update is thread safe: it changes only owner actor and it's children
+		// and doesn't use shared systems. Root actors subtrees with thread safe components are updated in parallel
+		virtual bool IsUpdateThreadSafe() const;
+
 		// Sets component enable
 		virtual void SetEnabled(bool active);
 
@@ -248,6 +252,7 @@ CLASS_METHODS_META(o2::Component)
 	FUNCTION().PUBLIC().SIGNATURE(SceneUID, GetID);
 	FUNCTION().PUBLIC().SIGNATURE(void, Update, float);
 	FUNCTION().PUBLIC().SIGNATURE(void, FixedUpdate, float);
+	FUNCTION().PUBLIC().SIGNATURE(bool, IsUpdateThreadSafe);
 	FUNCTION().PUBLIC().SIGNATURE(void, SetEnabled, bool);
 	FUNCTION().PUBLIC().SIGNATURE(void, Enable);
 	FUNCTION().PUBLIC().SIGNATURE(void, Disable);
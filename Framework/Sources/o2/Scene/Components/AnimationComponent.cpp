@@ -2,6 +2,7 @@
 #include "AnimationComponent.h"
 
 #include "o2/Animation/Tracks/AnimationTrack.h"
+#include "o2/Scene/Scene.h"
 
 namespace o2
 {
@@ -31,15 +32,24 @@ namespace o2
 
 	void AnimationComponent::Update(float dt)
 	{
-		if (mInEditMode)
+		if (mInEditMode || mUpdatingByScene)
 			return;
 
+		UpdateStates(dt);
+		UpdateMixers(dt);
+	}
+
+	void AnimationComponent::UpdateStates(float dt)
+	{
 		for (auto state : mStates)
 		{
 			if (state->mAnimation)
 				state->player.Update(dt);
 		}
+	}
 
+	void AnimationComponent::UpdateMixers(float dt)
+	{
 		for (auto val : mValues)
 			val->Update();
 
@@ -47,6 +57,18 @@ namespace o2
 			mBlend.Update(dt);
 	}
 
+	void AnimationComponent::OnAddToScene()
+	{
+		Component::OnAddToScene();
+		o2Scene.OnAnimationComponentAdded(this);
+	}
+
+	void AnimationComponent::OnRemoveFromScene()
+	{
+		Component::OnRemoveFromScene();
+		o2Scene.OnAnimationComponentRemoved(this);
+	}
+
 	AnimationState* AnimationComponent::AddState(AnimationState* state)
 	{
 		state->player.SetTarget(mOwner);
@@ -54,7 +76,7 @@ namespace o2
 		state->mOwner = this;
 
 		for (auto trackPlayer : state->player.mTrackPlayers)
-			trackPlayer->RegMixer(state, trackPlayer->GetTrack()->path);
+			trackPlayer->RegMixer(state, trackPlayer->GetTrackPath());
 
 		mStates.Add(state);
 
@@ -80,7 +102,7 @@ namespace o2
 	void AnimationComponent::RemoveState(AnimationState* state)
 	{
 		for (auto trackPlayer : state->player.mTrackPlayers)
-			UnregTrack(trackPlayer, trackPlayer->GetTrack()->path);
+			UnregTrack(trackPlayer, trackPlayer->GetTrackPath());
 
 		mStates.Remove(state);
 		delete state;
@@ -260,12 +282,12 @@ namespace o2
 
 	void AnimationComponent::OnStateAnimationTrackAdded(AnimationState* state, IAnimationTrack::IPlayer* player)
 	{
-		player->RegMixer(state, player->GetTrack()->path);
+		player->RegMixer(state, player->GetTrackPath());
 	}
 
 	void AnimationComponent::OnStateAnimationTrackRemoved(AnimationState* state, IAnimationTrack::IPlayer* player)
 	{
-		UnregTrack(player, player->GetTrack()->path);
+		UnregTrack(player, player->GetTrackPath());
 	}
 
 	void AnimationComponent::OnStatesListChanged()
@@ -171,9 +171,22 @@ namespace o2
 
 		BlendState mBlend;  // Current blend parameters
 
-		bool mInEditMode = false; // True when some state animation is editing now, disables update
+		bool mInEditMode = false;       // True when some state animation is editing now, disables update
+		bool mUpdatingByScene = false; // True when animation is updated by scene batched animations pass, disables update
 
 	protected:
+		// Updates states players. Tracks players are evaluated or collected by recording tracks batch
+		void UpdateStates(float dt);
+
+		// Updates mixers values and blending
+		void UpdateMixers(float dt);
+
+		// Called when component added to scene, registers in scene animations list
+		void OnAddToScene() override;
+
+		// Called when component removed from scene, unregisters from scene animations list
+		void OnRemoveFromScene() override;
+
 		// Registers value by path and state
 		template<typename _type>
 		void RegTrack(typename AnimationTrack< _type >::Player* player, const String& path, AnimationState* state);
@@ -193,6 +206,7 @@ namespace o2
 		friend class AnimationClip;
 		friend class AnimationState;
 		friend class IAnimationTrack;
+		friend class Scene;
 
 		template<typename _type>
 		friend class AnimationTrack;
@@ -306,6 +320,7 @@ CLASS_FIELDS_META(o2::AnimationComponent)
 	FIELD().PROTECTED().NAME(mValues);
 	FIELD().PROTECTED().NAME(mBlend);
 	FIELD().PROTECTED().DEFAULT_VALUE(false).NAME(mInEditMode);
+	FIELD().PROTECTED().DEFAULT_VALUE(false).NAME(mUpdatingByScene);
 }
 END_META;
 CLASS_METHODS_META(o2::AnimationComponent)
@@ -336,6 +351,10 @@ CLASS_METHODS_META(o2::AnimationComponent)
 	FUNCTION().PUBLIC().SIGNATURE_STATIC(String, GetName);
 	FUNCTION().PUBLIC().SIGNATURE_STATIC(String, GetCategory);
 	FUNCTION().PUBLIC().SIGNATURE_STATIC(String, GetIcon);
+	FUNCTION().PROTECTED().SIGNATURE(void, UpdateStates, float);
+	FUNCTION().PROTECTED().SIGNATURE(void, UpdateMixers, float);
+	FUNCTION().PROTECTED().SIGNATURE(void, OnAddToScene);
+	FUNCTION().PROTECTED().SIGNATURE(void, OnRemoveFromScene);
 	FUNCTION().PROTECTED().SIGNATURE(void, UnregTrack, IAnimationTrack::IPlayer*, const String&);
 	FUNCTION().PROTECTED().SIGNATURE(void, OnStateAnimationTrackAdded, AnimationState*, IAnimationTrack::IPlayer*);
 	FUNCTION().PROTECTED().SIGNATURE(void, OnStateAnimationTrackRemoved, AnimationState*, IAnimationTrack::IPlayer*);
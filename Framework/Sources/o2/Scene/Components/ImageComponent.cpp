@@ -77,6 +77,11 @@ namespace o2
 		ISceneDrawable::Draw();
 	}
 
+	bool ImageComponent::IsUpdateThreadSafe() const
+	{
+		return true;
+	}
+
 	void ImageComponent::FitActorByImage() const
 	{
 		if (mImageAsset)
@@ -113,6 +118,12 @@ namespace o2
 		DrawableComponent::SetOwnerActor(actor);
 	}
 
+	bool ImageComponent::GetSceneDrawableBoundsBasis(Basis& basis) const
+	{
+		basis = Sprite::GetBasis();
+		return true;
+	}
+
 	void ImageComponent::OnDeserialized(const DataValue& node)
 	{
 		DrawableComponent::OnDeserialized(node);
@@ -53,6 +53,9 @@ namespace o2
 		// Draws sprite 
 		void Draw() override;
 
+		// Returns true, update is thread safe: it changes only own sprite
+		bool IsUpdateThreadSafe() const override;
+
 		// Sets actor's size as image size
 		void FitActorByImage() const;
 
@@ -79,6 +82,9 @@ namespace o2
 		// Sets owner actor
 		void SetOwnerActor(Actor* actor) override;
 
+		// Returns sprite world basis, used for camera culling
+		bool GetSceneDrawableBoundsBasis(Basis& basis) const override;
+
 		// Calling when deserializing
 		void OnDeserialized(const DataValue& node) override;
 
@@ -116,6 +122,7 @@ CLASS_METHODS_META(o2::ImageComponent)
 	FUNCTION().PUBLIC().CONSTRUCTOR(const Sprite&);
 	FUNCTION().PUBLIC().CONSTRUCTOR(const ImageComponent&);
 	FUNCTION().PUBLIC().SIGNATURE(void, Draw);
+	FUNCTION().PUBLIC().SIGNATURE(bool, IsUpdateThreadSafe);
 	FUNCTION().PUBLIC().SIGNATURE(void, FitActorByImage);
 	FUNCTION().PUBLIC().SIGNATURE(bool, IsUnderPoint, const Vec2F&);
 	FUNCTION().PUBLIC().SIGNATURE_STATIC(String, GetName);
@@ -123,6 +130,7 @@ CLASS_METHODS_META(o2::ImageComponent)
 	FUNCTION().PUBLIC().SIGNATURE_STATIC(String, GetIcon);
 	FUNCTION().PROTECTED().SIGNATURE(void, OnTransformUpdated);
 	FUNCTION().PROTECTED().SIGNATURE(void, SetOwnerActor, Actor*);
+	FUNCTION().PROTECTED().SIGNATURE(bool, GetSceneDrawableBoundsBasis, Basis&);
 	FUNCTION().PROTECTED().SIGNATURE(void, OnDeserialized, const DataValue&);
 	FUNCTION().PROTECTED().SIGNATURE(void, OnSerialize, DataValue&);
 	FUNCTION().PROTECTED().SIGNATURE(void, OnSerializeDelta, DataValue&, const IObject&);
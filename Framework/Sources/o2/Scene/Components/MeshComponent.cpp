@@ -46,6 +46,11 @@ namespace o2
 			o2Render.DrawMeshWire(&mMesh, Color4(0, 0, 0, 100));
 	}
 
+	bool MeshComponent::IsUpdateThreadSafe() const
+	{
+		return true;
+	}
+
 	bool MeshComponent::IsUnderPoint(const Vec2F& point)
 	{
 		return false;
@@ -147,6 +152,15 @@ namespace o2
 		}
 	}
 
+	bool MeshComponent::GetSceneDrawableBoundsBasis(Basis& basis) const
+	{
+		if (mNeedUpdateMesh)
+			return false;
+
+		basis = Basis(mMesh.GetVerticesRect());
+		return true;
+	}
+
 	void MeshComponent::UpdateMesh()
 	{
 		mNeedUpdateMesh = false;
@@ -38,6 +38,9 @@ namespace o2
 		// Draws sprite 
 		void Draw() override;
 
+		// Returns true, update is thread safe: it changes only own mesh
+		bool IsUpdateThreadSafe() const override;
+
 		// Returns true if point is under drawable
 		bool IsUnderPoint(const Vec2F& point) override;
 
@@ -111,6 +114,9 @@ namespace o2
 		// Sets owner actor
 		void SetOwnerActor(Actor* actor) override;
 
+		// Returns mesh vertices bounds basis, used for camera culling. Returns false when mesh must be rebuilt
+		bool GetSceneDrawableBoundsBasis(Basis& basis) const override;
+
 		// Calling when deserializing
 		void OnDeserialized(const DataValue& node) override;
 
@@ -146,6 +152,7 @@ CLASS_METHODS_META(o2::MeshComponent)
 	FUNCTION().PUBLIC().CONSTRUCTOR();
 	FUNCTION().PUBLIC().CONSTRUCTOR(const MeshComponent&);
 	FUNCTION().PUBLIC().SIGNATURE(void, Draw);
+	FUNCTION().PUBLIC().SIGNATURE(bool, IsUpdateThreadSafe);
 	FUNCTION().PUBLIC().SIGNATURE(bool, IsUnderPoint, const Vec2F&);
 	FUNCTION().PUBLIC().SIGNATURE(const Mesh&, GetMesh);
 	FUNCTION().PUBLIC().SIGNATURE(void, SetExtraPoints, const Vector<Vec2F>&);
@@ -165,6 +172,7 @@ CLASS_METHODS_META(o2::MeshComponent)
 	FUNCTION().PROTECTED().SIGNATURE(void, OnTransformUpdated);
 	FUNCTION().PROTECTED().SIGNATURE(void, UpdateMesh);
 	FUNCTION().PROTECTED().SIGNATURE(void, SetOwnerActor, Actor*);
+	FUNCTION().PROTECTED().SIGNATURE(bool, GetSceneDrawableBoundsBasis, Basis&);
 	FUNCTION().PROTECTED().SIGNATURE(void, OnDeserialized, const DataValue&);
 	FUNCTION().PROTECTED().SIGNATURE(void, OnDeserializedDelta, const DataValue&, const IObject&);
 }
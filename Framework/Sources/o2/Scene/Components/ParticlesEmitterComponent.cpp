@@ -2,6 +2,7 @@
 #include "ParticlesEmitterComponent.h"
 
 #include "o2/Scene/Actor.h"
+#include "o2/Scene/Scene.h"
 
 namespace o2
 {
@@ -30,9 +31,17 @@ namespace o2
 
 	void ParticlesEmitterComponent::Update(float dt)
 	{
+		if (mUpdatingByScene)
+			return;
+
 		ParticlesEmitter::Update(dt);
 	}
 
+	bool ParticlesEmitterComponent::IsUpdateThreadSafe() const
+	{
+		return true;
+	}
+
 	String ParticlesEmitterComponent::GetName()
 	{
 		return "Particles emitter";
@@ -53,6 +62,24 @@ namespace o2
 		basis = mOwner->transform->GetWorldBasis();
 	}
 
+	void ParticlesEmitterComponent::OnAddToScene()
+	{
+		DrawableComponent::OnAddToScene();
+		o2Scene.OnParticlesEmitterAdded(this);
+	}
+
+	void ParticlesEmitterComponent::OnRemoveFromScene()
+	{
+		DrawableComponent::OnRemoveFromScene();
+		o2Scene.OnParticlesEmitterRemoved(this);
+	}
+
+	bool ParticlesEmitterComponent::GetSceneDrawableBoundsBasis(Basis& basis) const
+	{
+		basis = Basis(mParticlesMesh->GetVerticesRect());
+		return true;
+	}
+
 	void ParticlesEmitterComponent::OnSerialize(DataValue& node) const
 	{
 		DrawableComponent::OnSerialize(node);
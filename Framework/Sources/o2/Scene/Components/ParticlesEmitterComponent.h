@@ -23,6 +23,9 @@ namespace o2
 		// Updates component
 		void Update(float dt) override;
 
+		// Returns true, particles emitter uses only own state and own random generator
+		bool IsUpdateThreadSafe() const override;
+
 		// Returns name of component
 		static String GetName();
 
@@ -32,10 +35,22 @@ namespace o2
 		// Returns name of component icon
 		static String GetIcon();
 
+	protected:
+		bool mUpdatingByScene = false; // True when emitter is updated by scene parallel particles pass, disables update
+
 	protected:
 		// Called when actor's transform was changed
 		void OnTransformUpdated();
 
+		// Called when actor was included to scene, registers emitter in scene
+		void OnAddToScene() override;
+
+		// Called when actor was excluded from scene, unregisters emitter from scene
+		void OnRemoveFromScene() override;
+
+		// Returns particles mesh bounds basis, used for camera culling
+		bool GetSceneDrawableBoundsBasis(Basis& basis) const override;
+
 		// Beginning serialization callback
 		void OnSerialize(DataValue& node) const override;
 
@@ -47,6 +62,8 @@ namespace o2
 
 		// Completion deserialization delta callback
 		void OnDeserializedDelta(const DataValue& node, const IObject& origin) override;
+
+		friend class Scene;
 	};
 }
 
@@ -58,6 +75,7 @@ CLASS_BASES_META(o2::ParticlesEmitterComponent)
 END_META;
 CLASS_FIELDS_META(o2::ParticlesEmitterComponent)
 {
+	FIELD().PROTECTED().DEFAULT_VALUE(false).NAME(mUpdatingByScene);
 }
 END_META;
 CLASS_METHODS_META(o2::ParticlesEmitterComponent)
@@ -67,10 +85,14 @@ CLASS_METHODS_META(o2::ParticlesEmitterComponent)
 	FUNCTION().PUBLIC().CONSTRUCTOR(const ParticlesEmitterComponent&);
 	FUNCTION().PUBLIC().SIGNATURE(void, Draw);
 	FUNCTION().PUBLIC().SIGNATURE(void, Update, float);
+	FUNCTION().PUBLIC().SIGNATURE(bool, IsUpdateThreadSafe);
 	FUNCTION().PUBLIC().SIGNATURE_STATIC(String, GetName);
 	FUNCTION().PUBLIC().SIGNATURE_STATIC(String, GetCategory);
 	FUNCTION().PUBLIC().SIGNATURE_STATIC(String, GetIcon);
 	FUNCTION().PROTECTED().SIGNATURE(void, OnTransformUpdated);
+	FUNCTION().PROTECTED().SIGNATURE(void, OnAddToScene);
+	FUNCTION().PROTECTED().SIGNATURE(void, OnRemoveFromScene);
+	FUNCTION().PROTECTED().SIGNATURE(bool, GetSceneDrawableBoundsBasis, Basis&);
 	FUNCTION().PROTECTED().SIGNATURE(void, OnSerialize, DataValue&);
 	FUNCTION().PROTECTED().SIGNATURE(void, OnDeserialized, const DataValue&);
 	FUNCTION().PROTECTED().SIGNATURE(void, OnSerializeDelta, DataValue&, const IObject&);
@@ -36,6 +36,11 @@ namespace o2
 	{
 	}
 
+	bool SkinningMeshBoneComponent::IsUpdateThreadSafe() const
+	{
+		return true;
+	}
+
 	String SkinningMeshBoneComponent::GetName()
 	{
 		return "Skinning mesh bone";
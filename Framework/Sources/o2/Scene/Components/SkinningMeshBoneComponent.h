@@ -36,6 +36,9 @@ namespace o2
 		// Updates component
 		void Update(float dt) override;
 
+		// Returns true, update is thread safe: it doesn't update anything
+		bool IsUpdateThreadSafe() const override;
+
 		// Searches skinning mesh in parent hierarchy
 		SkinningMeshComponent* FindSkinningMesh() const;
 
@@ -78,6 +81,7 @@ CLASS_METHODS_META(o2::SkinningMeshBoneComponent)
 	FUNCTION().PUBLIC().CONSTRUCTOR(const SkinningMeshBoneComponent&);
 	FUNCTION().PUBLIC().SIGNATURE(void, Draw);
 	FUNCTION().PUBLIC().SIGNATURE(void, Update, float);
+	FUNCTION().PUBLIC().SIGNATURE(bool, IsUpdateThreadSafe);
 	FUNCTION().PUBLIC().SIGNATURE(SkinningMeshComponent*, FindSkinningMesh);
 	FUNCTION().PUBLIC().SIGNATURE_STATIC(String, GetName);
 	FUNCTION().PUBLIC().SIGNATURE_STATIC(String, GetCategory);
@@ -328,6 +328,11 @@ namespace o2
 		DrawableComponent::SetOwnerActor(actor);
 	}
 
+	bool SkinningMeshComponent::GetSceneDrawableBoundsBasis(Basis& basis) const
+	{
+		return false;
+	}
+
 	void SkinningMeshComponent::OnDeserialized(const DataValue& node)
 	{
 		DrawableComponent::OnDeserialized(node);
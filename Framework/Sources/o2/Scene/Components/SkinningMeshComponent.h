@@ -134,6 +134,9 @@ namespace o2
 		// Sets owner actor
 		void SetOwnerActor(Actor* actor) override;
 
+		// Returns false, mesh vertices are moved by bones while drawing and can't be culled by owner transform
+		bool GetSceneDrawableBoundsBasis(Basis& basis) const override;
+
 		// Calling when deserializing
 		void OnDeserialized(const DataValue& node) override;
 
@@ -201,6 +204,7 @@ CLASS_METHODS_META(o2::SkinningMeshComponent)
 	FUNCTION().PROTECTED().SIGNATURE(void, UpdateMesh);
 	FUNCTION().PROTECTED().SIGNATURE(void, UpdateBones);
 	FUNCTION().PROTECTED().SIGNATURE(void, SetOwnerActor, Actor*);
+	FUNCTION().PROTECTED().SIGNATURE(bool, GetSceneDrawableBoundsBasis, Basis&);
 	FUNCTION().PROTECTED().SIGNATURE(void, OnDeserialized, const DataValue&);
 	FUNCTION().PROTECTED().SIGNATURE(void, OnDeserializedDelta, const DataValue&, const IObject&);
 	FUNCTION().PROTECTED().SIGNATURE(void, DrawMeshWire);
@@ -125,6 +125,15 @@ namespace o2
 		return 0;
 	}
 
+	bool DrawableComponent::GetSceneDrawableBoundsBasis(Basis& basis) const
+	{
+		if (!mOwner)
+			return false;
+
+		basis = mOwner->transform->GetWorldBasis();
+		return true;
+	}
+
 	void DrawableComponent::OnAddToScene()
 	{
 		Component::OnAddToScene();
@@ -62,6 +62,9 @@ namespace o2
 		// Returns the index in the parent's list of children, used to sort the rendering
 		int GetIndexInParentDrawable() const override;
 
+		// Returns owner actor world transform basis, used for camera culling
+		bool GetSceneDrawableBoundsBasis(Basis& basis) const override;
+
 		// Called when actor was included to scene
 		void OnAddToScene() override;
 
@@ -105,6 +108,7 @@ CLASS_METHODS_META(o2::DrawableComponent)
 	FUNCTION().PROTECTED().SIGNATURE(bool, IsSceneDrawableEnabled);
 	FUNCTION().PROTECTED().SIGNATURE(ISceneDrawable*, GetParentDrawable);
 	FUNCTION().PROTECTED().SIGNATURE(int, GetIndexInParentDrawable);
+	FUNCTION().PROTECTED().SIGNATURE(bool, GetSceneDrawableBoundsBasis, Basis&);
 	FUNCTION().PROTECTED().SIGNATURE(void, OnAddToScene);
 	FUNCTION().PROTECTED().SIGNATURE(void, OnRemoveFromScene);
 	FUNCTION().PUBLIC().SIGNATURE(SceneEditableObject*, GetEditableOwner);
@@ -159,6 +159,25 @@ namespace o2
 			layer->SetLastByDepth(this);
 	}
 
+	bool ISceneDrawable::GetDrawableWorldBounds(RectF& bounds)
+	{
+		if (!mChildrenInheritedDepth.IsEmpty())
+			return false;
+
+		Basis basis;
+		if (!GetSceneDrawableBoundsBasis(basis))
+			return false;
+
+		if (basis != mCachedBoundsBasis)
+		{
+			mCachedBoundsBasis = basis;
+			mCachedWorldBounds = basis.AABB();
+		}
+
+		bounds = mCachedWorldBounds;
+		return true;
+	}
+
 #if IS_EDITOR
 	SceneEditableObject* ISceneDrawable::GetEditableOwner()
 	{
@@ -3,6 +3,7 @@
 #include "o2/Render/IDrawable.h"
 #include "o2/Utils/Property.h"
 #include "o2/Utils/Serialization/Serializable.h"
+#include "o2/Utils/Types/Containers/SmallVector.h"
 
 #if IS_EDITOR
 #include "o2/Utils/Editor/SceneEditableObject.h"
@@ -53,6 +54,10 @@ namespace o2
 		// Sets this drawable as last drawing object in layer with same depth
 		void SetLastOnCurrentDepth();
 
+		// Returns cached world axis aligned bounds. Returns false when drawable can't be culled by bounds:
+		// it has no bounds or draws depth-inheriting children
+		bool GetDrawableWorldBounds(RectF& bounds);
+
 		SERIALIZABLE(ISceneDrawable);
 
 	protected:
@@ -61,7 +66,13 @@ namespace o2
 		float mDrawingDepth = 0.0f;                  // Drawing depth. Objects with higher depth will be drawn later @SERIALIZABLE
 		bool  mInheritDrawingDepthFromParent = true; // If parent depth is used @SERIALIZABLE
 
-		Vector<ISceneDrawable*> mChildrenInheritedDepth; // List of children who inherited depth
+		SmallVector<ISceneDrawable*, 4> mChildrenInheritedDepth; // List of children who inherited depth. Stored inline for few children
+
+		Basis mCachedBoundsBasis; // Bounds basis, for which world bounds were calculated
+		RectF mCachedWorldBounds; // Cached world axis aligned bounds
+
+		UInt64 mLayerDrawOrder = 0;          // Order in layer among drawables with same depth. Zero when drawable isn't drawn by layer
+		bool   mLayerDrawOrderDirty = false; // Is drawable waiting for sorting into layer drawables list
 
 	protected:
 		// Returns current scene layer
@@ -76,6 +87,9 @@ namespace o2
 		// Returns the index in the parent's list of children, used to sort the rendering
 		virtual int GetIndexInParentDrawable() const { return 0; }
 
+		// Returns world basis, containing all drawing geometry. Returns false when drawable has no bounds
+		virtual bool GetSceneDrawableBoundsBasis(Basis& basis) const { return false; }
+
 		// Called when the parent changes
 		virtual void OnDrawbleParentChanged();
 
@@ -121,6 +135,10 @@ CLASS_FIELDS_META(o2::ISceneDrawable)
 	FIELD().PROTECTED().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(0.0f).NAME(mDrawingDepth);
 	FIELD().PROTECTED().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(true).NAME(mInheritDrawingDepthFromParent);
 	FIELD().PROTECTED().NAME(mChildrenInheritedDepth);
+	FIELD().PROTECTED().NAME(mCachedBoundsBasis);
+	FIELD().PROTECTED().NAME(mCachedWorldBounds);
+	FIELD().PROTECTED().DEFAULT_VALUE(0).NAME(mLayerDrawOrder);
+	FIELD().PROTECTED().DEFAULT_VALUE(false).NAME(mLayerDrawOrderDirty);
 }
 END_META;
 CLASS_METHODS_META(o2::ISceneDrawable)
@@ -134,10 +152,12 @@ CLASS_METHODS_META(o2::ISceneDrawable)
 	FUNCTION().PUBLIC().SIGNATURE(void, SetDrawingDepthInheritFromParent, bool);
 	FUNCTION().PUBLIC().SIGNATURE(bool, IsDrawingDepthInheritedFromParent);
 	FUNCTION().PUBLIC().SIGNATURE(void, SetLastOnCurrentDepth);
+	FUNCTION().PUBLIC().SIGNATURE(bool, GetDrawableWorldBounds, RectF&);
 	FUNCTION().PROTECTED().SIGNATURE(SceneLayer*, GetSceneDrawableSceneLayer);
 	FUNCTION().PROTECTED().SIGNATURE(bool, IsSceneDrawableEnabled);
 	FUNCTION().PROTECTED().SIGNATURE(ISceneDrawable*, GetParentDrawable);
 	FUNCTION().PROTECTED().SIGNATURE(int, GetIndexInParentDrawable);
+	FUNCTION().PROTECTED().SIGNATURE(bool, GetSceneDrawableBoundsBasis, Basis&);
 	FUNCTION().PROTECTED().SIGNATURE(void, OnDrawbleParentChanged);
 	FUNCTION().PROTECTED().SIGNATURE(void, SortInheritedDrawables);
 	FUNCTION().PROTECTED().SIGNATURE(void, OnEnabled);
@@ -1,6 +1,7 @@
 #include "o2/stdafx.h"
 #include "Scene.h"
 
+#include "o2/Animation/AnimationTracksBatch.h"
 #include "o2/Application/Input.h"
 #include "o2/Assets/Types/ActorAsset.h"
 #include "o2/Render/Render.h"
@@ -9,6 +10,8 @@
 #include "o2/Scene/ActorRefResolver.h"
 #include "o2/Scene/CameraActor.h"
 #include "o2/Scene/Component.h"
+#include "o2/Scene/Components/AnimationComponent.h"
+#include "o2/Scene/Components/ParticlesEmitterComponent.h"
 #include "o2/Scene/DrawableComponent.h"
 #include "o2/Scene/SceneLayer.h"
 #include "o2/Scene/Tags.h"
@@ -16,6 +19,8 @@
 #include "o2/Scene/UI/WidgetLayout.h"
 #include "o2/Render/VectorFontEffects.h"
 #include "o2/Utils/Debug/Debug.h"
+#include "o2/Utils/Debug/Profiler.h"
+#include "o2/Utils/Tasks/JobSystem.h"
 
 namespace o2
 {
@@ -34,6 +39,9 @@ namespace o2
 		ClearCache();
 
 		delete mDefaultLayer;
+
+		if (mAnimationsBatch)
+			delete mAnimationsBatch;
 	}
 
 	const o2::Vector<CameraActor*>& Scene::GetCameras() const
@@ -43,6 +51,8 @@ namespace o2
 
 	void Scene::Update(float dt)
 	{
+		PROFILE_SCOPE("Scene::Update");
+
 		UpdateAddedEntities();
 		UpdateStartingEntities();
 		UpdateDestroyingEntities();
@@ -51,6 +61,8 @@ namespace o2
 
 	void Scene::FixedUpdate(float dt)
 	{
+		PROFILE_SCOPE("Scene::FixedUpdate");
+
 		for (auto actor : mRootActors)
 			actor->FixedUpdate(dt);
 
@@ -137,6 +149,118 @@ namespace o2
 		mActorsMap[actor->mId] = actor;
 	}
 
+	// Spatial index updates buffer of root actor subtree, updating on current thread
+	static thread_local Vector<Pair<int, RectF>>* parallelBoundsUpdates = nullptr;
+
+	void Scene::OnActorTransformUpdated(int spatialIndexItem, const RectF& worldBounds)
+	{
+		if (parallelBoundsUpdates)
+		{
+			parallelBoundsUpdates->Add(Pair<int, RectF>(spatialIndexItem, worldBounds));
+			return;
+		}
+
+		mSpatialIndex.Update(spatialIndexItem, worldBounds);
+	}
+
+	void Scene::OnActorsHierarchyChanged()
+	{
+		mTransformsStore.Invalidate();
+		mParallelGroupsDirty = true;
+	}
+
+	void Scene::OnActorComponentsChanged()
+	{
+		mParallelGroupsDirty = true;
+	}
+
+	Vector<Actor*> Scene::QueryRect(const RectF& rect) const
+	{
+		Vector<Actor*> res;
+		mSpatialIndex.QueryRect(rect, res);
+		return res;
+	}
+
+	void Scene::QueryRect(const RectF& rect, Vector<Actor*>& result) const
+	{
+		mSpatialIndex.QueryRect(rect, result);
+	}
+
+	Vector<Actor*> Scene::QueryPoint(const Vec2F& point) const
+	{
+		Vector<Actor*> res;
+		mSpatialIndex.QueryPoint(point, res);
+		return res;
+	}
+
+	void Scene::QueryPoint(const Vec2F& point, Vector<Actor*>& result) const
+	{
+		mSpatialIndex.QueryPoint(point, result);
+	}
+
+	const SceneSpatialIndex& Scene::GetSpatialIndex() const
+	{
+		return mSpatialIndex;
+	}
+
+	void Scene::SetBatchedTransformsUpdate(bool enabled)
+	{
+		mBatchedTransformsUpdate = enabled;
+
+		if (!enabled)
+			mTransformsStore.Clear();
+	}
+
+	bool Scene::IsBatchedTransformsUpdate() const
+	{
+		return mBatchedTransformsUpdate;
+	}
+
+	const ActorTransformsStore& Scene::GetTransformsStore() const
+	{
+		return mTransformsStore;
+	}
+
+	void Scene::SetBatchedAnimationsUpdate(bool enabled)
+	{
+		mBatchedAnimationsUpdate = enabled;
+
+		if (enabled && !mAnimationsBatch)
+			mAnimationsBatch = mnew AnimationTracksBatch();
+
+		for (auto component : mAnimationComponents)
+			component->mUpdatingByScene = enabled;
+	}
+
+	bool Scene::IsBatchedAnimationsUpdate() const
+	{
+		return mBatchedAnimationsUpdate;
+	}
+
+	void Scene::SetParallelUpdate(bool enabled)
+	{
+		mParallelUpdate = enabled;
+		mParallelGroupsDirty = true;
+	}
+
+	bool Scene::IsParallelUpdate() const
+	{
+		return mParallelUpdate;
+	}
+
+	void Scene::SetParallelParticlesUpdate(bool enabled)
+	{
+		mParallelParticlesUpdate = enabled;
+
+		for (auto component : mParticlesEmitters)
+			component->mUpdatingByScene = enabled;
+	}
+
+	bool Scene::IsParallelParticlesUpdate() const
+	{
+		return mParallelParticlesUpdate;
+	}
+
 	void Scene::DestroyEditableObject(SceneEditableObject* object)
 	{
 		mDestroyingObjects.Add(object);
@@ -144,17 +268,167 @@ namespace o2
 
 	void Scene::UpdateActors(float dt)
 	{
-		for (auto actor : mRootActors)
+		if (mBatchedAnimationsUpdate)
+			UpdateAnimations(dt);
+
+		if (mBatchedTransformsUpdate)
+		{
+			if (mTransformsStore.IsNeedRebuild())
+				mTransformsStore.Build(mRootActors);
+
+			mTransformsStore.Update();
+		}
+
+		if (mParallelUpdate && JobSystem::IsSingletonInitialzed() && o2Jobs.GetThreadsCount() > 1)
+			UpdateActorsParallel(dt);
+		else
+		{
+			for (auto actor : mRootActors)
+				actor->Update(dt);
+
+			for (auto actor : mRootActors)
+				actor->UpdateChildren(dt);
+		}
+
+		// Emitters are updated after actors, so their transforms are already final for this frame
+		if (mParallelParticlesUpdate)
+			UpdateParticlesEmitters(dt);
+	}
+
+	void Scene::UpdateAnimations(float dt)
+	{
+		// Tracks players don't evaluate while batch is recording, they are collected and evaluated together. Mixers
+		// read players values, so they are updated after batch evaluation
+		mAnimationsBatch->BeginRecording();
+
+		for (auto component : mAnimationComponents)
+		{
+			if (!component->mInEditMode)
+				component->UpdateStates(dt);
+		}
+
+		mAnimationsBatch->EndRecording();
+		mAnimationsBatch->Evaluate();
+
+		for (auto component : mAnimationComponents)
+		{
+			if (!component->mInEditMode)
+				component->UpdateMixers(dt);
+		}
+	}
+
+	void Scene::UpdateActorsParallel(float dt)
+	{
+		if (mParallelGroupsDirty)
+			UpdateParallelGroups();
+
+		// Passes are the same as serial: all roots are updated, then all children. Subtrees don't depend on each other,
+		// so results are the same on any threads count. Not thread safe subtrees are updated after parallel ones in
+		// each pass, so they see finished state of the pass
+		UpdateRootActorsParallel([dt](Actor* actor) { actor->Update(dt); });
+
+		for (auto actor : mSerialRootActors)
 			actor->Update(dt);
 
-		for (auto actor : mRootActors)
+		UpdateRootActorsParallel([dt](Actor* actor) { actor->UpdateChildren(dt); });
+
+		for (auto actor : mSerialRootActors)
 			actor->UpdateChildren(dt);
 	}
 
+	void Scene::UpdateRootActorsParallel(const Function<void(Actor*)>& update)
+	{
+		// Spatial index updates are collected by subtrees and applied in roots order
+		mParallelBoundsUpdates.Resize(mParallelRootActors.Count());
+
+		int batchSize = Math::Max(1, mParallelRootActors.Count()/(o2Jobs.GetThreadsCount()*4));
+		o2Jobs.ParallelFor(mParallelRootActors.Count(), batchSize, [&](int begin, int end)
+		{
+			for (int i = begin; i < end; i++)
+			{
+				parallelBoundsUpdates = &mParallelBoundsUpdates[i];
+				update(mParallelRootActors[i]);
+			}
+
+			parallelBoundsUpdates = nullptr;
+		});
+
+		for (auto& updates : mParallelBoundsUpdates)
+		{
+			for (auto& boundsUpdate : updates)
+				mSpatialIndex.Update(boundsUpdate.first, boundsUpdate.second);
+
+			updates.Clear();
+		}
+	}
+
+	void Scene::UpdateParticlesEmitters(float dt)
+	{
+		// Emitter changes only own particles and mesh and uses own random generator, so emitters are independent.
+		// Results don't depend on threads count
+		auto updateEmitters = [&](int begin, int end)
+		{
+			for (int i = begin; i < end; i++)
+			{
+				auto component = mParticlesEmitters[i];
+				if (component->IsEnabledInHierarchy())
+					component->ParticlesEmitter::Update(dt);
+			}
+		};
+
+		if (!JobSystem::IsSingletonInitialzed() || o2Jobs.GetThreadsCount() < 2)
+		{
+			updateEmitters(0, mParticlesEmitters.Count());
+			return;
+		}
+
+		int batchSize = Math::Max(1, mParticlesEmitters.Count()/(o2Jobs.GetThreadsCount()*4));
+		o2Jobs.ParallelFor(mParticlesEmitters.Count(), batchSize, updateEmitters);
+	}
+
+	void Scene::UpdateParallelGroups()
+	{
+		mParallelRootActors.Clear();
+		mSerialRootActors.Clear();
+
+		for (auto actor : mRootActors)
+		{
+			if (IsSubtreeUpdateThreadSafe(actor))
+				mParallelRootActors.Add(actor);
+			else
+				mSerialRootActors.Add(actor);
+		}
+
+		mParallelGroupsDirty = false;
+	}
+
+	bool Scene::IsSubtreeUpdateThreadSafe(Actor* actor)
+	{
+		// Derived actors and transforms can override update and use shared systems
+		if (&actor->GetType() != &TypeOf(Actor) || &actor->transform->GetType() != &TypeOf(ActorTransform))
+			return false;
+
+		for (auto comp : actor->mComponents)
+		{
+			if (!comp->IsUpdateThreadSafe())
+				return false;
+		}
+
+		for (auto child : actor->mChildren)
+		{
+			if (!IsSubtreeUpdateThreadSafe(child))
+				return false;
+		}
+
+		return true;
+	}
+
 #undef DrawText
 
 	void Scene::Draw()
 	{
+		PROFILE_SCOPE("Scene::Draw");
+
 		DrawCameras();
 	}
 
@@ -259,6 +533,15 @@ namespace o2
 
 		actor->OnAddToScene();
 
+		RectF worldBounds = actor->transform->GetWorldBasis().AABB();
+		int& spatialIndexItem = actor->transform->mData->spatialIndexItem;
+		if (spatialIndexItem < 0)
+			spatialIndexItem = mSpatialIndex.Add(actor, worldBounds);
+		else
+			mSpatialIndex.Update(spatialIndexItem, worldBounds);
+
+		OnActorsHierarchyChanged();
+
 		if constexpr (IS_EDITOR)
 		{
 			mChangedObjects.Add(actor);
@@ -274,6 +557,14 @@ namespace o2
 
 		mAllActors.Remove(actor);
 		mActorsMap.Remove(actor->mId);
+		int& spatialIndexItem = actor->transform->mData->spatialIndexItem;
+		if (spatialIndexItem >= 0)
+		{
+			mSpatialIndex.Remove(spatialIndexItem);
+			spatialIndexItem = -1;
+		}
+
+		OnActorsHierarchyChanged();
 
 		mStartActors.Remove(actor);
 		mAddedActors.Remove(actor);
@@ -297,6 +588,30 @@ namespace o2
 		mStartComponents.Remove(component);
 	}
 
+	void Scene::OnAnimationComponentAdded(AnimationComponent* component)
+	{
+		mAnimationComponents.Add(component);
+		component->mUpdatingByScene = mBatchedAnimationsUpdate;
+	}
+
+	void Scene::OnAnimationComponentRemoved(AnimationComponent* component)
+	{
+		mAnimationComponents.Remove(component);
+		component->mUpdatingByScene = false;
+	}
+
+	void Scene::OnParticlesEmitterAdded(ParticlesEmitterComponent* component)
+	{
+		mParticlesEmitters.Add(component);
+		component->mUpdatingByScene = mParallelParticlesUpdate;
+	}
+
+	void Scene::OnParticlesEmitterRemoved(ParticlesEmitterComponent* component)
+	{
+		mParticlesEmitters.Remove(component);
+		component->mUpdatingByScene = false;
+	}
+
 	void Scene::OnLayerRenamed(SceneLayer* layer, const String& oldName)
 	{
 		mLayersMap.Remove(oldName);
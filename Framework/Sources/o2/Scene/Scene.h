@@ -1,8 +1,11 @@
 #pragma once
 
 #include "o2/Assets/Types/ActorAsset.h"
+#include "o2/Scene/ActorTransformsStore.h"
+#include "o2/Scene/SceneSpatialIndex.h"
 #include "o2/Utils/Serialization/Serializable.h"
 #include "o2/Utils/Singleton.h"
+#include "o2/Utils/Types/Containers/Pair.h"
 #include "o2/Utils/Types/Containers/Vector.h"
 #include "o2/Utils/Types/String.h"
 #include "o2/Utils/Types/UID.h"
@@ -14,8 +17,11 @@
 namespace o2
 {
 	class Actor;
+	class AnimationComponent;
+	class AnimationTracksBatch;
 	class CameraActor;
 	class Component;
+	class ParticlesEmitterComponent;
 	class SceneLayer;
 	class Tag;
 
@@ -126,6 +132,50 @@ namespace o2
 		template<typename _type>
 		Vector<_type>* FindAllActorsComponents();
 
+		// Returns actors which world bounds intersects rectangle
+		Vector<Actor*> QueryRect(const RectF& rect) const;
+
+		// Collects actors which world bounds intersects rectangle
+		void QueryRect(const RectF& rect, Vector<Actor*>& result) const;
+
+		// Returns actors which world bounds contains point
+		Vector<Actor*> QueryPoint(const Vec2F& point) const;
+
+		// Collects actors which world bounds contains point
+		void QueryPoint(const Vec2F& point, Vector<Actor*>& result) const;
+
+		// Returns actors spatial index
+		const SceneSpatialIndex& GetSpatialIndex() const;
+
+		// Sets actors transforms updating in one flat batched pass before actors update
+		void SetBatchedTransformsUpdate(bool enabled);
+
+		// Returns is actors transforms updating in one flat batched pass
+		bool IsBatchedTransformsUpdate() const;
+
+		// Returns batched actors transforms storage
+		const ActorTransformsStore& GetTransformsStore() const;
+
+		// Sets animation components updating in one batched pass before actors update. Float, Vec2F and Color4 tracks
+		// of all animation components are evaluated together by tracks batch
+		void SetBatchedAnimationsUpdate(bool enabled);
+
+		// Returns is animation components updating in one batched pass
+		bool IsBatchedAnimationsUpdate() const;
+
+		// Sets updating of independent root actors subtrees in parallel by jobs system
+		void SetParallelUpdate(bool enabled);
+
+		// Returns is independent root actors subtrees updating in parallel
+		bool IsParallelUpdate() const;
+
+		// Sets particles emitters updating in one parallel pass after actors update. Particles simulation and meshes
+		// building are done by jobs system, meshes are drawn on main thread as usual
+		void SetParallelParticlesUpdate(bool enabled);
+
+		// Returns is particles emitters updating in parallel pass
+		bool IsParallelParticlesUpdate() const;
+
 		// Removes all actors
 		void Clear(bool keepDefaultLayer = true);
 
@@ -188,6 +238,24 @@ namespace o2
 
 		Vector<ActorAssetRef> mCache; // Cached actors assets
 
+		SceneSpatialIndex mSpatialIndex; // Spatial index of actors world bounds
+
+		ActorTransformsStore mTransformsStore;                 // Batched actors transforms storage
+		bool                 mBatchedTransformsUpdate = false; // Is transforms updating by batched storage
+
+		Vector<AnimationComponent*> mAnimationComponents;             // Animation components on scene
+		AnimationTracksBatch*       mAnimationsBatch = nullptr;       // Animation tracks batch, created when batched animations update enabled
+		bool                        mBatchedAnimationsUpdate = false; // Is animation components updating by tracks batch
+
+		bool                                mParallelUpdate = false;     // Is independent root actors subtrees updating in parallel
+		bool                                mParallelGroupsDirty = true; // Is parallel and serial root actors lists outdated
+		Vector<Actor*>                      mParallelRootActors;         // Root actors which subtrees can be updated in parallel
+		Vector<Actor*>                      mSerialRootActors;           // Root actors which subtrees are updated on main thread
+		Vector<Vector<Pair<int, RectF>>>    mParallelBoundsUpdates;      // Spatial index updates by parallel subtrees, applied in roots order
+
+		Vector<ParticlesEmitterComponent*> mParticlesEmitters;               // Particles emitters components on scene
+		bool                               mParallelParticlesUpdate = false; // Is particles emitters updating in parallel pass
+
 	protected:
 		// Default constructor
 		Scene();
@@ -201,6 +269,24 @@ namespace o2
 		// Updates root actors and their children
 		void UpdateActors(float dt);
 
+		// Updates animation components states, evaluates collected animation tracks by batch and updates mixers
+		void UpdateAnimations(float dt);
+
+		// Updates root actors and their children, independent subtrees are updated in parallel
+		void UpdateActorsParallel(float dt);
+
+		// Calls update function for each parallel root actor on job system threads, applies collected spatial index updates
+		void UpdateRootActorsParallel(const Function<void(Actor*)>& update);
+
+		// Updates particles emitters simulation and meshes, emitters are distributed between jobs system threads
+		void UpdateParticlesEmitters(float dt);
+
+		// Splits root actors into parallel and serial lists
+		void UpdateParallelGroups();
+
+		// Returns true when actor and it's children can be updated out of main thread
+		static bool IsSubtreeUpdateThreadSafe(Actor* actor);
+
 		// Updates just added actors and components
 		void UpdateAddedEntities();
 
@@ -222,12 +308,33 @@ namespace o2
 		// Called when actor unique id was changed; updates actors map
 		void OnActorIdChanged(Actor* actor, SceneUID prevId);
 
+		// Called when indexed actor transform was updated; updates spatial index item bounds
+		void OnActorTransformUpdated(int spatialIndexItem, const RectF& worldBounds);
+
+		// Called when actors hierarchy was changed; invalidates batched transforms storage and parallel groups
+		void OnActorsHierarchyChanged();
+
+		// Called when actor components were changed; invalidates parallel groups
+		void OnActorComponentsChanged();
+
 		// Called when component added to actor, registers for calling OnAddOnScene
 		void OnComponentAdded(Component* component);
 
 		// Called when component removed, register for calling OnRemovFromScene
 		void OnComponentRemoved(Component* component);
 
+		// Called when animation component added to scene, registers for batched animations update
+		void OnAnimationComponentAdded(AnimationComponent* component);
+
+		// Called when animation component removed from scene, unregisters from batched animations update
+		void OnAnimationComponentRemoved(AnimationComponent* component);
+
+		// Called when particles emitter component added to scene, registers for parallel particles update
+		void OnParticlesEmitterAdded(ParticlesEmitterComponent* component);
+
+		// Called when particles emitter component removed from scene, unregisters from parallel particles update
+		void OnParticlesEmitterRemoved(ParticlesEmitterComponent* component);
+
 		// Called when scene layer renamed, updates layers map
 		void OnLayerRenamed(SceneLayer* layer, const String& oldName);
 
@@ -239,11 +346,15 @@ namespace o2
 
 		friend class Actor;
 		friend class ActorRef;
+		friend class ActorTransform;
+		friend class ActorTransformsStore;
+		friend class AnimationComponent;
 		friend class Application;
 		friend class CameraActor;
 		friend class Component;
 		friend class ComponentRef;
 		friend class DrawableComponent;
+		friend class ParticlesEmitterComponent;
 		friend class SceneLayer;
 		friend class Widget;
 		friend class WidgetLayer;
@@ -403,6 +514,19 @@ CLASS_FIELDS_META(o2::Scene)
 	FIELD().PROTECTED().NAME(mDefaultLayer);
 	FIELD().PROTECTED().NAME(mTags);
 	FIELD().PROTECTED().NAME(mCache);
+	FIELD().PROTECTED().NAME(mSpatialIndex);
+	FIELD().PROTECTED().NAME(mTransformsStore);
+	FIELD().PROTECTED().DEFAULT_VALUE(false).NAME(mBatchedTransformsUpdate);
+	FIELD().PROTECTED().NAME(mAnimationComponents);
+	FIELD().PROTECTED().DEFAULT_VALUE(nullptr).NAME(mAnimationsBatch);
+	FIELD().PROTECTED().DEFAULT_VALUE(false).NAME(mBatchedAnimationsUpdate);
+	FIELD().PROTECTED().DEFAULT_VALUE(false).NAME(mParallelUpdate);
+	FIELD().PROTECTED().DEFAULT_VALUE(true).NAME(mParallelGroupsDirty);
+	FIELD().PROTECTED().NAME(mParallelRootActors);
+	FIELD().PROTECTED().NAME(mSerialRootActors);
+	FIELD().PROTECTED().NAME(mParallelBoundsUpdates);
+	FIELD().PROTECTED().NAME(mParticlesEmitters);
+	FIELD().PROTECTED().DEFAULT_VALUE(false).NAME(mParallelParticlesUpdate);
 	FIELD().PROTECTED().NAME(mPrototypeLinksCache);
 	FIELD().PROTECTED().NAME(mChangedObjects);
 	FIELD().PROTECTED().NAME(mEditableObjects);
@@ -440,6 +564,20 @@ CLASS_METHODS_META(o2::Scene)
 	FUNCTION().PUBLIC().SIGNATURE(Actor*, GetAssetActorByID, const UID&);
 	FUNCTION().PUBLIC().SIGNATURE(Actor*, FindActor, const String&);
 	FUNCTION().PUBLIC().SIGNATURE(const Vector<CameraActor*>&, GetCameras);
+	FUNCTION().PUBLIC().SIGNATURE(Vector<Actor*>, QueryRect, const RectF&);
+	FUNCTION().PUBLIC().SIGNATURE(void, QueryRect, const RectF&, Vector<Actor*>&);
+	FUNCTION().PUBLIC().SIGNATURE(Vector<Actor*>, QueryPoint, const Vec2F&);
+	FUNCTION().PUBLIC().SIGNATURE(void, QueryPoint, const Vec2F&, Vector<Actor*>&);
+	FUNCTION().PUBLIC().SIGNATURE(const SceneSpatialIndex&, GetSpatialIndex);
+	FUNCTION().PUBLIC().SIGNATURE(void, SetBatchedTransformsUpdate, bool);
+	FUNCTION().PUBLIC().SIGNATURE(bool, IsBatchedTransformsUpdate);
+	FUNCTION().PUBLIC().SIGNATURE(const ActorTransformsStore&, GetTransformsStore);
+	FUNCTION().PUBLIC().SIGNATURE(void, SetBatchedAnimationsUpdate, bool);
+	FUNCTION().PUBLIC().SIGNATURE(bool, IsBatchedAnimationsUpdate);
+	FUNCTION().PUBLIC().SIGNATURE(void, SetParallelUpdate, bool);
+	FUNCTION().PUBLIC().SIGNATURE(bool, IsParallelUpdate);
+	FUNCTION().PUBLIC().SIGNATURE(void, SetParallelParticlesUpdate, bool);
+	FUNCTION().PUBLIC().SIGNATURE(bool, IsParallelParticlesUpdate);
 	FUNCTION().PUBLIC().SIGNATURE(void, Clear, bool);
 	FUNCTION().PUBLIC().SIGNATURE(void, ClearCache);
 	FUNCTION().PUBLIC().SIGNATURE(void, Load, const String&, bool);
@@ -455,6 +593,12 @@ CLASS_METHODS_META(o2::Scene)
 	FUNCTION().PROTECTED().CONSTRUCTOR();
 	FUNCTION().PROTECTED().SIGNATURE(void, DrawCameras);
 	FUNCTION().PROTECTED().SIGNATURE(void, UpdateActors, float);
+	FUNCTION().PROTECTED().SIGNATURE(void, UpdateAnimations, float);
+	FUNCTION().PROTECTED().SIGNATURE(void, UpdateActorsParallel, float);
+	FUNCTION().PROTECTED().SIGNATURE(void, UpdateRootActorsParallel, const Function<void(Actor*)>&);
+	FUNCTION().PROTECTED().SIGNATURE(void, UpdateParticlesEmitters, float);
+	FUNCTION().PROTECTED().SIGNATURE(void, UpdateParallelGroups);
+	FUNCTION().PROTECTED().SIGNATURE_STATIC(bool, IsSubtreeUpdateThreadSafe, Actor*);
 	FUNCTION().PROTECTED().SIGNATURE(void, UpdateAddedEntities);
 	FUNCTION().PROTECTED().SIGNATURE(void, UpdateStartingEntities);
 	FUNCTION().PROTECTED().SIGNATURE(void, DrawCursorDebugInfo);
@@ -462,8 +606,15 @@ CLASS_METHODS_META(o2::Scene)
 	FUNCTION().PROTECTED().SIGNATURE(void, AddActorToSceneDeferred, Actor*);
 	FUNCTION().PROTECTED().SIGNATURE(void, RemoveActorFromScene, Actor*, bool);
 	FUNCTION().PROTECTED().SIGNATURE(void, OnActorIdChanged, Actor*, SceneUID);
+	FUNCTION().PROTECTED().SIGNATURE(void, OnActorTransformUpdated, int, const RectF&);
+	FUNCTION().PROTECTED().SIGNATURE(void, OnActorsHierarchyChanged);
+	FUNCTION().PROTECTED().SIGNATURE(void, OnActorComponentsChanged);
 	FUNCTION().PROTECTED().SIGNATURE(void, OnComponentAdded, Component*);
 	FUNCTION().PROTECTED().SIGNATURE(void, OnComponentRemoved, Component*);
+	FUNCTION().PROTECTED().SIGNATURE(void, OnAnimationComponentAdded, AnimationComponent*);
+	FUNCTION().PROTECTED().SIGNATURE(void, OnAnimationComponentRemoved, AnimationComponent*);
+	FUNCTION().PROTECTED().SIGNATURE(void, OnParticlesEmitterAdded, ParticlesEmitterComponent*);
+	FUNCTION().PROTECTED().SIGNATURE(void, OnParticlesEmitterRemoved, ParticlesEmitterComponent*);
 	FUNCTION().PROTECTED().SIGNATURE(void, OnLayerRenamed, SceneLayer*, const String&);
 	FUNCTION().PROTECTED().SIGNATURE(void, OnCameraAddedOnScene, CameraActor*);
 	FUNCTION().PROTECTED().SIGNATURE(void, OnCameraRemovedScene, CameraActor*);
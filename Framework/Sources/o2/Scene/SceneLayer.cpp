@@ -5,6 +5,9 @@
 #include "o2/Scene/ISceneDrawable.h"
 #include "o2/Scene/Scene.h"
 
+#include <algorithm>
+#include <iterator>
+
 namespace o2
 {
 	SceneLayer::SceneLayer()
@@ -78,48 +81,44 @@ namespace o2
 		mDrawables.Remove(drawable);
 	}
 
+	void SceneLayer::UpdateDrawablesOrder()
+	{
+		if (mChangedOrderDrawables.IsEmpty())
+			return;
+
+		// Changed drawables are removed from old places, other drawables stay sorted
+		auto changedBegin = std::remove_if(mEnabledDrawables.begin(), mEnabledDrawables.end(),
+										   [](ISceneDrawable* x) { return x->mLayerDrawOrderDirty; });
+
+		mEnabledDrawables.erase(changedBegin, mEnabledDrawables.end());
+
+		for (auto drawable : mChangedOrderDrawables)
+			drawable->mLayerDrawOrderDirty = false;
+
+		std::sort(mChangedOrderDrawables.begin(), mChangedOrderDrawables.end(), &SceneLayer::IsDrawnBefore);
+
+		mMergeBuffer.Clear();
+		mMergeBuffer.Reserve(mEnabledDrawables.Count() + mChangedOrderDrawables.Count());
+
+		std::merge(mEnabledDrawables.begin(), mEnabledDrawables.end(),
+				   mChangedOrderDrawables.begin(), mChangedOrderDrawables.end(),
+				   std::back_inserter(mMergeBuffer), &SceneLayer::IsDrawnBefore);
+
+		mEnabledDrawables.swap(mMergeBuffer);
+		mChangedOrderDrawables.Clear();
+	}
+
 	void SceneLayer::OnDrawableDepthChanged(ISceneDrawable* drawable)
 	{
-		OnDrawableDisabled(drawable, false);
-		OnDrawableEnabled(drawable, false);
+		if (drawable->mLayerDrawOrder != 0)
+			MarkDrawOrderChanged(drawable);
 	}
 
 	void SceneLayer::OnDrawableEnabled(ISceneDrawable* drawable, bool force)
 	{
 		if (force || !drawable->mInheritDrawingDepthFromParent)
 		{
-			const int binSearchRangeSizeStop = 5;
-			int rangeMin = 0, rangeMax = mEnabledDrawables.Count();
-			float targetDepth = drawable->mDrawingDepth;
-			int position = 0;
-			bool skipLinearSearch = false;
-
-			while (rangeMax - rangeMin > binSearchRangeSizeStop)
-			{
-				int center = (rangeMin + rangeMax) >> 1;
-
-				float centerValue = mEnabledDrawables[center]->mDrawingDepth;
-
-				if (targetDepth < centerValue)
-					rangeMax = center;
-				else if (targetDepth > centerValue)
-					rangeMin = center;
-				else
-				{
-					position = center;
-					skipLinearSearch = true;
-					break;
-				}
-			}
-
-			if (!skipLinearSearch)
-			{
-				for (position = rangeMin; position < rangeMax; position++)
-					if (mEnabledDrawables[position]->mDrawingDepth > targetDepth)
-						break;
-			}
-
-			mEnabledDrawables.Insert(drawable, position);
+			MarkDrawOrderChanged(drawable);
 		}
 		else if (drawable->mInheritDrawingDepthFromParent && drawable->mParentDrawable == nullptr)
 		{
@@ -130,25 +129,43 @@ namespace o2
 	void SceneLayer::OnDrawableDisabled(ISceneDrawable* drawable, bool force)
 	{
 		if (force || !drawable->mInheritDrawingDepthFromParent)
+		{
+			if (drawable->mLayerDrawOrderDirty)
+			{
+				mChangedOrderDrawables.Remove(drawable);
+				drawable->mLayerDrawOrderDirty = false;
+			}
+
 			mEnabledDrawables.Remove(drawable);
+			drawable->mLayerDrawOrder = 0;
+		}
 		else if (drawable->mInheritDrawingDepthFromParent && drawable->mParentDrawable == nullptr)
 			mRootDrawables.drawables.Remove(drawable);
 	}
 
 	void SceneLayer::SetLastByDepth(ISceneDrawable* drawable)
 	{
-		OnDrawableDisabled(drawable, drawable->IsDrawingDepthInheritedFromParent() && drawable->GetParentDrawable() == nullptr);
+		if (drawable->mLayerDrawOrder != 0)
+			MarkDrawOrderChanged(drawable);
+	}
 
-		for (int position = 0; position < mEnabledDrawables.Count(); position++)
+	void SceneLayer::MarkDrawOrderChanged(ISceneDrawable* drawable)
+	{
+		drawable->mLayerDrawOrder = ++mLastDrawOrder;
+
+		if (!drawable->mLayerDrawOrderDirty)
 		{
-			if (mEnabledDrawables[position]->mDrawingDepth > drawable->mDrawingDepth)
-			{
-				mEnabledDrawables.Insert(drawable, position);
-				return;
-			}
+			drawable->mLayerDrawOrderDirty = true;
+			mChangedOrderDrawables.Add(drawable);
 		}
+	}
+
+	bool SceneLayer::IsDrawnBefore(const ISceneDrawable* a, const ISceneDrawable* b)
+	{
+		if (a->mDrawingDepth != b->mDrawingDepth)
+			return a->mDrawingDepth < b->mDrawingDepth;
 
-		mEnabledDrawables.Add(drawable);
+		return a->mLayerDrawOrder < b->mLayerDrawOrder;
 	}
 
 	void SceneLayer::RootDrawablesContainer::Draw()
@@ -38,9 +38,14 @@ namespace o2
 		// Returns all drawable objects of actors in layer
 		const Vector<ISceneDrawable*>& GetDrawables() const;
 
-		// Returns enabled drawable objects of actors in layer
+		// Returns enabled drawable objects of actors in layer, sorted by depth. Call UpdateDrawablesOrder() before
+		// to get changes of depth, made after last update
 		const Vector<ISceneDrawable*>& GetEnabledDrawables() const;
 
+		// Applies batched drawables depth changes: sorts changed and enabled drawables and merges them into enabled
+		// drawables list in one pass. Drawables with same depth keep order of their changes. Called before drawing
+		void UpdateDrawablesOrder();
+
 		SERIALIZABLE(SceneLayer);
 
 	protected:
@@ -58,7 +63,11 @@ namespace o2
 		Vector<Actor*>  mEnabledActors; // Enabled actors
 
 		Vector<ISceneDrawable*> mDrawables;        // Drawable objects in layer
-		Vector<ISceneDrawable*> mEnabledDrawables; // Enabled drawable objects in layer
+		Vector<ISceneDrawable*> mEnabledDrawables; // Enabled drawable objects in layer, sorted by depth and order
+
+		Vector<ISceneDrawable*> mChangedOrderDrawables; // Enabled drawables with changed depth or order, waiting for sorting
+		Vector<ISceneDrawable*> mMergeBuffer;           // Buffer for merging sorted drawables lists
+		UInt64                  mLastDrawOrder = 0;     // Last drawable order, increases with each order change
 
 		RootDrawablesContainer mRootDrawables; // Root drawables with inherited depth. Draws at 0 priority
 
@@ -81,7 +90,7 @@ namespace o2
 		// Unregisters drawable object
 		void UnregisterDrawable(ISceneDrawable* drawable);
 
-		// Called when drawable object depth was changed and sorts all drawable component
+		// Called when drawable object depth was changed. Drawable is moved to new place at next order update
 		void OnDrawableDepthChanged(ISceneDrawable* drawable);
 
 		// Called when object was enabled. If force is true, it is added to the scene
@@ -93,6 +102,12 @@ namespace o2
 		// Sets drawable order as last of all objects with same depth
 		void SetLastByDepth(ISceneDrawable* drawable);
 
+		// Assigns new order to drawable and puts it into changed drawables list
+		void MarkDrawOrderChanged(ISceneDrawable* drawable);
+
+		// Returns true when drawable a is drawn before drawable b: by depth, then by order
+		static bool IsDrawnBefore(const ISceneDrawable* a, const ISceneDrawable* b);
+
 		friend class Actor;
 		friend class CameraActor;
 		friend class DrawableComponent;
@@ -131,6 +146,9 @@ CLASS_FIELDS_META(o2::SceneLayer)
 	FIELD().PROTECTED().NAME(mEnabledActors);
 	FIELD().PROTECTED().NAME(mDrawables);
 	FIELD().PROTECTED().NAME(mEnabledDrawables);
+	FIELD().PROTECTED().NAME(mChangedOrderDrawables);
+	FIELD().PROTECTED().NAME(mMergeBuffer);
+	FIELD().PROTECTED().DEFAULT_VALUE(0).NAME(mLastDrawOrder);
 	FIELD().PROTECTED().NAME(mRootDrawables);
 }
 END_META;
@@ -144,6 +162,7 @@ CLASS_METHODS_META(o2::SceneLayer)
 	FUNCTION().PUBLIC().SIGNATURE(const Vector<Actor*>&, GetEnabledActors);
 	FUNCTION().PUBLIC().SIGNATURE(const Vector<ISceneDrawable*>&, GetDrawables);
 	FUNCTION().PUBLIC().SIGNATURE(const Vector<ISceneDrawable*>&, GetEnabledDrawables);
+	FUNCTION().PUBLIC().SIGNATURE(void, UpdateDrawablesOrder);
 	FUNCTION().PROTECTED().SIGNATURE(void, RegisterActor, Actor*);
 	FUNCTION().PROTECTED().SIGNATURE(void, UnregisterActor, Actor*);
 	FUNCTION().PROTECTED().SIGNATURE(void, OnActorEnabled, Actor*);
@@ -154,5 +173,7 @@ CLASS_METHODS_META(o2::SceneLayer)
 	FUNCTION().PROTECTED().SIGNATURE(void, OnDrawableEnabled, ISceneDrawable*, bool);
 	FUNCTION().PROTECTED().SIGNATURE(void, OnDrawableDisabled, ISceneDrawable*, bool);
 	FUNCTION().PROTECTED().SIGNATURE(void, SetLastByDepth, ISceneDrawable*);
+	FUNCTION().PROTECTED().SIGNATURE(void, MarkDrawOrderChanged, ISceneDrawable*);
+	FUNCTION().PROTECTED().SIGNATURE_STATIC(bool, IsDrawnBefore, const ISceneDrawable*, const ISceneDrawable*);
 }
 END_META;
@@ -0,0 +1,217 @@
+#include "o2/stdafx.h"
+#include "SceneSpatialIndex.h"
+
+namespace o2
+{
+	SceneSpatialIndex::SceneSpatialIndex(float cellSize /*= 256.0f*/, int maxCellsPerActor /*= 64*/):
+		mCellSize(cellSize), mInvCellSize(1.0f/cellSize), mMaxCellsPerActor(maxCellsPerActor)
+	{}
+
+	int SceneSpatialIndex::Add(Actor* actor, const RectF& bounds)
+	{
+		int itemIdx;
+		if (!mFreeItems.IsEmpty())
+			itemIdx = mFreeItems.PopBack();
+		else
+		{
+			itemIdx = mItems.Count();
+			mItems.Add(Item());
+		}
+
+		Item& item = mItems[itemIdx];
+		item.actor = actor;
+		item.bounds = bounds;
+		item.cells = GetCellsRange(bounds);
+		item.queryId = 0;
+
+		InsertItemInCells(itemIdx);
+
+		return itemIdx;
+	}
+
+	void SceneSpatialIndex::Update(int itemIdx, const RectF& bounds)
+	{
+		Item& item = mItems[itemIdx];
+		item.bounds = bounds;
+
+		RectI cells = GetCellsRange(bounds);
+		if (cells == item.cells)
+			return;
+
+		RemoveItemFromCells(itemIdx);
+		item.cells = cells;
+		InsertItemInCells(itemIdx);
+	}
+
+	void SceneSpatialIndex::Remove(int itemIdx)
+	{
+		if (!mItems[itemIdx].actor)
+			return;
+
+		RemoveItemFromCells(itemIdx);
+		mItems[itemIdx].actor = nullptr;
+		mFreeItems.Add(itemIdx);
+	}
+
+	void SceneSpatialIndex::Clear()
+	{
+		mItems.Clear();
+		mFreeItems.Clear();
+		mCells.clear();
+		mLargeItems.Clear();
+	}
+
+	Actor* SceneSpatialIndex::GetActor(int itemIdx) const
+	{
+		return mItems[itemIdx].actor;
+	}
+
+	const RectF& SceneSpatialIndex::GetBounds(int itemIdx) const
+	{
+		return mItems[itemIdx].bounds;
+	}
+
+	int SceneSpatialIndex::GetActorsCount() const
+	{
+		return mItems.Count() - mFreeItems.Count();
+	}
+
+	void SceneSpatialIndex::QueryRect(const RectF& rect, Vector<Actor*>& result) const
+	{
+		mQueryId++;
+
+		for (int itemIdx : mLargeItems)
+			CheckItem(itemIdx, rect, result);
+
+		RectI cells = GetCellsRange(rect);
+
+		// When query covers more cells than exists, it's cheaper to check all existing cells
+		Int64 cellsCount = (Int64)(cells.right - cells.left + 1)*(Int64)(cells.top - cells.bottom + 1);
+		if (cellsCount > (Int64)mCells.size())
+		{
+			for (auto& cell : mCells)
+			{
+				for (int itemIdx : cell.second)
+					CheckItem(itemIdx, rect, result);
+			}
+
+			return;
+		}
+
+		for (int x = cells.left; x <= cells.right; x++)
+		{
+			for (int y = cells.bottom; y <= cells.top; y++)
+			{
+				auto fnd = mCells.find(GetCellKey(x, y));
+				if (fnd == mCells.end())
+					continue;
+
+				for (int itemIdx : fnd->second)
+					CheckItem(itemIdx, rect, result);
+			}
+		}
+	}
+
+	void SceneSpatialIndex::QueryPoint(const Vec2F& point, Vector<Actor*>& result) const
+	{
+		QueryRect(RectF(point, point), result);
+	}
+
+	void SceneSpatialIndex::SetCellSize(float size)
+	{
+		mCellSize = size;
+		mInvCellSize = 1.0f/size;
+
+		mCells.clear();
+		mLargeItems.Clear();
+
+		for (int i = 0; i < mItems.Count(); i++)
+		{
+			if (!mItems[i].actor)
+				continue;
+
+			mItems[i].cells = GetCellsRange(mItems[i].bounds);
+			InsertItemInCells(i);
+		}
+	}
+
+	float SceneSpatialIndex::GetCellSize() const
+	{
+		return mCellSize;
+	}
+
+	RectI SceneSpatialIndex::GetCellsRange(const RectF& bounds) const
+	{
+		return RectI(Math::FloorToInt(bounds.left*mInvCellSize), Math::FloorToInt(bounds.top*mInvCellSize),
+					 Math::FloorToInt(bounds.right*mInvCellSize), Math::FloorToInt(bounds.bottom*mInvCellSize));
+	}
+
+	UInt64 SceneSpatialIndex::GetCellKey(int x, int y)
+	{
+		return ((UInt64)(UInt)x << 32) | (UInt64)(UInt)y;
+	}
+
+	void SceneSpatialIndex::InsertItemInCells(int itemIdx)
+	{
+		Item& item = mItems[itemIdx];
+
+		Int64 cellsCount = (Int64)(item.cells.right - item.cells.left + 1)*(Int64)(item.cells.top - item.cells.bottom + 1);
+		item.large = cellsCount > (Int64)mMaxCellsPerActor;
+
+		if (item.large)
+		{
+			mLargeItems.Add(itemIdx);
+			return;
+		}
+
+		for (int x = item.cells.left; x <= item.cells.right; x++)
+		{
+			for (int y = item.cells.bottom; y <= item.cells.top; y++)
+				mCells[GetCellKey(x, y)].Add(itemIdx);
+		}
+	}
+
+	void SceneSpatialIndex::RemoveItemFromCells(int itemIdx)
+	{
+		Item& item = mItems[itemIdx];
+
+		if (item.large)
+		{
+			mLargeItems.Remove(itemIdx);
+			return;
+		}
+
+		for (int x = item.cells.left; x <= item.cells.right; x++)
+		{
+			for (int y = item.cells.bottom; y <= item.cells.top; y++)
+			{
+				auto fnd = mCells.find(GetCellKey(x, y));
+				if (fnd == mCells.end())
+					continue;
+
+				Vector<int>& cell = fnd->second;
+				int idx = cell.IndexOf(itemIdx);
+				if (idx >= 0)
+				{
+					cell[idx] = cell.Last();
+					cell.PopBack();
+				}
+
+				if (cell.IsEmpty())
+					mCells.erase(fnd);
+			}
+		}
+	}
+
+	void SceneSpatialIndex::CheckItem(int itemIdx, const RectF& rect, Vector<Actor*>& result) const
+	{
+		const Item& item = mItems[itemIdx];
+		if (item.queryId == mQueryId)
+			return;
+
+		item.queryId = mQueryId;
+
+		if (item.bounds.IsIntersects(rect))
+			result.Add(item.actor);
+	}
+}
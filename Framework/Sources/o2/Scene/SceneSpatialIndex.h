@@ -0,0 +1,100 @@
+#pragma once
+
+#include "o2/Utils/Math/Rect.h"
+#include "o2/Utils/Math/Vector2.h"
+#include "o2/Utils/Types/CommonTypes.h"
+#include "o2/Utils/Types/Containers/Vector.h"
+#include <unordered_map>
+
+namespace o2
+{
+	class Actor;
+
+	// -------------------------------------------------------------------------------------------------------
+	// Spatial index of scene actors. Uniform grid of cells, each cell contains actors which world bounds
+	// intersects it. Actors with very large bounds are stored in separate list and checked on each query.
+	// Actors are addressed by item index, returned on adding; owner keeps it to update bounds without lookups
+	// -------------------------------------------------------------------------------------------------------
+	class SceneSpatialIndex
+	{
+	public:
+		// Constructor
+		SceneSpatialIndex(float cellSize = 256.0f, int maxCellsPerActor = 64);
+
+		// Adds actor with bounds. Returns item index, used as actor handle for updating and removing
+		int Add(Actor* actor, const RectF& bounds);
+
+		// Updates bounds of item
+		void Update(int itemIdx, const RectF& bounds);
+
+		// Removes item from index
+		void Remove(int itemIdx);
+
+		// Removes all items. All items indexes become invalid
+		void Clear();
+
+		// Returns actor of item, or null when item is free
+		Actor* GetActor(int itemIdx) const;
+
+		// Returns bounds of item
+		const RectF& GetBounds(int itemIdx) const;
+
+		// Returns indexed actors count
+		int GetActorsCount() const;
+
+		// Collects actors which bounds intersects rectangle
+		void QueryRect(const RectF& rect, Vector<Actor*>& result) const;
+
+		// Collects actors which bounds contains point
+		void QueryPoint(const Vec2F& point, Vector<Actor*>& result) const;
+
+		// Sets size of grid cell. Rebuilds index
+		void SetCellSize(float size);
+
+		// Returns size of grid cell
+		float GetCellSize() const;
+
+	protected:
+		// -----------------------------------
+		// Indexed actor with it's cells range
+		// -----------------------------------
+		struct Item
+		{
+			Actor* actor = nullptr;   // Indexed actor, null when item is free
+			RectF  bounds;            // World bounds of actor
+			RectI  cells;             // Range of cells, containing actor
+			bool   large = false;     // Is actor stored in large items list
+			mutable UInt queryId = 0; // Last query id, used to skip duplicates
+		};
+
+		typedef std::unordered_map<UInt64, Vector<int>> CellsMap;
+
+	protected:
+		float mCellSize;         // Size of grid cell
+		float mInvCellSize;      // Inverted size of grid cell
+		int   mMaxCellsPerActor; // Maximum cells for actor. Actors with greater cells count stored in large items list
+
+		Vector<Item> mItems;      // Indexed items
+		Vector<int>  mFreeItems;  // Free items indexes
+		CellsMap     mCells;      // Grid cells, contains items indexes
+		Vector<int>  mLargeItems; // Items with too large bounds
+
+		mutable UInt mQueryId = 0; // Current query id
+
+	protected:
+		// Returns range of cells for bounds
+		RectI GetCellsRange(const RectF& bounds) const;
+
+		// Returns cell key by cell coordinates
+		static UInt64 GetCellKey(int x, int y);
+
+		// Adds item into cells
+		void InsertItemInCells(int itemIdx);
+
+		// Removes item from cells
+		void RemoveItemFromCells(int itemIdx);
+
+		// Checks item for rectangle and adds it's actor into result
+		void CheckItem(int itemIdx, const RectF& rect, Vector<Actor*>& result) const;
+	};
+}
@@ -10,6 +10,7 @@
 #include "o2/Scene/UI/WidgetLayer.h"
 #include "o2/Scene/UI/WidgetLayout.h"
 #include "o2/Scene/UI/WidgetState.h"
+#include "o2/Utils/Debug/Profiler.h"
 
 namespace o2
 {
@@ -255,6 +256,8 @@ namespace o2
 
 	void Widget::UpdateTransform()
 	{
+		PROFILE_DETAILED_SCOPE("Widget::UpdateTransform");
+
 		if (GetLayoutData().drivenByParent && mParentWidget)
 		{
 			mParentWidget->UpdateTransform();
@@ -3,6 +3,7 @@
 
 #include "o2/Scene/UI/Widget.h"
 #include "o2/Utils/Function/Function.h"
+#include "o2/Utils/Memory/Allocators/FrameAllocator.h"
 
 namespace o2
 {
@@ -728,9 +729,9 @@ namespace o2
 
 	Vector<float> CalculateExpandedSize(Vector<Widget*>& widgets, bool horizontal, float availableWidth, float spacing)
 	{
-		Vector<float> minSizes; minSizes.Reserve(widgets.Count());
-		Vector<float> maxSizes; maxSizes.Reserve(widgets.Count());
-		Vector<float> weights; weights.Reserve(widgets.Count());
+		FrameVector<float> minSizes; minSizes.Reserve(widgets.Count());
+		FrameVector<float> maxSizes; maxSizes.Reserve(widgets.Count());
+		FrameVector<float> weights; weights.Reserve(widgets.Count());
 
 		float minSizesSum = 0;
 		float weightsSum = 0;
@@ -760,7 +761,8 @@ namespace o2
 			}
 		}
 
-	Vector<float> widths = minSizes;
+	Vector<float> widths;
+	widths.insert(widths.end(), minSizes.begin(), minSizes.end());
 
 	int childCount = widgets.Count();
 
@@ -13,6 +13,7 @@ namespace o2
 		offStateAnimationSpeed(state.offStateAnimationSpeed), state(this), animationAsset(this), animationClip(this)
 	{
 		mAnimation = state.mAnimation;
+		player.SetBakedClip(mAnimation ? &mAnimation->baked : nullptr);
 		player.SetClip(mAnimation ? &mAnimation->animation : nullptr);
 		player.relTime = mState ? 1.0f:0.0f;
 	}
@@ -40,6 +41,7 @@ namespace o2
 	void WidgetState::SetAnimationAsset(const AnimationAssetRef& asset)
 	{
 		mAnimation = asset;
+		player.SetBakedClip(mAnimation ? &mAnimation->baked : nullptr);
 		player.SetClip(mAnimation ? &mAnimation->animation : nullptr);
 	}
 
@@ -50,8 +52,14 @@ namespace o2
 
 	void WidgetState::SetAnimationClip(const AnimationClip& animation)
 	{
+		// Baked clip isn't valid for new animation
+		player.SetBakedClip(nullptr);
+
 		if (mAnimation && mAnimation.IsInstance())
+		{
 			mAnimation->animation = animation;
+			mAnimation->baked.Clear();
+		}
 		else
 		{
 			mAnimation.SetInstance(mnew AnimationAsset(animation));
@@ -141,11 +149,13 @@ namespace o2
 
 	void WidgetState::OnAnimationChanged()
 	{
+		player.SetBakedClip(mAnimation ? &mAnimation->baked : nullptr);
 		player.SetClip(mAnimation ? &mAnimation->animation : nullptr);
 	}
 
 	void WidgetState::OnDeserialized(const DataValue& node)
 	{
+		player.SetBakedClip(mAnimation ? &mAnimation->baked : nullptr);
 		player.SetClip(mAnimation ? &mAnimation->animation : nullptr);
 	}
 
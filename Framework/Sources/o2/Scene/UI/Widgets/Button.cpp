@@ -84,6 +84,14 @@ namespace o2
 		return mDrawingScissorRect.IsInside(point) && isPointInside(point);
 	}
 
+	RectF Button::GetCursorAreaBounds() const
+	{
+		if (isPointInside.IsEmpty())
+			return layout->GetWorldBasis().AABB();
+
+		return CursorAreaEventsListener::GetCursorAreaBounds();
+	}
+
 	String Button::GetCreateMenuGroup()
 	{
 		return "Basic";
@@ -59,6 +59,9 @@ namespace o2
 		// Returns true if point is in this object
 		bool IsUnderPoint(const Vec2F& point) override;
 
+		// Returns layout bounds, or unbounded rectangle when point inside function is used
+		RectF GetCursorAreaBounds() const override;
+
 		// Returns create menu group in editor
 		static String GetCreateMenuGroup();
 
@@ -135,6 +138,7 @@ CLASS_METHODS_META(o2::Button)
 	FUNCTION().PUBLIC().SIGNATURE(Sprite*, GetIcon);
 	FUNCTION().PUBLIC().SIGNATURE(bool, IsFocusable);
 	FUNCTION().PUBLIC().SIGNATURE(bool, IsUnderPoint, const Vec2F&);
+	FUNCTION().PUBLIC().SIGNATURE(RectF, GetCursorAreaBounds);
 	FUNCTION().PUBLIC().SIGNATURE_STATIC(String, GetCreateMenuGroup);
 	FUNCTION().PROTECTED().SIGNATURE(void, OnCursorPressed, const Input::Cursor&);
 	FUNCTION().PROTECTED().SIGNATURE(void, OnCursorReleased, const Input::Cursor&);
@@ -725,6 +725,11 @@ namespace o2
 		return mDrawingScissorRect.IsInside(point) && mAbsoluteViewArea.IsInside(point);
 	}
 
+	RectF EditBox::GetCursorAreaBounds() const
+	{
+		return mAbsoluteViewArea;
+	}
+
 	bool EditBox::IsInputTransparent() const
 	{
 		return false;
@@ -147,6 +147,9 @@ namespace o2
 		// Returns true if point is under drawable
 		bool IsUnderPoint(const Vec2F& point) override;
 
+		// Returns view area bounds
+		RectF GetCursorAreaBounds() const override;
+
 		// Returns true when input events can be handled by down listeners, always returns false
 		bool IsInputTransparent() const override;
 
@@ -364,6 +367,7 @@ CLASS_METHODS_META(o2::EditBox)
 	FUNCTION().PUBLIC().SIGNATURE(bool, IsScrollable);
 	FUNCTION().PUBLIC().SIGNATURE(bool, IsFocusable);
 	FUNCTION().PUBLIC().SIGNATURE(bool, IsUnderPoint, const Vec2F&);
+	FUNCTION().PUBLIC().SIGNATURE(RectF, GetCursorAreaBounds);
 	FUNCTION().PUBLIC().SIGNATURE(bool, IsInputTransparent);
 	FUNCTION().PUBLIC().SIGNATURE_STATIC(String, GetCreateMenuGroup);
 	FUNCTION().PROTECTED().SIGNATURE(void, UpdateTransparency);
@@ -95,6 +95,11 @@ namespace o2
 		return Widget::IsUnderPoint(point);
 	}
 
+	RectF TreeNode::GetCursorAreaBounds() const
+	{
+		return layout->GetWorldBasis().AABB();
+	}
+
 	void TreeNode::SetSelectedState(bool state)
 	{
 		if (!mSelectedState)
@@ -529,6 +529,9 @@ namespace o2
 		// Returns true if point is in this object
 		bool IsUnderPoint(const Vec2F& point) override;
 
+		// Returns layout bounds
+		RectF GetCursorAreaBounds() const override;
+
 		// Sets selected state
 		void SetSelectedState(bool state);
 
@@ -794,6 +797,7 @@ CLASS_METHODS_META(o2::TreeNode)
 	FUNCTION().PUBLIC().SIGNATURE(void, Collapse, bool);
 	FUNCTION().PUBLIC().SIGNATURE(void*, GetObject);
 	FUNCTION().PUBLIC().SIGNATURE(bool, IsUnderPoint, const Vec2F&);
+	FUNCTION().PUBLIC().SIGNATURE(RectF, GetCursorAreaBounds);
 	FUNCTION().PUBLIC().SIGNATURE(void, SetSelectedState, bool);
 	FUNCTION().PUBLIC().SIGNATURE(void, SetFocusedState, bool);
 	FUNCTION().PUBLIC().SIGNATURE_STATIC(String, GetCreateMenuGroup);
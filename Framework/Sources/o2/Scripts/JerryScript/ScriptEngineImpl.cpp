@@ -6,6 +6,7 @@
 #include "jerryscript/jerry-port/default/include/jerryscript-port-default.h"
 #include "o2/Scripts/ScriptEngine.h"
 #include "o2/Utils/Debug/Log/LogStream.h"
+#include "o2/Utils/Debug/Profiler.h"
 
 namespace o2
 {
@@ -83,6 +84,8 @@ namespace o2
 
 	ScriptParseResult ScriptEngine::Parse(const String& script, const String& filename /*= ""*/)
 	{
+		PROFILE_SCOPE("ScriptEngine::Parse");
+
 		ScriptParseResult res;
 		res.mParsedCode = jerry_parse((jerry_char_t*)filename.Data(), filename.Length(),
 									  (jerry_char_t*)script.Data(), script.Length(), JERRY_PARSE_NO_OPTS);
@@ -92,6 +95,8 @@ namespace o2
 
 	ScriptValue ScriptEngine::Run(const ScriptParseResult& parseResult)
 	{
+		PROFILE_SCOPE("ScriptEngine::Run");
+
 		ScriptValue res;
 		res.Accept(jerry_run(parseResult.mParsedCode));
 		return res;
@@ -2,6 +2,7 @@
 
 #if defined(SCRIPTING_BACKEND_JERRYSCRIPT)
 #include "o2/Utils/Reflection/Type.h"
+#include "o2/Utils/Types/Containers/SmallVector.h"
 
 namespace o2
 {
@@ -452,6 +453,30 @@ namespace o2
 		}
 	};
 
+	template<typename T, int _capacity>
+	struct ScriptValue::Converter<SmallVector<T, _capacity>>
+	{
+		static constexpr bool isSupported = true;
+
+		static void Write(const SmallVector<T, _capacity>& value, ScriptValue& data)
+		{
+			data.jvalue = jerry_create_array(0);
+
+			for (auto& v : value)
+				data.AddElement(ScriptValue(v));
+		}
+
+		static void Read(SmallVector<T, _capacity>& value, const ScriptValue& data)
+		{
+			if (data.GetValueType() == ValueType::Array)
+			{
+				value.Clear();
+				for (int i = 0; i < data.GetLength(); i++)
+					value.Add(data[i].GetValue<T>());
+			}
+		}
+	};
+
 	template<typename _key, typename _value>
 	struct ScriptValue::Converter<Map<_key, _value>>
 	{
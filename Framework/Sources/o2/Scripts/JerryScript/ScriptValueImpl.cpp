@@ -2,6 +2,7 @@
 
 #if defined(SCRIPTING_BACKEND_JERRYSCRIPT)
 #include "o2/Scripts/ScriptValue.h"
+#include "o2/Utils/Debug/Profiler.h"
 
 namespace o2
 {
@@ -384,6 +385,8 @@ namespace o2
 	{
 		if (IsFunction())
 		{
+			PROFILE_SCOPE("ScriptValue::Invoke");
+
 			const int maxParameters = 16;
 			jerry_value_t valuesBuf[maxParameters];
 			for (int i = 0; i < args.Count() && i < maxParameters; i++)
@@ -152,21 +152,19 @@ namespace o2
 		int curbpp = bpp[(int)mFormat];
 		int pixelSize = curbpp;
 
-		for (int x = 0; x < imgSrcRect.right - imgSrcRect.left; x++)
-		{
-			if (x + position.x >= mSize.x)
-				break;
+		// Rows are continuous in both bitmaps, so they are copied entirely
+		int width = Math::Min(imgSrcRect.right - imgSrcRect.left, mSize.x - position.x);
+		int height = Math::Min(imgSrcRect.top - imgSrcRect.bottom, mSize.y - position.y);
 
-			for (int y = 0; y < imgSrcRect.top - imgSrcRect.bottom; y++)
-			{
-				if (y + position.y >= mSize.y)
-					break;
+		if (width <= 0)
+			return;
 
-				UInt srcIdx = (img->mSize.y - (y + imgSrcRect.bottom) - 1)*img->mSize.x + x + imgSrcRect.left;
-				UInt dstIdx = (mSize.y - 1 - (y + position.y))*mSize.x + x + position.x;
+		for (int y = 0; y < height; y++)
+		{
+			UInt srcIdx = (img->mSize.y - (y + imgSrcRect.bottom) - 1)*img->mSize.x + imgSrcRect.left;
+			UInt dstIdx = (mSize.y - 1 - (y + position.y))*mSize.x + position.x;
 
-                *(int*)&mData[dstIdx*pixelSize] = *(int*)&img->mData[srcIdx*pixelSize];
-			}
+			memcpy(&mData[dstIdx*pixelSize], &img->mData[srcIdx*pixelSize], width*pixelSize);
 		}
 	}
 
@@ -0,0 +1,301 @@
+#include "o2/stdafx.h"
+#include "Profiler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <stdio.h>
+#include <string>
+
+#include "o2/Utils/FileSystem/File.h"
+
+namespace o2
+{
+	DECLARE_SINGLETON(Profiler);
+
+	// ------------------------------------------------------------------------------------
+	// Holder of current thread profiler buffer. Returns buffer to profiler when thread ends
+	// ------------------------------------------------------------------------------------
+	struct ProfilerThreadBufferHolder
+	{
+		Profiler::ThreadBuffer* buffer = nullptr; // Current thread buffer
+
+		// Destructor. Returns buffer to profiler
+		~ProfilerThreadBufferHolder()
+		{
+			if (buffer && Profiler::IsSingletonInitialzed())
+				o2Profiler.OnThreadFinished(buffer);
+		}
+	};
+
+	static thread_local ProfilerThreadBufferHolder currentThreadBuffer;
+
+	Profiler::Profiler():
+		mEnabled(false)
+	{
+		mStartTime = GetSystemTime();
+	}
+
+	Profiler::~Profiler()
+	{
+		for (auto buffer : mThreads)
+			delete buffer;
+	}
+
+	void Profiler::SetEnabled(bool enabled)
+	{
+		mEnabled = enabled;
+	}
+
+	bool Profiler::IsEnabled() const
+	{
+		return mEnabled;
+	}
+
+	void Profiler::SetCurrentThreadName(const String& name)
+	{
+		auto buffer = GetCurrentThreadBuffer();
+
+		std::lock_guard<std::mutex> lock(mThreadsMutex);
+		buffer->name = name;
+	}
+
+	void Profiler::BeginFrame()
+	{
+		Frame& frame = mFrames[mFramesCount%framesBufferSize];
+		frame.index = mFramesCount;
+		frame.begin = GetTime();
+		frame.end = 0;
+
+		mFramesCount++;
+		mFramesThreadId = GetCurrentThreadBuffer()->id;
+	}
+
+	void Profiler::EndFrame()
+	{
+		if (mFramesCount > 0)
+			mFrames[(mFramesCount - 1)%framesBufferSize].end = GetTime();
+	}
+
+	Vector<Profiler::Frame> Profiler::GetFrames() const
+	{
+		Vector<Frame> res;
+
+		UInt64 first = mFramesCount > framesBufferSize ? mFramesCount - framesBufferSize : 0;
+		res.Reserve((int)(mFramesCount - first));
+
+		for (UInt64 i = first; i < mFramesCount; i++)
+		{
+			const Frame& frame = mFrames[i%framesBufferSize];
+			if (frame.end != 0)
+				res.Add(frame);
+		}
+
+		return res;
+	}
+
+	Vector<Profiler::Zone> Profiler::GetZones(UInt64 begin, UInt64 end) const
+	{
+		Vector<Zone> res;
+
+		std::lock_guard<std::mutex> lock(mThreadsMutex);
+		for (auto buffer : mThreads)
+			CollectZones(buffer, begin, end, res);
+
+		return res;
+	}
+
+	Vector<Profiler::ThreadInfo> Profiler::GetThreads() const
+	{
+		Vector<ThreadInfo> res;
+
+		std::lock_guard<std::mutex> lock(mThreadsMutex);
+		for (auto buffer : mThreads)
+		{
+			ThreadInfo info;
+			info.id = buffer->id;
+			info.name = buffer->name;
+			res.Add(info);
+		}
+
+		return res;
+	}
+
+	bool Profiler::SaveChromeTrace(const String& path, int framesCount /*= 0*/) const
+	{
+		Vector<Frame> frames = GetFrames();
+		if (framesCount > 0 && frames.Count() > framesCount)
+			frames.RemoveRange(0, frames.Count() - framesCount);
+
+		Vector<Zone> zones;
+		if (!frames.IsEmpty())
+			zones = GetZones(frames[0].begin, frames.Last().end);
+
+		std::string json;
+		json.reserve(256 + (frames.Count() + zones.Count())*100);
+		json += "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+
+		char buffer[512];
+		bool first = true;
+
+		auto addEvent = [&](int length) {
+			if (!first)
+				json += ",\n";
+
+			json.append(buffer, Math::Min(length, (int)sizeof(buffer) - 1));
+			first = false;
+		};
+
+		for (auto& thread : GetThreads())
+		{
+			std::string name = thread.name.Data();
+			for (auto& c : name)
+			{
+				if (c == '"' || c == '\\')
+					c = '\'';
+			}
+
+			addEvent(snprintf(buffer, sizeof(buffer),
+							  "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%i,\"args\":{\"name\":\"%s\"}}",
+							  thread.id, name.c_str()));
+		}
+
+		// Frames are written as zones of main thread, they contain main thread zones
+		for (auto& frame : frames)
+		{
+			addEvent(snprintf(buffer, sizeof(buffer),
+							  "{\"name\":\"Frame %llu\",\"cat\":\"frame\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%i}",
+							  frame.index, frame.begin/1000.0, (frame.end - frame.begin)/1000.0, mFramesThreadId));
+		}
+
+		for (auto& zone : zones)
+		{
+			std::string name = zone.name;
+			for (auto& c : name)
+			{
+				if (c == '"' || c == '\\')
+					c = '\'';
+			}
+
+			addEvent(snprintf(buffer, sizeof(buffer),
+							  "{\"name\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%i}",
+							  name.c_str(), zone.begin/1000.0, (zone.end - zone.begin)/1000.0, zone.threadId));
+		}
+
+		json += "\n]}\n";
+
+		OutFile file(path);
+		if (!file.IsOpened())
+			return false;
+
+		file.WriteData(json.data(), (UInt)json.size());
+		return true;
+	}
+
+	UInt64 Profiler::GetTime() const
+	{
+		return GetSystemTime() - mStartTime;
+	}
+
+	UInt64 Profiler::BeginZone()
+	{
+		ThreadBuffer* buffer = GetCurrentThreadBuffer();
+		buffer->depth++;
+
+		return GetTime();
+	}
+
+	void Profiler::EndZone(const char* name, UInt64 begin)
+	{
+		UInt64 end = GetTime();
+
+		ThreadBuffer* buffer = GetCurrentThreadBuffer();
+		buffer->depth--;
+
+		UInt64 writeIndex = buffer->writesCount.load(std::memory_order_relaxed);
+		Zone& zone = buffer->zones[writeIndex & (zonesBufferSize - 1)];
+		zone.name = name;
+		zone.begin = begin;
+		zone.end = end;
+		zone.depth = buffer->depth;
+		zone.threadId = buffer->id;
+
+		buffer->writesCount.store(writeIndex + 1, std::memory_order_release);
+	}
+
+	Profiler::ThreadBuffer* Profiler::GetCurrentThreadBuffer()
+	{
+		if (!currentThreadBuffer.buffer)
+		{
+			std::lock_guard<std::mutex> lock(mThreadsMutex);
+
+			ThreadBuffer* buffer = nullptr;
+			if (!mFreeBuffers.IsEmpty())
+			{
+				buffer = mFreeBuffers.PopBack();
+				buffer->depth = 0;
+			}
+			else
+			{
+				buffer = mnew ThreadBuffer();
+				buffer->id = mThreads.Count();
+				mThreads.Add(buffer);
+			}
+
+			buffer->name = "Thread " + (String)buffer->id;
+			currentThreadBuffer.buffer = buffer;
+		}
+
+		return currentThreadBuffer.buffer;
+	}
+
+	void Profiler::OnThreadFinished(ThreadBuffer* buffer)
+	{
+		std::lock_guard<std::mutex> lock(mThreadsMutex);
+		mFreeBuffers.Add(buffer);
+	}
+
+	void Profiler::CollectZones(const ThreadBuffer* buffer, UInt64 begin, UInt64 end, Vector<Zone>& zones)
+	{
+		// Zones, that could be rewritten by owner thread while copying, are skipped. Zones are written in order of
+		// their ends, so iteration goes from the newest zone and stops when zones end before range
+		UInt64 writesCount = buffer->writesCount.load(std::memory_order_acquire);
+		UInt64 guard = 64;
+		UInt64 available = Math::Min(writesCount, (UInt64)zonesBufferSize - guard);
+
+		int firstZone = zones.Count();
+		for (UInt64 i = 0; i < available; i++)
+		{
+			const Zone& zone = buffer->zones[(writesCount - 1 - i) & (zonesBufferSize - 1)];
+			if (zone.end < begin)
+				break;
+
+			if (zone.begin <= end)
+				zones.Add(zone);
+		}
+
+		UInt64 writesCountAfter = buffer->writesCount.load(std::memory_order_acquire);
+		if (writesCountAfter - writesCount > guard)
+			zones.RemoveRange(firstZone, zones.Count());
+
+		std::reverse(zones.begin() + firstZone, zones.end());
+	}
+
+	UInt64 Profiler::GetSystemTime()
+	{
+		return (UInt64)std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	ProfilerZone::ProfilerZone(const char* name):
+		mName(name), mRecording(Profiler::IsSingletonInitialzed() && o2Profiler.IsEnabled())
+	{
+		if (mRecording)
+			mBegin = o2Profiler.BeginZone();
+	}
+
+	ProfilerZone::~ProfilerZone()
+	{
+		if (mRecording)
+			o2Profiler.EndZone(mName, mBegin);
+	}
+}
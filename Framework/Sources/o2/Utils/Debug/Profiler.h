@@ -0,0 +1,190 @@
+#pragma once
+
+#include "o2/Utils/Singleton.h"
+#include "o2/Utils/Types/CommonTypes.h"
+#include "o2/Utils/Types/Containers/Vector.h"
+#include "o2/Utils/Types/String.h"
+#include <atomic>
+#include <mutex>
+
+// Profiler access macros
+#define o2Profiler o2::Profiler::Instance()
+
+#define PROFILER_ZONE_NAME_CONCAT_IMPL(A, B) A##B
+#define PROFILER_ZONE_NAME_CONCAT(A, B) PROFILER_ZONE_NAME_CONCAT_IMPL(A, B)
+
+#if IS_PROFILER_ENABLED
+// Profiles code from macro to the end of scope. Name must be static string
+#define PROFILE_SCOPE(NAME) o2::ProfilerZone PROFILER_ZONE_NAME_CONCAT(__profilerZone, __LINE__)(NAME)
+
+// Profiles function from macro to the end of function
+#define PROFILE_FUNCTION() PROFILE_SCOPE(__FUNCTION__)
+#else
+#define PROFILE_SCOPE(NAME)
+#define PROFILE_FUNCTION()
+#endif
+
+#if IS_PROFILER_ENABLED && IS_DETAILED_PROFILER_ENABLED
+// Profiles frequently called code, like per widget or per actor functions. Compiled only with detailed profiling
+#define PROFILE_DETAILED_SCOPE(NAME) PROFILE_SCOPE(NAME)
+#else
+#define PROFILE_DETAILED_SCOPE(NAME)
+#endif
+
+namespace o2
+{
+	// -------------------------------------------------------------------------------------------------------
+	// Frame CPU profiler. Collects scoped zones into thread local ring buffers: writing zone is a few stores
+	// into own thread buffer without locks, old zones are overwritten. Zones are grouped by frames, marked by
+	// BeginFrame() and EndFrame() from main thread. Zones can be read for timeline or saved as Chrome trace
+	// events JSON, which opens in chrome://tracing and Perfetto. Times are in nanoseconds from profiler start.
+	// Created by application, disabled by default
+	// -------------------------------------------------------------------------------------------------------
+	class Profiler: public Singleton<Profiler>
+	{
+	public:
+		// -------------
+		// Profiled zone
+		// -------------
+		struct Zone
+		{
+			const char* name = nullptr; // Zone name, static string
+			UInt64      begin = 0;      // Zone begin time
+			UInt64      end = 0;        // Zone end time
+			int         depth = 0;      // Depth of zone in thread zones stack
+			int         threadId = 0;   // Index of thread in profiler
+		};
+
+		// --------------
+		// Profiled frame
+		// --------------
+		struct Frame
+		{
+			UInt64 index = 0; // Frame index
+			UInt64 begin = 0; // Frame begin time
+			UInt64 end = 0;   // Frame end time
+		};
+
+		// ---------------------------------
+		// Information about profiled thread
+		// ---------------------------------
+		struct ThreadInfo
+		{
+			int    id = 0; // Index of thread in profiler
+			String name;   // Thread name
+		};
+
+	public:
+		// Destructor. Releases threads buffers
+		~Profiler();
+
+		// Sets profiling enabled. When disabled, zones aren't recorded
+		void SetEnabled(bool enabled);
+
+		// Returns is profiling enabled
+		bool IsEnabled() const;
+
+		// Sets current thread name, used in timeline and trace
+		void SetCurrentThreadName(const String& name);
+
+		// Begins frame. Called from main thread at the beginning of frame
+		void BeginFrame();
+
+		// Ends frame. Called from main thread at the end of frame
+		void EndFrame();
+
+		// Returns last recorded frames, from old to new
+		Vector<Frame> GetFrames() const;
+
+		// Returns recorded zones of all threads, intersecting time range
+		Vector<Zone> GetZones(UInt64 begin, UInt64 end) const;
+
+		// Returns profiled threads
+		Vector<ThreadInfo> GetThreads() const;
+
+		// Saves recorded zones of last frames into Chrome trace events JSON file. Saves all recorded frames when
+		// frames count is zero. Returns false when file can't be written
+		bool SaveChromeTrace(const String& path, int framesCount = 0) const;
+
+		// Returns current time in nanoseconds from profiler start
+		UInt64 GetTime() const;
+
+		// Begins zone in current thread. Returns zone begin time
+		UInt64 BeginZone();
+
+		// Ends zone in current thread, started at begin time
+		void EndZone(const char* name, UInt64 begin);
+
+	protected:
+		static const int zonesBufferSize = 1 << 16; // Size of thread zones ring buffer, power of two
+		static const int framesBufferSize = 512;    // Size of frames ring buffer
+
+		// ----------------------------------------------------------------------------------------------
+		// Thread zones ring buffer. Written only by owner thread; writes counter is increased after zone
+		// is written, so readers skip zones, that could be overwritten while reading
+		// ----------------------------------------------------------------------------------------------
+		struct ThreadBuffer
+		{
+			int    id = 0;    // Index of thread in profiler
+			String name;      // Thread name
+			int    depth = 0; // Current zones stack depth
+
+			std::atomic<UInt64> writesCount;            // Count of written zones
+			Zone                zones[zonesBufferSize]; // Zones ring buffer
+
+			// Constructor
+			ThreadBuffer(): writesCount(0) {}
+		};
+
+	protected:
+		std::atomic<bool> mEnabled; // Is profiling enabled
+
+		UInt64 mStartTime = 0; // Profiler start time, in steady clock nanoseconds
+
+		mutable std::mutex    mThreadsMutex; // Threads buffers list mutex
+		Vector<ThreadBuffer*> mThreads;      // Threads buffers
+		Vector<ThreadBuffer*> mFreeBuffers;  // Buffers of finished threads, reused by new threads
+
+		Frame  mFrames[framesBufferSize]; // Frames ring buffer
+		UInt64 mFramesCount = 0;          // Count of begun frames
+		int    mFramesThreadId = 0;       // Index of thread, that marks frames
+
+	protected:
+		// Constructor. Profiler is created by application
+		Profiler();
+
+		// Returns buffer of current thread, creates it when required
+		ThreadBuffer* GetCurrentThreadBuffer();
+
+		// Called when thread is finished, puts thread buffer to free buffers
+		void OnThreadFinished(ThreadBuffer* buffer);
+
+		// Copies zones of thread buffer, intersecting time range
+		static void CollectZones(const ThreadBuffer* buffer, UInt64 begin, UInt64 end, Vector<Zone>& zones);
+
+		// Returns system steady clock time in nanoseconds
+		static UInt64 GetSystemTime();
+
+		friend class Application;
+		friend struct ProfilerThreadBufferHolder;
+	};
+
+	// -------------------------------------------------------------------------------
+	// Scoped profiler zone. Records zone from construction to destruction. Use it via
+	// PROFILE_SCOPE or PROFILE_FUNCTION macros
+	// -------------------------------------------------------------------------------
+	class ProfilerZone
+	{
+	public:
+		// Constructor. Begins zone with static name
+		ProfilerZone(const char* name);
+
+		// Destructor. Ends zone
+		~ProfilerZone();
+
+	protected:
+		const char* mName;      // Zone name
+		UInt64      mBegin = 0; // Zone begin time
+		bool        mRecording; // Is zone recording, false when profiler was disabled at zone begin
+	};
+}
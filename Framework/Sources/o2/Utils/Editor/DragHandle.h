@@ -72,6 +72,9 @@ namespace o2
 		// Returns true if point is above this
 		bool IsUnderPoint(const Vec2F& point) override;
 
+		// Returns regular drawable bounds, or unbounded rectangle when point inside function is used
+		RectF GetCursorAreaBounds() const override;
+
 		// Sets position
 		void SetPosition(const Vec2F& position);
 
@@ -501,6 +504,7 @@ CLASS_METHODS_META(o2::DragHandle)
 	FUNCTION().PUBLIC().SIGNATURE(void, Draw);
 	FUNCTION().PUBLIC().SIGNATURE(void, Draw, const RectF&);
 	FUNCTION().PUBLIC().SIGNATURE(bool, IsUnderPoint, const Vec2F&);
+	FUNCTION().PUBLIC().SIGNATURE(RectF, GetCursorAreaBounds);
 	FUNCTION().PUBLIC().SIGNATURE(void, SetPosition, const Vec2F&);
 	FUNCTION().PUBLIC().SIGNATURE(const Vec2F&, GetScreenPosition);
 	FUNCTION().PUBLIC().SIGNATURE(void, UpdateScreenPosition);
@@ -6,6 +6,10 @@
 
 #include "Utils/Reflection/Reflection.h"
 #include "Utils/FileSystem/FileSystem.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 namespace o2
 {
@@ -147,6 +151,82 @@ namespace o2
     {
         mOfstream.write((const char*)dataPtr, bytes);
     }
+
+    bool MappedFile::Open(const String& filename)
+    {
+        Close();
+
+        if (filename.StartsWith(GetAndroidAssetsPath()))
+        {
+            String assetsPath = filename.SubStr(((String)GetAndroidAssetsPath()).Length());
+            mAsset = AAssetManager_open(o2FileSystem.GetAssetManager(), assetsPath, AASSET_MODE_BUFFER);
+
+            if (!mAsset)
+                return false;
+
+            mDataSize = (UInt)AAsset_getLength(mAsset);
+            mData = (const char*)AAsset_getBuffer(mAsset);
+
+            // Compressed assets can't be mapped, their data is read into own buffer
+            if (!mData)
+            {
+                char* buffer = mnew char[mDataSize];
+                AAsset_read(mAsset, buffer, mDataSize);
+
+                mData = buffer;
+                mOwnsData = true;
+            }
+        }
+        else
+        {
+            int file = open(filename.Data(), O_RDONLY);
+            if (file < 0)
+                return false;
+
+            struct stat fileStat;
+            if (fstat(file, &fileStat) != 0 || fileStat.st_size == 0)
+            {
+                close(file);
+                return false;
+            }
+
+            void* data = mmap(nullptr, (size_t)fileStat.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+            close(file);
+
+            if (data == MAP_FAILED)
+                return false;
+
+            mData = (const char*)data;
+            mDataSize = (UInt)fileStat.st_size;
+        }
+
+        mOpened = true;
+        mFilename = filename;
+
+        return true;
+    }
+
+    bool MappedFile::Close()
+    {
+        if (mOpened)
+        {
+            if (mOwnsData)
+                delete[] mData;
+
+            if (mAsset)
+                AAsset_close(mAsset);
+            else if (!mOwnsData)
+                munmap(const_cast<char*>(mData), mDataSize);
+
+            mData = nullptr;
+            mDataSize = 0;
+            mAsset = nullptr;
+            mOwnsData = false;
+            mOpened = false;
+        }
+
+        return true;
+    }
 }
 
 #endif
@@ -56,4 +56,37 @@ namespace o2
 		return mOpened;
 	}
 
+	MappedFile::MappedFile()
+	{}
+
+	MappedFile::MappedFile(const String& filename)
+	{
+		Open(filename);
+	}
+
+	MappedFile::~MappedFile()
+	{
+		Close();
+	}
+
+	const char* MappedFile::GetData() const
+	{
+		return mData;
+	}
+
+	UInt MappedFile::GetDataSize() const
+	{
+		return mDataSize;
+	}
+
+	bool MappedFile::IsOpened() const
+	{
+		return mOpened;
+	}
+
+	const String& MappedFile::GetFilename() const
+	{
+		return mFilename;
+	}
+
 }
@@ -100,4 +100,53 @@ namespace o2
 		String        mFilename; // File name
 		bool          mOpened;   // True, if file was opened
 	};
+
+	// ---------------------------------------------------------------------------------------------------
+	// Read-only memory mapped file. File data is accessible by pointer without reading and copying, pages
+	// are loaded by system on access. Data is valid until file is closed
+	// ---------------------------------------------------------------------------------------------------
+	class MappedFile
+	{
+	public:
+		// Default constructor
+		MappedFile();
+
+		// Constructor with opening file
+		MappedFile(const String& filename);
+
+		// Destructor. Closes file
+		~MappedFile();
+
+		// Opens and maps file
+		bool Open(const String& filename);
+
+		// Unmaps and closes file
+		bool Close();
+
+		// Returns mapped data
+		const char* GetData() const;
+
+		// Returns size of mapped data
+		UInt GetDataSize() const;
+
+		// Returns true, if file was opened
+		bool IsOpened() const;
+
+		// Returns file name
+		const String& GetFilename() const;
+
+	private:
+		const char* mData = nullptr; // Mapped file data
+		UInt        mDataSize = 0;   // Size of data
+		String      mFilename;       // File name
+		bool        mOpened = false; // True, if file was opened
+
+#if defined PLATFORM_WINDOWS
+		void* mFileHandle = nullptr;    // File handle
+		void* mMappingHandle = nullptr; // File mapping handle
+#elif defined PLATFORM_ANDROID
+		AAsset* mAsset = nullptr;       // Asset, when file is in application assets
+		bool    mOwnsData = false;      // Is data copied from compressed asset and owned by file
+#endif
+	};
 }
@@ -5,6 +5,10 @@
 #include "o2/Utils/FileSystem/File.h"
 #include "o2/Utils/Reflection/Reflection.h"
 #include "o2/Utils/FileSystem/FileSystem.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 namespace o2
 {
@@ -106,6 +110,49 @@ namespace o2
     {
         mOfstream.write((const char*)dataPtr, bytes);
     }
+
+    bool MappedFile::Open(const String& filename)
+    {
+        Close();
+
+        int file = open((o2FileSystem.GetBundlePath() + filename).Data(), O_RDONLY);
+        if (file < 0)
+            return false;
+
+        struct stat fileStat;
+        if (fstat(file, &fileStat) != 0 || fileStat.st_size == 0)
+        {
+            close(file);
+            return false;
+        }
+
+        void* data = mmap(nullptr, (size_t)fileStat.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+        close(file);
+
+        if (data == MAP_FAILED)
+            return false;
+
+        mData = (const char*)data;
+        mDataSize = (UInt)fileStat.st_size;
+        mOpened = true;
+        mFilename = filename;
+
+        return true;
+    }
+
+    bool MappedFile::Close()
+    {
+        if (mOpened)
+        {
+            munmap(const_cast<char*>(mData), mDataSize);
+
+            mData = nullptr;
+            mDataSize = 0;
+            mOpened = false;
+        }
+
+        return true;
+    }
 }
 
 #endif
@@ -2,6 +2,7 @@
 
 #ifdef PLATFORM_WINDOWS
 
+#include <Windows.h>
 #include "o2/Utils/FileSystem/File.h"
 #include "o2/Utils/Reflection/Reflection.h"
 
@@ -105,6 +106,67 @@ namespace o2
     {
         mOfstream.write((const char*)dataPtr, bytes);
     }
+
+    bool MappedFile::Open(const String& filename)
+    {
+        Close();
+
+        // Mapped data can live while file is deleted, deletion is finished when mapping is closed
+        HANDLE file = CreateFileA(filename.Data(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, NULL,
+                                  OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+
+        if (file == INVALID_HANDLE_VALUE)
+            return false;
+
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+        {
+            CloseHandle(file);
+            return false;
+        }
+
+        HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (!mapping)
+        {
+            CloseHandle(file);
+            return false;
+        }
+
+        void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (!data)
+        {
+            CloseHandle(mapping);
+            CloseHandle(file);
+            return false;
+        }
+
+        mFileHandle = file;
+        mMappingHandle = mapping;
+        mData = (const char*)data;
+        mDataSize = (UInt)size.QuadPart;
+        mOpened = true;
+        mFilename = filename;
+
+        return true;
+    }
+
+    bool MappedFile::Close()
+    {
+        if (mOpened)
+        {
+            UnmapViewOfFile(mData);
+            CloseHandle(mMappingHandle);
+            CloseHandle(mFileHandle);
+
+            mData = nullptr;
+            mDataSize = 0;
+            mFileHandle = nullptr;
+            mMappingHandle = nullptr;
+            mOpened = false;
+        }
+
+        return true;
+    }
 }
 
 #endif
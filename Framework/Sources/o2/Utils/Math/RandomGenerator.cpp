@@ -0,0 +1,46 @@
+#include "o2/stdafx.h"
+#include "RandomGenerator.h"
+
+namespace o2
+{
+	RandomGenerator::RandomGenerator(UInt seed /*= 1*/)
+	{
+		SetSeed(seed);
+	}
+
+	void RandomGenerator::SetSeed(UInt seed)
+	{
+		// Seed is mixed, so close seeds give different sequences. Zero state is replaced, xorshift stays zero on it
+		seed ^= seed >> 16;
+		seed *= 0x7feb352dU;
+		seed ^= seed >> 15;
+		seed *= 0x846ca68bU;
+		seed ^= seed >> 16;
+
+		mState = seed != 0 ? seed : 0x9e3779b9U;
+	}
+
+	UInt RandomGenerator::Next()
+	{
+		mState ^= mState << 13;
+		mState ^= mState >> 17;
+		mState ^= mState << 5;
+
+		return mState;
+	}
+
+	float RandomGenerator::Next01()
+	{
+		return (float)(Next() >> 8)/(float)(1 << 24);
+	}
+
+	float RandomGenerator::Range(float minValue, float maxValue)
+	{
+		return minValue + (maxValue - minValue)*Next01();
+	}
+
+	int RandomGenerator::Range(int minValue, int maxValue)
+	{
+		return minValue + (int)((float)(maxValue - minValue)*Next01());
+	}
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "o2/Utils/Types/CommonTypes.h"
+
+namespace o2
+{
+	// ----------------------------------------------------------------------------------------------------------
+	// Deterministic pseudo random numbers generator (xorshift). Keeps own state, so sequences of different
+	// generators don't depend on each other and on threads, where they are used. Same seed gives same sequence
+	// ----------------------------------------------------------------------------------------------------------
+	class RandomGenerator
+	{
+	public:
+		// Constructor with seed
+		RandomGenerator(UInt seed = 1);
+
+		// Sets seed and restarts sequence
+		void SetSeed(UInt seed);
+
+		// Returns next random value
+		UInt Next();
+
+		// Returns next random value in range 0...1
+		float Next01();
+
+		// Returns next random value in range from minValue to maxValue
+		float Range(float minValue, float maxValue);
+
+		// Returns next random value in range from minValue to maxValue
+		int Range(int minValue, int maxValue);
+
+	protected:
+		UInt mState; // Generator state, never zero
+	};
+}
@@ -0,0 +1,100 @@
+#pragma once
+#include "o2/Utils/Memory/Allocators/DefaultAllocator.h"
+#include "o2/Utils/Memory/Allocators/IAllocator.h"
+#include <cstddef>
+
+namespace o2
+{
+	// -------------------------------------------------------------------------------------------------
+	// Standard containers allocator, that allocates memory from IAllocator. Used as allocator type of
+	// containers, for example Vector<int, AllocatorAdapter<int>>. Default allocator is DefaultAllocator
+	// -------------------------------------------------------------------------------------------------
+	template<typename _type>
+	class AllocatorAdapter
+	{
+	public:
+		typedef _type value_type;
+
+		template<typename _other_type>
+		struct rebind { typedef AllocatorAdapter<_other_type> other; };
+
+	public:
+		// Default constructor, uses default allocator
+		AllocatorAdapter();
+
+		// Constructor with allocator
+		AllocatorAdapter(IAllocator* allocator);
+
+		// Copy-constructor from adapter of other type
+		template<typename _other_type>
+		AllocatorAdapter(const AllocatorAdapter<_other_type>& other);
+
+		// Allocates memory for count of elements
+		_type* allocate(size_t count);
+
+		// Deallocates elements memory
+		void deallocate(_type* ptr, size_t count);
+
+		// Returns used allocator
+		IAllocator* GetAllocator() const;
+
+		// Equal operator
+		template<typename _other_type>
+		bool operator==(const AllocatorAdapter<_other_type>& other) const;
+
+		// Not equal operator
+		template<typename _other_type>
+		bool operator!=(const AllocatorAdapter<_other_type>& other) const;
+
+	protected:
+		IAllocator* mAllocator; // Allocator of memory
+	};
+
+	template<typename _type>
+	AllocatorAdapter<_type>::AllocatorAdapter():
+		mAllocator(DefaultAllocator::GetInstance())
+	{}
+
+	template<typename _type>
+	AllocatorAdapter<_type>::AllocatorAdapter(IAllocator* allocator):
+		mAllocator(allocator)
+	{}
+
+	template<typename _type>
+	template<typename _other_type>
+	AllocatorAdapter<_type>::AllocatorAdapter(const AllocatorAdapter<_other_type>& other):
+		mAllocator(other.GetAllocator())
+	{}
+
+	template<typename _type>
+	_type* AllocatorAdapter<_type>::allocate(size_t count)
+	{
+		return (_type*)mAllocator->Allocate(sizeof(_type)*count);
+	}
+
+	template<typename _type>
+	void AllocatorAdapter<_type>::deallocate(_type* ptr, size_t count)
+	{
+		mAllocator->Deallocate(ptr);
+	}
+
+	template<typename _type>
+	IAllocator* AllocatorAdapter<_type>::GetAllocator() const
+	{
+		return mAllocator;
+	}
+
+	template<typename _type>
+	template<typename _other_type>
+	bool AllocatorAdapter<_type>::operator==(const AllocatorAdapter<_other_type>& other) const
+	{
+		return mAllocator == other.GetAllocator();
+	}
+
+	template<typename _type>
+	template<typename _other_type>
+	bool AllocatorAdapter<_type>::operator!=(const AllocatorAdapter<_other_type>& other) const
+	{
+		return mAllocator != other.GetAllocator();
+	}
+}
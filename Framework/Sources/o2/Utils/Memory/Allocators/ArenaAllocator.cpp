@@ -0,0 +1,135 @@
+#include "o2/stdafx.h"
+#include "ArenaAllocator.h"
+
+#include <string.h>
+
+namespace o2
+{
+	ArenaAllocator::ArenaAllocator(size_t blockSize /*= 1024*1024*/, IAllocator* baseAllocator /*= DefaultAllocator::GetInstance()*/):
+		mBaseAllocator(baseAllocator), mBlockSize(GetAlignedSize(blockSize))
+	{
+		mBlocks.Add(CreateBlock(mBlockSize));
+		mTop = mBlocks[0].memory;
+		mEnd = mTop + mBlocks[0].size;
+	}
+
+	ArenaAllocator::~ArenaAllocator()
+	{
+		for (auto& block : mBlocks)
+			mBaseAllocator->Deallocate(block.memory);
+	}
+
+	void* ArenaAllocator::Allocate(size_t size)
+	{
+		size = GetAlignedSize(size);
+
+		if (mTop + size > mEnd)
+			NextBlock(size);
+
+		mLastAllocation = mTop;
+		mTop += size;
+		mAllocationsCount++;
+
+		return mLastAllocation;
+	}
+
+	void ArenaAllocator::Deallocate(void* ptr)
+	{
+		if (ptr && ptr == mLastAllocation)
+		{
+			mTop = mLastAllocation;
+			mLastAllocation = nullptr;
+		}
+	}
+
+	void* ArenaAllocator::Reallocate(void* ptr, size_t oldSize, size_t newSize)
+	{
+		if (ptr && ptr == mLastAllocation && mLastAllocation + GetAlignedSize(newSize) <= mEnd)
+		{
+			mTop = mLastAllocation + GetAlignedSize(newSize);
+			return ptr;
+		}
+
+		void* newMemory = Allocate(newSize);
+		if (ptr)
+			memcpy(newMemory, ptr, Math::Min(oldSize, newSize));
+
+		return newMemory;
+	}
+
+	void ArenaAllocator::Reset()
+	{
+		mLastResetStatistics = GetCurrentStatistics();
+		mPeakUsedBytes = Math::Max(mPeakUsedBytes, mLastResetStatistics.usedBytes);
+
+		// When allocations didn't fit in one block, blocks are replaced with one block enough for all of them.
+		// After peak usage big block is shrunk back
+		size_t requiredSize = Math::Max(mBlockSize, GetAlignedSize(mLastResetStatistics.usedBytes));
+		bool tooSmall = mCurrentBlock > 0;
+		bool tooBig = mBlocks[0].size > requiredSize*4;
+
+		if (tooSmall || tooBig)
+		{
+			for (auto& block : mBlocks)
+				mBaseAllocator->Deallocate(block.memory);
+
+			mBlocks.Clear();
+			mBlocks.Add(CreateBlock(tooSmall ? mLastResetStatistics.capacity : requiredSize*2));
+		}
+
+		mCurrentBlock = 0;
+		mUsedInBlocks = 0;
+		mTop = mBlocks[0].memory;
+		mEnd = mTop + mBlocks[0].size;
+		mLastAllocation = nullptr;
+		mAllocationsCount = 0;
+	}
+
+	ArenaAllocator::Statistics ArenaAllocator::GetCurrentStatistics() const
+	{
+		Statistics res;
+		res.usedBytes = mUsedInBlocks + (mTop - mBlocks[mCurrentBlock].memory);
+		res.allocationsCount = mAllocationsCount;
+		res.blocksCount = mCurrentBlock + 1;
+
+		for (auto& block : mBlocks)
+			res.capacity += block.size;
+
+		return res;
+	}
+
+	const ArenaAllocator::Statistics& ArenaAllocator::GetLastResetStatistics() const
+	{
+		return mLastResetStatistics;
+	}
+
+	size_t ArenaAllocator::GetPeakUsedBytes() const
+	{
+		return Math::Max(mPeakUsedBytes, GetCurrentStatistics().usedBytes);
+	}
+
+	void ArenaAllocator::NextBlock(size_t size)
+	{
+		mUsedInBlocks += mTop - mBlocks[mCurrentBlock].memory;
+		mCurrentBlock++;
+
+		// Blocks after first exist only until reset, so current block is always the last
+		mBlocks.Add(CreateBlock(Math::Max(size, mBlocks.Last().size*2)));
+
+		mTop = mBlocks[mCurrentBlock].memory;
+		mEnd = mTop + mBlocks[mCurrentBlock].size;
+	}
+
+	ArenaAllocator::Block ArenaAllocator::CreateBlock(size_t size)
+	{
+		Block block;
+		block.memory = (std::byte*)mBaseAllocator->Allocate(size);
+		block.size = size;
+		return block;
+	}
+
+	size_t ArenaAllocator::GetAlignedSize(size_t size)
+	{
+		return (size + alignment - 1) & ~(alignment - 1);
+	}
+}
@@ -0,0 +1,111 @@
+#pragma once
+#include "o2/Utils/Memory/Allocators/DefaultAllocator.h"
+#include "o2/Utils/Memory/Allocators/IAllocator.h"
+#include "o2/Utils/Types/Containers/Vector.h"
+#include <cstddef>
+#include <memory>
+
+namespace o2
+{
+	// -----------------------------------------------------------------------------------------------------
+	// Arena allocator. Allocates memory by moving pointer in big blocks, deallocation does nothing except
+	// the last allocation. All memory is released at once by Reset(), so arena allocated memory must not be
+	// used after reset. When arena requires more than one block between resets, blocks are merged into one
+	// bigger block on reset. Not thread safe
+	// -----------------------------------------------------------------------------------------------------
+	class ArenaAllocator: public IAllocator
+	{
+	public:
+		// -----------------
+		// Arena usage stats
+		// -----------------
+		struct Statistics
+		{
+			size_t usedBytes = 0;        // Allocated bytes
+			size_t capacity = 0;         // Capacity of all blocks
+			int    allocationsCount = 0; // Count of allocations
+			int    blocksCount = 0;      // Count of used blocks
+		};
+
+	public:
+		// Constructor with initial block size
+		ArenaAllocator(size_t blockSize = 1024*1024, IAllocator* baseAllocator = DefaultAllocator::GetInstance());
+
+		// Destructor. Releases all blocks
+		~ArenaAllocator();
+
+		// Allocates memory, aligned by 16 bytes
+		void* Allocate(size_t size) override;
+
+		// Deallocates memory. Returns memory back only when it is the last allocation
+		void Deallocate(void* ptr) override;
+
+		// Reallocates memory. Grows in place when memory is the last allocation
+		void* Reallocate(void* ptr, size_t oldSize, size_t newSize) override;
+
+		// Allocates array of default constructed elements. Elements aren't destructed, so type must be trivially destructible
+		template<typename _type>
+		_type* AllocateArray(int count);
+
+		// Releases all allocated memory
+		void Reset();
+
+		// Returns usage stats since last reset
+		Statistics GetCurrentStatistics() const;
+
+		// Returns usage stats before last reset
+		const Statistics& GetLastResetStatistics() const;
+
+		// Returns maximum of used bytes between resets
+		size_t GetPeakUsedBytes() const;
+
+	protected:
+		static const size_t alignment = 16; // Alignment of allocations
+
+		// ------------------
+		// Arena memory block
+		// ------------------
+		struct Block
+		{
+			std::byte* memory = nullptr; // Block memory
+			size_t     size = 0;         // Size of block
+		};
+
+	protected:
+		IAllocator* mBaseAllocator; // Allocator of blocks
+		size_t      mBlockSize;     // Minimal size of block
+
+		Vector<Block> mBlocks;           // Allocated blocks
+		int           mCurrentBlock = 0; // Index of block, where allocations are placed
+		size_t        mUsedInBlocks = 0; // Used bytes in blocks before current
+
+		std::byte* mTop = nullptr;            // Pointer to free memory in current block
+		std::byte* mEnd = nullptr;            // End of current block
+		std::byte* mLastAllocation = nullptr; // Last allocated memory
+
+		int    mAllocationsCount = 0; // Count of allocations since last reset
+		size_t mPeakUsedBytes = 0;    // Maximum of used bytes between resets
+
+		Statistics mLastResetStatistics; // Usage stats before last reset
+
+	protected:
+		// Moves allocations into new block, that can fit size
+		void NextBlock(size_t size);
+
+		// Allocates block with size
+		Block CreateBlock(size_t size);
+
+		// Returns size aligned by allocations alignment
+		static size_t GetAlignedSize(size_t size);
+	};
+
+	template<typename _type>
+	_type* ArenaAllocator::AllocateArray(int count)
+	{
+		static_assert(std::is_trivially_destructible<_type>::value, "Arena allocated array elements aren't destructed");
+
+		_type* res = (_type*)Allocate(sizeof(_type)*count);
+		std::uninitialized_default_construct_n(res, count);
+		return res;
+	}
+}
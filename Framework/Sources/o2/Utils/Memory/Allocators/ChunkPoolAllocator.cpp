@@ -77,4 +77,26 @@ namespace o2
 		}
 	}
 
+	void ChunkPoolAllocator::Reset()
+	{
+		while (mHead && mHead->prev)
+		{
+			Chunk* chunk = mHead;
+			mHead = chunk->prev;
+			mBaseAllocator->Deallocate(chunk);
+		}
+
+		if (mHead)
+			mHead->currentSize = 0;
+	}
+
+	size_t ChunkPoolAllocator::GetCapacity() const
+	{
+		size_t capacity = 0;
+		for (Chunk* chunk = mHead; chunk; chunk = chunk->prev)
+			capacity += chunk->capacity;
+
+		return capacity;
+	}
+
 }
\ No newline at end of file
@@ -18,6 +18,9 @@ namespace o2
 		void* Reallocate(void* ptr, size_t oldSize, size_t newSize) override;
 
 		void Clear();
+		void Reset();
+
+		size_t GetCapacity() const;
 
 	private:
 		struct Chunk
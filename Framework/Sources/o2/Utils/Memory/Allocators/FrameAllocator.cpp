@@ -0,0 +1,15 @@
+#include "o2/stdafx.h"
+#include "FrameAllocator.h"
+
+namespace o2
+{
+	DECLARE_SINGLETON(FrameAllocator);
+
+	FrameAllocator::FrameAllocator()
+	{}
+
+	const FrameAllocator::Statistics& FrameAllocator::GetLastFrameStatistics() const
+	{
+		return GetLastResetStatistics();
+	}
+}
@@ -0,0 +1,55 @@
+#pragma once
+#include "o2/Utils/Memory/Allocators/AllocatorAdapter.h"
+#include "o2/Utils/Memory/Allocators/ArenaAllocator.h"
+#include "o2/Utils/Singleton.h"
+
+// Frame allocator access macros
+#define o2FrameAllocator o2::FrameAllocator::Instance()
+
+namespace o2
+{
+	// ------------------------------------------------------------------------------------------------
+	// Per-frame arena allocator. Created by application, which resets it at the end of frame, so frame
+	// allocated memory must not be used after the frame. Not thread safe, used from main thread
+	// ------------------------------------------------------------------------------------------------
+	class FrameAllocator: public ArenaAllocator, public Singleton<FrameAllocator>
+	{
+	public:
+		// Returns usage stats of previous frame
+		const Statistics& GetLastFrameStatistics() const;
+
+	protected:
+		// Default constructor
+		FrameAllocator();
+
+		friend class Application;
+	};
+
+	// -------------------------------------------------------------------------------------
+	// Standard containers allocator, that allocates memory from frame allocator. Containers
+	// with it must not live longer than frame
+	// -------------------------------------------------------------------------------------
+	template<typename _type>
+	class FrameAllocatorAdapter: public AllocatorAdapter<_type>
+	{
+	public:
+		template<typename _other_type>
+		struct rebind { typedef FrameAllocatorAdapter<_other_type> other; };
+
+	public:
+		// Default constructor, uses frame allocator
+		FrameAllocatorAdapter():
+			AllocatorAdapter<_type>(FrameAllocator::InstancePtr())
+		{}
+
+		// Copy-constructor from adapter of other type
+		template<typename _other_type>
+		FrameAllocatorAdapter(const FrameAllocatorAdapter<_other_type>& other):
+			AllocatorAdapter<_type>(other)
+		{}
+	};
+
+	// Frame temporary vector. Elements memory is allocated from frame allocator
+	template<typename _type>
+	using FrameVector = Vector<_type, FrameAllocatorAdapter<_type>>;
+}
@@ -0,0 +1,132 @@
+#pragma once
+#include <cstddef>
+#include <new>
+#include <type_traits>
+
+namespace o2
+{
+	// ---------------------------------------------------------------------------------------------------
+	// Standard containers allocator with inline buffer for capacity elements. First allocation, that fits
+	// the buffer, is placed in it, others go to heap. Buffer is part of allocator, so copied or moved
+	// allocator gets own empty buffer and never equals to other allocator: containers move elements
+	// instead of stealing memory. Allocators of other types, created by rebind, don't use the buffer.
+	// Containers with it must not be swapped
+	// ---------------------------------------------------------------------------------------------------
+	template<typename _type, int _capacity>
+	class InlineAllocator
+	{
+	public:
+		typedef _type value_type;
+
+		typedef std::false_type propagate_on_container_copy_assignment;
+		typedef std::false_type propagate_on_container_move_assignment;
+		typedef std::false_type propagate_on_container_swap;
+		typedef std::false_type is_always_equal;
+
+		template<typename _other_type>
+		struct rebind { typedef InlineAllocator<_other_type, _capacity> other; };
+
+	public:
+		// Default constructor
+		InlineAllocator();
+
+		// Copy-constructor. Doesn't copy buffer
+		InlineAllocator(const InlineAllocator& other);
+
+		// Copy-constructor from allocator of other type. Created allocator doesn't use buffer
+		template<typename _other_type>
+		InlineAllocator(const InlineAllocator<_other_type, _capacity>& other);
+
+		// Copy-operator. Keeps own buffer
+		InlineAllocator& operator=(const InlineAllocator& other);
+
+		// Allocates memory for count of elements
+		_type* allocate(size_t count);
+
+		// Deallocates elements memory
+		void deallocate(_type* ptr, size_t count);
+
+		// Returns allocator for container copy: new allocator with own buffer
+		InlineAllocator select_on_container_copy_construction() const;
+
+		// Returns true when ptr is in inline buffer
+		bool IsInline(const _type* ptr) const;
+
+		// Equal operator. Allocator is equal only to itself
+		bool operator==(const InlineAllocator& other) const;
+
+		// Not equal operator
+		bool operator!=(const InlineAllocator& other) const;
+
+	protected:
+		alignas(_type) std::byte mBuffer[sizeof(_type)*_capacity]; // Inline elements buffer
+
+		bool mBufferEnabled = true; // Is buffer can be used. Disabled for rebound allocators
+		bool mBufferUsed = false;   // Is buffer allocated
+	};
+
+	template<typename _type, int _capacity>
+	InlineAllocator<_type, _capacity>::InlineAllocator()
+	{}
+
+	template<typename _type, int _capacity>
+	InlineAllocator<_type, _capacity>::InlineAllocator(const InlineAllocator& other)
+	{}
+
+	template<typename _type, int _capacity>
+	template<typename _other_type>
+	InlineAllocator<_type, _capacity>::InlineAllocator(const InlineAllocator<_other_type, _capacity>& other):
+		mBufferEnabled(false)
+	{}
+
+	template<typename _type, int _capacity>
+	InlineAllocator<_type, _capacity>& InlineAllocator<_type, _capacity>::operator=(const InlineAllocator& other)
+	{
+		return *this;
+	}
+
+	template<typename _type, int _capacity>
+	_type* InlineAllocator<_type, _capacity>::allocate(size_t count)
+	{
+		if (mBufferEnabled && !mBufferUsed && count <= (size_t)_capacity)
+		{
+			mBufferUsed = true;
+			return (_type*)mBuffer;
+		}
+
+		return (_type*)::operator new(sizeof(_type)*count);
+	}
+
+	template<typename _type, int _capacity>
+	void InlineAllocator<_type, _capacity>::deallocate(_type* ptr, size_t count)
+	{
+		if (IsInline(ptr))
+			mBufferUsed = false;
+		else
+			::operator delete(ptr);
+	}
+
+	template<typename _type, int _capacity>
+	InlineAllocator<_type, _capacity> InlineAllocator<_type, _capacity>::select_on_container_copy_construction() const
+	{
+		return InlineAllocator();
+	}
+
+	template<typename _type, int _capacity>
+	bool InlineAllocator<_type, _capacity>::IsInline(const _type* ptr) const
+	{
+		return (const std::byte*)ptr == mBuffer;
+	}
+
+	template<typename _type, int _capacity>
+	bool InlineAllocator<_type, _capacity>::operator==(const InlineAllocator& other) const
+	{
+		return this == &other;
+	}
+
+	template<typename _type, int _capacity>
+	bool InlineAllocator<_type, _capacity>::operator!=(const InlineAllocator& other) const
+	{
+		return this != &other;
+	}
+}
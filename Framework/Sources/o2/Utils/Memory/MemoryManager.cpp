@@ -75,13 +75,50 @@ void _mfree(void* allocMemory)
 
 namespace o2
 {
+	// Removed allocation slot marker, never equal to allocated memory
+	static void* const removedSlot = (void*)1;
+
+	// Shift of line in packed source location key. Pointer takes lower bits
+	static const int locationLineShift = sizeof(void*) == 8 ? 48 : 32;
+
+	// Maximum line in packed source location key
+	static const UInt64 locationMaxLine = ((UInt64)1 << (64 - locationLineShift)) - 1;
+
+	// Source for overflowed locations
+	static const char* const otherLocationsSource = "<other locations>";
+
 	MemoryManager::MemoryManager():
-		mTotalBytes(0)
-	{}
+		mTotalBytes(0), mTotalCount(0), mPeakBytes(0)
+	{
+		for (int i = 0; i < shardsCount; i++)
+			mShards[i].first = CreateSegment(initialSegmentSize);
+
+		mLocations = (Location*)malloc(sizeof(Location)*locationsCapacity);
+		for (int i = 0; i < locationsCapacity; i++)
+		{
+			Location* location = new (mLocations + i) Location();
+			location->key = 0;
+			location->bytes = location->count = location->peakBytes = location->totalCount = 0;
+		}
+
+		mLocations[0].key = (UInt64)(size_t)otherLocationsSource;
+	}
 
 	MemoryManager::~MemoryManager()
 	{
 		DumpInfo();
+
+		for (int i = 0; i < shardsCount; i++)
+		{
+			for (Segment* segment = mShards[i].first; segment;)
+			{
+				Segment* next = segment->next.load(std::memory_order_acquire);
+				DestroySegment(segment);
+				segment = next;
+			}
+		}
+
+		free(mLocations);
 	}
 
 	MemoryManager& MemoryManager::Instance()
@@ -97,86 +134,326 @@ namespace o2
 		mInstance = new MemoryManager();
 	}
 
+	Int64 MemoryManager::GetAllocatedBytes() const
+	{
+		return mTotalBytes;
+	}
+
+	Int64 MemoryManager::GetPeakAllocatedBytes() const
+	{
+		return mPeakBytes;
+	}
+
+	Int64 MemoryManager::GetAllocationsCount() const
+	{
+		return mTotalCount;
+	}
+
 	void MemoryManager::OnMemoryAllocate(void* memory, size_t size, const char* source, int line)
 	{
-		AllocInfo info;
-		info.memory = memory;
-		info.size = size;
-		info.sourceLine = line;
-		info.source = source;
-		mAllocs[memory] = info;
-		mTotalBytes += size;
+		int locationIdx = GetLocationIndex(source, line);
+		Location& location = mLocations[locationIdx];
+
+		UpdatePeak(location.peakBytes, location.bytes.fetch_add(size, std::memory_order_relaxed) + size);
+		location.count.fetch_add(1, std::memory_order_relaxed);
+		location.totalCount.fetch_add(1, std::memory_order_relaxed);
+
+		UpdatePeak(mPeakBytes, mTotalBytes.fetch_add(size, std::memory_order_relaxed) + size);
+		mTotalCount.fetch_add(1, std::memory_order_relaxed);
+
+		InsertAllocation(memory, size, locationIdx);
 	}
 
 	void MemoryManager::OnMemoryRelease(void* memory)
 	{
-		std::map<void*, AllocInfo>::iterator fnd = mAllocs.find(memory);
-		if (fnd != mAllocs.end())
-		{
-			mTotalBytes -= (*fnd).second.size;
-			mAllocs.erase(fnd);
-		}
+		if (!memory)
+			return;
+
+		size_t size;
+		int locationIdx;
+		if (!RemoveAllocation(memory, size, locationIdx))
+			return;
+
+		Location& location = mLocations[locationIdx];
+		location.bytes.fetch_sub(size, std::memory_order_relaxed);
+		location.count.fetch_sub(1, std::memory_order_relaxed);
+
+		mTotalBytes.fetch_sub(size, std::memory_order_relaxed);
+		mTotalCount.fetch_sub(1, std::memory_order_relaxed);
 	}
 
-	void MemoryManager::DumpInfo()
+	int MemoryManager::GetLocationIndex(const char* source, int line)
 	{
-		printf("========MemoryManager::DumpInfo==========\n");
+		// Line can't be packed into key without collision with other line, location is collected as overflowed
+		if (line < 0 || (UInt64)line > locationMaxLine)
+			return 0;
 
-		printf("Total managed allocations: %f MB\n", (float)mTotalBytes / 1024.0f / 1024.0f);
+		UInt64 key = (UInt64)(size_t)source | ((UInt64)line << locationLineShift);
+		int mask = locationsCapacity - 1;
 
-		struct allocSrc
+		// Location 0 is reserved for overflow
+		int idx = (int)(GetHash(key) & mask);
+		for (int i = 0; i < locationsCapacity; i++, idx = (idx + 1) & mask)
 		{
-			char source[128];
-			int line = 0;
-			int size = 0;
-			int count = 0;
+			if (idx == 0)
+				continue;
 
-			bool operator<(const allocSrc& other) const
+			UInt64 current = mLocations[idx].key.load(std::memory_order_acquire);
+			if (current == key)
+				return idx;
+
+			if (current == 0)
 			{
-				return size < other.size;
+				if (mLocations[idx].key.compare_exchange_strong(current, key) || current == key)
+					return idx;
 			}
-		};
-		std::vector<allocSrc> allocs;
+		}
+
+		return 0;
+	}
+
+	void MemoryManager::InsertAllocation(void* memory, size_t size, int location)
+	{
+		UInt64 hash = GetHash((UInt64)(size_t)memory);
+		Segment* segment = mShards[(hash >> 32)%shardsCount].first;
 
-		int i = 0;
-		for (auto it = mAllocs.begin(); it != mAllocs.end(); ++it, i++)
+		// Removed slots are reused in all segments, so table grows only with count of live allocations
+		while (true)
 		{
-			auto& info = (*it).second;
+			bool canUseEmpty = segment->used.load(std::memory_order_relaxed) < segment->size/4*3;
 
-			bool found = false;
-			for (auto& allc : allocs)
+			int mask = segment->size - 1;
+			int idx = (int)(hash & mask);
+			for (int i = 0; i < segment->size; i++, idx = (idx + 1) & mask)
 			{
-				if (allc.line == info.sourceLine && strcmp(allc.source, info.source) == 0)
-				{
-					allc.size += info.size;
-					allc.count++;
-					found = true;
+				AllocSlot& slot = segment->slots[idx];
+				void* current = slot.memory.load(std::memory_order_relaxed);
+
+				// Empty slot ends probing sequence, allocation can't be put after it
+				if (current == nullptr && !canUseEmpty)
 					break;
+
+				if (current != nullptr && current != removedSlot)
+					continue;
+
+				if (slot.memory.compare_exchange_strong(current, memory))
+				{
+					if (current == nullptr)
+						segment->used.fetch_add(1, std::memory_order_relaxed);
+
+					slot.size = size;
+					slot.location = location;
+					return;
 				}
 			}
 
-			if (!found)
+			segment = GetNextSegment(segment);
+		}
+	}
+
+	bool MemoryManager::RemoveAllocation(void* memory, size_t& size, int& location)
+	{
+		UInt64 hash = GetHash((UInt64)(size_t)memory);
+		Shard& shard = mShards[(hash >> 32)%shardsCount];
+
+		for (Segment* segment = shard.first; segment; segment = segment->next.load(std::memory_order_acquire))
+		{
+			int mask = segment->size - 1;
+			int idx = (int)(hash & mask);
+			for (int i = 0; i < segment->size; i++, idx = (idx + 1) & mask)
 			{
-				allocSrc allc;
-				allc.line = info.sourceLine;
-				strncpy(allc.source, info.source, 127);
-				allc.size = info.size;
-				allc.count = 1;
+				AllocSlot& slot = segment->slots[idx];
+				void* current = slot.memory.load(std::memory_order_acquire);
+				if (current == nullptr)
+					break;
 
-				allocs.push_back(allc);
+				if (current == memory)
+				{
+					size = slot.size;
+					location = slot.location;
+					slot.memory.store(removedSlot, std::memory_order_release);
+					return true;
+				}
 			}
 		}
 
-		std::sort(allocs.begin(), allocs.end());
+		return false;
+	}
 
-		for (int i = 0; i < (int)allocs.size(); i++)
+	MemoryManager::Segment* MemoryManager::GetNextSegment(Segment* segment)
+	{
+		Segment* next = segment->next.load(std::memory_order_acquire);
+		if (next)
+			return next;
+
+		Segment* newSegment = CreateSegment(segment->size*2);
+		if (segment->next.compare_exchange_strong(next, newSegment))
+			return newSegment;
+
+		DestroySegment(newSegment);
+		return next;
+	}
+
+	MemoryManager::Segment* MemoryManager::CreateSegment(int size)
+	{
+		// Tables memory is allocated by malloc, so it isn't registered itself
+		Segment* segment = new (malloc(sizeof(Segment))) Segment();
+		segment->size = size;
+		segment->used = 0;
+		segment->next = nullptr;
+		segment->slots = (AllocSlot*)malloc(sizeof(AllocSlot)*size);
+
+		for (int i = 0; i < size; i++)
+			new (segment->slots + i) AllocSlot();
+
+		for (int i = 0; i < size; i++)
+			segment->slots[i].memory.store(nullptr, std::memory_order_relaxed);
+
+		return segment;
+	}
+
+	void MemoryManager::DestroySegment(Segment* segment)
+	{
+		free(segment->slots);
+		free(segment);
+	}
+
+	void MemoryManager::UpdatePeak(std::atomic<Int64>& peak, Int64 value)
+	{
+		Int64 current = peak.load(std::memory_order_relaxed);
+		while (current < value && !peak.compare_exchange_weak(current, value, std::memory_order_relaxed))
+		{}
+	}
+
+	UInt64 MemoryManager::GetHash(UInt64 value)
+	{
+		value ^= value >> 33;
+		value *= 0xff51afd7ed558ccdULL;
+		value ^= value >> 33;
+		value *= 0xc4ceb9fe1a85ec53ULL;
+		value ^= value >> 33;
+		return value;
+	}
+
+	MemoryManager::Snapshot MemoryManager::MakeSnapshot(bool resetPeaks /*= false*/)
+	{
+		Snapshot snapshot;
+		snapshot.bytes = mTotalBytes;
+		snapshot.count = mTotalCount;
+		snapshot.peakBytes = mPeakBytes;
+
+		if (resetPeaks)
+			mPeakBytes = snapshot.bytes;
+
+		UInt64 pointerMask = ((UInt64)1 << locationLineShift) - 1;
+
+		for (int i = 0; i < locationsCapacity; i++)
+		{
+			Location& location = mLocations[i];
+			UInt64 key = location.key.load(std::memory_order_acquire);
+			if (key == 0)
+				continue;
+
+			LocationStats stats;
+			stats.source = (const char*)(size_t)(key & pointerMask);
+			stats.line = (int)(key >> locationLineShift);
+			stats.bytes = location.bytes;
+			stats.count = location.count;
+			stats.peakBytes = location.peakBytes;
+			stats.totalCount = location.totalCount;
+
+			if (resetPeaks)
+				location.peakBytes = stats.bytes;
+
+			snapshot.locations.push_back(stats);
+		}
+
+		std::sort(snapshot.locations.begin(), snapshot.locations.end(), [](const LocationStats& a, const LocationStats& b) {
+			return a.source != b.source ? std::less<const char*>()(a.source, b.source) : a.line < b.line;
+		});
+
+		return snapshot;
+	}
+
+	std::vector<MemoryManager::LocationStats> MemoryManager::Diff(const Snapshot& from, const Snapshot& to)
+	{
+		std::vector<LocationStats> res;
+
+		auto less = [](const LocationStats& a, const LocationStats& b) {
+			return a.source != b.source ? std::less<const char*>()(a.source, b.source) : a.line < b.line;
+		};
+
+		// Both lists are sorted, merge them. Locations are never removed, so each from location is in to list
+		auto fromIt = from.locations.begin();
+		for (auto& toStats : to.locations)
 		{
-			printf("%i: %s : %i - %i bytes (%f MB) in %i allocs\n",
-				   i, allocs[i].source, allocs[i].line, allocs[i].size,
-				   (float)allocs[i].size / 1024.0f / 1024.0f, allocs[i].count);
+			while (fromIt != from.locations.end() && less(*fromIt, toStats))
+				++fromIt;
+
+			LocationStats diff = toStats;
+			if (fromIt != from.locations.end() && !less(toStats, *fromIt))
+			{
+				diff.bytes -= fromIt->bytes;
+				diff.count -= fromIt->count;
+				diff.totalCount -= fromIt->totalCount;
+			}
+
+			if (diff.bytes != 0 || diff.count != 0 || diff.totalCount != 0)
+				res.push_back(diff);
+		}
+
+		return res;
+	}
+
+	MemoryManager::Snapshot MemoryManager::DumpDiff(const Snapshot& from)
+	{
+		Snapshot current = MakeSnapshot(true);
+		std::vector<LocationStats> diff = Diff(from, current);
+
+		std::sort(diff.begin(), diff.end(), [](const LocationStats& a, const LocationStats& b) { return a.bytes > b.bytes; });
+
+		printf("========MemoryManager::DumpDiff==========\n");
+
+		printf("Total managed allocations: %f MB (%+lld bytes), %lld allocs (%+lld), peak %f MB\n",
+			   (float)current.bytes / 1024.0f / 1024.0f, current.bytes - from.bytes, current.count,
+			   current.count - from.count, (float)current.peakBytes / 1024.0f / 1024.0f);
+
+		for (int i = 0; i < (int)diff.size(); i++)
+		{
+			printf("%i: %s : %i - %+lld bytes in %+lld allocs, peak %lld bytes, %lld allocations\n",
+				   i, diff[i].source, diff[i].line, diff[i].bytes, diff[i].count, diff[i].peakBytes, diff[i].totalCount);
 		}
 
 		printf("========END==========\n");
+
+		return current;
 	}
 
+	void MemoryManager::DumpInfo()
+	{
+		printf("========MemoryManager::DumpInfo==========\n");
+
+		Snapshot snapshot = MakeSnapshot();
+
+		printf("Total managed allocations: %f MB, peak %f MB\n", (float)snapshot.bytes / 1024.0f / 1024.0f,
+			   (float)snapshot.peakBytes / 1024.0f / 1024.0f);
+
+		std::vector<LocationStats> allocs;
+		for (auto& stats : snapshot.locations)
+		{
+			if (stats.count > 0)
+				allocs.push_back(stats);
+		}
+
+		std::sort(allocs.begin(), allocs.end(), [](const LocationStats& a, const LocationStats& b) { return a.bytes < b.bytes; });
+
+		for (int i = 0; i < (int)allocs.size(); i++)
+		{
+			printf("%i: %s : %i - %lld bytes (%f MB) in %lld allocs, peak %lld bytes\n",
+				   i, allocs[i].source, allocs[i].line, allocs[i].bytes,
+				   (float)allocs[i].bytes / 1024.0f / 1024.0f, allocs[i].count, allocs[i].peakBytes);
+		}
+
+		printf("========END==========\n");
+	}
 }
@@ -1,8 +1,8 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
 #include <vector>
-#include <map>
 
 #include "o2/EngineSettings.h"
 #include "o2/Utils/Types/CommonTypes.h"
@@ -47,11 +47,39 @@ namespace o2
 {
 	class LogStream;
 
-	// ------------------------------------------------------------------
-	// Memory manager, using for collecting garbage, tracing memory leaks
-	// ------------------------------------------------------------------
+	// ---------------------------------------------------------------------------------------------------
+	// Memory manager, using for tracing memory leaks and high-water marks. Allocations are registered in
+	// sharded lock-free open addressing table, statistics are collected by allocation source locations.
+	// Can be used from any thread
+	// ---------------------------------------------------------------------------------------------------
 	class MemoryManager
 	{
+	public:
+		// ------------------------------------------
+		// Allocations statistics of source location
+		// ------------------------------------------
+		struct LocationStats
+		{
+			const char* source = nullptr; // Allocation source code file
+			int         line = 0;         // Allocation source code line
+			Int64       bytes = 0;        // Allocated bytes
+			Int64       count = 0;        // Count of live allocations
+			Int64       peakBytes = 0;    // Maximum of allocated bytes
+			Int64       totalCount = 0;   // Total count of allocations
+		};
+
+		// ------------------------------------
+		// Snapshot of allocations statistics
+		// ------------------------------------
+		struct Snapshot
+		{
+			Int64 bytes = 0;     // Total allocated bytes
+			Int64 count = 0;     // Total count of live allocations
+			Int64 peakBytes = 0; // Maximum of total allocated bytes
+
+			std::vector<LocationStats> locations; // Statistics of source locations, sorted by source and line
+		};
+
 	public:
 		// Constructor
 		MemoryManager();
@@ -68,22 +96,80 @@ namespace o2
 		// Collects information about allocated memory and prints into console
 		void DumpInfo();
 
+		// Returns total allocated bytes
+		Int64 GetAllocatedBytes() const;
+
+		// Returns maximum of total allocated bytes
+		Int64 GetPeakAllocatedBytes() const;
+
+		// Returns count of live allocations
+		Int64 GetAllocationsCount() const;
+
+		// Makes snapshot of statistics. When resetPeaks is true, peaks are reset to current values after snapshot,
+		// so next snapshot will contain peaks of period between snapshots
+		Snapshot MakeSnapshot(bool resetPeaks = false);
+
+		// Returns difference between snapshots by locations: growth of bytes and live count, peak and count of
+		// allocations in period. Locations without changes are skipped
+		static std::vector<LocationStats> Diff(const Snapshot& from, const Snapshot& to);
+
+		// Prints difference between snapshot and current state into console. Returns current snapshot with reset peaks
+		Snapshot DumpDiff(const Snapshot& from);
+
 	protected:
-		// ----------------------
-		// Allocation information
-		// ----------------------
-		struct AllocInfo
+		static const int shardsCount = 64;          // Count of allocations table shards
+		static const int initialSegmentSize = 1024; // Slots count of first shard segment, power of two
+		static const int locationsCapacity = 16384; // Maximum count of source locations, power of two
+
+		// -------------------------------------------------------------------------
+		// Allocation slot. Memory is null when slot is empty, tombstone when removed
+		// -------------------------------------------------------------------------
+		struct AllocSlot
+		{
+			std::atomic<void*> memory;   // Allocated memory
+			size_t             size;     // Allocated size in bytes
+			int                location; // Source location index
+		};
+
+		// ------------------------------------------------------------------------------------------------
+		// Open addressing slots array of shard. When segment is filled, next twice bigger segment is linked
+		// ------------------------------------------------------------------------------------------------
+		struct Segment
+		{
+			int                   size;  // Count of slots, power of two
+			std::atomic<int>      used;  // Count of used slots, including removed
+			std::atomic<Segment*> next;  // Next bigger segment
+			AllocSlot*            slots; // Slots array
+		};
+
+		// ------------------------------------------------------------------------
+		// Allocations table shard. List of segments, segments are never released
+		// ------------------------------------------------------------------------
+		struct Shard
 		{
-			const char* source;     // Allocation source code file
-			int         sourceLine; // Allocation source code line
-			size_t      size;       // Allocated size in bytes
-			void*       memory;     // Pointer to allocated memory
+			Segment* first; // First segment
+		};
+
+		// ---------------------------------------------------------------------------------
+		// Counters of source location. Key is packed source pointer and line, zero when free
+		// ---------------------------------------------------------------------------------
+		struct Location
+		{
+			std::atomic<UInt64> key;        // Packed source pointer and line
+			std::atomic<Int64>  bytes;      // Allocated bytes
+			std::atomic<Int64>  count;      // Count of live allocations
+			std::atomic<Int64>  peakBytes;  // Maximum of allocated bytes
+			std::atomic<Int64>  totalCount; // Total count of allocations
 		};
 
 		static MemoryManager* mInstance; // Instance pointer
 
-		std::map<void*, AllocInfo> mAllocs;     // Allocations info
-		size_t                     mTotalBytes; // Total managed allocated bytes
+		Shard     mShards[shardsCount]; // Allocations table shards
+		Location* mLocations;           // Source locations counters. First location collects overflowed locations
+
+		std::atomic<Int64> mTotalBytes; // Total managed allocated bytes
+		std::atomic<Int64> mTotalCount; // Total count of live allocations
+		std::atomic<Int64> mPeakBytes;  // Maximum of total allocated bytes
 
 	protected:
 		// Called when memory was allocated and registers allocation
@@ -92,6 +178,31 @@ namespace o2
 		// Called when memory releasing, unregisters allocation
 		void OnMemoryRelease(void* memory);
 
+		// Returns index of source location, registers location when required. Lines above 65535 on 64-bit platforms
+		// are collected into overflow location
+		int GetLocationIndex(const char* source, int line);
+
+		// Puts allocation into table
+		void InsertAllocation(void* memory, size_t size, int location);
+
+		// Removes allocation from table. Returns false when memory isn't registered
+		bool RemoveAllocation(void* memory, size_t& size, int& location);
+
+		// Returns next segment, links new twice bigger segment when it's last
+		static Segment* GetNextSegment(Segment* segment);
+
+		// Creates segment with slots count
+		static Segment* CreateSegment(int size);
+
+		// Destroys segment
+		static void DestroySegment(Segment* segment);
+
+		// Updates peak value with maximum
+		static void UpdatePeak(std::atomic<Int64>& peak, Int64 value);
+
+		// Returns mixed pointer hash
+		static UInt64 GetHash(UInt64 value);
+
 		friend void* ::operator new(size_t size, const char* location, int line);
 		friend void* ::operator new[](size_t size, const char* location, int line);
 		friend void  ::operator delete(void* allocMemory) noexcept;
@@ -2,6 +2,7 @@
 #include "FieldInfo.h"
 
 #include "o2/Utils/Reflection/Type.h"
+#include "o2/Utils/Serialization/DataValue.h"
 
 namespace o2
 {
@@ -12,11 +13,12 @@ namespace o2
 						 ProtectSection section, IDefaultValue* defaultValue /*= nullptr*/, 
 						 ITypeSerializer* serializer /*= nullptr*/):
 		mOwnerType(ownerType), mName(name), mPointerGetter(pointerGetter), mType(type), mProtectSection(section),
-		mSerializer(serializer ? serializer : mType->GetSerializer()), mDefaultValue(defaultValue)
+		mSerializer(serializer ? serializer : mType->GetSerializer()), mDefaultValue(defaultValue),
+		mNameHash(DataValue::GetNameHash(name.Data(), name.Length()))
 	{}
 
 	FieldInfo::FieldInfo(FieldInfo&& other):
-		mProtectSection(other.mProtectSection), mName(other.mName), mType(other.mType), mOwnerType(other.mOwnerType),
+		mProtectSection(other.mProtectSection), mName(other.mName), mNameHash(other.mNameHash), mType(other.mType), mOwnerType(other.mOwnerType),
 		mAttributes(other.mAttributes), mSerializer(other.mSerializer), mDefaultValue(other.mDefaultValue), 
 		mPointerGetter(other.mPointerGetter)
 	{
@@ -48,6 +50,11 @@ namespace o2
 		return mName;
 	}
 
+	UInt FieldInfo::GetNameHash() const
+	{
+		return mNameHash;
+	}
+
 	void FieldInfo::SetProtectSection(ProtectSection section)
 	{
 		mProtectSection = section;
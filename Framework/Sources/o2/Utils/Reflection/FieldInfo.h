@@ -61,6 +61,9 @@ namespace o2
 		// Returns name of field
 		const String& GetName() const;
 
+		// Returns hash of field name, used for data members lookup when deserializing
+		UInt GetNameHash() const;
+
 		// Sets protection section
 		void SetProtectSection(ProtectSection section);
 
@@ -125,6 +128,7 @@ namespace o2
 	protected:
 		ProtectSection         mProtectSection = ProtectSection::Public; // Protection section
 		String                 mName;                                    // Name of field
+		UInt                   mNameHash = 0;                            // Hash of name, see DataValue::GetNameHash
 		const Type*            mType = nullptr;                          // Field type
 		const Type*            mOwnerType = nullptr;                     // Field owner type
 		Vector<IAttribute*>    mAttributes;                              // Attributes array
@@ -0,0 +1,250 @@
+#include "o2/stdafx.h"
+#include "FieldPath.h"
+
+#include "o2/Utils/Basic/IObject.h"
+#include "o2/Utils/Reflection/Reflection.h"
+#include "o2/Utils/Reflection/Type.h"
+
+namespace o2
+{
+	FieldPath::FieldPath(const Type* type, const String& path):
+		mType(type), mPath(path)
+	{
+		if (!Compile(type, path))
+		{
+			mSteps.Clear();
+			mFieldInfo = nullptr;
+			AddStep(StepType::Invalid, type);
+			return;
+		}
+
+		// Merging sequential constant base casts into one offset
+		Vector<Step> steps;
+		steps.Reserve(mSteps.Count());
+		for (auto& step : mSteps)
+		{
+			if (step.stepType == StepType::BaseCast && !steps.IsEmpty() && steps.Last().stepType == StepType::BaseCast)
+				steps.Last().offset += step.offset;
+			else
+				steps.Add(step);
+		}
+
+		steps.RemoveAll([](const Step& step) { return step.stepType == StepType::BaseCast && step.offset == 0; });
+		mSteps = steps;
+	}
+
+	void* FieldPath::Resolve(void* object, const FieldInfo*& fieldInfo) const
+	{
+		for (auto& step : mSteps)
+		{
+			if (!object)
+				return nullptr;
+
+			switch (step.stepType)
+			{
+			case StepType::BaseCast:
+				object = reinterpret_cast<char*>(object) + step.offset;
+				break;
+
+			case StepType::BaseCastFunction:
+				object = (*step.castFunc)(object);
+				break;
+
+			case StepType::Field:
+				object = step.field->GetValuePtrStrong(object);
+				break;
+
+			case StepType::Dereference:
+				object = *(void**)object;
+				break;
+
+			case StepType::VectorElement:
+			{
+				auto vectorType = static_cast<const VectorType*>(step.type);
+				if (step.offset >= vectorType->GetObjectVectorSize(object))
+					return nullptr;
+
+				object = vectorType->GetObjectVectorElementPtr(object, step.offset);
+				break;
+			}
+
+			case StepType::PropertyValue:
+				object = static_cast<const PropertyType*>(step.type)->GetValueAsPtr(object);
+				break;
+
+			case StepType::RealType:
+			{
+				auto objectType = static_cast<const ObjectType*>(step.type);
+				IObject* iobject = objectType->DynamicCastToIObject(object);
+				if (!iobject)
+					return nullptr;
+
+				auto realType = dynamic_cast<const ObjectType*>(&iobject->GetType());
+				if (realType && realType != objectType)
+					return realType->GetFieldPtrByCompiledPath(realType->DynamicCastFromIObject(iobject), step.path, fieldInfo);
+
+				break;
+			}
+
+			case StepType::Remainder:
+				return step.type->GetFieldPtr(object, step.path, fieldInfo);
+
+			case StepType::Invalid:
+				return nullptr;
+			}
+		}
+
+		fieldInfo = mFieldInfo;
+		return object;
+	}
+
+	const Type* FieldPath::GetType() const
+	{
+		return mType;
+	}
+
+	const String& FieldPath::GetPath() const
+	{
+		return mPath;
+	}
+
+	bool FieldPath::IsInvalid() const
+	{
+		return mSteps.Count() == 1 && mSteps[0].stepType == StepType::Invalid;
+	}
+
+	bool FieldPath::IsCacheable() const
+	{
+		return !mSteps.Contains([](const Step& step) {
+			return step.stepType == StepType::Invalid || step.stepType == StepType::VectorElement;
+		});
+	}
+
+	bool FieldPath::Compile(const Type* type, const String& path)
+	{
+		if (!type)
+			return false;
+
+		switch (type->GetUsage())
+		{
+		case Type::Usage::Object:
+		{
+			// Object can have other real type with other fields, it's checked when resolving. Type without derived
+			// types in primary bases tree still can be secondary base of other type, so real type is checked always
+			AddStep(StepType::RealType, type).path = path;
+
+			int stepsCount = mSteps.Count();
+			if (!CompileFields(type, path))
+			{
+				mSteps.Resize(stepsCount);
+				AddStep(StepType::Invalid, type);
+			}
+
+			return true;
+		}
+
+		case Type::Usage::Vector:
+			return CompileVector(type, path);
+
+		case Type::Usage::Pointer:
+			AddStep(StepType::Dereference, type);
+			return Compile(static_cast<const PointerType*>(type)->GetUnpointedType(), path);
+
+		case Type::Usage::Property:
+		{
+			auto valueType = static_cast<const PropertyType*>(type)->GetValueType();
+			if (!valueType || valueType->GetUsage() != Type::Usage::Pointer)
+				return false;
+
+			AddStep(StepType::PropertyValue, type);
+			return Compile(static_cast<const PointerType*>(valueType)->GetUnpointedType(), path);
+		}
+
+		case Type::Usage::Map:
+			return false;
+
+		case Type::Usage::StringAccessor:
+			AddStep(StepType::Remainder, type).path = path;
+			return true;
+
+		default:
+			return CompileFields(type, path);
+		}
+	}
+
+	bool FieldPath::CompileFields(const Type* type, const String& path)
+	{
+		int delPos = path.Find("/");
+		String pathPart = path.SubStr(0, delPos);
+
+		for (auto& field : type->GetFields())
+		{
+			if (field.GetName() != pathPart)
+				continue;
+
+			AddStep(StepType::Field, type).field = &field;
+
+			if (delPos == -1)
+			{
+				mFieldInfo = &field;
+				return true;
+			}
+
+			return Compile(field.GetType(), path.SubStr(delPos + 1));
+		}
+
+		for (auto& baseType : type->GetBaseTypes())
+		{
+			int stepsCount = mSteps.Count();
+
+			if (baseType.isVirtual)
+				AddStep(StepType::BaseCastFunction, type).castFunc = baseType.dynamicCastUpFunc;
+			else
+				AddStep(StepType::BaseCast, type).offset = baseType.offset;
+
+			if (CompileFields(baseType.type, path))
+				return true;
+
+			mSteps.Resize(stepsCount);
+		}
+
+		return false;
+	}
+
+	bool FieldPath::CompileVector(const Type* type, const String& path)
+	{
+		auto vectorType = static_cast<const VectorType*>(type);
+
+		int delPos = path.Find("/");
+		String pathPart = path.SubStr(0, delPos);
+
+		if (pathPart == "count")
+		{
+			mFieldInfo = vectorType->GetCountFieldInfo();
+			return true;
+		}
+
+		int idx = (int)pathPart;
+		if (idx < 0)
+			return false;
+
+		AddStep(StepType::VectorElement, type).offset = idx;
+
+		if (delPos < 0)
+		{
+			mFieldInfo = vectorType->GetElementFieldInfo();
+			return true;
+		}
+
+		return Compile(vectorType->GetElementType(), path.SubStr(delPos + 1));
+	}
+
+	FieldPath::Step& FieldPath::AddStep(StepType stepType, const Type* type)
+	{
+		Step step;
+		step.stepType = stepType;
+		step.type = type;
+
+		return mSteps.Add(step);
+	}
+}
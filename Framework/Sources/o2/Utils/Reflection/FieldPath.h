@@ -0,0 +1,80 @@
+#pragma once
+
+#include "o2/Utils/Types/CommonTypes.h"
+#include "o2/Utils/Types/Containers/Vector.h"
+#include "o2/Utils/Types/String.h"
+
+namespace o2
+{
+	class FieldInfo;
+	class Type;
+
+	// -----------------------------------------------------------------------------------------------------------
+	// Compiled path to field of type, like "transform/position" or "children/0/layer/depth". Path is parsed once
+	// into chain of steps: base types casts, fields pointers getters, pointers dereferences, vectors elements and
+	// properties values. Resolving doesn't work with strings, excepting objects with other real type, that are
+	// resolved by real type compiled path. Compiled paths are cached in types, see Type::GetFieldPtrByCompiledPath()
+	// -----------------------------------------------------------------------------------------------------------
+	class FieldPath
+	{
+	public:
+		// Constructor. Compiles path for type
+		FieldPath(const Type* type, const String& path);
+
+		// Returns pointer to field of object by path and field info. Works same as Type::GetFieldPtr.
+		// Returns null and doesn't change field info when field not found
+		void* Resolve(void* object, const FieldInfo*& fieldInfo) const;
+
+		// Returns type of objects, path compiled for
+		const Type* GetType() const;
+
+		// Returns path string
+		const String& GetPath() const;
+
+		// Returns true when path can't be resolved for any object of type
+		bool IsInvalid() const;
+
+		// Returns true when path can be cached in type: it's valid for type and has no vector elements indices
+		bool IsCacheable() const;
+
+	protected:
+		typedef void*(*CastFuncPtr)(void*);
+
+		enum class StepType
+		{
+			BaseCast, BaseCastFunction, Field, Dereference, VectorElement, PropertyValue, RealType, Remainder, Invalid
+		};
+
+		// -----------------------------------------------------------------------------
+		// Path step. Converts pointer to value into pointer to next value of path chain
+		// -----------------------------------------------------------------------------
+		struct Step
+		{
+			StepType         stepType;           // Step type
+			const Type*      type = nullptr;     // Type of value, that step converts
+			const FieldInfo* field = nullptr;    // Field info for field step
+			CastFuncPtr      castFunc = nullptr; // Cast function for base cast through virtual base
+			int              offset = 0;         // Base offset or vector element index
+			String           path;               // Rest of path for real type and remainder steps
+		};
+
+	protected:
+		const Type*      mType;                // Type of objects, path compiled for
+		String           mPath;                // Path string
+		Vector<Step>     mSteps;               // Compiled steps
+		const FieldInfo* mFieldInfo = nullptr; // Last field info of path
+
+	protected:
+		// Compiles steps for value of type by rest of path. Returns false when path can't be resolved
+		bool Compile(const Type* type, const String& path);
+
+		// Compiles steps for fields of type and its base types, like Type::GetFieldPtr does
+		bool CompileFields(const Type* type, const String& path);
+
+		// Compiles steps for vector element or count
+		bool CompileVector(const Type* type, const String& path);
+
+		// Adds step with type
+		Step& AddStep(StepType stepType, const Type* type);
+	};
+}
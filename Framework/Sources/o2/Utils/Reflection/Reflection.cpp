@@ -84,9 +84,97 @@ namespace o2
 			func(0, processor);
 
 		mInstance->mInitializingFunctions.Clear();
+
+		InitializeTypesHierarchy();
+
 		mInstance->mTypesInitialized = true;
 	}
 
+	void Reflection::InitializeTypesHierarchy()
+	{
+		Map<const Type*, Vector<Type*>> derivedTypes;
+		Vector<Type*> rootTypes;
+		for (auto& kv : mInstance->mTypes)
+		{
+			if (kv.second->mBaseTypes.IsEmpty())
+				rootTypes.Add(kv.second);
+			else
+				derivedTypes[kv.second->mBaseTypes[0].type].Add(kv.second);
+		}
+
+		UInt index = 1;
+		for (auto type : rootTypes)
+			AssignHierarchyInterval(type, derivedTypes, index);
+
+		for (auto& kv : mInstance->mTypes)
+		{
+			Type* type = kv.second;
+			if (!type->mBaseCasts.IsEmpty())
+				continue;
+
+			Vector<void*(*)(void*)> path;
+			CollectBaseCasts(type, type, 0, false, path);
+			type->mBaseCasts.Sort([](const Type::BaseCast& a, const Type::BaseCast& b) { return a.type->mId < b.type->mId; });
+
+			// Interval covers only primary base types chain; other bases must be searched in casts table
+			int primaryBasesCount = 0;
+			for (const Type* base = type; !base->mBaseTypes.IsEmpty(); base = base->mBaseTypes[0].type)
+				primaryBasesCount++;
+
+			type->mHasSecondaryBases = type->mBaseCasts.Count() > primaryBasesCount;
+		}
+	}
+
+	void Reflection::AssignHierarchyInterval(Type* type, const Map<const Type*, Vector<Type*>>& derivedTypes, UInt& index)
+	{
+		if (type->mHierarchyBegin != 0)
+			return;
+
+		type->mHierarchyBegin = index++;
+
+		auto fnd = derivedTypes.find(type);
+		if (fnd != derivedTypes.end())
+		{
+			for (auto derivedType : fnd->second)
+				AssignHierarchyInterval(derivedType, derivedTypes, index);
+		}
+
+		type->mHierarchyEnd = index - 1;
+	}
+
+	void Reflection::CollectBaseCasts(Type* type, const Type* current, int offset, bool isVirtualPath,
+									  Vector<void*(*)(void*)>& path)
+	{
+		for (auto& baseType : current->mBaseTypes)
+		{
+			bool isBaseVirtualPath = isVirtualPath || baseType.isVirtual;
+			int baseOffset = offset + baseType.offset;
+
+			path.Add(baseType.dynamicCastUpFunc);
+
+			if (!type->mBaseCasts.Contains([&](const Type::BaseCast& x) { return x.type == baseType.type; }))
+			{
+				Type::BaseCast baseCast;
+				baseCast.type = baseType.type;
+
+				if (isBaseVirtualPath)
+				{
+					baseCast.castsBegin = type->mBaseCastFuncs.Count();
+					baseCast.castsCount = path.Count();
+					type->mBaseCastFuncs.Add(path);
+				}
+				else
+					baseCast.offset = baseOffset;
+
+				type->mBaseCasts.Add(baseCast);
+			}
+
+			CollectBaseCasts(type, baseType.type, baseOffset, isBaseVirtualPath, path);
+
+			path.PopBack();
+		}
+	}
+
 	const Map<String, Type*>& Reflection::GetTypes()
 	{
 		return mInstance->mTypes;
@@ -31,6 +31,13 @@ namespace o2
 
 	typedef UInt TypeId;
 
+	// Is pointer to B castable to pointer to T with static_cast, false when B is virtual base of T
+	template<class T, class B, class = std::void_t<>>
+	struct IsStaticDownCastable : std::false_type { };
+
+	template<class T, class B>
+	struct IsStaticDownCastable<T, B, std::void_t<decltype(static_cast<T*>(std::declval<B*>()))>> : std::true_type { };
+
 	// ------------------------------
 	// Reflection in application container
 	// ------------------------------
@@ -87,8 +94,8 @@ namespace o2
 		template<typename _value_type, typename _property_type>
 		static const PropertyType* InitializePropertyType();
 
-		// Initializes vector type
-		template<typename _element_type>
+		// Initializes vector type. Vector type can be Vector or SmallVector
+		template<typename _element_type, typename _vector_type = Vector<_element_type>>
 		static const VectorType* InitializeVectorType();
 
 		// Initializes dictionary type
@@ -129,6 +136,16 @@ namespace o2
 		// Initializes fundamental types
 		static void InitializeFundamentalTypes();
 
+		// Assigns hierarchy intervals and builds base casts tables for all initialized types
+		static void InitializeTypesHierarchy();
+
+		// Assigns pre-order hierarchy interval to type and its derived by primary base types
+		static void AssignHierarchyInterval(Type* type, const Map<const Type*, Vector<Type*>>& derivedTypes, UInt& index);
+
+		// Collects casts from type to base types of current type. Path is cast functions chain from type to current
+		static void CollectBaseCasts(Type* type, const Type* current, int offset, bool isVirtualPath,
+									 Vector<void*(*)(void*)>& path);
+
 		friend class Type;
 	};
 }
@@ -308,16 +325,16 @@ namespace o2
 		return newType;
 	}
 
-	template<typename _element_type>
+	template<typename _element_type, typename _vector_type>
 	const VectorType* Reflection::InitializeVectorType()
 	{
-		String typeName = "o2::Vector<" + TypeOf(_element_type).GetName() + ">";
+		String typeName = VectorTypeName<_vector_type>::Get(TypeOf(_element_type).GetName());
 
 		auto fnd = mInstance->mTypes.find(typeName);
 		if (fnd != mInstance->mTypes.End())
 			return dynamic_cast<VectorType*>(fnd->second);
 
-		TVectorType<_element_type>* newType = mnew TVectorType<_element_type>();
+		TVectorType<_element_type, _vector_type>* newType = mnew TVectorType<_element_type, _vector_type>();
 		newType->mId = mInstance->mLastGivenTypeId++;
 
 		mInstance->mTypes[newType->GetName()] = newType;
@@ -372,6 +389,15 @@ namespace o2
 		baseTypeInfo.dynamicCastUpFunc = &Reflection::CastFunc<_object_type, _base_type>;
 		baseTypeInfo.dynamicCastDownFunc = &Reflection::CastFunc<_base_type, _object_type>;
 
+		if constexpr (IsStaticDownCastable<_object_type, _base_type>::value)
+		{
+			// Offset of non virtual base is constant, calculating it by fake address without accessing object
+			_object_type* sample = reinterpret_cast<_object_type*>(alignof(_object_type)*1024);
+			baseTypeInfo.offset = (int)(reinterpret_cast<char*>(static_cast<_base_type*>(sample)) - reinterpret_cast<char*>(sample));
+		}
+		else
+			baseTypeInfo.isVirtual = true;
+
 		type->mBaseTypes.Add(baseTypeInfo);
 	}
 
@@ -3,6 +3,7 @@
 
 #include "o2/Animation/AnimationClip.h"
 #include "o2/Utils/Basic/IObject.h"
+#include "o2/Utils/Reflection/FieldPath.h"
 #include "o2/Utils/Reflection/Reflection.h"
 #include "o2/Utils/Serialization/DataValue.h"
 #include "o2/Utils/System/Time/Timer.h"
@@ -17,6 +18,9 @@ namespace o2
 	{
 		for (auto func : mFunctions)
 			delete func;
+
+		for (auto& kv : mFieldPaths)
+			delete kv.second;
 	}
 
 	bool Type::operator!=(const Type& other) const
@@ -49,18 +53,70 @@ namespace o2
 		if (mId == other.mId)
 			return true;
 
-		for (auto typeInfo : mBaseTypes)
-		{
-			if (typeInfo.type->mId == mId)
-				return true;
+		if (mHierarchyBegin == 0 || other.mHierarchyBegin == 0)
+			return IsBasedOnRecursive(other);
 
-			if (typeInfo.type->IsBasedOn(other))
+		if (mHierarchyBegin >= other.mHierarchyBegin && mHierarchyBegin <= other.mHierarchyEnd)
+			return true;
+
+		if (!mHasSecondaryBases)
+			return false;
+
+		return FindBaseCast(other) != nullptr;
+	}
+
+	bool Type::IsBasedOnRecursive(const Type& other) const
+	{
+		if (mId == other.mId)
+			return true;
+
+		for (auto& baseType : mBaseTypes)
+		{
+			if (baseType.type->IsBasedOnRecursive(other))
 				return true;
 		}
 
 		return false;
 	}
 
+	const Type::BaseCast* Type::FindBaseCast(const Type& baseType) const
+	{
+		int begin = 0, end = mBaseCasts.Count();
+		while (begin < end)
+		{
+			int middle = (begin + end)/2;
+			TypeId middleId = mBaseCasts[middle].type->mId;
+
+			if (middleId == baseType.mId)
+				return &mBaseCasts[middle];
+
+			if (middleId < baseType.mId)
+				begin = middle + 1;
+			else
+				end = middle;
+		}
+
+		return nullptr;
+	}
+
+	void* Type::CastToBaseType(void* object, const Type& baseType) const
+	{
+		if (!object || mId == baseType.mId)
+			return object;
+
+		auto baseCast = FindBaseCast(baseType);
+		if (!baseCast)
+			return nullptr;
+
+		if (baseCast->castsCount == 0)
+			return reinterpret_cast<char*>(object) + baseCast->offset;
+
+		for (int i = baseCast->castsBegin; i < baseCast->castsBegin + baseCast->castsCount; i++)
+			object = (*mBaseCastFuncs[i])(object);
+
+		return object;
+	}
+
 	Type::Usage Type::GetUsage() const
 	{
 		return Usage::Regular;
@@ -231,6 +287,41 @@ namespace o2
 		return nullptr;
 	}
 
+	void* Type::GetFieldPtrByCompiledPath(void* object, const String& path, const FieldInfo*& fieldInfo) const
+	{
+		// Cached path is resolved outside the lock, it can resolve nested path of this type. Cached paths live until type
+		// is destroyed
+		FieldPath* cachedPath = nullptr;
+		{
+			std::lock_guard<std::mutex> lock(mFieldPathsMutex);
+
+			auto fnd = mFieldPaths.find(path);
+			if (fnd != mFieldPaths.end())
+				cachedPath = fnd->second;
+		}
+
+		if (cachedPath)
+			return cachedPath->Resolve(object, fieldInfo);
+
+		FieldPath* fieldPath = mnew FieldPath(this, path);
+		void* res = fieldPath->Resolve(object, fieldInfo);
+
+		if (fieldPath->IsCacheable())
+		{
+			std::lock_guard<std::mutex> lock(mFieldPathsMutex);
+
+			auto fnd = mFieldPaths.find(path);
+			if (fnd == mFieldPaths.end())
+			{
+				mFieldPaths[path] = fieldPath;
+				return res;
+			}
+		}
+
+		delete fieldPath;
+		return res;
+	}
+
 	void Type::Serialize(void* ptr, DataValue& data) const
 	{
 		mSerializer->Serialize(ptr, data);
@@ -440,12 +531,7 @@ namespace o2
 
 	void* ObjectType::GetFieldPtr(void* object, const String& path, const FieldInfo*& fieldInfo) const
 	{
-		IObject* iobject = DynamicCastToIObject(object);
-		const Type* realType = &iobject->GetType();
-		if (realType == this)
-			return Type::GetFieldPtr(object, path, fieldInfo);
-
-		return realType->GetFieldPtr(dynamic_cast<const ObjectType*>(realType)->DynamicCastFromIObject(iobject), path, fieldInfo);
+		return GetFieldPtrByCompiledPath(object, path, fieldInfo);
 	}
 
 	StringPointerAccessorType::StringPointerAccessorType(const String& name, int size, ITypeSerializer* serializer) :
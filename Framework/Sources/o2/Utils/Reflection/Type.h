@@ -8,6 +8,7 @@
 #include "o2/Utils/Types/Containers/Map.h"
 #include "o2/Utils/Types/Containers/Vector.h"
 #include "o2/Utils/Types/StringDef.h"
+#include <mutex>
 
 // Returns type of TYPE
 #define TypeOf(TYPE) GetTypeOf<TYPE>()
@@ -16,6 +17,7 @@ namespace o2
 {
 	class DataValue;
 	class FieldInfo;
+	class FieldPath;
 	class FunctionInfo;
 	class IAbstractValueProxy;
 	class IObject;
@@ -26,15 +28,15 @@ namespace o2
 	template<typename _type>
 	class IValueProxy;
 
-	template<typename _key_type, typename _value_type>
-	class Map;
-
 	template<typename _type, typename _getter>
 	const Type& GetTypeOf();
 
-	template<typename _element_type>
+	template<typename _element_type, typename _vector_type>
 	struct VectorCountFieldSerializer;
 
+	template<class T>
+	struct VectorTypeName;
+
 	typedef UInt TypeId;
 
 	// ---------------
@@ -54,9 +56,24 @@ namespace o2
 			void* (*dynamicCastUpFunc)(void*);
 			void* (*dynamicCastDownFunc)(void*);
 
+			int  offset = 0;        // Constant offset from object to base, valid when base isn't virtual
+			bool isVirtual = false; // Is base virtual or can't be casted statically; only cast functions can be used
+
 			bool operator==(const BaseType& other) const { return type == other.type; }
 		};
 
+		// ----------------------------------------------------------------------------------------------------
+		// Cached cast from type to one of its direct or indirect base types. When there is no virtual bases on
+		// the path, cast is constant offset; otherwise it's a chain of cast functions
+		// ----------------------------------------------------------------------------------------------------
+		struct BaseCast
+		{
+			const Type* type = nullptr; // Base type
+			int         offset = 0;     // Constant offset from object to base
+			int         castsBegin = 0; // Index of first cast function in base casts functions
+			int         castsCount = 0; // Count of cast functions. Zero when offset is constant
+		};
+
 	public:
 		// Default constructor
 		Type(const String& name, int size, ITypeSerializer* serializer);
@@ -79,9 +96,15 @@ namespace o2
 		// Returns size of type in bytes
 		int GetSize() const;
 
-		// Is this type based on other
+		// Is this type based on other. Checks hierarchy interval when types are initialized
 		bool IsBasedOn(const Type& other) const;
 
+		// Returns cached cast to base type, or null when type isn't based on it
+		const BaseCast* FindBaseCast(const Type& baseType) const;
+
+		// Casts object pointer of this type to base type pointer by cached cast. Returns null when type isn't based on it
+		void* CastToBaseType(void* object, const Type& baseType) const;
+
 		// Returns pointer of type (type -> type*)
 		virtual const Type* GetPointerType() const = 0;
 
@@ -135,6 +158,10 @@ namespace o2
 		// Returns filed pointer by path
 		virtual void* GetFieldPtr(void* object, const String& path, const FieldInfo*& fieldInfo) const;
 
+		// Returns filed pointer by compiled path. Compiled paths are cached, excepting paths that can't be resolved
+		// and paths with vector elements indices
+		void* GetFieldPtrByCompiledPath(void* object, const String& path, const FieldInfo*& fieldInfo) const;
+
 		// Returns abstract value proxy for object value
 		virtual IAbstractValueProxy* GetValueProxy(void* object) const = 0;
 
@@ -180,7 +207,22 @@ namespace o2
 
 		ITypeSerializer* mSerializer = nullptr; // Value serializer
 
+		UInt mHierarchyBegin = 0;        // Pre-order index in tree of primary base types. Zero when type isn't indexed
+		UInt mHierarchyEnd = 0;          // Last pre-order index of derived types in tree of primary base types
+		bool mHasSecondaryBases = false; // Is some base type in hierarchy has several bases, interval isn't enough
+
+		Vector<BaseCast>        mBaseCasts;     // All direct and indirect base types casts, sorted by base type id
+		Vector<void*(*)(void*)> mBaseCastFuncs; // Cast functions chains of base casts through virtual bases
+
+		mutable std::mutex              mFieldPathsMutex; // Compiled fields paths cache mutex
+		mutable Map<String, FieldPath*> mFieldPaths;      // Compiled fields paths cache
+
+	protected:
+		// Returns is type based on other by walking through base types
+		bool IsBasedOnRecursive(const Type& other) const;
+
 		friend class FieldInfo;
+		friend class FieldPath;
 		friend class FunctionInfo;
 		friend class PointerType;
 		friend class Reflection;
@@ -441,14 +483,14 @@ namespace o2
 		FieldInfo* mElementFieldInfo;
 		FieldInfo* mCountFieldInfo;
 
-		template<typename _element_type>
+		template<typename _element_type, typename _vector_type>
 		friend struct VectorCountFieldSerializer;
 	};
 
-	// -----------------------
-	// Specialized vector type
-	// -----------------------
-	template<typename _element_type>
+	// -----------------------------------------------------------------
+	// Specialized vector type. Vector type can be Vector or SmallVector
+	// -----------------------------------------------------------------
+	template<typename _element_type, typename _vector_type = Vector<_element_type>>
 	class TVectorType: public VectorType
 	{
 	public:
@@ -1072,7 +1114,7 @@ namespace o2
 	// TVectorType implementation
 	// --------------------------
 
-	template<typename _element_type>
+	template<typename _element_type, typename _vector_type>
 	struct VectorCountFieldSerializer: public ITypeSerializer
 	{
 		VectorCountFieldSerializer() { }
@@ -1083,22 +1125,22 @@ namespace o2
 		ITypeSerializer* Clone() const;
 	};
 
-	template<typename _element_type>
-	void* TVectorType<_element_type>::GetObjectVectorElementPtr(void* object, int idx) const
+	template<typename _element_type, typename _vector_type>
+	void* TVectorType<_element_type, _vector_type>::GetObjectVectorElementPtr(void* object, int idx) const
 	{
-		return &((Vector<_element_type>*)object)->Get(idx);
+		return &((_vector_type*)object)->Get(idx);
 	}
 
-	template<typename _element_type>
-	IAbstractValueProxy* TVectorType<_element_type>::GetObjectVectorElementProxy(void* object, int idx) const
+	template<typename _element_type, typename _vector_type>
+	IAbstractValueProxy* TVectorType<_element_type, _vector_type>::GetObjectVectorElementProxy(void* object, int idx) const
 	{
-		return mElementType->GetValueProxy(&((Vector<_element_type>*)object)->Get(idx));
+		return mElementType->GetValueProxy(&((_vector_type*)object)->Get(idx));
 	}
 
-	template<typename _element_type>
-	void TVectorType<_element_type>::SetObjectVectorSize(void* object, int size) const
+	template<typename _element_type, typename _vector_type>
+	void TVectorType<_element_type, _vector_type>::SetObjectVectorSize(void* object, int size) const
 	{
-		auto vectorObj = ((Vector<_element_type>*)object);
+		auto vectorObj = ((_vector_type*)object);
 		int oldSize = vectorObj->Count();
 		vectorObj->Resize(size);
 
@@ -1106,55 +1148,55 @@ namespace o2
 			(*vectorObj)[i] = _element_type();
 	}
 
-	template<typename _element_type>
-	void TVectorType<_element_type>::RemoveObjectVectorElement(void* object, int idx) const
+	template<typename _element_type, typename _vector_type>
+	void TVectorType<_element_type, _vector_type>::RemoveObjectVectorElement(void* object, int idx) const
 	{
-		((Vector<_element_type>*)object)->RemoveAt(idx);
+		((_vector_type*)object)->RemoveAt(idx);
 	}
 
-	template<typename _element_type>
-	void* TVectorType<_element_type>::CreateSample() const
+	template<typename _element_type, typename _vector_type>
+	void* TVectorType<_element_type, _vector_type>::CreateSample() const
 	{
-		return mnew Vector<_element_type>();
+		return mnew _vector_type();
 	}
 
-	template<typename _element_type>
-	IAbstractValueProxy* TVectorType<_element_type>::GetValueProxy(void* object) const
+	template<typename _element_type, typename _vector_type>
+	IAbstractValueProxy* TVectorType<_element_type, _vector_type>::GetValueProxy(void* object) const
 	{
-		return mnew PointerValueProxy<Vector<_element_type>>((Vector<_element_type>*)object);
+		return mnew PointerValueProxy<_vector_type>((_vector_type*)object);
 	}
 
-	template<typename _element_type>
-	int TVectorType<_element_type>::GetObjectVectorSize(void* object) const
+	template<typename _element_type, typename _vector_type>
+	int TVectorType<_element_type, _vector_type>::GetObjectVectorSize(void* object) const
 	{
-		return ((Vector<_element_type>*)object)->Count();
+		return ((_vector_type*)object)->Count();
 	}
 
-	template<typename _element_type>
-	TVectorType<_element_type>::TVectorType():
-		VectorType((String)"o2::Vector<" + GetTypeOf<_element_type>().GetName() + ">", sizeof(Vector<_element_type>), mnew TypeSerializer<Vector<_element_type>>())
+	template<typename _element_type, typename _vector_type>
+	TVectorType<_element_type, _vector_type>::TVectorType():
+		VectorType(VectorTypeName<_vector_type>::Get(GetTypeOf<_element_type>().GetName()), sizeof(_vector_type), mnew TypeSerializer<_vector_type>())
 	{
 		mElementType = &GetTypeOf<_element_type>();
 
 		mElementFieldInfo = mnew FieldInfo(this, "element", 0, mElementType, ProtectSection::Private);
 		mCountFieldInfo = mnew FieldInfo(this, "count", 0, &GetTypeOf<int>(), ProtectSection::Public,
 										 mnew DefaultValue<int>(0),
-										 mnew VectorCountFieldSerializer<_element_type>());
+										 mnew VectorCountFieldSerializer<_element_type, _vector_type>());
 	}
 
-	template<typename _element_type>
-	const Type* TVectorType<_element_type>::GetPointerType() const
+	template<typename _element_type, typename _vector_type>
+	const Type* TVectorType<_element_type, _vector_type>::GetPointerType() const
 	{
 		if (!mPtrType)
-			Reflection::InitializePointerType<Vector<_element_type>>(this);
+			Reflection::InitializePointerType<_vector_type>(this);
 
 		return mPtrType;
 	}
 
-	template<typename _element_type>
-	void VectorCountFieldSerializer<_element_type>::Serialize(void* object, DataValue& data) const
+	template<typename _element_type, typename _vector_type>
+	void VectorCountFieldSerializer<_element_type, _vector_type>::Serialize(void* object, DataValue& data) const
 	{
-		const VectorType& type = (const VectorType&)(GetTypeOf<Vector<_element_type>>());
+		const VectorType& type = (const VectorType&)(GetTypeOf<_vector_type>());
 
 		int size = type.GetObjectVectorSize(object);
 		data["Size"].Set(size);
@@ -1167,10 +1209,10 @@ namespace o2
 		}
 	}
 
-	template<typename _element_type>
-	void VectorCountFieldSerializer<_element_type>::Deserialize(void* object, DataValue& data) const
+	template<typename _element_type, typename _vector_type>
+	void VectorCountFieldSerializer<_element_type, _vector_type>::Deserialize(void* object, DataValue& data) const
 	{
-		const VectorType& type = (const VectorType&)(GetTypeOf<Vector<_element_type>>());
+		const VectorType& type = (const VectorType&)(GetTypeOf<_vector_type>());
 		int size = type.GetObjectVectorSize(object);
 		int newSize;
 		data["Size"].Get(newSize);
@@ -1189,22 +1231,22 @@ namespace o2
 		}
 	}
 
-	template<typename _element_type>
-	bool VectorCountFieldSerializer<_element_type>::Equals(void* objectA, void* objectB) const
+	template<typename _element_type, typename _vector_type>
+	bool VectorCountFieldSerializer<_element_type, _vector_type>::Equals(void* objectA, void* objectB) const
 	{
-		const VectorType& type = (const VectorType&)(GetTypeOf<Vector<_element_type>>());
+		const VectorType& type = (const VectorType&)(GetTypeOf<_vector_type>());
 		return type.GetObjectVectorSize(objectA) == type.GetObjectVectorSize(objectB);
 	}
 
-	template<typename _element_type>
-	void VectorCountFieldSerializer<_element_type>::Copy(void* objectA, void* objectB) const
+	template<typename _element_type, typename _vector_type>
+	void VectorCountFieldSerializer<_element_type, _vector_type>::Copy(void* objectA, void* objectB) const
 	{
-		const VectorType& type = (const VectorType&)(GetTypeOf<Vector<_element_type>>());
+		const VectorType& type = (const VectorType&)(GetTypeOf<_vector_type>());
 		type.SetObjectVectorSize(objectA, type.GetObjectVectorSize(objectB));
 	}
 
-	template<typename _element_type>
-	ITypeSerializer* VectorCountFieldSerializer<_element_type>::Clone() const
+	template<typename _element_type, typename _vector_type>
+	ITypeSerializer* VectorCountFieldSerializer<_element_type, _vector_type>::Clone() const
 	{
 		return mnew VectorCountFieldSerializer();
 	}
@@ -8,6 +8,7 @@
 #include "o2/Utils/Math/Vector2.h"
 #include "o2/Utils/Math/Vertex.h"
 #include "o2/Utils/Types/Containers/Map.h"
+#include "o2/Utils/Types/Containers/SmallVector.h"
 #include "o2/Utils/Types/Containers/Vector.h"
 #include "o2/Utils/Types/UID.h"
 
@@ -15,9 +16,14 @@ namespace o2
 {
 	template<class T> struct IsVectorHelper : std::false_type {};
 	template<class T> struct IsVectorHelper<Vector<T>> : std::true_type {};
+	template<class T, int N> struct IsVectorHelper<SmallVector<T, N>> : std::true_type {};
 	template<class T> struct IsVector : IsVectorHelper<typename std::remove_cv<T>::type> {};
 	template<class T> struct ExtractVectorElementType { typedef T type; };
 	template<class T> struct ExtractVectorElementType<Vector<T>> { typedef T type; };
+	template<class T, int N> struct ExtractVectorElementType<SmallVector<T, N>> { typedef T type; };
+
+	template<class T> struct VectorTypeName { static String Get(const String& element) { return "o2::Vector<" + element + ">"; } };
+	template<class T, int N> struct VectorTypeName<SmallVector<T, N>> { static String Get(const String& element) { return "o2::SmallVector<" + element + ", " + (String)N + ">"; } };
 
 	template<class T, class T2> struct IsMapHelper : std::false_type {};
 	template<class T, class T2> struct IsMapHelper<Map<T, T2>, void> : std::true_type {};
@@ -157,7 +163,7 @@ namespace o2
 		}
 		else if constexpr (IsVector<_type>::value)
 		{
-			return *Reflection::InitializeVectorType<typename ExtractVectorElementType<_type>::type>();
+			return *Reflection::InitializeVectorType<typename ExtractVectorElementType<_type>::type, typename std::remove_cv<_type>::type>();
 		}
 		else if constexpr (IsStringAccessor<_type>::value)
 		{
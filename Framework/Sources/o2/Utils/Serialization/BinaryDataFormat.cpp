@@ -0,0 +1,459 @@
+#include "o2/stdafx.h"
+#include "BinaryDataFormat.h"
+
+#include <string.h>
+
+namespace o2
+{
+	bool ParseBinaryInplace(const char* data, UInt size, DataDocument& document)
+	{
+		BinaryDataDocumentReader reader(data, size, document);
+		return reader.Read();
+	}
+
+	void WriteBinary(Vector<char>& data, const DataDocument& document)
+	{
+		BinaryDataDocumentWriter writer(data);
+		document.Write(writer);
+		writer.Finish();
+	}
+
+	bool IsBinaryData(const char* data, UInt size)
+	{
+		return size >= BinaryDataFormat::HeaderSize &&
+			memcmp(data, BinaryDataFormat::Signature, sizeof(BinaryDataFormat::Signature)) == 0;
+	}
+
+	BinaryDataDocumentWriter::BinaryDataDocumentWriter(Vector<char>& data):
+		mData(data)
+	{
+		mData.clear();
+		mData.resize(BinaryDataFormat::HeaderSize, 0);
+	}
+
+	void BinaryDataDocumentWriter::Finish()
+	{
+		Assert(mItems.Count() == 1 && mContainersItems.IsEmpty(), "Binary data written incompletely");
+
+		UInt rootOffset = mItems.IsEmpty() ? 0 : mItems[0].offset;
+		UInt stringsOffset = (UInt)mData.size();
+
+		for (auto str : mStrings)
+		{
+			WriteVarUInt(str->length());
+			mData.insert(mData.end(), str->begin(), str->end());
+			mData.push_back('\0');
+		}
+
+		memcpy(mData.data(), BinaryDataFormat::Signature, sizeof(BinaryDataFormat::Signature));
+		WriteUInt(BinaryDataFormat::Version, 4);
+		WriteUInt(rootOffset, 8);
+		WriteUInt(stringsOffset, 12);
+		WriteUInt((UInt)mStrings.Count(), 16);
+	}
+
+	bool BinaryDataDocumentWriter::Null()
+	{
+		BeginValue(BinaryDataFormat::Tag::Null);
+		return true;
+	}
+
+	bool BinaryDataDocumentWriter::Bool(bool value)
+	{
+		BeginValue(value ? BinaryDataFormat::Tag::True : BinaryDataFormat::Tag::False);
+		return true;
+	}
+
+	bool BinaryDataDocumentWriter::Int(int value)
+	{
+		BeginValue(BinaryDataFormat::Tag::Int);
+		WriteVarInt(value);
+		return true;
+	}
+
+	bool BinaryDataDocumentWriter::Uint(unsigned value)
+	{
+		BeginValue(BinaryDataFormat::Tag::UInt);
+		WriteVarUInt(value);
+		return true;
+	}
+
+	bool BinaryDataDocumentWriter::Int64(int64_t value)
+	{
+		BeginValue(BinaryDataFormat::Tag::Int64);
+		WriteVarInt(value);
+		return true;
+	}
+
+	bool BinaryDataDocumentWriter::Uint64(uint64_t value)
+	{
+		BeginValue(BinaryDataFormat::Tag::UInt64);
+		WriteVarUInt(value);
+		return true;
+	}
+
+	bool BinaryDataDocumentWriter::Double(double value)
+	{
+		BeginValue(BinaryDataFormat::Tag::Double);
+
+		// All supported platforms are little-endian, double is written as is
+		char bytes[sizeof(double)];
+		memcpy(bytes, &value, sizeof(double));
+		mData.insert(mData.end(), bytes, bytes + sizeof(double));
+		return true;
+	}
+
+	bool BinaryDataDocumentWriter::String(const char* str, unsigned length, bool copy)
+	{
+		UInt index = GetStringIndex(str, length);
+		BeginValue(BinaryDataFormat::Tag::String);
+		WriteVarUInt(index);
+		return true;
+	}
+
+	bool BinaryDataDocumentWriter::StartObject()
+	{
+		mContainersItems.Add(mItems.Count());
+		mContainersKeys.Add(mKey);
+		mKey = noKey;
+		return true;
+	}
+
+	bool BinaryDataDocumentWriter::Key(const char* str, unsigned length, bool copy)
+	{
+		mKey = GetStringIndex(str, length);
+		return true;
+	}
+
+	bool BinaryDataDocumentWriter::EndObject(unsigned memberCount)
+	{
+		EndContainer(BinaryDataFormat::Tag::Object, true);
+		return true;
+	}
+
+	bool BinaryDataDocumentWriter::StartArray()
+	{
+		return StartObject();
+	}
+
+	bool BinaryDataDocumentWriter::EndArray(unsigned elementCount)
+	{
+		EndContainer(BinaryDataFormat::Tag::Array, false);
+		return true;
+	}
+
+	void BinaryDataDocumentWriter::BeginValue(BinaryDataFormat::Tag tag)
+	{
+		mItems.Add({ mKey, (UInt)mData.size() });
+		mKey = noKey;
+
+		mData.push_back((char)tag);
+	}
+
+	void BinaryDataDocumentWriter::EndContainer(BinaryDataFormat::Tag tag, bool withKeys)
+	{
+		int firstItem = mContainersItems.PopBack();
+		int count = mItems.Count() - firstItem;
+
+		mKey = mContainersKeys.PopBack();
+		BeginValue(tag);
+		WriteVarUInt(count);
+
+		for (int i = firstItem; i < firstItem + count; i++)
+		{
+			if (withKeys)
+				WriteUInt(mItems[i].key);
+
+			WriteUInt(mItems[i].offset);
+		}
+
+		// Remove written items, except container item itself
+		Item containerItem = mItems.Last();
+		mItems.resize(firstItem);
+		mItems.Add(containerItem);
+	}
+
+	UInt BinaryDataDocumentWriter::GetStringIndex(const char* str, unsigned length)
+	{
+		auto it = mStringsIndices.emplace(std::string(str, length), (UInt)mStrings.Count());
+		if (it.second)
+			mStrings.Add(&it.first->first);
+
+		return it.first->second;
+	}
+
+	void BinaryDataDocumentWriter::WriteVarUInt(UInt64 value)
+	{
+		while (value >= 0x80)
+		{
+			mData.push_back((char)((value & 0x7f) | 0x80));
+			value >>= 7;
+		}
+
+		mData.push_back((char)value);
+	}
+
+	void BinaryDataDocumentWriter::WriteVarInt(int64_t value)
+	{
+		WriteVarUInt(((UInt64)value << 1) ^ (UInt64)(value >> 63));
+	}
+
+	void BinaryDataDocumentWriter::WriteUInt(UInt value)
+	{
+		mData.resize(mData.size() + 4);
+		WriteUInt(value, (UInt)mData.size() - 4);
+	}
+
+	void BinaryDataDocumentWriter::WriteUInt(UInt value, UInt position)
+	{
+		mData[position] = (char)(value & 0xff);
+		mData[position + 1] = (char)((value >> 8) & 0xff);
+		mData[position + 2] = (char)((value >> 16) & 0xff);
+		mData[position + 3] = (char)((value >> 24) & 0xff);
+	}
+
+	BinaryDataDocumentReader::BinaryDataDocumentReader(const char* data, UInt size, DataDocument& document):
+		mData(data), mSize(size), mDocument(document)
+	{}
+
+	bool BinaryDataDocumentReader::Read()
+	{
+		if (!IsBinaryData(mData, mSize))
+			return false;
+
+		UInt position = 4;
+		UInt version, rootOffset, stringsOffset, stringsCount;
+		ReadUInt(position, version);
+		ReadUInt(position, rootOffset);
+		ReadUInt(position, stringsOffset);
+		ReadUInt(position, stringsCount);
+
+		if (version != BinaryDataFormat::Version)
+			return false;
+
+		if (!ReadStrings(stringsOffset, stringsCount))
+			return false;
+
+		DataValue root(mDocument);
+		if (!ReadValue(rootOffset, root, 0))
+			return false;
+
+		(DataValue&)mDocument = std::move(root);
+		return true;
+	}
+
+	bool BinaryDataDocumentReader::ReadStrings(UInt offset, UInt count)
+	{
+		if (offset > mSize || count > mSize - offset)
+			return false;
+
+		mStrings.Clear();
+		mStrings.Reserve(count);
+
+		UInt position = offset;
+		for (UInt i = 0; i < count; i++)
+		{
+			UInt64 length;
+			if (!ReadVarUInt(position, length) || length >= mSize - position || mData[position + length] != '\0')
+				return false;
+
+			mStrings.Add({ mData + position, (UInt)length });
+			position += (UInt)length + 1;
+		}
+
+		return true;
+	}
+
+	bool BinaryDataDocumentReader::ReadValue(UInt offset, DataValue& value, int depth)
+	{
+		if (offset < BinaryDataFormat::HeaderSize || offset >= mSize || depth > maxDepth)
+			return false;
+
+		UInt position = offset;
+		BinaryDataFormat::Tag tag = (BinaryDataFormat::Tag)mData[position++];
+
+		switch (tag)
+		{
+		case BinaryDataFormat::Tag::Null:
+		value.SetNull();
+		return true;
+
+		case BinaryDataFormat::Tag::False:
+		value.Set(false);
+		return true;
+
+		case BinaryDataFormat::Tag::True:
+		value.Set(true);
+		return true;
+
+		case BinaryDataFormat::Tag::Int:
+		{
+			Int64 intValue;
+			if (!ReadVarInt(position, intValue))
+				return false;
+
+			value.Set((int)intValue);
+			return true;
+		}
+
+		case BinaryDataFormat::Tag::UInt:
+		{
+			UInt64 uintValue;
+			if (!ReadVarUInt(position, uintValue))
+				return false;
+
+			value.Set((UInt)uintValue);
+			return true;
+		}
+
+		case BinaryDataFormat::Tag::Int64:
+		{
+			Int64 intValue;
+			if (!ReadVarInt(position, intValue))
+				return false;
+
+			value.Set(intValue);
+			return true;
+		}
+
+		case BinaryDataFormat::Tag::UInt64:
+		{
+			UInt64 uintValue;
+			if (!ReadVarUInt(position, uintValue))
+				return false;
+
+			value.Set(uintValue);
+			return true;
+		}
+
+		case BinaryDataFormat::Tag::Double:
+		{
+			if (sizeof(double) > mSize - position)
+				return false;
+
+			double doubleValue;
+			memcpy(&doubleValue, mData + position, sizeof(double));
+			value.Set(doubleValue);
+			return true;
+		}
+
+		case BinaryDataFormat::Tag::String:
+		return ReadString(position, value);
+
+		case BinaryDataFormat::Tag::Array:
+		{
+			UInt64 count;
+			if (!ReadVarUInt(position, count) || count > (mSize - position)/4)
+				return false;
+
+			DataValue* elements = nullptr;
+			if (count > 0)
+				elements = (DataValue*)mDocument.mAllocator.Allocate(sizeof(DataValue)*count);
+
+			for (UInt i = 0; i < count; i++)
+			{
+				UInt elementOffset;
+				ReadUInt(position, elementOffset);
+
+				DataValue* element = new (elements + i) DataValue(mDocument);
+				if (elementOffset >= offset || !ReadValue(elementOffset, *element, depth + 1))
+					return false;
+			}
+
+			value.mData.flagsData.flags = DataValue::Flags::Array;
+			value.mData.arrayData.elements = elements;
+			value.mData.arrayData.count = (UInt)count;
+			value.mData.arrayData.capacity = (UInt)count;
+			return true;
+		}
+
+		case BinaryDataFormat::Tag::Object:
+		{
+			UInt64 count;
+			if (!ReadVarUInt(position, count) || count > (mSize - position)/8)
+				return false;
+
+			DataMember* members = nullptr;
+			if (count > 0)
+				members = (DataMember*)mDocument.mAllocator.Allocate(DataValue::GetMembersAllocationSize((UInt)count));
+
+			for (UInt i = 0; i < count; i++)
+			{
+				UInt nameIndex, memberOffset;
+				ReadUInt(position, nameIndex);
+				ReadUInt(position, memberOffset);
+
+				DataValue* name = new (&members[i].name) DataValue(mDocument);
+				DataValue* member = new (&members[i].value) DataValue(mDocument);
+
+				if (nameIndex >= (UInt)mStrings.Count())
+					return false;
+
+				name->SetString(mStrings[nameIndex].string, mStrings[nameIndex].length, false);
+
+				if (memberOffset >= offset || !ReadValue(memberOffset, *member, depth + 1))
+					return false;
+			}
+
+			value.mData.flagsData.flags = DataValue::Flags::Object;
+			value.mData.objectData.members = members;
+			value.mData.objectData.count = (UInt)count;
+			value.mData.objectData.capacity = (UInt)count;
+			value.RebuildMembersIndex();
+			return true;
+		}
+
+		default:
+		return false;
+		}
+	}
+
+	bool BinaryDataDocumentReader::ReadString(UInt& position, DataValue& value)
+	{
+		UInt64 index;
+		if (!ReadVarUInt(position, index) || index >= (UInt64)mStrings.Count())
+			return false;
+
+		value.SetString(mStrings[(int)index].string, mStrings[(int)index].length, false);
+		return true;
+	}
+
+	bool BinaryDataDocumentReader::ReadVarUInt(UInt& position, UInt64& value) const
+	{
+		value = 0;
+		for (int shift = 0; shift < 64; shift += 7)
+		{
+			if (position >= mSize)
+				return false;
+
+			UInt64 byte = (unsigned char)mData[position++];
+			value |= (byte & 0x7f) << shift;
+
+			if ((byte & 0x80) == 0)
+				return true;
+		}
+
+		return false;
+	}
+
+	bool BinaryDataDocumentReader::ReadVarInt(UInt& position, Int64& value) const
+	{
+		UInt64 zigzag;
+		if (!ReadVarUInt(position, zigzag))
+			return false;
+
+		value = (Int64)(zigzag >> 1) ^ -(Int64)(zigzag & 1);
+		return true;
+	}
+
+	bool BinaryDataDocumentReader::ReadUInt(UInt& position, UInt& value) const
+	{
+		if (position > mSize || 4 > mSize - position)
+			return false;
+
+		const unsigned char* bytes = (const unsigned char*)mData + position;
+		value = (UInt)bytes[0] | ((UInt)bytes[1] << 8) | ((UInt)bytes[2] << 16) | ((UInt)bytes[3] << 24);
+		position += 4;
+		return true;
+	}
+}
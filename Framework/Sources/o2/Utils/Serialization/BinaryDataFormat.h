@@ -0,0 +1,159 @@
+#pragma once
+#include "DataValue.h"
+#include <string>
+#include <unordered_map>
+
+namespace o2
+{
+	// Parses binary document into DataDocument. Strings are referenced to data, so data must be valid while document is used
+	bool ParseBinaryInplace(const char* data, UInt size, DataDocument& document);
+
+	// Writes data into binary format
+	void WriteBinary(Vector<char>& data, const DataDocument& document);
+
+	// Returns true when data starts with binary format signature
+	bool IsBinaryData(const char* data, UInt size);
+
+	// -----------------------------------------------------------------------------------------------------------
+	// Binary data document format. File contains header, values and strings table:
+	// - header: signature, version, offset of root value, offset of strings table and strings count, 4 bytes each
+	// - value: tag byte and payload. Integers are written as varints, signed with zigzag encoding, doubles as
+	//   8 bytes. Strings are written as index in strings table
+	// - array and object are written after their elements: tag, varint count and 4 bytes offsets of elements.
+	//   Object member has also 4 bytes name string index. Elements can be accessed by index without parsing
+	// - strings table: all names and string values are interned, each string is written once as varint length,
+	//   characters and terminating zero, so strings can be used directly from file memory
+	// -----------------------------------------------------------------------------------------------------------
+	struct BinaryDataFormat
+	{
+		enum class Tag : char { Null, False, True, Int, UInt, Int64, UInt64, Double, String, Array, Object };
+
+		static constexpr char Signature[4] = { 'o', '2', 'b', 'd' }; // File signature
+		static constexpr UInt Version = 1;                           // Format version
+		static constexpr UInt HeaderSize = 20;                       // Size of header in bytes
+	};
+
+	// ----------------------------------------------------------------------------------------------------
+	// Binary data document writer handler. Receives values from DataValue::Write and writes them into data
+	// ----------------------------------------------------------------------------------------------------
+	class BinaryDataDocumentWriter
+	{
+	public:
+		// Constructor. Writes header placeholder into data
+		BinaryDataDocumentWriter(Vector<char>& data);
+
+		// Writes strings table and header. Called when root value was written
+		void Finish();
+
+		bool Null();
+		bool Bool(bool value);
+		bool Int(int value);
+		bool Uint(unsigned value);
+		bool Int64(int64_t value);
+		bool Uint64(uint64_t value);
+		bool Double(double value);
+		bool String(const char* str, unsigned length, bool copy);
+		bool StartObject();
+		bool Key(const char* str, unsigned length, bool copy);
+		bool EndObject(unsigned memberCount);
+		bool StartArray();
+		bool EndArray(unsigned elementCount);
+
+	protected:
+		static constexpr UInt noKey = (UInt)-1;
+
+		// -----------------------------------------------------------
+		// Written value of not finished array or object, with its key
+		// -----------------------------------------------------------
+		struct Item
+		{
+			UInt key;    // Index of name string in strings table
+			UInt offset; // Offset of value in data
+		};
+
+	protected:
+		Vector<char>& mData; // Output data
+
+		Vector<Item> mItems;           // Written values of not finished arrays and objects
+		Vector<int>  mContainersItems; // Indices of first items of not finished arrays and objects
+		Vector<UInt> mContainersKeys;  // Keys of not finished arrays and objects
+		UInt         mKey = noKey;     // Key of next value
+
+		std::unordered_map<std::string, UInt> mStringsIndices; // Interned strings indices
+		Vector<const std::string*>            mStrings;        // Interned strings by index
+
+	protected:
+		// Writes value tag and registers value in current container
+		void BeginValue(BinaryDataFormat::Tag tag);
+
+		// Writes array or object table of items from current container
+		void EndContainer(BinaryDataFormat::Tag tag, bool withKeys);
+
+		// Returns index of interned string
+		UInt GetStringIndex(const char* str, unsigned length);
+
+		// Writes unsigned varint
+		void WriteVarUInt(UInt64 value);
+
+		// Writes signed varint with zigzag encoding
+		void WriteVarInt(int64_t value);
+
+		// Writes 4 bytes unsigned integer
+		void WriteUInt(UInt value);
+
+		// Writes 4 bytes unsigned integer at position
+		void WriteUInt(UInt value, UInt position);
+	};
+
+	// ------------------------------------------------------------------------------------------------
+	// Binary data document reader. Builds DataDocument DOM structure from binary data, strings are not
+	// copied and reference binary data
+	// ------------------------------------------------------------------------------------------------
+	class BinaryDataDocumentReader
+	{
+	public:
+		// Constructor
+		BinaryDataDocumentReader(const char* data, UInt size, DataDocument& document);
+
+		// Reads root value into document. Returns false when data is corrupted
+		bool Read();
+
+	protected:
+		static constexpr int maxDepth = 1024; // Maximum depth of values hierarchy
+
+		// ----------------------------------
+		// Reference to string in binary data
+		// ----------------------------------
+		struct StringRef
+		{
+			const char* string; // String characters
+			UInt        length; // String length
+		};
+
+	protected:
+		const char*   mData;     // Binary data
+		UInt          mSize;     // Size of data
+		DataDocument& mDocument; // Target document
+
+		Vector<StringRef> mStrings; // Strings table
+
+	protected:
+		// Reads strings table
+		bool ReadStrings(UInt offset, UInt count);
+
+		// Reads value at offset. Elements of arrays and objects must be before them
+		bool ReadValue(UInt offset, DataValue& value, int depth);
+
+		// Reads string value by index
+		bool ReadString(UInt& position, DataValue& value);
+
+		// Reads unsigned varint at position and moves position
+		bool ReadVarUInt(UInt& position, UInt64& value) const;
+
+		// Reads signed varint with zigzag encoding at position and moves position
+		bool ReadVarInt(UInt& position, Int64& value) const;
+
+		// Reads 4 bytes unsigned integer at position and moves position
+		bool ReadUInt(UInt& position, UInt& value) const;
+	};
+}
@@ -1,7 +1,9 @@
 #include "o2/stdafx.h"
 #include "DataValue.h"
 
+#include "o2/Utils/FileSystem/File.h"
 #include "o2/Utils/FileSystem/FileSystem.h"
+#include "o2/Utils/Serialization/BinaryDataFormat.h"
 #include "o2/Utils/Serialization/JsonDataFormat.h"
 
 #include "rapidjson/document.h"
@@ -400,10 +402,21 @@ namespace o2
 	}
 
 	DataValue* DataValue::FindMember(const DataValue& name)
+	{
+		return const_cast<DataValue*>(const_cast<const DataValue*>(this)->FindMember(name));
+	}
+
+	const DataValue* DataValue::FindMember(const DataValue& name) const
 	{
 		if (!IsObject())
 			return nullptr;
 
+		if (name.IsString())
+		{
+			auto member = FindMemberByName(name.GetString());
+			return member ? &member->value : nullptr;
+		}
+
 		for (auto memberIt = BeginMember(); memberIt != EndMember(); ++memberIt)
 		{
 			if (memberIt->name == name)
@@ -413,28 +426,198 @@ namespace o2
 		return nullptr;
 	}
 
-	const DataValue* DataValue::FindMember(const DataValue& name) const
+	DataValue* DataValue::FindMember(const char* name)
+	{
+		return const_cast<DataValue*>(const_cast<const DataValue*>(this)->FindMember(name));
+	}
+
+	const DataValue* DataValue::FindMember(const char* name) const
 	{
 		if (!IsObject())
 			return nullptr;
 
-		for (auto memberIt = BeginMember(); memberIt != EndMember(); ++memberIt)
+		auto member = FindMemberByName(name);
+		return member ? &member->value : nullptr;
+	}
+
+	DataValue* DataValue::FindMember(const char* name, UInt nameHash)
+	{
+		return const_cast<DataValue*>(const_cast<const DataValue*>(this)->FindMember(name, nameHash));
+	}
+
+	const DataValue* DataValue::FindMember(const char* name, UInt nameHash) const
+	{
+		if (!IsObject())
+			return nullptr;
+
+		auto member = FindMemberByHash(name, nameHash);
+		return member ? &member->value : nullptr;
+	}
+
+	UInt DataValue::GetNameHash(const char* name)
+	{
+		UInt hash = 2166136261u;
+		for (const char* c = name; *c; c++)
+			hash = (hash ^ (unsigned char)*c)*16777619u;
+
+		return hash;
+	}
+
+	UInt DataValue::GetNameHash(const char* name, int length)
+	{
+		UInt hash = 2166136261u;
+		for (int i = 0; i < length; i++)
+			hash = (hash ^ (unsigned char)name[i])*16777619u;
+
+		return hash;
+	}
+
+	UInt DataValue::GetMembersIndexSize(UInt capacity)
+	{
+		if (capacity < MembersIndexMinCapacity)
+			return 0;
+
+		UInt size = MembersIndexMinCapacity*2;
+		while (size < capacity*2)
+			size <<= 1;
+
+		return size;
+	}
+
+	size_t DataValue::GetMembersAllocationSize(UInt capacity)
+	{
+		return sizeof(DataMember)*capacity + sizeof(MembersIndexSlot)*GetMembersIndexSize(capacity);
+	}
+
+	void DataValue::RebuildMembersIndex()
+	{
+		UInt indexSize = GetMembersIndexSize(mData.objectData.capacity);
+		if (indexSize == 0)
+			return;
+
+		auto slots = (MembersIndexSlot*)(mData.objectData.members + mData.objectData.capacity);
+		memset(slots, 0, sizeof(MembersIndexSlot)*indexSize);
+
+		for (UInt i = 0; i < mData.objectData.count; i++)
+			AddMemberToIndex(i);
+	}
+
+	void DataValue::AddMemberToIndex(UInt member)
+	{
+		UInt indexSize = GetMembersIndexSize(mData.objectData.capacity);
+		const DataValue& name = mData.objectData.members[member].name;
+		if (indexSize == 0 || !name.IsString())
+			return;
+
+		auto slots = (MembersIndexSlot*)(mData.objectData.members + mData.objectData.capacity);
+		UInt hash = GetNameHash(name.GetString(), name.GetStringLength());
+		UInt mask = indexSize - 1;
+
+		UInt position = hash & mask;
+		while (slots[position].member != 0)
+			position = (position + 1) & mask;
+
+		slots[position].hash = hash;
+		slots[position].member = member + 1;
+	}
+
+	void DataValue::RemoveMemberFromIndex(UInt member)
+	{
+		UInt indexSize = GetMembersIndexSize(mData.objectData.capacity);
+		if (indexSize == 0)
+			return;
+
+		auto slots = (MembersIndexSlot*)(mData.objectData.members + mData.objectData.capacity);
+		UInt mask = indexSize - 1;
+
+		if (MembersIndexSlot* slot = FindMemberIndexSlot(member))
 		{
-			if (memberIt->name == name)
-				return &memberIt->value;
+			// Backward shift deletion: moves next slots of probe sequence to the hole, when it doesn't break their
+			// sequences
+			UInt hole = (UInt)(slot - slots);
+			UInt position = (hole + 1) & mask;
+			while (slots[position].member != 0)
+			{
+				UInt home = slots[position].hash & mask;
+				if (((position - home) & mask) >= ((position - hole) & mask))
+				{
+					slots[hole] = slots[position];
+					hole = position;
+				}
+
+				position = (position + 1) & mask;
+			}
+
+			slots[hole].member = 0;
+		}
+
+		UInt lastMember = mData.objectData.count - 1;
+		if (member != lastMember)
+		{
+			if (MembersIndexSlot* lastSlot = FindMemberIndexSlot(lastMember))
+				lastSlot->member = member + 1;
+		}
+	}
+
+	DataValue::MembersIndexSlot* DataValue::FindMemberIndexSlot(UInt member) const
+	{
+		const DataValue& name = mData.objectData.members[member].name;
+		if (!name.IsString())
+			return nullptr;
+
+		auto slots = (MembersIndexSlot*)(mData.objectData.members + mData.objectData.capacity);
+		UInt mask = GetMembersIndexSize(mData.objectData.capacity) - 1;
+
+		UInt position = GetNameHash(name.GetString(), name.GetStringLength()) & mask;
+		while (slots[position].member != 0)
+		{
+			if (slots[position].member == member + 1)
+				return slots + position;
+
+			position = (position + 1) & mask;
 		}
 
 		return nullptr;
 	}
 
-	DataValue* DataValue::FindMember(const char* name)
+	const DataMember* DataValue::FindMemberByName(const char* name) const
 	{
-		return FindMember(DataValue(name));
+		if (mData.objectData.capacity >= MembersIndexMinCapacity)
+			return FindMemberByHash(name, GetNameHash(name));
+
+		for (UInt i = 0; i < mData.objectData.count; i++)
+		{
+			const DataValue& memberName = mData.objectData.members[i].name;
+			if (memberName.IsString() && strcmp(memberName.GetString(), name) == 0)
+				return mData.objectData.members + i;
+		}
+
+		return nullptr;
 	}
 
-	const DataValue* DataValue::FindMember(const char* name) const
+	const DataMember* DataValue::FindMemberByHash(const char* name, UInt nameHash) const
 	{
-		return FindMember(DataValue(name));
+		UInt indexSize = GetMembersIndexSize(mData.objectData.capacity);
+		if (indexSize == 0)
+			return FindMemberByName(name);
+
+		auto slots = (const MembersIndexSlot*)(mData.objectData.members + mData.objectData.capacity);
+		UInt mask = indexSize - 1;
+
+		UInt position = nameHash & mask;
+		while (slots[position].member != 0)
+		{
+			if (slots[position].hash == nameHash)
+			{
+				const DataMember* member = mData.objectData.members + slots[position].member - 1;
+				if (strcmp(member->name.GetString(), name) == 0)
+					return member;
+			}
+
+			position = (position + 1) & mask;
+		}
+
+		return nullptr;
 	}
 
 	void DataValue::SetObject()
@@ -444,7 +627,7 @@ namespace o2
 
 		mData.flagsData.flags = Flags::Object;
 
-		mData.objectData.members = (DataMember*)mDocument->mAllocator.Allocate(sizeof(DataMember)*ObjectInitialCapacity);
+		mData.objectData.members = (DataMember*)mDocument->mAllocator.Allocate(GetMembersAllocationSize(ObjectInitialCapacity));
 		mData.objectData.capacity = ObjectInitialCapacity;
 		mData.objectData.count = 0;
 	}
@@ -459,14 +642,15 @@ namespace o2
 			{
 				UInt newCapacity = Math::Max(mData.objectData.capacity*2, ObjectInitialCapacity);
 				mData.objectData.members = (DataMember*)mDocument->mAllocator.Reallocate(
-					mData.objectData.members, sizeof(DataMember)*mData.objectData.capacity,
-					sizeof(DataMember)*newCapacity);
+					mData.objectData.members, GetMembersAllocationSize(mData.objectData.capacity),
+					GetMembersAllocationSize(newCapacity));
 
 				mData.objectData.capacity = newCapacity;
+				RebuildMembersIndex();
 			}
 			else
 			{
-				mData.objectData.members = (DataMember*)mDocument->mAllocator.Allocate(sizeof(DataMember)*ObjectInitialCapacity);
+				mData.objectData.members = (DataMember*)mDocument->mAllocator.Allocate(GetMembersAllocationSize(ObjectInitialCapacity));
 				mData.objectData.capacity = ObjectInitialCapacity;
 			}
 		}
@@ -476,6 +660,7 @@ namespace o2
 		DataMember* newMember =
 			new (mData.objectData.members + mData.objectData.count) DataMember(name, value);
 
+		AddMemberToIndex(mData.objectData.count);
 		mData.objectData.count++;
 
 		return newMember->value;
@@ -495,8 +680,7 @@ namespace o2
 		{
 			if (memberIt->name == name)
 			{
-				*memberIt = *(mData.objectData.members + mData.objectData.count - 1);
-				mData.objectData.count--;
+				RemoveMember(memberIt);
 				break;
 			}
 		}
@@ -507,6 +691,8 @@ namespace o2
 		Assert(IsObject(), "Trying remove member, but value isn't object");
 		Assert(it >= BeginMember() && it < EndMember(), "Iterator is invalid");
 
+		RemoveMemberFromIndex((UInt)(&*it - mData.objectData.members));
+
 		*it = *(mData.objectData.members + mData.objectData.count - 1);
 		mData.objectData.count--;
 
@@ -674,7 +860,10 @@ namespace o2
 	void DataValue::Clear()
 	{
 		if (IsObject())
+		{
 			mData.objectData.count = 0;
+			RebuildMembersIndex();
+		}
 		else if (IsArray())
 			mData.arrayData.count = 0;
 		else
@@ -691,11 +880,16 @@ namespace o2
 
 	DataDocument::DataDocument(DataDocument&& other) :
 		DataValue(other), mAllocator(other.mAllocator)
-	{}
+	{
+		std::swap(mMappedFile, other.mMappedFile);
+	}
 
 	DataDocument::~DataDocument()
 	{
 		mAllocator.Clear();
+
+		if (mMappedFile)
+			delete mMappedFile;
 	}
 
 	bool DataDocument::operator!=(const DataDocument& other) const
@@ -718,11 +912,28 @@ namespace o2
 	{
 		DataValue::operator=(other);
 		mAllocator = other.mAllocator;
+		std::swap(mMappedFile, other.mMappedFile);
 		return *this;
 	}
 
 	bool DataDocument::LoadFromFile(const String& fileName, Format format /*= Format::JSON*/)
 	{
+		if (format == Format::Binary)
+		{
+			MappedFile* mappedFile = mnew MappedFile(fileName);
+			if (!mappedFile->IsOpened() || !ParseBinaryInplace(mappedFile->GetData(), mappedFile->GetDataSize(), *this))
+			{
+				delete mappedFile;
+				return false;
+			}
+
+			if (mMappedFile)
+				delete mMappedFile;
+
+			mMappedFile = mappedFile;
+			return true;
+		}
+
 		InFile file(fileName);
 		if (!file.IsOpened())
 			return false;
@@ -742,20 +953,34 @@ namespace o2
 		if (format == Format::JSON)
 			return ParseJson(data.Data(), *this);
 
+		if (format == Format::Binary)
+		{
+			char* binaryData = (char*)mAllocator.Allocate(data.Length());
+			memcpy(binaryData, data.Data(), data.Length());
+			return ParseBinaryInplace(binaryData, data.Length(), *this);
+		}
+
 		return false;
 	}
 
 	bool DataDocument::SaveToFile(const String& fileName, Format format /*= Format::JSON*/) const
 	{
-		String data = SaveAsString(format);
-
 		OutFile file(fileName);
 		if (!file.IsOpened())
 			return false;
 
+		if (format == Format::Binary)
+		{
+			Vector<char> data;
+			WriteBinary(data, *this);
+			file.WriteData(data.Data(), data.Count());
+			return true;
+		}
+
+		String data = SaveAsString(format);
 		file.WriteData(data.Data(), data.Length());
 
-		return false;
+		return true;
 	}
 
 	String DataDocument::SaveAsString(Format format /*= Format::JSON*/) const
@@ -767,10 +992,34 @@ namespace o2
 			return buf;
 		}
 
+		if (format == Format::Binary)
+		{
+			Vector<char> data;
+			WriteBinary(data, *this);
+			return String(std::string(data.Data(), data.Count()));
+		}
+
 		return "";
 		//return XmlDataFormat::SaveDataDoc(*this);
 	}
 
+	void DataDocument::Reset()
+	{
+		SetNull();
+		mAllocator.Reset();
+
+		if (mMappedFile)
+		{
+			delete mMappedFile;
+			mMappedFile = nullptr;
+		}
+	}
+
+	size_t DataDocument::GetAllocatedMemory() const
+	{
+		return mAllocator.GetCapacity();
+	}
+
 	DataValue::Flags operator&(const DataValue::Flags& a, const DataValue::Flags& b)
 	{
 		return static_cast<DataValue::Flags>(
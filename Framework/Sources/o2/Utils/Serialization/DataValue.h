@@ -2,6 +2,7 @@
 
 #include "o2/Utils/Memory/Allocators/ChunkPoolAllocator.h"
 #include "o2/Utils/Types/Containers/Map.h"
+#include "o2/Utils/Types/Containers/SmallVector.h"
 #include "o2/Utils/Types/Containers/Vector.h"
 #include "o2/Utils/Types/String.h"
 #include "o2/Utils/Types/UID.h"
@@ -13,6 +14,7 @@
 namespace o2
 {
 	class ISerializable;
+	class MappedFile;
 
 	class DataDocument;
 	struct DataMember;
@@ -258,6 +260,12 @@ namespace o2
 		// Returns node by name.
 		const DataValue* FindMember(const char* name) const;
 
+		// Returns node by name and its precomputed hash from GetNameHash()
+		DataValue* FindMember(const char* name, UInt nameHash);
+
+		// Returns node by name and its precomputed hash from GetNameHash()
+		const DataValue* FindMember(const char* name, UInt nameHash) const;
+
 		// Add new node with name
 		DataValue& AddMember(DataValue& name);
 
@@ -296,6 +304,12 @@ namespace o2
 		template <typename _writer>
 		void Write(_writer& writer) const;
 
+		// Returns hash of member name, used for members lookup
+		static UInt GetNameHash(const char* name);
+
+		// Returns hash of member name with length, used for members lookup
+		static UInt GetNameHash(const char* name, int length);
+
 	public:
 		enum class Flags
 		{
@@ -326,6 +340,8 @@ namespace o2
 		static constexpr UInt ObjectInitialCapacity = 7;
 		static constexpr UInt ArrayInitialCapacity = 7;
 
+		static constexpr UInt MembersIndexMinCapacity = 16; // Minimal object capacity, when members hash index is built
+
 		struct IntData
 		{
 			int intValue;
@@ -371,6 +387,8 @@ namespace o2
 			}
 		};
 
+		// Object members. When capacity is at least MembersIndexMinCapacity, members are followed by open addressing
+		// hash index in same allocation. Index size is power of two, at least twice bigger than capacity
 		struct ObjectData
 		{
 			DataMember* members;
@@ -378,6 +396,13 @@ namespace o2
 			UInt capacity;
 		};
 
+		// Members hash index slot
+		struct MembersIndexSlot
+		{
+			UInt hash;   // Hash of member name
+			UInt member; // Index of member plus one, zero in empty slot
+		};
+
 		struct ArrayData
 		{
 			DataValue* elements;
@@ -408,12 +433,37 @@ namespace o2
 		// Constructor temporary string reference
 		explicit DataValue(const char* stringRef);
 
+		// Returns size of members hash index for object capacity. Returns zero when index isn't used
+		static UInt GetMembersIndexSize(UInt capacity);
+
+		// Returns size of members allocation with hash index for object capacity
+		static size_t GetMembersAllocationSize(UInt capacity);
+
+		// Rebuilds members hash index, called when members are reallocated
+		void RebuildMembersIndex();
+
+		// Adds member into hash index
+		void AddMemberToIndex(UInt member);
+
+		// Removes member from hash index and moves last member index to its place, called before member removing
+		void RemoveMemberFromIndex(UInt member);
+
+		// Returns members index slot, that contains member
+		MembersIndexSlot* FindMemberIndexSlot(UInt member) const;
+
+		// Returns member by name
+		const DataMember* FindMemberByName(const char* name) const;
+
+		// Returns member by name and its hash
+		const DataMember* FindMemberByHash(const char* name, UInt nameHash) const;
+
 		// Transcode wide char to char
 		static bool Transcode(rapidjson::GenericStringBuffer<rapidjson::UTF8<>>& target, const wchar_t* source);
 
 		// Transcode char to wide char
 		static bool Transcode(rapidjson::GenericStringBuffer<rapidjson::UTF16<>>& target, const char* source);
 
+		friend class BinaryDataDocumentReader;
 		friend class JsonDataDocumentParseHandler;
 
 		template<typename T>
@@ -461,7 +511,7 @@ namespace o2
 		template<typename _type>
 		DataDocument& operator=(const _type& value);
 
-		// Loads data structure from file
+		// Loads data structure from file. Binary file is memory mapped, its strings are used without copying
 		bool LoadFromFile(const String& fileName, Format format = Format::JSON);
 
 		// Loads data structure from string
@@ -473,9 +523,18 @@ namespace o2
 		// Saves data to string
 		String SaveAsString(Format format = Format::JSON) const;
 
+		// Sets document null and releases its memory, except first allocator chunk, that is reused
+		void Reset();
+
+		// Returns size of memory, allocated by document for values and strings
+		size_t GetAllocatedMemory() const;
+
 	protected:
 		ChunkPoolAllocator mAllocator;
 
+		MappedFile* mMappedFile = nullptr; // Mapped binary file, strings of document reference its data
+
+		friend class BinaryDataDocumentReader;
 		friend class DataValue;
 		friend class JsonDataDocumentParseHandler;
 	};
@@ -557,12 +557,12 @@ namespace o2
 		}
 	};
 
-	template<typename T>
-	struct DataValue::Converter<Vector<T>>
+	template<typename T, typename A>
+	struct DataValue::Converter<Vector<T, A>>
 	{
 		static constexpr bool isSupported = true;
 
-		static void Write(const Vector<T>& value, DataValue& data)
+		static void Write(const Vector<T, A>& value, DataValue& data)
 		{
 			data.mData.flagsData.flags = Flags::Array;
 			data.mData.arrayData.elements = nullptr;
@@ -573,7 +573,7 @@ namespace o2
 				data.AddElement() = DataValue(v, *data.mDocument);
 		}
 
-		static void Read(Vector<T>& value, const DataValue& data)
+		static void Read(Vector<T, A>& value, const DataValue& data)
 		{
 			if (data.IsArray())
 			{
@@ -588,6 +588,10 @@ namespace o2
 		}
 	};
 
+	template<typename T, int N>
+	struct DataValue::Converter<SmallVector<T, N>>: public DataValue::Converter<Vector<T, InlineAllocator<T, N>>>
+	{};
+
 	template<typename _key, typename _value>
 	struct DataValue::Converter<Map<_key, _value>>
 	{
@@ -713,12 +717,12 @@ namespace o2
 		}
 	};
 
-	template<typename T>
-	struct DataValue::DeltaConverter<Vector<T>>
+	template<typename T, typename A>
+	struct DataValue::DeltaConverter<Vector<T, A>>
 	{
 		static constexpr bool isSupported = true;
 
-		static void Write(const Vector<T>& value, const Vector<T>& origin, DataValue& data)
+		static void Write(const Vector<T, A>& value, const Vector<T, A>& origin, DataValue& data)
 		{
 			data.mData.flagsData.flags = Flags::Array;
 			data.mData.arrayData.elements = nullptr;
@@ -739,7 +743,7 @@ namespace o2
 			}
 		}
 
-		static void Read(Vector<T>& value, const Vector<T>& origin, const DataValue& data)
+		static void Read(Vector<T, A>& value, const Vector<T, A>& origin, const DataValue& data)
 		{
 			if (data.IsArray())
 			{
@@ -760,4 +764,8 @@ namespace o2
 			}
 		}
 	};
+
+	template<typename T, int N>
+	struct DataValue::DeltaConverter<SmallVector<T, N>>: public DataValue::DeltaConverter<Vector<T, InlineAllocator<T, N>>>
+	{};
 }
@@ -0,0 +1,552 @@
+#include "o2/stdafx.h"
+#include "JsonStream.h"
+
+#include "rapidjson/reader.h"
+#include "rapidjson/prettywriter.h"
+#include "o2/Utils/Serialization/Serializable.h"
+
+namespace o2
+{
+	bool SaveJsonStream(const ISerializable& object, const String& fileName)
+	{
+		JsonFileWriteStream stream(fileName);
+		if (!stream.IsOpened())
+			return false;
+
+		JsonStreamWriter writer(stream);
+		object.SerializeStream(writer);
+		stream.Flush();
+
+		return true;
+	}
+
+	bool LoadJsonStream(ISerializable& object, const String& fileName)
+	{
+		JsonFileReadStream stream(fileName);
+		if (!stream.IsOpened())
+			return false;
+
+		JsonStreamDeserializeHandler handler(object);
+		return handler.Parse(stream);
+	}
+
+	JsonFileWriteStream::JsonFileWriteStream(const String& fileName):
+		mFile(fileName)
+	{
+		mBuffer.Resize(bufferSize);
+	}
+
+	JsonFileWriteStream::~JsonFileWriteStream()
+	{
+		Flush();
+	}
+
+	bool JsonFileWriteStream::IsOpened() const
+	{
+		return mFile.IsOpened();
+	}
+
+	void JsonFileWriteStream::Flush()
+	{
+		if (mSize == 0)
+			return;
+
+		mFile.WriteData(mBuffer.Data(), mSize);
+		mWrittenSize += mSize;
+		mSize = 0;
+	}
+
+	size_t JsonFileWriteStream::GetWrittenSize() const
+	{
+		return mWrittenSize + mSize;
+	}
+
+	JsonFileReadStream::JsonFileReadStream(const String& fileName):
+		mFile(fileName)
+	{
+		mBuffer.Resize(bufferSize + 1);
+		mCurrent = mBuffer.Data();
+		mLast = mCurrent;
+
+		if (mFile.IsOpened())
+			mFileSize = mFile.GetDataSize();
+
+		ReadBlock();
+		mReadSize = 0;
+	}
+
+	bool JsonFileReadStream::IsOpened() const
+	{
+		return mFile.IsOpened();
+	}
+
+	void JsonFileReadStream::ReadBlock()
+	{
+		mReadSize += mLast - mBuffer.Data() + 1;
+
+		UInt size = Math::Min((UInt)bufferSize, mFileSize - mFilePosition);
+		if (size > 0)
+			mFile.ReadData(mBuffer.Data(), size);
+
+		mFilePosition += size;
+		mCurrent = mBuffer.Data();
+		mLast = mCurrent + size - 1;
+
+		if (mFilePosition == mFileSize)
+		{
+			mBuffer[size] = '\0';
+			mLast++;
+			mEof = true;
+		}
+	}
+
+	struct JsonStreamWriter::Impl
+	{
+		rapidjson::PrettyWriter<JsonFileWriteStream> writer; // Json writer into file stream
+
+		// Constructor
+		Impl(JsonFileWriteStream& stream):writer(stream) {}
+	};
+
+	JsonStreamWriter::JsonStreamWriter(JsonFileWriteStream& stream):
+		mImpl(mnew Impl(stream))
+	{}
+
+	JsonStreamWriter::~JsonStreamWriter()
+	{
+		delete mImpl;
+	}
+
+	JsonStreamWriter::MemberWriter JsonStreamWriter::AddMember(const char* name)
+	{
+		return MemberWriter{ *this, name };
+	}
+
+	void JsonStreamWriter::StartObject()
+	{
+		mImpl->writer.StartObject();
+	}
+
+	void JsonStreamWriter::Key(const char* name)
+	{
+		mImpl->writer.Key(name);
+	}
+
+	void JsonStreamWriter::EndObject()
+	{
+		mImpl->writer.EndObject();
+	}
+
+	void JsonStreamWriter::StartArray()
+	{
+		mImpl->writer.StartArray();
+	}
+
+	void JsonStreamWriter::EndArray()
+	{
+		mImpl->writer.EndArray();
+	}
+
+	void JsonStreamWriter::Write(const DataValue& value)
+	{
+		value.Write(mImpl->writer);
+	}
+
+	void JsonStreamWriter::WriteSerializableData(const ISerializable& object)
+	{
+		mScratch.SetObject();
+		object.Serialize(mScratch);
+		WriteScratch();
+	}
+
+	size_t JsonStreamWriter::GetPeakScratchMemory() const
+	{
+		return mPeakScratchMemory;
+	}
+
+	void JsonStreamWriter::WriteNull()
+	{
+		mImpl->writer.Null();
+	}
+
+	void JsonStreamWriter::WriteBool(bool value)
+	{
+		mImpl->writer.Bool(value);
+	}
+
+	void JsonStreamWriter::WriteInt(int value)
+	{
+		mImpl->writer.Int(value);
+	}
+
+	void JsonStreamWriter::WriteUInt(UInt value)
+	{
+		mImpl->writer.Uint(value);
+	}
+
+	void JsonStreamWriter::WriteInt64(Int64 value)
+	{
+		mImpl->writer.Int64(value);
+	}
+
+	void JsonStreamWriter::WriteUInt64(UInt64 value)
+	{
+		mImpl->writer.Uint64(value);
+	}
+
+	void JsonStreamWriter::WriteDouble(double value)
+	{
+		mImpl->writer.Double(value);
+	}
+
+	void JsonStreamWriter::WriteString(const char* value, int length)
+	{
+		mImpl->writer.String(value, length);
+	}
+
+	void JsonStreamWriter::WriteSerializablePointer(const ISerializable* value)
+	{
+		if (!value)
+		{
+			WriteNull();
+			return;
+		}
+
+		const String& typeName = value->GetType().GetName();
+
+		StartObject();
+		Key("Type");
+		WriteString(typeName.Data(), (int)typeName.Length());
+		Key("Value");
+		value->SerializeStream(*this);
+		EndObject();
+	}
+
+	void JsonStreamWriter::WriteScratch()
+	{
+		Write(mScratch);
+
+		mPeakScratchMemory = Math::Max(mPeakScratchMemory, mScratch.GetAllocatedMemory());
+		mScratch.Reset();
+	}
+
+	JsonStreamDeserializeHandler::JsonStreamDeserializeHandler(ISerializable& object):
+		mCapture(mScratch)
+	{
+		mRoot.object = &object;
+		mRoot.type = &object.GetType();
+
+		if (auto objectType = dynamic_cast<const ObjectType*>(mRoot.type))
+			mRoot.ptr = objectType->DynamicCastFromIObject(&object);
+	}
+
+	bool JsonStreamDeserializeHandler::Parse(JsonFileReadStream& stream)
+	{
+		rapidjson::Reader reader;
+		auto result = reader.Parse<rapidjson::kParseStopWhenDoneFlag>(stream, *this);
+
+		return !result.IsError();
+	}
+
+	size_t JsonStreamDeserializeHandler::GetPeakScratchMemory() const
+	{
+		return mPeakScratchMemory;
+	}
+
+	bool JsonStreamDeserializeHandler::Null()
+	{
+		BeginScalar();
+		mCapture.Null();
+		EndCapturedValue();
+		return true;
+	}
+
+	bool JsonStreamDeserializeHandler::Bool(bool value)
+	{
+		BeginScalar();
+		mCapture.Bool(value);
+		EndCapturedValue();
+		return true;
+	}
+
+	bool JsonStreamDeserializeHandler::Int(int value)
+	{
+		BeginScalar();
+		mCapture.Int(value);
+		EndCapturedValue();
+		return true;
+	}
+
+	bool JsonStreamDeserializeHandler::Uint(unsigned value)
+	{
+		BeginScalar();
+		mCapture.Uint(value);
+		EndCapturedValue();
+		return true;
+	}
+
+	bool JsonStreamDeserializeHandler::Int64(int64_t value)
+	{
+		BeginScalar();
+		mCapture.Int64(value);
+		EndCapturedValue();
+		return true;
+	}
+
+	bool JsonStreamDeserializeHandler::Uint64(uint64_t value)
+	{
+		BeginScalar();
+		mCapture.Uint64(value);
+		EndCapturedValue();
+		return true;
+	}
+
+	bool JsonStreamDeserializeHandler::Double(double value)
+	{
+		BeginScalar();
+		mCapture.Double(value);
+		EndCapturedValue();
+		return true;
+	}
+
+	bool JsonStreamDeserializeHandler::String(const char* str, unsigned length, bool copy)
+	{
+		BeginScalar();
+		mCapture.String(str, length, copy);
+		EndCapturedValue();
+		return true;
+	}
+
+	bool JsonStreamDeserializeHandler::RawNumber(const char* str, unsigned length, bool copy)
+	{
+		BeginScalar();
+		mCapture.RawNumber(str, length, copy);
+		EndCapturedValue();
+		return true;
+	}
+
+	bool JsonStreamDeserializeHandler::StartObject()
+	{
+		if (mCapturing)
+		{
+			mCaptureDepth++;
+			return mCapture.StartObject();
+		}
+
+		Target target = GetNextTarget();
+		if (target.object && target.object->IsStreamDeserializable())
+		{
+			Frame frame;
+			frame.objectPtr = target.ptr;
+			frame.objectType = target.type;
+			frame.fields = &GetTypeFields(target.type);
+			mFrames.Add(frame);
+
+			return true;
+		}
+
+		StartCapture(target);
+		mCaptureDepth = 1;
+		return mCapture.StartObject();
+	}
+
+	bool JsonStreamDeserializeHandler::Key(const char* str, unsigned length, bool copy)
+	{
+		if (mCapturing)
+			return mCapture.Key(str, length, copy);
+
+		Frame& frame = mFrames.Last();
+		frame.member = Target();
+
+		UInt hash = DataValue::GetNameHash(str, length);
+		for (auto& streamField : *frame.fields)
+		{
+			const FieldInfo* field = streamField.field;
+			if (field->GetNameHash() != hash || field->GetName().Length() != length ||
+				memcmp(field->GetName().Data(), str, length) != 0)
+			{
+				continue;
+			}
+
+			void* owner = frame.objectType->CastToBaseType(frame.objectPtr, *streamField.ownerType);
+
+			frame.member.ptr = field->GetValuePtrStrong(owner);
+			frame.member.type = field->GetType();
+			frame.member.field = field;
+			ResolveObject(frame.member);
+
+			break;
+		}
+
+		return true;
+	}
+
+	bool JsonStreamDeserializeHandler::EndObject(unsigned memberCount)
+	{
+		if (mCapturing)
+		{
+			if (!mCapture.EndObject(memberCount))
+				return false;
+
+			mCaptureDepth--;
+			EndCapturedValue();
+			return true;
+		}
+
+		mFrames.PopBack();
+		return true;
+	}
+
+	bool JsonStreamDeserializeHandler::StartArray()
+	{
+		if (mCapturing)
+		{
+			mCaptureDepth++;
+			return mCapture.StartArray();
+		}
+
+		Target target = GetNextTarget();
+		if (target.ptr && target.type && target.type->GetUsage() == Type::Usage::Vector)
+		{
+			auto vectorType = dynamic_cast<const VectorType*>(target.type);
+			if (vectorType->GetElementType() && vectorType->GetElementType()->GetSerializer())
+			{
+				vectorType->SetObjectVectorSize(target.ptr, 0);
+
+				Frame frame;
+				frame.vector = target.ptr;
+				frame.vectorType = vectorType;
+				mFrames.Add(frame);
+
+				return true;
+			}
+		}
+
+		StartCapture(target);
+		mCaptureDepth = 1;
+		return mCapture.StartArray();
+	}
+
+	bool JsonStreamDeserializeHandler::EndArray(unsigned elementCount)
+	{
+		if (mCapturing)
+		{
+			if (!mCapture.EndArray(elementCount))
+				return false;
+
+			mCaptureDepth--;
+			EndCapturedValue();
+			return true;
+		}
+
+		mFrames.PopBack();
+		return true;
+	}
+
+	JsonStreamDeserializeHandler::Target JsonStreamDeserializeHandler::GetNextTarget()
+	{
+		if (mFrames.IsEmpty())
+		{
+			if (mRootRead)
+				return Target();
+
+			mRootRead = true;
+			return mRoot;
+		}
+
+		Frame& frame = mFrames.Last();
+		if (frame.vectorType)
+		{
+			int idx = frame.vectorType->GetObjectVectorSize(frame.vector);
+			frame.vectorType->SetObjectVectorSize(frame.vector, idx + 1);
+
+			Target target;
+			target.ptr = frame.vectorType->GetObjectVectorElementPtr(frame.vector, idx);
+			target.type = frame.vectorType->GetElementType();
+			ResolveObject(target);
+
+			return target;
+		}
+
+		Target target = frame.member;
+		frame.member = Target();
+
+		return target;
+	}
+
+	void JsonStreamDeserializeHandler::ResolveObject(Target& target) const
+	{
+		if (!target.ptr || !target.type || target.type->GetUsage() != Type::Usage::Object)
+			return;
+
+		if (auto objectType = dynamic_cast<const ObjectType*>(target.type))
+			target.object = dynamic_cast<ISerializable*>(objectType->DynamicCastToIObject(target.ptr));
+	}
+
+	void JsonStreamDeserializeHandler::BeginScalar()
+	{
+		if (!mCapturing)
+			StartCapture(GetNextTarget());
+	}
+
+	void JsonStreamDeserializeHandler::EndCapturedValue()
+	{
+		if (mCaptureDepth == 0)
+			FinishCapture();
+	}
+
+	void JsonStreamDeserializeHandler::StartCapture(const Target& target)
+	{
+		mCaptureTarget = target;
+		mCaptureDepth = 0;
+		mCapturing = true;
+	}
+
+	void JsonStreamDeserializeHandler::FinishCapture()
+	{
+		DataValue* value = mCapture.stack.Pop<DataValue>();
+
+		if (mCaptureTarget.ptr)
+		{
+			if (mCaptureTarget.object)
+				mCaptureTarget.object->Deserialize(*value);
+			else if (mCaptureTarget.field)
+				mCaptureTarget.field->Deserialize(mCaptureTarget.ptr, *value);
+			else if (mCaptureTarget.type && mCaptureTarget.type->GetSerializer())
+				mCaptureTarget.type->GetSerializer()->Deserialize(mCaptureTarget.ptr, *value);
+		}
+
+		mPeakScratchMemory = Math::Max(mPeakScratchMemory, mScratch.GetAllocatedMemory());
+		mScratch.Reset();
+
+		mCaptureTarget = Target();
+		mCapturing = false;
+	}
+
+	const Vector<JsonStreamDeserializeHandler::StreamField>& JsonStreamDeserializeHandler::GetTypeFields(const Type* type)
+	{
+		auto fnd = mTypesFields.find(type);
+		if (fnd != mTypesFields.end())
+			return fnd->second;
+
+		auto& fields = mTypesFields[type];
+		CollectTypeFields(type, fields);
+
+		return fields;
+	}
+
+	void JsonStreamDeserializeHandler::CollectTypeFields(const Type* ownerType, Vector<StreamField>& fields) const
+	{
+		for (auto& baseType : ownerType->GetBaseTypes())
+		{
+			if (baseType.type->IsBasedOn(TypeOf(ISerializable)))
+				CollectTypeFields(baseType.type, fields);
+		}
+
+		for (auto& field : ownerType->GetFields())
+		{
+			if (field.HasAttribute<SerializableAttribute>())
+				fields.Add({ &field, ownerType });
+		}
+	}
+}
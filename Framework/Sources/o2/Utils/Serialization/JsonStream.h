@@ -0,0 +1,362 @@
+#pragma once
+#include "o2/Utils/FileSystem/File.h"
+#include "o2/Utils/Serialization/DataValue.h"
+#include "o2/Utils/Serialization/JsonDataFormat.h"
+#include "o2/Utils/Types/Containers/Vector.h"
+#include <unordered_map>
+
+namespace o2
+{
+	class FieldInfo;
+	class ISerializable;
+	class Type;
+	class VectorType;
+
+	// Serializes object into json file. Fields are written directly into file stream without building data document
+	// of whole object. Returns false when file can't be opened
+	bool SaveJsonStream(const ISerializable& object, const String& fileName);
+
+	// Deserializes object from json file. Reflected fields are read directly from parser events without building data
+	// document of whole file. Returns false when file can't be opened or parsed
+	bool LoadJsonStream(ISerializable& object, const String& fileName);
+
+	// ------------------------------------------------
+	// Buffered json output file stream for json writer
+	// ------------------------------------------------
+	class JsonFileWriteStream
+	{
+	public:
+		typedef char Ch;
+
+		static constexpr int bufferSize = 64*1024; // Size of buffer
+
+	public:
+		// Constructor. Opens file
+		JsonFileWriteStream(const String& fileName);
+
+		// Destructor. Flushes buffer
+		~JsonFileWriteStream();
+
+		// Returns true, if file was opened
+		bool IsOpened() const;
+
+		// Puts character into buffer
+		void Put(char c) { if (mSize == bufferSize) Flush(); mBuffer[mSize++] = c; }
+
+		// Writes buffer into file
+		void Flush();
+
+		// Returns count of written bytes
+		size_t GetWrittenSize() const;
+
+	protected:
+		OutFile      mFile;            // Output file
+		Vector<char> mBuffer;          // Characters buffer
+		int          mSize = 0;        // Count of characters in buffer
+		size_t       mWrittenSize = 0; // Count of written into file bytes
+	};
+
+	// ------------------------------------------------------------------------------------------
+	// Buffered json input file stream for json reader. Reads file by blocks, returns zero at end
+	// ------------------------------------------------------------------------------------------
+	class JsonFileReadStream
+	{
+	public:
+		typedef char Ch;
+
+		static constexpr int bufferSize = 64*1024; // Size of buffer
+
+	public:
+		// Constructor. Opens file and reads first block
+		JsonFileReadStream(const String& fileName);
+
+		// Returns true, if file was opened
+		bool IsOpened() const;
+
+		// Returns current character
+		char Peek() const { return *mCurrent; }
+
+		// Returns current character and moves to next
+		char Take() { char c = *mCurrent; Next(); return c; }
+
+		// Returns count of read characters
+		size_t Tell() const { return mReadSize + (mCurrent - mBuffer.Data()); }
+
+		// Not supported, used only for insitu parsing
+		char* PutBegin() { return nullptr; }
+		void Put(char) {}
+		void Flush() {}
+		size_t PutEnd(char*) { return 0; }
+
+	protected:
+		InFile       mFile;              // Input file
+		UInt         mFileSize = 0;      // Size of file
+		UInt         mFilePosition = 0;  // Count of bytes read from file
+		Vector<char> mBuffer;            // Block buffer. Zero character is set after last block
+		const char*  mCurrent = nullptr; // Current character in buffer
+		const char*  mLast = nullptr;    // Last character in buffer
+		size_t       mReadSize = 0;      // Count of characters in previous blocks
+		bool         mEof = false;       // Is file finished
+
+	protected:
+		// Moves to next character, reads next block when buffer is finished
+		void Next() { if (mCurrent < mLast) mCurrent++; else if (!mEof) ReadBlock(); }
+
+		// Reads next block from file. Sets zero character after last character of file
+		void ReadBlock();
+	};
+
+	// ----------------------------------------------------------------------------------------------------------------
+	// Streaming json writer. Used by serialization field processors in the same way as DataValue: AddMember(name) and
+	// Set(value). Primitives, strings, vectors and serializable objects are written directly into stream, other values
+	// are converted into small scratch data document, that is written and reused
+	// ----------------------------------------------------------------------------------------------------------------
+	class JsonStreamWriter
+	{
+	public:
+		// ---------------------------------------------------------------------------------
+		// Written object member. Writes name and value when it's set, like DataValue member
+		// ---------------------------------------------------------------------------------
+		struct MemberWriter
+		{
+			JsonStreamWriter& writer; // Owner writer
+			const char*       name;   // Member name
+
+			// Writes member name and value
+			template<typename _type>
+			void Set(const _type& value) { writer.Key(name); writer.WriteValue(value); }
+		};
+
+	public:
+		// Constructor
+		JsonStreamWriter(JsonFileWriteStream& stream);
+
+		// Destructor
+		~JsonStreamWriter();
+
+		// Returns member writer for current object
+		MemberWriter AddMember(const char* name);
+
+		// Starts object
+		void StartObject();
+
+		// Writes object member name
+		void Key(const char* name);
+
+		// Ends object
+		void EndObject();
+
+		// Starts array
+		void StartArray();
+
+		// Ends array
+		void EndArray();
+
+		// Writes data value
+		void Write(const DataValue& value);
+
+		// Writes serializable object through scratch data document. Used for objects with custom serialization
+		void WriteSerializableData(const ISerializable& object);
+
+		// Writes value. Serializable objects are written by their SerializeStream
+		template<typename _type>
+		void WriteValue(const _type& value);
+
+		// Writes vector as array
+		template<typename _type>
+		void WriteValue(const Vector<_type>& value);
+
+		// Returns maximum allocated memory of scratch data document
+		size_t GetPeakScratchMemory() const;
+
+	protected:
+		struct Impl;
+
+		Impl* mImpl; // Rapidjson writer implementation
+
+		DataDocument mScratch;               // Scratch document for values without direct writing
+		size_t       mPeakScratchMemory = 0; // Maximum allocated memory of scratch document
+
+	protected:
+		// Writes null value
+		void WriteNull();
+
+		// Writes boolean value
+		void WriteBool(bool value);
+
+		// Writes integer value
+		void WriteInt(int value);
+
+		// Writes unsigned integer value
+		void WriteUInt(UInt value);
+
+		// Writes 64 bit integer value
+		void WriteInt64(Int64 value);
+
+		// Writes 64 bit unsigned integer value
+		void WriteUInt64(UInt64 value);
+
+		// Writes floating point value
+		void WriteDouble(double value);
+
+		// Writes string value
+		void WriteString(const char* value, int length);
+
+		// Writes type name and value of serializable object by pointer, like DataValue does for IObject pointers
+		void WriteSerializablePointer(const ISerializable* value);
+
+		// Writes scratch document and resets it
+		void WriteScratch();
+	};
+
+	// --------------------------------------------------------------------------------------------------------------
+	// Json reader events handler, that deserializes object without building whole data document. Members of objects,
+	// that don't override deserialization, are matched with reflected serializable fields by name hash. Nested
+	// serializable objects and vectors are read directly into fields, other values are captured into scratch data
+	// document and deserialized by field serializer. Objects with custom deserialization are captured entirely
+	// --------------------------------------------------------------------------------------------------------------
+	class JsonStreamDeserializeHandler
+	{
+	public:
+		// Constructor
+		JsonStreamDeserializeHandler(ISerializable& object);
+
+		// Parses json from stream and deserializes object. Returns false when json is incorrect
+		bool Parse(JsonFileReadStream& stream);
+
+		// Returns maximum allocated memory of scratch data document
+		size_t GetPeakScratchMemory() const;
+
+		bool Null();
+		bool Bool(bool value);
+		bool Int(int value);
+		bool Uint(unsigned value);
+		bool Int64(int64_t value);
+		bool Uint64(uint64_t value);
+		bool Double(double value);
+		bool String(const char* str, unsigned length, bool copy);
+		bool RawNumber(const char* str, unsigned length, bool copy);
+		bool StartObject();
+		bool Key(const char* str, unsigned length, bool copy);
+		bool EndObject(unsigned memberCount);
+		bool StartArray();
+		bool EndArray(unsigned elementCount);
+
+	protected:
+		// -------------------------------------------------
+		// Serializable field of object type with owner type
+		// -------------------------------------------------
+		struct StreamField
+		{
+			const FieldInfo* field;     // Field info
+			const Type*      ownerType; // Field owner type, object type or its base type
+		};
+
+		// -------------------------------------------
+		// Value target: field, vector element or root
+		// -------------------------------------------
+		struct Target
+		{
+			void*            ptr = nullptr;    // Pointer to value. Null when value is skipped
+			const Type*      type = nullptr;   // Value type
+			const FieldInfo* field = nullptr;  // Field info, when value is field
+			ISerializable*   object = nullptr; // Serializable object, when value is serializable
+		};
+
+		// ---------------------------------------
+		// Reading object or vector, directly read
+		// ---------------------------------------
+		struct Frame
+		{
+			void*                      objectPtr = nullptr;  // Object pointer of its type, null for vector
+			const Type*                objectType = nullptr; // Object type
+			const Vector<StreamField>* fields = nullptr;     // Serializable fields of object type
+			Target                     member;               // Target of last key member
+
+			void*             vector = nullptr;     // Vector pointer
+			const VectorType* vectorType = nullptr; // Vector type
+		};
+
+	protected:
+		Target mRoot;             // Root object target
+		bool   mRootRead = false; // Is root value started
+
+		Vector<Frame> mFrames; // Reading objects and vectors stack
+
+		DataDocument                 mScratch;               // Scratch document for captured values
+		JsonDataDocumentParseHandler mCapture;               // Captured values handler
+		Target                       mCaptureTarget;         // Target of captured value
+		int                          mCaptureDepth = 0;      // Depth of captured objects and arrays
+		bool                         mCapturing = false;     // Is value capturing now
+		size_t                       mPeakScratchMemory = 0; // Maximum allocated memory of scratch document
+
+		std::unordered_map<const Type*, Vector<StreamField>> mTypesFields; // Cached serializable fields by types
+
+	protected:
+		// Returns target of next value: member of current object, new element of current vector or root
+		Target GetNextTarget();
+
+		// Fills serializable object of target, when its type is object
+		void ResolveObject(Target& target) const;
+
+		// Starts capturing scalar value, when it isn't inside captured value
+		void BeginScalar();
+
+		// Finishes capturing when captured value is completed
+		void EndCapturedValue();
+
+		// Starts capturing value for target
+		void StartCapture(const Target& target);
+
+		// Deserializes captured value into target and resets scratch document
+		void FinishCapture();
+
+		// Returns serializable fields of type, including serializable base types fields
+		const Vector<StreamField>& GetTypeFields(const Type* type);
+
+		// Collects serializable fields of owner type and its serializable base types
+		void CollectTypeFields(const Type* ownerType, Vector<StreamField>& fields) const;
+	};
+
+	template<typename _type>
+	void JsonStreamWriter::WriteValue(const _type& value)
+	{
+		if constexpr (std::is_same<_type, bool>::value)
+			WriteBool(value);
+		else if constexpr (std::is_same<_type, int>::value)
+			WriteInt(value);
+		else if constexpr (std::is_same<_type, UInt>::value)
+			WriteUInt(value);
+		else if constexpr (std::is_same<_type, Int64>::value)
+			WriteInt64(value);
+		else if constexpr (std::is_same<_type, UInt64>::value)
+			WriteUInt64(value);
+		else if constexpr (std::is_same<_type, float>::value || std::is_same<_type, double>::value)
+			WriteDouble((double)value);
+		else if constexpr (std::is_same<_type, o2::String>::value)
+			WriteString(value.Data(), (int)value.Length());
+		else if constexpr (std::is_base_of<ISerializable, _type>::value)
+			value.SerializeStream(*this);
+		else if constexpr (std::is_pointer<_type>::value && !std::is_const<_type>::value &&
+						   std::is_base_of<ISerializable, typename std::remove_pointer<_type>::type>::value)
+		{
+			WriteSerializablePointer(value);
+		}
+		else
+		{
+			mScratch.Set(value);
+			WriteScratch();
+		}
+	}
+
+	template<typename _type>
+	void JsonStreamWriter::WriteValue(const Vector<_type>& value)
+	{
+		StartArray();
+
+		for (const _type& element : value)
+			WriteValue(element);
+
+		EndArray();
+	}
+}
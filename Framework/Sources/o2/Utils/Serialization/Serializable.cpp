@@ -16,6 +16,11 @@ namespace o2
 		doc.LoadFromData(str);
 		Deserialize(doc);
 	}
+
+	void ISerializable::SerializeStream(JsonStreamWriter& writer) const
+	{
+		writer.WriteSerializableData(*this);
+	}
 }
 
 DECLARE_CLASS(o2::ISerializable);
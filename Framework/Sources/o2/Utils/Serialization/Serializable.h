@@ -3,6 +3,7 @@
 
 #include "o2/Utils/Types/Containers/Map.h"
 #include "o2/Utils/Serialization/DataValue.h"
+#include "o2/Utils/Serialization/JsonStream.h"
 #include "o2/Utils/Basic/IObject.h"
 #include "o2/Utils/Reflection/Reflection.h"
 #include "o2/Utils/Types/String.h"
@@ -35,6 +36,12 @@ namespace o2
 		// Deserializes data from string
 		void DeserializeFromString(const String& str);
 
+		// Serializes object into json stream writer. By default it's serialized through data document
+		virtual void SerializeStream(JsonStreamWriter& writer) const;
+
+		// Returns true when object can be deserialized directly from json stream by its reflected fields
+		virtual bool IsStreamDeserializable() const { return false; }
+
 		// Assign operator from data node
 		ISerializable& operator=(const DataValue& node) { return *this; };
 
@@ -56,6 +63,9 @@ namespace o2
 		// Deserializing object from data node
 		virtual void DeserializeDeltaBasic(const DataValue& node, const IObject& origin) {}
 
+		// Serializing object fields into json stream writer
+		virtual void SerializeStreamBasic(JsonStreamWriter& writer) const {}
+
 		// Beginning serialization callback
 		virtual void OnSerialize(DataValue& node) const {}
 
@@ -186,6 +196,56 @@ namespace o2
 		}
 	};
 
+	template<typename _type, typename _enable = void>
+	struct HasSerializeBasicOverride: std::false_type {};
+
+	template<typename T>
+	struct HasSerializeBasicOverride<T, typename std::void_t<decltype(&T::SerializeBasicOverride)>>: std::true_type {};
+
+	template<typename _type, typename _enable = void>
+	struct HasDeserializeBasicOverride: std::false_type {};
+
+	template<typename T>
+	struct HasDeserializeBasicOverride<T, typename std::void_t<decltype(&T::DeserializeBasicOverride)>>: std::true_type {};
+
+	template<typename _type, typename _enable = void>
+	struct CheckSerializeStreamOverridden
+	{
+		// Serialization or callback is overridden, serializing through data document
+		static void Process(_type* object, JsonStreamWriter& writer)
+		{
+			writer.WriteSerializableData(*object);
+		}
+	};
+
+	template<typename T>
+	struct CheckSerializeStreamOverridden<T, typename std::enable_if<!HasSerializeBasicOverride<T>::value &&
+		std::is_same<decltype(&T::OnSerialize), void (ISerializable::*)(DataValue&) const>::value>::type>
+	{
+		// Default serialization way, fields are written directly
+		static void Process(T* object, JsonStreamWriter& writer)
+		{
+			writer.StartObject();
+			object->SerializeStreamBasic(writer);
+			writer.EndObject();
+		}
+	};
+
+	template<typename _type, typename _enable = void>
+	struct CheckDeserializeStreamOverridden
+	{
+		// Deserialization or callback is overridden, object is deserialized from data document
+		static constexpr bool isStreamable = false;
+	};
+
+	template<typename T>
+	struct CheckDeserializeStreamOverridden<T, typename std::enable_if<!HasDeserializeBasicOverride<T>::value &&
+		std::is_same<decltype(&T::OnDeserialized), void (ISerializable::*)(const DataValue&)>::value>::type>
+	{
+		// Default deserialization way, fields can be read directly
+		static constexpr bool isStreamable = true;
+	};
+
 	// ----------------------------
 	// Serializable field attribute
 	// ----------------------------
@@ -300,7 +360,7 @@ namespace o2
 			{
 				_field_type* fieldPtr = (_field_type*)((*pointerGetter)(object));
 
-				if (auto m = _base::node.FindMember(name))
+				if (auto m = _base::FindFieldMember(name))
 					m->Get(*fieldPtr);
 
 				return *this;
@@ -386,7 +446,7 @@ namespace o2
 				_field_type* fieldPtr = (_field_type*)((*pointerGetter)(object));
 				_field_type* originFieldPtr = (_field_type*)((*pointerGetter)(&const_cast<_object_type&>(_base::origin)));
 
-				if (auto m = _base::node.FindMember(name); m && !m->IsNull())
+				if (auto m = _base::FindFieldMember(name); m && !m->IsNull())
 					m->GetDelta(*fieldPtr, *originFieldPtr);
 				else
 				{
@@ -562,6 +622,12 @@ namespace o2
 	template<typename __type, typename _enable>       															                       \
 	friend struct o2::CheckDeserializeDeltaBasicOverridden;																               \
                                                                                                                                        \
+	template<typename __type, typename _enable>                                                                                        \
+	friend struct o2::CheckSerializeStreamOverridden;                                                                                  \
+	                                                                                                                                   \
+	template<typename __type, typename _enable>                                                                                        \
+	friend struct o2::CheckDeserializeStreamOverridden;                                                                                \
+                                                                                                                                       \
     void SerializeBasic(o2::DataValue& node) const override                                                                            \
     {						                                                                                                           \
     	o2::SerializeTypeProcessor processor(node);                                                                                    \
@@ -602,6 +668,20 @@ namespace o2
     {												                                                                                   \
 		o2::CheckDeserializeDeltaBasicOverridden<CLASS>::Process(const_cast<CLASS*>(this), dynamic_cast<const CLASS*>(&origin), node); \
 	}												                                                                                   \
+    void SerializeStreamBasic(o2::JsonStreamWriter& writer) const override                                                             \
+    {                                                                                                                                  \
+    	o2::SerializeStreamTypeProcessor processor(writer);                                                                            \
+		ProcessBaseTypes(const_cast<CLASS*>(this), processor);                                                                         \
+		ProcessFields(const_cast<CLASS*>(this), processor);                                                                            \
+	}                                                                                                                                  \
+    void SerializeStream(o2::JsonStreamWriter& writer) const override                                                                  \
+    {                                                                                                                                  \
+		o2::CheckSerializeStreamOverridden<CLASS>::Process(const_cast<CLASS*>(this), writer);                                          \
+	}                                                                                                                                  \
+    bool IsStreamDeserializable() const override                                                                                       \
+    {                                                                                                                                  \
+		return o2::CheckDeserializeStreamOverridden<CLASS>::isStreamable;                                                              \
+	}                                                                                                                                  \
 	CLASS& operator=(const o2::DataValue& node) 		                                                                               \
 	{												                                                                                   \
 		Deserialize(node); return *this; 			                                                                                   \
@@ -644,10 +724,13 @@ CLASS_METHODS_META(o2::ISerializable)
 	FUNCTION().PUBLIC().SIGNATURE(void, DeserializeDelta, const DataValue&, const IObject&);
 	FUNCTION().PUBLIC().SIGNATURE(String, SerializeToString);
 	FUNCTION().PUBLIC().SIGNATURE(void, DeserializeFromString, const String&);
+	FUNCTION().PUBLIC().SIGNATURE(void, SerializeStream, JsonStreamWriter&);
+	FUNCTION().PUBLIC().SIGNATURE(bool, IsStreamDeserializable);
 	FUNCTION().PROTECTED().SIGNATURE(void, SerializeBasic, DataValue&);
 	FUNCTION().PROTECTED().SIGNATURE(void, DeserializeBasic, const DataValue&);
 	FUNCTION().PROTECTED().SIGNATURE(void, SerializeDeltaBasic, DataValue&, const IObject&);
 	FUNCTION().PROTECTED().SIGNATURE(void, DeserializeDeltaBasic, const DataValue&, const IObject&);
+	FUNCTION().PROTECTED().SIGNATURE(void, SerializeStreamBasic, JsonStreamWriter&);
 	FUNCTION().PROTECTED().SIGNATURE(void, OnSerialize, DataValue&);
 	FUNCTION().PROTECTED().SIGNATURE(void, OnDeserialized, const DataValue&);
 	FUNCTION().PROTECTED().SIGNATURE(void, OnSerializeDelta, DataValue&, const IObject&);
@@ -1,5 +1,6 @@
 #pragma once
 #include "o2/Utils/Serialization/DataValue.h"
+#include "o2/Utils/Serialization/JsonStream.h"
 #include "o2/Utils/Basic/IObject.h"
 #include "o2/Utils/Reflection/Reflection.h"
 
@@ -114,6 +115,96 @@ namespace o2
 		};
 	};
 
+	// -------------------------------------------------------------------------------------------------
+	// Serialization into json stream writer. Same as SerializeTypeProcessor, but members are written by
+	// JsonStreamWriter instead of data value, so attributes field processors are used without changes
+	// -------------------------------------------------------------------------------------------------
+	class SerializeStreamTypeProcessor
+	{
+	public:
+		struct BaseFieldProcessor;
+
+	public:
+		JsonStreamWriter& node;
+
+	public:
+		SerializeStreamTypeProcessor(JsonStreamWriter& node):node(node) {}
+
+		template<typename _object_type>
+		void StartBases(_object_type* object, Type* type) {}
+
+		template<typename _object_type>
+		void StartFields(_object_type* object, Type* type) {}
+
+		template<typename _object_type, typename _base_type>
+		void BaseType(_object_type* object, Type* type, const char* name)
+		{
+			if constexpr (std::is_base_of<ISerializable, _base_type>::value && !std::is_same<ISerializable, _base_type>::value)
+				object->_base_type::SerializeStreamBasic(node);
+		}
+
+		BaseFieldProcessor StartField()
+		{
+			return BaseFieldProcessor(node);
+		}
+
+		struct BaseFieldProcessor
+		{
+			JsonStreamWriter& node;
+
+			BaseFieldProcessor(JsonStreamWriter& node):node(node) {}
+
+			template<typename _base, typename _attribute_type>
+			struct AttributeWrapper: public _attribute_type::template SerializeFieldProcessor<_base>
+			{
+				template<typename ... _args>
+				AttributeWrapper(const _base& base, _args ... args):_attribute_type::template SerializeFieldProcessor<_base>(base, args ...) {}
+			};
+
+			template<typename _base, typename _attribute_type, typename ... _args>
+			auto AddAttributeImpl(const _base& base, _args ... args)
+			{
+				if constexpr (HasAttributeSerializeProcessor<_attribute_type>::value)
+				{
+					return AttributeWrapper<_base, _attribute_type>(base, args ...);
+				}
+				else
+					return *this;
+			}
+
+			template<typename _attribute_type, typename ... _args>
+			auto AddAttribute(_args ... args)
+			{
+				return AddAttributeImpl<BaseFieldProcessor, _attribute_type, _args ...>(*this, args ...);
+			}
+
+			template<typename _type>
+			BaseFieldProcessor& SetDefaultValue(const _type& value)
+			{
+				return *this;
+			}
+
+			template<typename _object_type, typename _field_type>
+			BaseFieldProcessor& FieldBasics(_object_type* object, Type* type, const char* name, void*(*pointerGetter)(void*),
+											_field_type& field)
+			{
+				return *this;
+			}
+
+			BaseFieldProcessor& SetProtectSection(ProtectSection section)
+			{
+				return *this;
+			}
+
+			template<typename _object_type, typename _field_type>
+			bool CheckSerialize(_object_type* object, Type* type, const char* name, void*(*pointerGetter)(void*),
+								_field_type& field)
+			{
+				return true;
+			}
+		};
+	};
+
 	class DeserializeTypeProcessor
 	{
 	public:
@@ -125,6 +216,9 @@ namespace o2
 	public:
 		const DataValue& node;
 
+		const Vector<FieldInfo>* fields = nullptr; // Reflected fields of type, in same order as processed fields
+		int                      fieldIdx = 0;     // Index of next processed field
+
 	public:
 		DeserializeTypeProcessor(const DataValue& node):node(node) {}
 
@@ -132,7 +226,11 @@ namespace o2
 		void StartBases(_object_type* object, Type* type) {}
 
 		template<typename _object_type>
-		void StartFields(_object_type* object, Type* type) {}
+		void StartFields(_object_type* object, Type* type)
+		{
+			fields = type ? &type->GetFields() : nullptr;
+			fieldIdx = 0;
+		}
 
 		template<typename _object_type, typename _base_type>
 		void BaseType(_object_type* object, Type* type, const char* name)
@@ -143,14 +241,27 @@ namespace o2
 
 		BaseFieldProcessor StartField()
 		{
-			return BaseFieldProcessor(node);
+			const FieldInfo* fieldInfo = fields && fieldIdx < fields->Count() ? &(*fields)[fieldIdx] : nullptr;
+			fieldIdx++;
+
+			return BaseFieldProcessor(node, fieldInfo);
 		}
 
 		struct BaseFieldProcessor
 		{
 			const DataValue& node;
+			const FieldInfo* fieldInfo; // Reflected field info, used for cached name hash. Can be null
+
+			BaseFieldProcessor(const DataValue& node, const FieldInfo* fieldInfo = nullptr):node(node), fieldInfo(fieldInfo) {}
 
-			BaseFieldProcessor(const DataValue& node):node(node) {}
+			// Returns node member by field name, uses field info name hash when field info is for same name
+			const DataValue* FindFieldMember(const char* name) const
+			{
+				if (fieldInfo && fieldInfo->GetName() == name)
+					return node.FindMember(name, fieldInfo->GetNameHash());
+
+				return node.FindMember(name);
+			}
 			
 			template<typename _base, typename _attribute_type>
 			struct AttributeWrapper: public _attribute_type::template DeserializeFieldProcessor<_base>
@@ -296,6 +407,9 @@ namespace o2
 		const DataValue& node;
 		const _origin_type& origin;
 
+		const Vector<FieldInfo>* fields = nullptr; // Reflected fields of type, in same order as processed fields
+		int                      fieldIdx = 0;     // Index of next processed field
+
 	public:
 		DeserializeDeltaTypeProcessor(const DataValue& node, const _origin_type& origin):node(node), origin(origin) {}
 
@@ -303,7 +417,11 @@ namespace o2
 		void StartBases(_object_type* object, Type* type) {}
 
 		template<typename _object_type>
-		void StartFields(_object_type* object, Type* type) {}
+		void StartFields(_object_type* object, Type* type)
+		{
+			fields = type ? &type->GetFields() : nullptr;
+			fieldIdx = 0;
+		}
 
 		template<typename _object_type, typename _base_type>
 		void BaseType(_object_type* object, Type* type, const char* name)
@@ -314,17 +432,31 @@ namespace o2
 
 		BaseFieldProcessor StartField()
 		{
-			return BaseFieldProcessor(node, origin);
+			const FieldInfo* fieldInfo = fields && fieldIdx < fields->Count() ? &(*fields)[fieldIdx] : nullptr;
+			fieldIdx++;
+
+			return BaseFieldProcessor(node, origin, fieldInfo);
 		}
 
 		struct BaseFieldProcessor
 		{
 			const DataValue& node;
 			const _origin_type& origin;
+			const FieldInfo* fieldInfo; // Reflected field info, used for cached name hash. Can be null
 
 			typedef _origin_type OriginType;
 
-			BaseFieldProcessor(const DataValue& node, const _origin_type& origin):node(node), origin(origin) {}
+			BaseFieldProcessor(const DataValue& node, const _origin_type& origin, const FieldInfo* fieldInfo = nullptr):
+				node(node), origin(origin), fieldInfo(fieldInfo) {}
+
+			// Returns node member by field name, uses field info name hash when field info is for same name
+			const DataValue* FindFieldMember(const char* name) const
+			{
+				if (fieldInfo && fieldInfo->GetName() == name)
+					return node.FindMember(name, fieldInfo->GetNameHash());
+
+				return node.FindMember(name);
+			}
 
 			template<typename _base, typename _attribute_type>
 			struct AttributeWrapper: public _attribute_type::template DeserializeDeltaFieldProcessor<_base>
@@ -0,0 +1,320 @@
+#include "o2/stdafx.h"
+#include "JobSystem.h"
+
+#include "o2/Utils/Debug/Profiler.h"
+
+namespace o2
+{
+	DECLARE_SINGLETON(JobSystem);
+
+	// ---------------------------------------------------------------------------------------------
+	// Scheduled job. Queued when waiting dependencies counter becomes zero. Continuations are jobs
+	// waiting this one
+	// ---------------------------------------------------------------------------------------------
+	class Job
+	{
+	public:
+		Function<void()> function; // Job function
+
+		std::atomic<int>  refsCount;           // References count: job system and handles
+		std::atomic<int>  waitingDependencies; // Count of not done dependencies
+		std::atomic<bool> done;                // Is job done
+
+		std::mutex   continuationsMutex; // Continuations and done flag mutex
+		Vector<Job*> continuations;      // Jobs waiting this one
+
+	public:
+		// Constructor
+		Job(const Function<void()>& function):
+			function(function), refsCount(1), waitingDependencies(1), done(false)
+		{}
+	};
+
+	static thread_local int currentThreadIndex = -1;
+
+	JobHandle::JobHandle()
+	{}
+
+	JobHandle::JobHandle(Job* job):
+		mJob(job)
+	{
+		if (mJob)
+			mJob->refsCount++;
+	}
+
+	JobHandle::JobHandle(const JobHandle& other):
+		JobHandle(other.mJob)
+	{}
+
+	JobHandle::~JobHandle()
+	{
+		if (mJob)
+			JobSystem::Release(mJob);
+	}
+
+	JobHandle& JobHandle::operator=(const JobHandle& other)
+	{
+		if (other.mJob)
+			other.mJob->refsCount++;
+
+		if (mJob)
+			JobSystem::Release(mJob);
+
+		mJob = other.mJob;
+		return *this;
+	}
+
+	bool JobHandle::IsValid() const
+	{
+		return mJob != nullptr;
+	}
+
+	bool JobHandle::IsDone() const
+	{
+		return !mJob || mJob->done;
+	}
+
+	void JobHandle::Wait() const
+	{
+		o2Jobs.Wait(*this);
+	}
+
+	JobSystem::JobSystem(int threadsCount /*= 0*/):
+		mQueuedJobsCount(0), mStopping(false), mWaitingThreadsCount(0)
+	{
+		if (threadsCount <= 0)
+			threadsCount = Math::Max(1, (int)std::thread::hardware_concurrency());
+
+		currentThreadIndex = 0;
+
+		for (int i = 0; i < threadsCount; i++)
+			mQueues.Add(mnew ThreadQueue());
+
+		for (int i = 1; i < threadsCount; i++)
+			mThreads.emplace_back(&JobSystem::WorkerThread, this, i);
+	}
+
+	JobSystem::~JobSystem()
+	{
+		while (Job* job = TryGetJob(0))
+			Execute(job);
+
+		mStopping = true;
+
+		{
+			std::lock_guard<std::mutex> lock(mSleepMutex);
+		}
+		mSleepCondition.notify_all();
+
+		for (auto& thread : mThreads)
+			thread.join();
+
+		for (auto queue : mQueues)
+			delete queue;
+
+		currentThreadIndex = -1;
+	}
+
+	JobHandle JobSystem::Schedule(const Function<void()>& func, const Vector<JobHandle>& dependencies /*= Vector<JobHandle>()*/)
+	{
+		Job* job = mnew Job(func);
+		JobHandle handle(job);
+
+		for (auto& dependency : dependencies)
+		{
+			if (!dependency.mJob)
+				continue;
+
+			std::lock_guard<std::mutex> lock(dependency.mJob->continuationsMutex);
+			if (!dependency.mJob->done)
+			{
+				job->waitingDependencies++;
+				dependency.mJob->continuations.Add(job);
+			}
+		}
+
+		// Initial waiting counter value protects job from queueing while dependencies are adding
+		if (--job->waitingDependencies == 0)
+			Enqueue(job);
+
+		return handle;
+	}
+
+	JobHandle JobSystem::ScheduleParallelFor(int count, int batchSize, const Function<void(int, int)>& func,
+											 const Vector<JobHandle>& dependencies /*= Vector<JobHandle>()*/)
+	{
+		batchSize = Math::Max(1, batchSize);
+
+		Vector<JobHandle> batches;
+		batches.reserve((count + batchSize - 1)/batchSize);
+
+		for (int begin = 0; begin < count; begin += batchSize)
+		{
+			int end = Math::Min(begin + batchSize, count);
+			batches.Add(Schedule([=]() { func(begin, end); }, dependencies));
+		}
+
+		return Schedule(Function<void()>(), batches);
+	}
+
+	void JobSystem::ParallelFor(int count, int batchSize, const Function<void(int, int)>& func)
+	{
+		Wait(ScheduleParallelFor(count, batchSize, func));
+	}
+
+	void JobSystem::Wait(const JobHandle& handle)
+	{
+		int threadIndex = currentThreadIndex;
+		while (!handle.IsDone())
+		{
+			if (threadIndex >= 0)
+			{
+				if (Job* job = TryGetJob(threadIndex))
+				{
+					Execute(job);
+					continue;
+				}
+			}
+
+			// Nothing to execute, sleeping until some job is done or queued. Waiting counter is increased before
+			// checking condition, and notifiers check it after changing state, so wake up can't be missed
+			std::unique_lock<std::mutex> lock(mSleepMutex);
+			mWaitingThreadsCount++;
+			mWaitCondition.wait(lock, [&]() { return handle.IsDone() || (threadIndex >= 0 && mQueuedJobsCount > 0); });
+			mWaitingThreadsCount--;
+		}
+	}
+
+	void JobSystem::WaitAll(const Vector<JobHandle>& handles)
+	{
+		for (auto& handle : handles)
+			Wait(handle);
+	}
+
+	int JobSystem::GetThreadsCount() const
+	{
+		return mQueues.Count();
+	}
+
+	int JobSystem::GetCurrentThreadIndex()
+	{
+		return currentThreadIndex;
+	}
+
+	void JobSystem::WorkerThread(int threadIndex)
+	{
+		currentThreadIndex = threadIndex;
+		o2Profiler.SetCurrentThreadName("Worker " + (String)threadIndex);
+
+		while (true)
+		{
+			if (Job* job = TryGetJob(threadIndex))
+			{
+				Execute(job);
+				continue;
+			}
+
+			std::unique_lock<std::mutex> lock(mSleepMutex);
+			mSleepCondition.wait(lock, [&]() { return mStopping || mQueuedJobsCount > 0; });
+
+			if (mStopping)
+				break;
+		}
+	}
+
+	void JobSystem::Enqueue(Job* job)
+	{
+		ThreadQueue* queue = mQueues[Math::Max(0, currentThreadIndex)];
+
+		{
+			std::lock_guard<std::mutex> lock(queue->mutex);
+			queue->jobs.push_back(job);
+		}
+
+		mQueuedJobsCount++;
+
+		{
+			std::lock_guard<std::mutex> lock(mSleepMutex);
+		}
+		mSleepCondition.notify_one();
+
+		NotifyWaitingThreads();
+	}
+
+	void JobSystem::NotifyWaitingThreads()
+	{
+		if (mWaitingThreadsCount == 0)
+			return;
+
+		{
+			std::lock_guard<std::mutex> lock(mSleepMutex);
+		}
+		mWaitCondition.notify_all();
+	}
+
+	Job* JobSystem::TryGetJob(int threadIndex)
+	{
+		if (mQueuedJobsCount == 0)
+			return nullptr;
+
+		ThreadQueue* ownQueue = mQueues[threadIndex];
+		{
+			std::lock_guard<std::mutex> lock(ownQueue->mutex);
+			if (!ownQueue->jobs.empty())
+			{
+				Job* job = ownQueue->jobs.back();
+				ownQueue->jobs.pop_back();
+				mQueuedJobsCount--;
+				return job;
+			}
+		}
+
+		for (int i = 1; i < mQueues.Count(); i++)
+		{
+			ThreadQueue* queue = mQueues[(threadIndex + i)%mQueues.Count()];
+
+			std::lock_guard<std::mutex> lock(queue->mutex);
+			if (!queue->jobs.empty())
+			{
+				Job* job = queue->jobs.front();
+				queue->jobs.pop_front();
+				mQueuedJobsCount--;
+				return job;
+			}
+		}
+
+		return nullptr;
+	}
+
+	void JobSystem::Execute(Job* job)
+	{
+		if (!job->function.IsEmpty())
+		{
+			PROFILE_SCOPE("Job");
+			job->function();
+		}
+
+		Vector<Job*> continuations;
+		{
+			std::lock_guard<std::mutex> lock(job->continuationsMutex);
+			job->done = true;
+			continuations.swap(job->continuations);
+		}
+
+		for (auto continuation : continuations)
+		{
+			if (--continuation->waitingDependencies == 0)
+				Enqueue(continuation);
+		}
+
+		NotifyWaitingThreads();
+
+		Release(job);
+	}
+
+	void JobSystem::Release(Job* job)
+	{
+		if (--job->refsCount == 0)
+			delete job;
+	}
+}
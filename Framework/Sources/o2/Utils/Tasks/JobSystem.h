@@ -0,0 +1,140 @@
+#pragma once
+
+#include "o2/Utils/Function/Function.h"
+#include "o2/Utils/Singleton.h"
+#include "o2/Utils/Types/Containers/Vector.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+// Job system access macros
+#define o2Jobs o2::JobSystem::Instance()
+
+namespace o2
+{
+	class Job;
+
+	// --------------------------------------------------------------------------------------
+	// Handle of scheduled job. Keeps job alive while exists; used to wait job and to declare
+	// dependencies of other jobs. Empty handle is always done
+	// --------------------------------------------------------------------------------------
+	class JobHandle
+	{
+	public:
+		// Default constructor, empty handle
+		JobHandle();
+
+		// Copy-constructor
+		JobHandle(const JobHandle& other);
+
+		// Destructor. Releases job
+		~JobHandle();
+
+		// Copy-operator
+		JobHandle& operator=(const JobHandle& other);
+
+		// Returns true when handle refers to job
+		bool IsValid() const;
+
+		// Returns true when job is done
+		bool IsDone() const;
+
+		// Waits job. Calling thread executes other jobs while waiting
+		void Wait() const;
+
+	protected:
+		Job* mJob = nullptr; // Referenced job
+
+	protected:
+		// Constructor with job, retains it
+		JobHandle(Job* job);
+
+		friend class JobSystem;
+	};
+
+	// ---------------------------------------------------------------------------------------------------
+	// Work stealing job system. Has pool of worker threads, each worker has own jobs queue. Worker takes
+	// jobs from the back of own queue and steals from the front of other queues when own is empty.
+	// Job is queued when all it's dependencies are done. Main thread executes jobs while waiting.
+	// With one thread jobs are executed only while waiting
+	// ---------------------------------------------------------------------------------------------------
+	class JobSystem: public Singleton<JobSystem>
+	{
+	public:
+		// Schedules job. It will be executed after all dependencies are done
+		JobHandle Schedule(const Function<void()>& func, const Vector<JobHandle>& dependencies = Vector<JobHandle>());
+
+		// Schedules parallel for: splits range [0, count) into batches and calls func(begin, end) for each batch.
+		// Returned handle is done when all batches are done
+		JobHandle ScheduleParallelFor(int count, int batchSize, const Function<void(int, int)>& func,
+									  const Vector<JobHandle>& dependencies = Vector<JobHandle>());
+
+		// Runs parallel for and waits it. Calling thread executes batches too
+		void ParallelFor(int count, int batchSize, const Function<void(int, int)>& func);
+
+		// Waits job. Calling thread executes other jobs while waiting and sleeps when there are no jobs to execute
+		void Wait(const JobHandle& handle);
+
+		// Waits all jobs
+		void WaitAll(const Vector<JobHandle>& handles);
+
+		// Returns count of threads executing jobs, including main thread
+		int GetThreadsCount() const;
+
+		// Returns index of current thread in job system: 0 for main thread, -1 for threads out of job system
+		static int GetCurrentThreadIndex();
+
+	protected:
+		// -------------------------------------------------------------------------------------
+		// Thread jobs queue. Owner pushes and pops from the back, other threads steal from front
+		// -------------------------------------------------------------------------------------
+		struct ThreadQueue
+		{
+			std::mutex       mutex; // Queue access mutex
+			std::deque<Job*> jobs;  // Queued jobs
+		};
+
+	protected:
+		Vector<std::thread>  mThreads; // Worker threads
+		Vector<ThreadQueue*> mQueues;  // Jobs queues by thread index. First is main thread queue
+
+		std::atomic<int>  mQueuedJobsCount; // Count of jobs in all queues
+		std::atomic<bool> mStopping;        // Is system stopping, workers must exit
+
+		std::mutex              mSleepMutex;     // Mutex of sleeping workers and waiting threads
+		std::condition_variable mSleepCondition; // Condition for sleeping workers, notifies when job queued
+
+		std::condition_variable mWaitCondition;       // Condition for waiting threads, notifies when job queued or done
+		std::atomic<int>        mWaitingThreadsCount; // Count of threads sleeping in waiting
+
+	protected:
+		// Constructor. Creates worker threads; threads count includes main thread, hardware threads count when zero
+		JobSystem(int threadsCount = 0);
+
+		// Destructor. Executes rest jobs and stops worker threads
+		~JobSystem();
+
+		// Worker thread function
+		void WorkerThread(int threadIndex);
+
+		// Puts job into current thread queue and wakes up worker and waiting threads
+		void Enqueue(Job* job);
+
+		// Wakes up waiting threads, when there are any
+		void NotifyWaitingThreads();
+
+		// Returns job from thread queue or steals from other queues. Returns null when there are no jobs
+		Job* TryGetJob(int threadIndex);
+
+		// Executes job, marks it done and queues it's continuations
+		void Execute(Job* job);
+
+		// Releases job reference, deletes job when no references left
+		static void Release(Job* job);
+
+		friend class Application;
+		friend class JobHandle;
+	};
+}
@@ -54,14 +54,57 @@ namespace o2
 		return mRects.Max<int>([&](Rect* rt) { return rt->page; })->page + 1;
 	}
 
+	void RectsPacker::SetAlgorithm(Algorithm algorithm)
+	{
+		mAlgorithm = algorithm;
+	}
+
+	RectsPacker::Algorithm RectsPacker::GetAlgorithm() const
+	{
+		return mAlgorithm;
+	}
+
+	void RectsPacker::SetRotationAllowed(bool allowed)
+	{
+		mRotationAllowed = allowed;
+	}
+
+	bool RectsPacker::IsRotationAllowed() const
+	{
+		return mRotationAllowed;
+	}
+
 	bool RectsPacker::Pack()
 	{
 		for (auto node : mQuadNodes)
 			delete node;
 
 		mQuadNodes.Clear();
+		mFreeRects.Clear();
+
+		mRects.ForEach([](Rect* rt) { rt->page = -1; rt->rect = RectI(); rt->rotated = false; });
+
+		if (mAlgorithm == Algorithm::MaxRects)
+			return PackMaxRects();
+
+		return PackQuadTree();
+	}
+
+	float RectsPacker::GetPackingEfficiency() const
+	{
+		int pagesCount = GetPagesCount();
+		if (pagesCount == 0)
+			return 0.0f;
 
-		mRects.ForEach([](Rect* rt) { rt->page = -1; rt->rect = RectI(); });
+		float rectsArea = 0.0f;
+		for (auto rt : mRects)
+			rectsArea += rt->size.x*rt->size.y;
+
+		return rectsArea/(mMaxSize.x*mMaxSize.y*pagesCount);
+	}
+
+	bool RectsPacker::PackQuadTree()
+	{
 		mRects.Sort([](auto a, auto b) { return a->size.y > b->size.y; });
 
 		for (auto rt : mRects)
@@ -73,6 +116,144 @@ namespace o2
 		return true;
 	}
 
+	bool RectsPacker::PackMaxRects()
+	{
+		// Big rectangles are placed first, small ones fill gaps between them
+		mRects.Sort([](auto a, auto b) {
+			float aMax = Math::Max(a->size.x, a->size.y), bMax = Math::Max(b->size.x, b->size.y);
+			if (!Math::Equals(aMax, bMax))
+				return aMax > bMax;
+
+			return a->size.x*a->size.y > b->size.x*b->size.y;
+		});
+
+		for (auto rt : mRects)
+		{
+			if (TryPlaceMaxRects(*rt))
+				continue;
+
+			mFreeRects.Add(Vector<RectF>());
+			mFreeRects.Last().Add(RectF(Vec2F(), mMaxSize));
+
+			if (!TryPlaceMaxRects(*rt))
+				return false;
+		}
+
+		return true;
+	}
+
+	bool RectsPacker::TryPlaceMaxRects(Rect& rt)
+	{
+		int bestPage = -1;
+		bool bestRotated = false;
+		Vec2F bestPosition;
+		float bestShortSide = FLT_MAX, bestLongSide = FLT_MAX;
+
+		// Best short side fit: free rectangle with minimal leftover by short side, then by long side
+		auto checkFit = [&](int page, const RectF& freeRect, const Vec2F& size, bool rotated)
+		{
+			float leftoverX = freeRect.Width() - size.x, leftoverY = freeRect.Height() - size.y;
+			if (leftoverX < 0.0f || leftoverY < 0.0f)
+				return;
+
+			float shortSide = Math::Min(leftoverX, leftoverY), longSide = Math::Max(leftoverX, leftoverY);
+			if (shortSide < bestShortSide || (Math::Equals(shortSide, bestShortSide) && longSide < bestLongSide))
+			{
+				bestPage = page;
+				bestRotated = rotated;
+				bestPosition = freeRect.LeftBottom();
+				bestShortSide = shortSide;
+				bestLongSide = longSide;
+			}
+		};
+
+		for (int page = 0; page < mFreeRects.Count() && bestPage < 0; page++)
+		{
+			for (auto& freeRect : mFreeRects[page])
+			{
+				checkFit(page, freeRect, rt.size, false);
+
+				if (mRotationAllowed && !Math::Equals(rt.size.x, rt.size.y))
+					checkFit(page, freeRect, Vec2F(rt.size.y, rt.size.x), true);
+			}
+		}
+
+		if (bestPage < 0)
+			return false;
+
+		Vec2F placedSize = bestRotated ? Vec2F(rt.size.y, rt.size.x) : rt.size;
+
+		rt.page = bestPage;
+		rt.rotated = bestRotated;
+		rt.rect = RectF(bestPosition, bestPosition + placedSize);
+
+		SplitFreeRects(bestPage, rt.rect);
+		PruneFreeRects(bestPage);
+
+		return true;
+	}
+
+	void RectsPacker::SplitFreeRects(int page, const RectF& used)
+	{
+		auto& freeRects = mFreeRects[page];
+		int count = freeRects.Count();
+
+		for (int i = 0; i < count; )
+		{
+			RectF freeRect = freeRects[i];
+
+			if (used.left >= freeRect.right || used.right <= freeRect.left ||
+				used.bottom >= freeRect.top || used.top <= freeRect.bottom)
+			{
+				i++;
+				continue;
+			}
+
+			// Free rectangle is replaced by maximal parts around used rectangle
+			if (used.left > freeRect.left)
+				freeRects.Add(RectF(freeRect.left, freeRect.top, used.left, freeRect.bottom));
+
+			if (used.right < freeRect.right)
+				freeRects.Add(RectF(used.right, freeRect.top, freeRect.right, freeRect.bottom));
+
+			if (used.bottom > freeRect.bottom)
+				freeRects.Add(RectF(freeRect.left, used.bottom, freeRect.right, freeRect.bottom));
+
+			if (used.top < freeRect.top)
+				freeRects.Add(RectF(freeRect.left, freeRect.top, freeRect.right, used.top));
+
+			freeRects.RemoveAt(i);
+			count--;
+		}
+	}
+
+	void RectsPacker::PruneFreeRects(int page)
+	{
+		auto& freeRects = mFreeRects[page];
+
+		auto isContained = [](const RectF& a, const RectF& b) {
+			return a.left >= b.left && a.right <= b.right && a.bottom >= b.bottom && a.top <= b.top;
+		};
+
+		for (int i = 0; i < freeRects.Count(); i++)
+		{
+			for (int j = i + 1; j < freeRects.Count(); )
+			{
+				if (isContained(freeRects[i], freeRects[j]))
+				{
+					freeRects.RemoveAt(i);
+					i--;
+					break;
+				}
+
+				if (isContained(freeRects[j], freeRects[i]))
+					freeRects.RemoveAt(j);
+				else
+					j++;
+			}
+		}
+	}
+
 
 	void RectsPacker::CreateNewPage()
 	{
@@ -169,7 +350,14 @@ namespace o2
 	}
 
 	RectsPacker::Rect::Rect(const Vec2F& size /*= Vec2F()*/):
-		size(size), page(-1)
+		size(size), page(-1), rotated(false)
 	{}
 
 }
+
+ENUM_META(o2::RectsPacker::Algorithm)
+{
+	ENUM_ENTRY(MaxRects);
+	ENUM_ENTRY(QuadTree);
+}
+END_ENUM_META;
@@ -8,20 +8,25 @@
 
 namespace o2
 {
-	// -----------------
-	// Rectangles packer
-	// -----------------
+	// ---------------------------------------------------------------------------------------------------------
+	// Rectangles packer. Packs by quad tree of free nodes, or by MaxRects: keeps all maximal free rectangles of
+	// pages and places each rectangle into free rectangle with best short side fit
+	// ---------------------------------------------------------------------------------------------------------
 	class RectsPacker
 	{
+	public:
+		enum class Algorithm { QuadTree, MaxRects };
+
 	public:
 		// -----------------
 		// Packing rectangle
 		// -----------------
 		struct Rect
 		{
-			int   page; // Page index
-			RectF rect; // Rectangle on page
-			Vec2F size; // Size of rectangle
+			int   page;    // Page index
+			RectF rect;    // Rectangle on page
+			Vec2F size;    // Size of rectangle
+			bool  rotated; // Is rectangle rotated by 90 degrees on page. Rect size is swapped then
 
 		public:
 			// Constructor
@@ -53,9 +58,24 @@ namespace o2
 		// Returns pages count
 		int GetPagesCount() const;
 
+		// Sets packing algorithm
+		void SetAlgorithm(Algorithm algorithm);
+
+		// Returns packing algorithm
+		Algorithm GetAlgorithm() const;
+
+		// Sets rectangles rotation by 90 degrees allowed. Used only by MaxRects algorithm
+		void SetRotationAllowed(bool allowed);
+
+		// Returns is rectangles rotation allowed
+		bool IsRotationAllowed() const;
+
 		// Tries to pack, returns true if packed successfully
 		bool Pack();
 
+		// Returns ratio of rectangles area to pages area after packing
+		float GetPackingEfficiency() const;
+
 	protected:
 		// ---------
 		// Quad node
@@ -82,7 +102,27 @@ namespace o2
 		Vector<QuadNode*> mQuadNodes; // Quad nodes 
 		Vec2F             mMaxSize;   // Max page size
 
+		Algorithm mAlgorithm = Algorithm::QuadTree; // Packing algorithm
+		bool      mRotationAllowed = false;         // Is rectangles rotation allowed
+
+		Vector<Vector<RectF>> mFreeRects; // Maximal free rectangles of pages, used by MaxRects algorithm
+
 	protected:
+		// Packs rectangles by quad nodes
+		bool PackQuadTree();
+
+		// Packs rectangles by maximal free rectangles
+		bool PackMaxRects();
+
+		// Tries to place rectangle into free rectangles of pages
+		bool TryPlaceMaxRects(Rect& rt);
+
+		// Splits free rectangles of page, intersecting with used rectangle
+		void SplitFreeRects(int page, const RectF& used);
+
+		// Removes free rectangles of page, contained in other free rectangles
+		void PruneFreeRects(int page);
+
 		// Tries to insert rectangle
 		bool InsertRect(Rect& rt);
 
@@ -97,3 +137,5 @@ namespace o2
 	};
 
 }
+
+PRE_ENUM_META(o2::RectsPacker::Algorithm);
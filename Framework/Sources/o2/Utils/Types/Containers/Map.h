@@ -6,21 +6,26 @@
 
 namespace o2
 {
-	// ----------
-	// Dictionary
-	// ----------
-	template<typename _key_type, typename _value_type>
-	class Map : public std::map<_key_type, _value_type>
+	// ----------------------------------------------------------------------------------------
+	// Dictionary. Uses standard allocator by default, AllocatorAdapter can be used to allocate
+	// nodes from any IAllocator
+	// ----------------------------------------------------------------------------------------
+	template<typename _key_type, typename _value_type,
+			 typename _allocator = std::allocator<std::pair<const _key_type, _value_type>>>
+	class Map : public std::map<_key_type, _value_type, std::less<_key_type>, _allocator>
 	{
 	public:
-		using KeyValuePair = typename std::map<_key_type, _value_type>::value_type;
-		using Iterator = typename std::map<_key_type, _value_type>::iterator;
-		using ConstIterator = typename std::map<_key_type, _value_type>::const_iterator;
+		using KeyValuePair = typename std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::value_type;
+		using Iterator = typename std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::iterator;
+		using ConstIterator = typename std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::const_iterator;
 
 	public:
 		// Default constructor
 		Map();
 
+		// Constructor with allocator
+		explicit Map(const _allocator& allocator);
+
 		// Copy-constructor
 		Map(const Map& other);
 
@@ -147,96 +152,101 @@ namespace o2
 		_sel_type Sum(const Function<_sel_type(const _key_type&, const _value_type&)>& selector) const;
 
 		// Returns begin iterator
-		Iterator Begin() { return std::map<_key_type, _value_type>::begin(); }
+		Iterator Begin() { return std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::begin(); }
 
 		// Returns end iterator
-		Iterator End() { return std::map<_key_type, _value_type>::end(); }
+		Iterator End() { return std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::end(); }
 
 		// Returns constant begin iterator
-		ConstIterator Begin() const { return std::map<_key_type, _value_type>::cbegin(); }
+		ConstIterator Begin() const { return std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::cbegin(); }
 
 		// Returns constant end iterator
-		ConstIterator End() const { return std::map<_key_type, _value_type>::cend(); }
+		ConstIterator End() const { return std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::cend(); }
 	};
 
-	template<typename _key_type, typename _value_type>
-	Map<_key_type, _value_type>::Map()
+	template<typename _key_type, typename _value_type, typename _allocator>
+	Map<_key_type, _value_type, _allocator>::Map()
+	{}
+
+	template<typename _key_type, typename _value_type, typename _allocator>
+	Map<_key_type, _value_type, _allocator>::Map(const _allocator& allocator):
+		std::map<_key_type, _value_type, std::less<_key_type>, _allocator>(allocator)
 	{}
 
-	template<typename _key_type, typename _value_type>
-	Map<_key_type, _value_type>::Map(const Map<_key_type, _value_type>& other):
-		std::map<_key_type, _value_type>(other)
+	template<typename _key_type, typename _value_type, typename _allocator>
+	Map<_key_type, _value_type, _allocator>::Map(const Map<_key_type, _value_type, _allocator>& other):
+		std::map<_key_type, _value_type, std::less<_key_type>, _allocator>(other)
 	{ }
 
-	template<typename _key_type, typename _value_type>
-	Map<_key_type, _value_type>::Map(std::initializer_list<KeyValuePair> init):
-		std::map<_key_type, _value_type>(init)
+	template<typename _key_type, typename _value_type, typename _allocator>
+	Map<_key_type, _value_type, _allocator>::Map(std::initializer_list<KeyValuePair> init):
+		std::map<_key_type, _value_type, std::less<_key_type>, _allocator>(init)
 	{}
 
-	template<typename _key_type, typename _value_type>
-	Map<_key_type, _value_type>::~Map()
+	template<typename _key_type, typename _value_type, typename _allocator>
+	Map<_key_type, _value_type, _allocator>::~Map()
 	{}
 
-	template<typename _key_type, typename _value_type>
-	bool Map<_key_type, _value_type>::operator==(const Map& other) const
+	template<typename _key_type, typename _value_type, typename _allocator>
+	bool Map<_key_type, _value_type, _allocator>::operator==(const Map& other) const
 	{
-		return std::operator==((const std::map<_key_type, _value_type>&)*this, (const std::map<_key_type, _value_type>&)other);
+		return std::operator==((const std::map<_key_type, _value_type, std::less<_key_type>, _allocator>&)*this, (const std::map<_key_type, _value_type, std::less<_key_type>, _allocator>&)other);
 	}
 
-	template<typename _key_type, typename _value_type>
-	bool Map<_key_type, _value_type>::operator!=(const Map& other) const
+	template<typename _key_type, typename _value_type, typename _allocator>
+	bool Map<_key_type, _value_type, _allocator>::operator!=(const Map& other) const
 	{
-		return std::operator!=((const std::map<_key_type, _value_type>&)*this, (const std::map<_key_type, _value_type>&)other);
+		return std::operator!=((const std::map<_key_type, _value_type, std::less<_key_type>, _allocator>&)*this, (const std::map<_key_type, _value_type, std::less<_key_type>, _allocator>&)other);
 	}
 
-	template<typename _key_type, typename _value_type>
-	Map<_key_type, _value_type>& Map<_key_type, _value_type>::operator=(const Map& other)
+	template<typename _key_type, typename _value_type, typename _allocator>
+	Map<_key_type, _value_type, _allocator>& Map<_key_type, _value_type, _allocator>::operator=(const Map& other)
 	{
-		std::map<_key_type, _value_type>::operator=(other);
+		std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::operator=(other);
 		return *this;
 	}
 
-	template<typename _key_type, typename _value_type>
-	void Map<_key_type, _value_type>::Add(const _key_type& key, const _value_type& value)
+	template<typename _key_type, typename _value_type, typename _allocator>
+	void Map<_key_type, _value_type, _allocator>::Add(const _key_type& key, const _value_type& value)
 	{
-		std::map<_key_type, _value_type>::insert({ key, value });
+		std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::insert({ key, value });
 	}
 
-	template<typename _key_type, typename _value_type>
-	void Map<_key_type, _value_type>::Add(const KeyValuePair& keyValue)
+	template<typename _key_type, typename _value_type, typename _allocator>
+	void Map<_key_type, _value_type, _allocator>::Add(const KeyValuePair& keyValue)
 	{
-		std::map<_key_type, _value_type>::insert(keyValue);
+		std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::insert(keyValue);
 	}
 
-	template<typename _key_type, typename _value_type>
-	void Map<_key_type, _value_type>::Add(const Map& other)
+	template<typename _key_type, typename _value_type, typename _allocator>
+	void Map<_key_type, _value_type, _allocator>::Add(const Map& other)
 	{
 		for (auto& kv : other)
 			Add(kv.first, kv.second);
 	}
 
-	template<typename _key_type, typename _value_type>
-	void Map<_key_type, _value_type>::Remove(const _key_type& key)
+	template<typename _key_type, typename _value_type, typename _allocator>
+	void Map<_key_type, _value_type, _allocator>::Remove(const _key_type& key)
 	{
-		std::map<_key_type, _value_type>::erase(key);
+		std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::erase(key);
 	}
 
-	template<typename _key_type, typename _value_type>
-	void Map<_key_type, _value_type>::Clear()
+	template<typename _key_type, typename _value_type, typename _allocator>
+	void Map<_key_type, _value_type, _allocator>::Clear()
 	{
-		std::map<_key_type, _value_type>::clear();
+		std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::clear();
 	}
 
-	template<typename _key_type, typename _value_type>
-	bool Map<_key_type, _value_type>::ContainsKey(const _key_type& key) const
+	template<typename _key_type, typename _value_type, typename _allocator>
+	bool Map<_key_type, _value_type, _allocator>::ContainsKey(const _key_type& key) const
 	{
-		return std::map<_key_type, _value_type>::find(key) != std::map<_key_type, _value_type>::end();
+		return std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::find(key) != std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::end();
 	}
 
-	template<typename _key_type, typename _value_type>
-	bool Map<_key_type, _value_type>::ContainsValue(const _value_type& value) const
+	template<typename _key_type, typename _value_type, typename _allocator>
+	bool Map<_key_type, _value_type, _allocator>::ContainsValue(const _value_type& value) const
 	{
-		for (auto it = std::map<_key_type, _value_type>::begin(); it != std::map<_key_type, _value_type>::end(); ++it)
+		for (auto it = std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::begin(); it != std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::end(); ++it)
 		{
 			if (it->second == value)
 				return true;
@@ -245,27 +255,27 @@ namespace o2
 		return false;
 	}
 
-	template<typename _key_type, typename _value_type>
-	bool Map<_key_type, _value_type>::Contains(const KeyValuePair& keyValue) const
+	template<typename _key_type, typename _value_type, typename _allocator>
+	bool Map<_key_type, _value_type, _allocator>::Contains(const KeyValuePair& keyValue) const
 	{
-		auto fnd = std::map<_key_type, _value_type>::find(keyValue.first);
-		return fnd != std::map<_key_type, _value_type>::end() && fnd->second == keyValue.second;
+		auto fnd = std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::find(keyValue.first);
+		return fnd != std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::end() && fnd->second == keyValue.second;
 	}
 
-	template<typename _key_type, typename _value_type>
-	typename Map<_key_type, _value_type>::KeyValuePair Map<_key_type, _value_type>::FindKey(const _key_type& key) const
+	template<typename _key_type, typename _value_type, typename _allocator>
+	typename Map<_key_type, _value_type, _allocator>::KeyValuePair Map<_key_type, _value_type, _allocator>::FindKey(const _key_type& key) const
 	{
-		auto fnd = std::map<_key_type, _value_type>::find(key);
-		if (fnd != std::map<_key_type, _value_type>::end())
+		auto fnd = std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::find(key);
+		if (fnd != std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::end())
 			return { fnd->first, fnd->second };
 
 		return KeyValuePair();
 	}
 
-	template<typename _key_type, typename _value_type>
-	typename Map<_key_type, _value_type>::KeyValuePair Map<_key_type, _value_type>::FindValue(const _value_type& value) const
+	template<typename _key_type, typename _value_type, typename _allocator>
+	typename Map<_key_type, _value_type, _allocator>::KeyValuePair Map<_key_type, _value_type, _allocator>::FindValue(const _value_type& value) const
 	{
-		for (auto it = std::map<_key_type, _value_type>::begin(); it != std::map<_key_type, _value_type>::end(); ++it)
+		for (auto it = std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::begin(); it != std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::end(); ++it)
 		{
 			if (it->second == value)
 				return { it->first, it->second };
@@ -274,21 +284,21 @@ namespace o2
 		return KeyValuePair();
 	}
 
-	template<typename _key_type, typename _value_type>
-	void Map<_key_type, _value_type>::Set(const _key_type& key, const _value_type& value)
+	template<typename _key_type, typename _value_type, typename _allocator>
+	void Map<_key_type, _value_type, _allocator>::Set(const _key_type& key, const _value_type& value)
 	{
-		auto fnd = std::map<_key_type, _value_type>::find(key);
-		if (fnd != std::map<_key_type, _value_type>::end())
+		auto fnd = std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::find(key);
+		if (fnd != std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::end())
 			fnd->second = value;
 		else
-			std::map<_key_type, _value_type>::insert({ key, value });
+			std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::insert({ key, value });
 	}
 
-	template<typename _key_type, typename _value_type>
-	_value_type& Map<_key_type, _value_type>::Get(const _key_type& key)
+	template<typename _key_type, typename _value_type, typename _allocator>
+	_value_type& Map<_key_type, _value_type, _allocator>::Get(const _key_type& key)
 	{
-		auto fnd = std::map<_key_type, _value_type>::find(key);
-		if (fnd != std::map<_key_type, _value_type>::end())
+		auto fnd = std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::find(key);
+		if (fnd != std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::end())
 			return fnd->second;
 
 		Assert(false, "Failed to get value from dictionary: not found key");
@@ -297,11 +307,11 @@ namespace o2
 		return fake;
 	}
 
-	template<typename _key_type, typename _value_type>
-	const _value_type& Map<_key_type, _value_type>::Get(const _key_type& key) const
+	template<typename _key_type, typename _value_type, typename _allocator>
+	const _value_type& Map<_key_type, _value_type, _allocator>::Get(const _key_type& key) const
 	{
-		auto fnd = std::map<_key_type, _value_type>::find(key);
-		if (fnd != std::map<_key_type, _value_type>::end())
+		auto fnd = std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::find(key);
+		if (fnd != std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::end())
 			return fnd->second;
 
 		Assert(false, "Failed to get value from dictionary: not found key");
@@ -310,11 +320,11 @@ namespace o2
 		return fake;
 	}
 
-	template<typename _key_type, typename _value_type>
-	bool Map<_key_type, _value_type>::TryGetValue(const _key_type& key, _value_type& output) const
+	template<typename _key_type, typename _value_type, typename _allocator>
+	bool Map<_key_type, _value_type, _allocator>::TryGetValue(const _key_type& key, _value_type& output) const
 	{
-		auto fnd = std::map<_key_type, _value_type>::find(key);
-		if (fnd != std::map<_key_type, _value_type>::end())
+		auto fnd = std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::find(key);
+		if (fnd != std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::end())
 		{
 			output = fnd->second;
 			return true;
@@ -323,11 +333,11 @@ namespace o2
 		return false;
 	}
 
-	template<typename _key_type, typename _value_type>
-	typename Map<_key_type, _value_type>::KeyValuePair Map<_key_type, _value_type>::GetIdx(int index) const
+	template<typename _key_type, typename _value_type, typename _allocator>
+	typename Map<_key_type, _value_type, _allocator>::KeyValuePair Map<_key_type, _value_type, _allocator>::GetIdx(int index) const
 	{
 		int i = 0; 
-		for (auto it = std::map<_key_type, _value_type>::begin(); it != std::map<_key_type, _value_type>::end(); ++it)
+		for (auto it = std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::begin(); it != std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::end(); ++it)
 		{
 			if (i == index)
 				return { it->first, it->second };
@@ -338,30 +348,30 @@ namespace o2
 		return KeyValuePair();
 	}
 
-	template<typename _key_type, typename _value_type>
-	int Map<_key_type, _value_type>::Count() const
+	template<typename _key_type, typename _value_type, typename _allocator>
+	int Map<_key_type, _value_type, _allocator>::Count() const
 	{
-		return (int)std::map<_key_type, _value_type>::size();
+		return (int)std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::size();
 	}
 
-	template<typename _key_type, typename _value_type>
-	bool Map<_key_type, _value_type>::IsEmpty() const
+	template<typename _key_type, typename _value_type, typename _allocator>
+	bool Map<_key_type, _value_type, _allocator>::IsEmpty() const
 	{
-		return std::map<_key_type, _value_type>::empty();
+		return std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::empty();
 	}
 
-	template<typename _key_type, typename _value_type>
-	void Map<_key_type, _value_type>::ForEach(const Function<void(const _key_type&, _value_type&)>& func)
+	template<typename _key_type, typename _value_type, typename _allocator>
+	void Map<_key_type, _value_type, _allocator>::ForEach(const Function<void(const _key_type&, _value_type&)>& func)
 	{
-		for (auto it = std::map<_key_type, _value_type>::begin(); it != std::map<_key_type, _value_type>::end(); ++it)
+		for (auto it = std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::begin(); it != std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::end(); ++it)
 			func(it->first, it->second);
 	}
 
-	template<typename _key_type, typename _value_type>
-	int Map<_key_type, _value_type>::Count(const Function<bool(const _key_type&, const _value_type&)>& match) const
+	template<typename _key_type, typename _value_type, typename _allocator>
+	int Map<_key_type, _value_type, _allocator>::Count(const Function<bool(const _key_type&, const _value_type&)>& match) const
 	{
 		int res = 0; 
-		for (auto it = std::map<_key_type, _value_type>::begin(); it != std::map<_key_type, _value_type>::end(); ++it)
+		for (auto it = std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::begin(); it != std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::end(); ++it)
 		{
 			if (match(it->first, it->second))
 				res++;
@@ -370,10 +380,10 @@ namespace o2
 		return res;
 	}
 
-	template<typename _key_type, typename _value_type>
-	typename Map<_key_type, _value_type>::KeyValuePair Map<_key_type, _value_type>::Last(const Function<bool(const _key_type&, const _value_type&)>& match) const
+	template<typename _key_type, typename _value_type, typename _allocator>
+	typename Map<_key_type, _value_type, _allocator>::KeyValuePair Map<_key_type, _value_type, _allocator>::Last(const Function<bool(const _key_type&, const _value_type&)>& match) const
 	{
-		for (auto it = std::map<_key_type, _value_type>::rbegin(); it != std::map<_key_type, _value_type>::rend(); ++it)
+		for (auto it = std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::rbegin(); it != std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::rend(); ++it)
 		{
 			if (match(it->first, it->second))
 				return { it->first, it->second };
@@ -382,10 +392,10 @@ namespace o2
 		return KeyValuePair();
 	}
 
-	template<typename _key_type, typename _value_type>
-	typename Map<_key_type, _value_type>::KeyValuePair Map<_key_type, _value_type>::First(const Function<bool(const _key_type&, const _value_type&)>& match) const
+	template<typename _key_type, typename _value_type, typename _allocator>
+	typename Map<_key_type, _value_type, _allocator>::KeyValuePair Map<_key_type, _value_type, _allocator>::First(const Function<bool(const _key_type&, const _value_type&)>& match) const
 	{
-		for (auto it = std::map<_key_type, _value_type>::begin(); it != std::map<_key_type, _value_type>::end(); ++it)
+		for (auto it = std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::begin(); it != std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::end(); ++it)
 		{
 			if (match(it->first, it->second))
 				return { it->first, it->second };
@@ -394,22 +404,22 @@ namespace o2
 		return KeyValuePair();
 	}
 
-	template<typename _key_type, typename _value_type>
-	typename Map<_key_type, _value_type>::KeyValuePair Map<_key_type, _value_type>::FindLast(const Function<bool(const _key_type&, const _value_type&)>& match) const
+	template<typename _key_type, typename _value_type, typename _allocator>
+	typename Map<_key_type, _value_type, _allocator>::KeyValuePair Map<_key_type, _value_type, _allocator>::FindLast(const Function<bool(const _key_type&, const _value_type&)>& match) const
 	{
 		return Last(match);
 	}
 
-	template<typename _key_type, typename _value_type>
-	typename Map<_key_type, _value_type>::KeyValuePair Map<_key_type, _value_type>::Find(const Function<bool(const _key_type&, const _value_type&)>& match) const
+	template<typename _key_type, typename _value_type, typename _allocator>
+	typename Map<_key_type, _value_type, _allocator>::KeyValuePair Map<_key_type, _value_type, _allocator>::Find(const Function<bool(const _key_type&, const _value_type&)>& match) const
 	{
 		return Find(match);
 	}
 
-	template<typename _key_type, typename _value_type>
-	bool Map<_key_type, _value_type>::Contains(const Function<bool(const _key_type&, const _value_type&)>& match) const
+	template<typename _key_type, typename _value_type, typename _allocator>
+	bool Map<_key_type, _value_type, _allocator>::Contains(const Function<bool(const _key_type&, const _value_type&)>& match) const
 	{
-		for (auto it = std::map<_key_type, _value_type>::rbegin(); it != std::map<_key_type, _value_type>::rend(); ++it)
+		for (auto it = std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::rbegin(); it != std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::rend(); ++it)
 		{
 			if (match(it->first, it->second))
 				return true;
@@ -418,10 +428,10 @@ namespace o2
 		return false;
 	}
 
-	template<typename _key_type, typename _value_type>
-	void Map<_key_type, _value_type>::RemoveAll(const Function<bool(const _key_type&, const _value_type&)>& match)
+	template<typename _key_type, typename _value_type, typename _allocator>
+	void Map<_key_type, _value_type, _allocator>::RemoveAll(const Function<bool(const _key_type&, const _value_type&)>& match)
 	{
-		for (auto it = std::map<_key_type, _value_type>::begin(); it != std::map<_key_type, _value_type>::end();)
+		for (auto it = std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::begin(); it != std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::end();)
 		{
 			if (match(it->first, it->second)) 
 				it = erase(it);
@@ -430,21 +440,21 @@ namespace o2
 		}
 	}
 
-	template<typename _key_type, typename _value_type>
+	template<typename _key_type, typename _value_type, typename _allocator>
 	template<typename _sel_type>
-	_sel_type Map<_key_type, _value_type>::Sum(const Function<_sel_type(const _key_type&, const _value_type&)>& selector) const
+	_sel_type Map<_key_type, _value_type, _allocator>::Sum(const Function<_sel_type(const _key_type&, const _value_type&)>& selector) const
 	{
 		_sel_type res = _sel_type();
-		for (auto it = std::map<_key_type, _value_type>::begin(); it != std::map<_key_type, _value_type>::end(); ++it)
+		for (auto it = std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::begin(); it != std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::end(); ++it)
 			res += res + selector(it->first, it->second);
 
 		return res;
 	}
 
-	template<typename _key_type, typename _value_type>
-	bool Map<_key_type, _value_type>::Any(const Function<bool(const _key_type&, const _value_type&)>& match) const
+	template<typename _key_type, typename _value_type, typename _allocator>
+	bool Map<_key_type, _value_type, _allocator>::Any(const Function<bool(const _key_type&, const _value_type&)>& match) const
 	{
-		for (auto it = std::map<_key_type, _value_type>::begin(); it != std::map<_key_type, _value_type>::end(); ++it)
+		for (auto it = std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::begin(); it != std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::end(); ++it)
 		{
 			if (match(it->first, it->second))
 				return true;
@@ -453,10 +463,10 @@ namespace o2
 		return false;
 	}
 
-	template<typename _key_type, typename _value_type>
-	bool Map<_key_type, _value_type>::All(const Function<bool(const _key_type&, const _value_type&)>& match) const
+	template<typename _key_type, typename _value_type, typename _allocator>
+	bool Map<_key_type, _value_type, _allocator>::All(const Function<bool(const _key_type&, const _value_type&)>& match) const
 	{
-		for (auto it = std::map<_key_type, _value_type>::begin(); it != std::map<_key_type, _value_type>::end(); ++it)
+		for (auto it = std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::begin(); it != std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::end(); ++it)
 		{
 			if (!match(it->first, it->second))
 				return false;
@@ -465,16 +475,16 @@ namespace o2
 		return true;
 	}
 
-	template<typename _key_type, typename _value_type>
+	template<typename _key_type, typename _value_type, typename _allocator>
 	template<typename _sel_type>
-	int Map<_key_type, _value_type>::MaxIdx(const Function<_sel_type(const _key_type&, const _value_type&)>& selector) const
+	int Map<_key_type, _value_type, _allocator>::MaxIdx(const Function<_sel_type(const _key_type&, const _value_type&)>& selector) const
 	{
 		int idx = 0;
 		int maxIdx = 0;
 		_sel_type maxVal;
-		for (auto it = std::map<_key_type, _value_type>::begin(); it != std::map<_key_type, _value_type>::end(); ++it)
+		for (auto it = std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::begin(); it != std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::end(); ++it)
 		{
-			if (it == std::map<_key_type, _value_type>::begin())
+			if (it == std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::begin())
 				maxVal = selector(it->first, it->second);
 			else
 			{
@@ -492,15 +502,15 @@ namespace o2
 		return idx;
 	}
 
-	template<typename _key_type, typename _value_type>
+	template<typename _key_type, typename _value_type, typename _allocator>
 	template<typename _sel_type>
-	typename Map<_key_type, _value_type>::KeyValuePair Map<_key_type, _value_type>::Max(const Function<_sel_type(const _key_type&, const _value_type&)>& selector) const
+	typename Map<_key_type, _value_type, _allocator>::KeyValuePair Map<_key_type, _value_type, _allocator>::Max(const Function<_sel_type(const _key_type&, const _value_type&)>& selector) const
 	{
 		_sel_type maxVal;
 		KeyValuePair res;
-		for (auto it = std::map<_key_type, _value_type>::begin(); it != std::map<_key_type, _value_type>::end(); ++it)
+		for (auto it = std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::begin(); it != std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::end(); ++it)
 		{
-			if (it == std::map<_key_type, _value_type>::begin())
+			if (it == std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::begin())
 			{
 				maxVal = selector(it->first, it->second);
 				res = { it->first, it->second };
@@ -519,16 +529,16 @@ namespace o2
 		return res;
 	}
 
-	template<typename _key_type, typename _value_type>
+	template<typename _key_type, typename _value_type, typename _allocator>
 	template<typename _sel_type>
-	int Map<_key_type, _value_type>::MinIdx(const Function<_sel_type(const _key_type&, const _value_type&)>& selector) const
+	int Map<_key_type, _value_type, _allocator>::MinIdx(const Function<_sel_type(const _key_type&, const _value_type&)>& selector) const
 	{
 		int idx = 0;
 		int minIdx = 0;
 		_sel_type minVal;
-		for (auto it = std::map<_key_type, _value_type>::begin(); it != std::map<_key_type, _value_type>::end(); ++it)
+		for (auto it = std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::begin(); it != std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::end(); ++it)
 		{
-			if (it == std::map<_key_type, _value_type>::begin())
+			if (it == std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::begin())
 				minVal = selector(it->first, it->second);
 			else
 			{
@@ -546,15 +556,15 @@ namespace o2
 		return idx;
 	}
 
-	template<typename _key_type, typename _value_type>
+	template<typename _key_type, typename _value_type, typename _allocator>
 	template<typename _sel_type>
-	typename Map<_key_type, _value_type>::KeyValuePair Map<_key_type, _value_type>::Min(const Function<_sel_type(const _key_type&, const _value_type&)>& selector) const
+	typename Map<_key_type, _value_type, _allocator>::KeyValuePair Map<_key_type, _value_type, _allocator>::Min(const Function<_sel_type(const _key_type&, const _value_type&)>& selector) const
 	{
 		_sel_type minVal;
 		KeyValuePair res;
-		for (auto it = std::map<_key_type, _value_type>::begin(); it != std::map<_key_type, _value_type>::end(); ++it)
+		for (auto it = std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::begin(); it != std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::end(); ++it)
 		{
-			if (it == std::map<_key_type, _value_type>::begin())
+			if (it == std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::begin())
 			{
 				minVal = selector(it->first, it->second);
 				res = { it->first, it->second };
@@ -573,11 +583,11 @@ namespace o2
 		return res;
 	}
 
-	template<typename _key_type, typename _value_type>
-	Map<_key_type, _value_type> Map<_key_type, _value_type>::Where(const Function<bool(const _key_type&, const _value_type&)>& match) const
+	template<typename _key_type, typename _value_type, typename _allocator>
+	Map<_key_type, _value_type, _allocator> Map<_key_type, _value_type, _allocator>::Where(const Function<bool(const _key_type&, const _value_type&)>& match) const
 	{
 		Map res;
-		for (auto it = std::map<_key_type, _value_type>::begin(); it != std::map<_key_type, _value_type>::end(); ++it)
+		for (auto it = std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::begin(); it != std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::end(); ++it)
 		{
 			if (match(it->first, it->second))
 				res.Add(it->first, it->second);
@@ -586,11 +596,11 @@ namespace o2
 		return res;
 	}
 
-	template<typename _key_type, typename _value_type>
-	Map<_key_type, _value_type> Map<_key_type, _value_type>::FindAll(const Function<bool(const _key_type&, const _value_type&)>& match) const
+	template<typename _key_type, typename _value_type, typename _allocator>
+	Map<_key_type, _value_type, _allocator> Map<_key_type, _value_type, _allocator>::FindAll(const Function<bool(const _key_type&, const _value_type&)>& match) const
 	{
 		Map res;
-		for (auto it = std::map<_key_type, _value_type>::begin(); it != std::map<_key_type, _value_type>::end(); ++it)
+		for (auto it = std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::begin(); it != std::map<_key_type, _value_type, std::less<_key_type>, _allocator>::end(); ++it)
 		{
 			if (match(it->first, it->second))
 				res.Add(it->first, it->second);
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "o2/Utils/Memory/Allocators/InlineAllocator.h"
+#include "o2/Utils/Types/Containers/Vector.h"
+
+namespace o2
+{
+	// ----------------------------------------------------------------------------------------------------
+	// Vector with inline storage for _capacity elements. Doesn't allocate heap memory until elements count
+	// exceeds inline capacity. Has all Vector functions. Moving is element-wise, swapping isn't supported
+	// ----------------------------------------------------------------------------------------------------
+	template<typename _type, int _capacity>
+	class SmallVector: public Vector<_type, InlineAllocator<_type, _capacity>>
+	{
+	public:
+		typedef Vector<_type, InlineAllocator<_type, _capacity>> Base;
+
+	public:
+		// Default constructor
+		SmallVector();
+
+		// Constructor from initializer list
+		SmallVector(std::initializer_list<_type> init);
+
+		// Copy-constructor
+		SmallVector(const SmallVector& other);
+
+		// Move-constructor
+		SmallVector(SmallVector&& other);
+
+		// Constructor from vector with other allocator
+		template<typename _other_allocator>
+		SmallVector(const Vector<_type, _other_allocator>& other);
+
+		// Copy-operator
+		SmallVector& operator=(const SmallVector& other);
+
+		// Move-operator
+		SmallVector& operator=(SmallVector&& other);
+
+		// Copy-operator from vector with other allocator
+		template<typename _other_allocator>
+		SmallVector& operator=(const Vector<_type, _other_allocator>& other);
+	};
+
+	template<typename _type, int _capacity>
+	SmallVector<_type, _capacity>::SmallVector()
+	{
+		Base::reserve(_capacity);
+	}
+
+	template<typename _type, int _capacity>
+	SmallVector<_type, _capacity>::SmallVector(std::initializer_list<_type> init)
+	{
+		Base::reserve(_capacity);
+		Base::insert(Base::end(), init.begin(), init.end());
+	}
+
+	template<typename _type, int _capacity>
+	SmallVector<_type, _capacity>::SmallVector(const SmallVector& other)
+	{
+		Base::reserve(_capacity);
+		Base::insert(Base::end(), other.begin(), other.end());
+	}
+
+	template<typename _type, int _capacity>
+	SmallVector<_type, _capacity>::SmallVector(SmallVector&& other)
+	{
+		Base::reserve(_capacity);
+		Base::insert(Base::end(), std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+		other.clear();
+	}
+
+	template<typename _type, int _capacity>
+	template<typename _other_allocator>
+	SmallVector<_type, _capacity>::SmallVector(const Vector<_type, _other_allocator>& other)
+	{
+		Base::reserve(_capacity);
+		Base::insert(Base::end(), other.begin(), other.end());
+	}
+
+	template<typename _type, int _capacity>
+	SmallVector<_type, _capacity>& SmallVector<_type, _capacity>::operator=(const SmallVector& other)
+	{
+		Base::assign(other.begin(), other.end());
+		return *this;
+	}
+
+	template<typename _type, int _capacity>
+	SmallVector<_type, _capacity>& SmallVector<_type, _capacity>::operator=(SmallVector&& other)
+	{
+		Base::assign(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+		other.clear();
+		return *this;
+	}
+
+	template<typename _type, int _capacity>
+	template<typename _other_allocator>
+	SmallVector<_type, _capacity>& SmallVector<_type, _capacity>::operator=(const Vector<_type, _other_allocator>& other)
+	{
+		Base::assign(other.begin(), other.end());
+		return *this;
+	}
+}
@@ -9,20 +9,24 @@
 
 namespace o2
 {
-	// --------------------
-	// Dynamic linear array
-	// --------------------
-	template<typename _type>
-	class Vector : public std::vector<_type>
+	// -----------------------------------------------------------------------------------------
+	// Dynamic linear array. Uses standard allocator by default, AllocatorAdapter can be used to
+	// allocate elements from any IAllocator, for example from frame allocator
+	// -----------------------------------------------------------------------------------------
+	template<typename _type, typename _allocator = std::allocator<_type>>
+	class Vector : public std::vector<_type, _allocator>
 	{
 	public:
-		typedef typename std::vector<_type>::iterator Iterator;
-		typedef typename std::vector<_type>::const_iterator ConstIterator;
+		typedef typename std::vector<_type, _allocator>::iterator Iterator;
+		typedef typename std::vector<_type, _allocator>::const_iterator ConstIterator;
 
 	public:
 		// Constructor by initial capacity
 		Vector();
 
+		// Constructor with allocator
+		explicit Vector(const _allocator& allocator);
+
 		// Constructor from initializer list
 		Vector(std::initializer_list<_type> init);
 
@@ -32,6 +36,10 @@ namespace o2
 		// Move-constructor
 		Vector(Vector&& arr);
 
+		// Constructor from vector with other allocator
+		template<typename _other_allocator>
+		Vector(const Vector<_type, _other_allocator>& arr);
+
 		// Assign operator
 		Vector& operator=(const Vector& arr);
 
@@ -69,7 +77,7 @@ namespace o2
 		bool operator!=(const Vector& arr) const;
 
 		// Returns a copy of this
-		Vector<_type>* Clone() const;
+		Vector<_type, _allocator>* Clone() const;
 
 		// Returns data pointer
 		_type* Data();
@@ -109,13 +117,21 @@ namespace o2
 		_type& Add(const _type& value);
 
 		// Adds elements from other array
-		void Add(const Vector<_type>& arr);
+		void Add(const Vector<_type, _allocator>& arr);
+
+		// Adds elements from other array with other allocator
+		template<typename _other_allocator>
+		void Add(const Vector<_type, _other_allocator>& arr);
 
 		// Inserts new value at position
 		_type& Insert(const _type& value, int position);
 
 		// Inserts new values from other array at position
-		void Insert(const Vector<_type>& arr, int position);
+		void Insert(const Vector<_type, _allocator>& arr, int position);
+
+		// Inserts new values from other array with other allocator at position
+		template<typename _other_allocator>
+		void Insert(const Vector<_type, _other_allocator>& arr, int position);
 
 		// Returns index of equal element. Returns -1 when array haven't equal element
 		int IndexOf(const _type& value) const;
@@ -274,120 +290,132 @@ namespace o2
 		ConstIterator End() const;
 	};
 
-	template<typename _type>
-	Vector<_type>::Vector() :
-		std::vector<_type>()
+	template<typename _type, typename _allocator>
+	Vector<_type, _allocator>::Vector() :
+		std::vector<_type, _allocator>()
+	{}
+
+	template<typename _type, typename _allocator>
+	Vector<_type, _allocator>::Vector(const _allocator& allocator) :
+		std::vector<_type, _allocator>(allocator)
+	{}
+
+	template<typename _type, typename _allocator>
+	Vector<_type, _allocator>::Vector(std::initializer_list<_type> init) :
+		std::vector<_type, _allocator>(init)
 	{}
 
-	template<typename _type>
-	Vector<_type>::Vector(std::initializer_list<_type> init) :
-		std::vector<_type>(init)
+	template<typename _type, typename _allocator>
+	Vector<_type, _allocator>::Vector(const Vector& arr) :
+		std::vector<_type, _allocator>((const std::vector<_type, _allocator>&)arr)
 	{}
 
-	template<typename _type>
-	Vector<_type>::Vector(const Vector& arr) :
-		std::vector<_type>((const std::vector<_type>&)arr)
+	template<typename _type, typename _allocator>
+	Vector<_type, _allocator>::Vector(Vector&& arr):
+		std::vector<_type, _allocator>((std::vector<_type, _allocator>&&)arr,
+									   std::allocator_traits<_allocator>::select_on_container_copy_construction(arr.get_allocator()))
 	{}
 
-	template<typename _type>
-	Vector<_type>::Vector(Vector&& arr):
-		std::vector<_type>((std::vector<_type>&&)arr)
+	template<typename _type, typename _allocator>
+	template<typename _other_allocator>
+	Vector<_type, _allocator>::Vector(const Vector<_type, _other_allocator>& arr):
+		std::vector<_type, _allocator>(arr.begin(), arr.end())
 	{}
 
-	template<typename _type>
-	_type* Vector<_type>::Data()
+	template<typename _type, typename _allocator>
+	_type* Vector<_type, _allocator>::Data()
 	{
-		return std::vector<_type>::data();
+		return std::vector<_type, _allocator>::data();
 	}
 
-	template<typename _type>
-	Vector<_type>* Vector<_type>::Clone() const
+	template<typename _type, typename _allocator>
+	Vector<_type, _allocator>* Vector<_type, _allocator>::Clone() const
 	{
-		return mnew Vector<_type>(this);
+		return mnew Vector<_type, _allocator>(this);
 	}
 
-	template<typename _type>
-	Vector<_type>& Vector<_type>::operator=(const Vector<_type>& arr)
+	template<typename _type, typename _allocator>
+	Vector<_type, _allocator>& Vector<_type, _allocator>::operator=(const Vector<_type, _allocator>& arr)
 	{
-		std::vector<_type>::operator=(arr);
+		std::vector<_type, _allocator>::operator=(arr);
 		return *this;
 	}
 
-	template<typename _type>
-	Vector<_type>& Vector<_type>::operator=(Vector&& arr)
+	template<typename _type, typename _allocator>
+	Vector<_type, _allocator>& Vector<_type, _allocator>::operator=(Vector&& arr)
 	{
-		std::vector<_type>::operator=(arr);
+		std::vector<_type, _allocator>::operator=(arr);
 		return *this;
 	}
 
-	template<typename _type>
-	Vector<_type> Vector<_type>::operator+(const Vector<_type>& arr) const
+	template<typename _type, typename _allocator>
+	Vector<_type, _allocator> Vector<_type, _allocator>::operator+(const Vector<_type, _allocator>& arr) const
 	{
-		Vector<_type> res(*this);
+		Vector<_type, _allocator> res(*this);
 		res.Add(arr);
 		return res;
 	}
 
-	template<typename _type>
-	Vector<_type>& Vector<_type>::operator+=(const Vector<_type>& arr)
+	template<typename _type, typename _allocator>
+	Vector<_type, _allocator>& Vector<_type, _allocator>::operator+=(const Vector<_type, _allocator>& arr)
 	{
 		Add(arr);
 		return *this;
 	}
 
-	template<typename _type>
-	Vector<_type> Vector<_type>::operator+(const _type& value) const
+	template<typename _type, typename _allocator>
+	Vector<_type, _allocator> Vector<_type, _allocator>::operator+(const _type& value) const
 	{
-		Vector<_type> res(*this);
+		Vector<_type, _allocator> res(*this);
 		res.Add(value);
 		return res;
 	}
 
-	template<typename _type>
-	Vector<_type>& Vector<_type>::operator+=(const _type& value)
+	template<typename _type, typename _allocator>
+	Vector<_type, _allocator>& Vector<_type, _allocator>::operator+=(const _type& value)
 	{
 		Add(value);
 		return *this;
 	}
 
 
-	template<typename _type>
-	Vector<_type> Vector<_type>::operator-(const Vector<_type>& arr) const
+	template<typename _type, typename _allocator>
+	Vector<_type, _allocator> Vector<_type, _allocator>::operator-(const Vector<_type, _allocator>& arr) const
 	{
-		Vector<_type> res(*this);
+		Vector<_type, _allocator> res(*this);
 		res.Remove(arr);
 		return res;
 	}
 
-	template<typename _type>
-	Vector<_type>& Vector<_type>::operator-=(const Vector<_type>& arr)
+	template<typename _type, typename _allocator>
+	Vector<_type, _allocator>& Vector<_type, _allocator>::operator-=(const Vector<_type, _allocator>& arr)
 	{
 		Remove(arr);
 		return *this;
 	}
 
-	template<typename _type>
-	Vector<_type> Vector<_type>::operator-(const _type& value) const
+	template<typename _type, typename _allocator>
+	Vector<_type, _allocator> Vector<_type, _allocator>::operator-(const _type& value) const
 	{
-		Vector<_type> res(*this);
+		Vector<_type, _allocator> res(*this);
 		res.Remove(value);
 		return res;
 	}
 
-	template<typename _type>
-	Vector<_type>& Vector<_type>::operator-=(const _type& value)
+	template<typename _type, typename _allocator>
+	Vector<_type, _allocator>& Vector<_type, _allocator>::operator-=(const _type& value)
 	{
 		Remove(value);
 		return *this;
 	}
 
-	template<typename _type>
-	bool Vector<_type>::operator==(const Vector<_type>& arr) const
+	template<typename _type, typename _allocator>
+	bool Vector<_type, _allocator>::operator==(const Vector<_type, _allocator>& arr) const
 	{
-		if (arr.size() != std::vector<_type>::size())
+		if (arr.size() != std::vector<_type, _allocator>::size())
 			return false;
 
-		for (unsigned int i = 0; i < std::vector<_type>::size(); i++)
+		for (unsigned int i = 0; i < std::vector<_type, _allocator>::size(); i++)
 		{
 			if (!((*this)[i] == arr[i]))
 				return false;
@@ -396,233 +424,247 @@ namespace o2
 		return true;
 	}
 
-	template<typename _type>
-	bool Vector<_type>::operator!=(const Vector<_type>& arr) const
+	template<typename _type, typename _allocator>
+	bool Vector<_type, _allocator>::operator!=(const Vector<_type, _allocator>& arr) const
 	{
 		return !(*this == arr);
 	}
 
-	template<typename _type>
-	int Vector<_type>::Count() const
+	template<typename _type, typename _allocator>
+	int Vector<_type, _allocator>::Count() const
 	{
-		return (int)std::vector<_type>::size();
+		return (int)std::vector<_type, _allocator>::size();
 	}
 
-	template<typename _type>
-	int Vector<_type>::Capacity() const
+	template<typename _type, typename _allocator>
+	int Vector<_type, _allocator>::Capacity() const
 	{
-		return std::vector<_type>::capacity();
+		return std::vector<_type, _allocator>::capacity();
 	}
 
-	template<typename _type>
-	void Vector<_type>::Resize(int newCount)
+	template<typename _type, typename _allocator>
+	void Vector<_type, _allocator>::Resize(int newCount)
 	{
-		std::vector<_type>::resize(newCount);
+		std::vector<_type, _allocator>::resize(newCount);
 	}
 
-	template<typename _type>
-	void Vector<_type>::Reserve(int newCapacity)
+	template<typename _type, typename _allocator>
+	void Vector<_type, _allocator>::Reserve(int newCapacity)
 	{
-		std::vector<_type>::reserve(newCapacity);
+		std::vector<_type, _allocator>::reserve(newCapacity);
 	}
 
-	template<typename _type>
-	void Vector<_type>::ShrinkToFit()
+	template<typename _type, typename _allocator>
+	void Vector<_type, _allocator>::ShrinkToFit()
 	{
-		std::vector<_type>::shrink_to_fit();
+		std::vector<_type, _allocator>::shrink_to_fit();
 	}
 
-	template<typename _type>
-	const _type& Vector<_type>::Get(int idx) const
+	template<typename _type, typename _allocator>
+	const _type& Vector<_type, _allocator>::Get(int idx) const
 	{
-		return std::vector<_type>::at(idx);
+		return std::vector<_type, _allocator>::at(idx);
 	}
 
-	template<typename _type>
-	_type& Vector<_type>::Get(int idx)
+	template<typename _type, typename _allocator>
+	_type& Vector<_type, _allocator>::Get(int idx)
 	{
-		return std::vector<_type>::at(idx);
+		return std::vector<_type, _allocator>::at(idx);
 	}
 
-	template<typename _type>
-	void Vector<_type>::Set(int idx, const _type& value)
+	template<typename _type, typename _allocator>
+	void Vector<_type, _allocator>::Set(int idx, const _type& value)
 	{
 		(*this)[idx] = value;
 	}
 
-	template<typename _type>
-	_type& Vector<_type>::Add(const _type& value)
+	template<typename _type, typename _allocator>
+	_type& Vector<_type, _allocator>::Add(const _type& value)
+	{
+		std::vector<_type, _allocator>::push_back(value);
+		return (*this)[std::vector<_type, _allocator>::size() - 1];
+	}
+
+	template<typename _type, typename _allocator>
+	void Vector<_type, _allocator>::Add(const Vector<_type, _allocator>& arr)
 	{
-		std::vector<_type>::push_back(value);
-		return (*this)[std::vector<_type>::size() - 1];
+		std::vector<_type, _allocator>::insert(std::vector<_type, _allocator>::end(), arr.begin(), arr.end());
 	}
 
-	template<typename _type>
-	void Vector<_type>::Add(const Vector<_type>& arr)
+	template<typename _type, typename _allocator>
+	template<typename _other_allocator>
+	void Vector<_type, _allocator>::Add(const Vector<_type, _other_allocator>& arr)
 	{
-		std::vector<_type>::insert(std::vector<_type>::end(), arr.begin(), arr.end());
+		std::vector<_type, _allocator>::insert(std::vector<_type, _allocator>::end(), arr.begin(), arr.end());
 	}
 
-	template<typename _type>
-	_type Vector<_type>::PopBack()
+	template<typename _type, typename _allocator>
+	_type Vector<_type, _allocator>::PopBack()
 	{
-		_type res = std::vector<_type>::back();
-		std::vector<_type>::pop_back();
+		_type res = std::vector<_type, _allocator>::back();
+		std::vector<_type, _allocator>::pop_back();
 		return res;
 	}
 
-	template<typename _type>
-	_type& Vector<_type>::Insert(const _type& value, int position)
+	template<typename _type, typename _allocator>
+	_type& Vector<_type, _allocator>::Insert(const _type& value, int position)
+	{
+		std::vector<_type, _allocator>::insert(std::vector<_type, _allocator>::begin() + position, value);
+		return std::vector<_type, _allocator>::at(position);
+	}
+
+	template<typename _type, typename _allocator>
+	void Vector<_type, _allocator>::Insert(const Vector<_type, _allocator>& arr, int position)
 	{
-		std::vector<_type>::insert(std::vector<_type>::begin() + position, value);
-		return std::vector<_type>::at(position);
+		std::vector<_type, _allocator>::insert(std::vector<_type, _allocator>::begin() + position, arr.begin(), arr.end());
 	}
 
-	template<typename _type>
-	void Vector<_type>::Insert(const Vector<_type>& arr, int position)
+	template<typename _type, typename _allocator>
+	template<typename _other_allocator>
+	void Vector<_type, _allocator>::Insert(const Vector<_type, _other_allocator>& arr, int position)
 	{
-		std::vector<_type>::insert(std::vector<_type>::begin() + position, arr.begin(), arr.end());
+		std::vector<_type, _allocator>::insert(std::vector<_type, _allocator>::begin() + position, arr.begin(), arr.end());
 	}
 
-	template<typename _type>
-	int Vector<_type>::IndexOf(const _type& value) const
+	template<typename _type, typename _allocator>
+	int Vector<_type, _allocator>::IndexOf(const _type& value) const
 	{
-		auto fnd = std::find(std::vector<_type>::begin(), std::vector<_type>::end(), value);
-		if (fnd == std::vector<_type>::end())
+		auto fnd = std::find(std::vector<_type, _allocator>::begin(), std::vector<_type, _allocator>::end(), value);
+		if (fnd == std::vector<_type, _allocator>::end())
 			return -1;
 
-		return (int)(fnd - std::vector<_type>::begin());
+		return (int)(fnd - std::vector<_type, _allocator>::begin());
 	}
 
-	template<typename _type>
-	bool Vector<_type>::Contains(const _type& value) const
+	template<typename _type, typename _allocator>
+	bool Vector<_type, _allocator>::Contains(const _type& value) const
 	{
-		return std::find(std::vector<_type>::begin(), std::vector<_type>::end(), value) != std::vector<_type>::end();
+		return std::find(std::vector<_type, _allocator>::begin(), std::vector<_type, _allocator>::end(), value) != std::vector<_type, _allocator>::end();
 	}
 
-	template<typename _type>
-	void Vector<_type>::RemoveAt(int idx)
+	template<typename _type, typename _allocator>
+	void Vector<_type, _allocator>::RemoveAt(int idx)
 	{
-		std::vector<_type>::erase(std::vector<_type>::begin() + idx);
+		std::vector<_type, _allocator>::erase(std::vector<_type, _allocator>::begin() + idx);
 	}
 
-	template<typename _type>
-	void Vector<_type>::RemoveRange(int first, int last)
+	template<typename _type, typename _allocator>
+	void Vector<_type, _allocator>::RemoveRange(int first, int last)
 	{
-		std::vector<_type>::erase(std::vector<_type>::begin() + first, std::vector<_type>::begin() + last);
+		std::vector<_type, _allocator>::erase(std::vector<_type, _allocator>::begin() + first, std::vector<_type, _allocator>::begin() + last);
 	}
 
-	template<typename _type>
-	void Vector<_type>::Remove(const _type& value)
+	template<typename _type, typename _allocator>
+	void Vector<_type, _allocator>::Remove(const _type& value)
 	{
-		auto fnd = std::find(std::vector<_type>::begin(), std::vector<_type>::end(), value);
-		if (fnd != std::vector<_type>::end())
-			std::vector<_type>::erase(fnd);
+		auto fnd = std::find(std::vector<_type, _allocator>::begin(), std::vector<_type, _allocator>::end(), value);
+		if (fnd != std::vector<_type, _allocator>::end())
+			std::vector<_type, _allocator>::erase(fnd);
 	}
 
-	template<typename _type>
-	typename Vector<_type>::Iterator Vector<_type>::Remove(const Iterator& first, const Iterator& last)
+	template<typename _type, typename _allocator>
+	typename Vector<_type, _allocator>::Iterator Vector<_type, _allocator>::Remove(const Iterator& first, const Iterator& last)
 	{
-		return std::vector<_type>::erase(first, last);
+		return std::vector<_type, _allocator>::erase(first, last);
 	}
 
-	template<typename _type>
-	typename Vector<_type>::Iterator Vector<_type>::Remove(const Iterator& it)
+	template<typename _type, typename _allocator>
+	typename Vector<_type, _allocator>::Iterator Vector<_type, _allocator>::Remove(const Iterator& it)
 	{
-		return std::vector<_type>::erase(it);
+		return std::vector<_type, _allocator>::erase(it);
 	}
 
-	template<typename _type>
-	void Vector<_type>::RemoveFirst(const Function<bool(const _type&)>& match)
+	template<typename _type, typename _allocator>
+	void Vector<_type, _allocator>::RemoveFirst(const Function<bool(const _type&)>& match)
 	{
-		for (auto it = std::vector<_type>::begin(); it != std::vector<_type>::end(); ++it)
+		for (auto it = std::vector<_type, _allocator>::begin(); it != std::vector<_type, _allocator>::end(); ++it)
 		{
 			if (match(*it))
 			{
-				std::vector<_type>::erase(it);
+				std::vector<_type, _allocator>::erase(it);
 				return;
 			}
 		}
 	}
 
-	template<typename _type>
-	void Vector<_type>::Clear()
+	template<typename _type, typename _allocator>
+	void Vector<_type, _allocator>::Clear()
 	{
-		std::vector<_type>::clear();
+		std::vector<_type, _allocator>::clear();
 	}
 
-	template<typename _type>
-	bool Vector<_type>::IsEmpty() const
+	template<typename _type, typename _allocator>
+	bool Vector<_type, _allocator>::IsEmpty() const
 	{
-		return std::vector<_type>::empty();
+		return std::vector<_type, _allocator>::empty();
 	}
 
-	template<typename _type>
-	_type& Vector<_type>::First()
+	template<typename _type, typename _allocator>
+	_type& Vector<_type, _allocator>::First()
 	{
-		return std::vector<_type>::front();
+		return std::vector<_type, _allocator>::front();
 	}
 
-	template<typename _type>
-	const _type& Vector<_type>::First() const
+	template<typename _type, typename _allocator>
+	const _type& Vector<_type, _allocator>::First() const
 	{
-		return std::vector<_type>::front();
+		return std::vector<_type, _allocator>::front();
 	}
 
-	template<typename _type>
-	const _type& Vector<_type>::Last() const
+	template<typename _type, typename _allocator>
+	const _type& Vector<_type, _allocator>::Last() const
 	{
-		return std::vector<_type>::back();
+		return std::vector<_type, _allocator>::back();
 	}
 
-	template<typename _type>
-	_type& Vector<_type>::Last()
+	template<typename _type, typename _allocator>
+	_type& Vector<_type, _allocator>::Last()
 	{
-		return std::vector<_type>::back();
+		return std::vector<_type, _allocator>::back();
 	}
 
-	template<typename _type>
-	void Vector<_type>::Sort(const Function<bool(const _type&, const _type&)>& pred /*= Math::Fewer*/)
+	template<typename _type, typename _allocator>
+	void Vector<_type, _allocator>::Sort(const Function<bool(const _type&, const _type&)>& pred /*= Math::Fewer*/)
 	{
-		std::sort(std::vector<_type>::begin(), std::vector<_type>::end(), pred);
+		std::sort(std::vector<_type, _allocator>::begin(), std::vector<_type, _allocator>::end(), pred);
 	}
 
-	template<typename _type>
-	Vector<_type> Vector<_type>::Sorted(const Function<bool(const _type&, const _type&)>& pred /*= Math::Fewer*/)
+	template<typename _type, typename _allocator>
+	Vector<_type, _allocator> Vector<_type, _allocator>::Sorted(const Function<bool(const _type&, const _type&)>& pred /*= Math::Fewer*/)
 	{
-		Vector<_type> copy = *this;
+		Vector<_type, _allocator> copy = *this;
 		copy.Sort(pred);
 		return copy;
 	}
 
-	template<typename _type>
-	typename Vector<_type>::Iterator Vector<_type>::Begin()
+	template<typename _type, typename _allocator>
+	typename Vector<_type, _allocator>::Iterator Vector<_type, _allocator>::Begin()
 	{
-		return std::vector<_type>::begin();
+		return std::vector<_type, _allocator>::begin();
 	}
 
-	template<typename _type>
-	typename Vector<_type>::Iterator Vector<_type>::End()
+	template<typename _type, typename _allocator>
+	typename Vector<_type, _allocator>::Iterator Vector<_type, _allocator>::End()
 	{
-		return std::vector<_type>::end();
+		return std::vector<_type, _allocator>::end();
 	}
 
-	template<typename _type>
-	typename Vector<_type>::ConstIterator Vector<_type>::Begin() const
+	template<typename _type, typename _allocator>
+	typename Vector<_type, _allocator>::ConstIterator Vector<_type, _allocator>::Begin() const
 	{
-		return std::vector<_type>::cbegin();
+		return std::vector<_type, _allocator>::cbegin();
 	}
 
-	template<typename _type>
-	typename Vector<_type>::ConstIterator Vector<_type>::End() const
+	template<typename _type, typename _allocator>
+	typename Vector<_type, _allocator>::ConstIterator Vector<_type, _allocator>::End() const
 	{
-		return std::vector<_type>::cend();
+		return std::vector<_type, _allocator>::cend();
 	}
 
-	template<typename _type>
-	Vector<_type> Vector<_type>::FindAll(const Function<bool(const _type&)>& match) const
+	template<typename _type, typename _allocator>
+	Vector<_type, _allocator> Vector<_type, _allocator>::FindAll(const Function<bool(const _type&)>& match) const
 	{
-		Vector<_type> res;
+		Vector<_type, _allocator> res;
 		for (auto& element : *this)
 		{
 			if (match(element))
@@ -632,10 +674,10 @@ namespace o2
 		return res;
 	}
 
-	template<typename _type>
-	Vector<_type> Vector<_type>::Where(const Function<bool(const _type&)>& match) const
+	template<typename _type, typename _allocator>
+	Vector<_type, _allocator> Vector<_type, _allocator>::Where(const Function<bool(const _type&)>& match) const
 	{
-		Vector<_type> res;
+		Vector<_type, _allocator> res;
 		for (auto& element : *this)
 		{
 			if (match(element))
@@ -645,9 +687,9 @@ namespace o2
 		return res;
 	}
 
-	template<typename _type>
+	template<typename _type, typename _allocator>
 	template<typename _sel_type>
-	Vector<_sel_type> Vector<_type>::Convert(const Function<_sel_type(const _type&)>& selector) const
+	Vector<_sel_type> Vector<_type, _allocator>::Convert(const Function<_sel_type(const _type&)>& selector) const
 	{
 		Vector<_sel_type> res;
 		for (auto& element : *this)
@@ -656,9 +698,9 @@ namespace o2
 		return res;
 	}
 
-	template<typename _type>
+	template<typename _type, typename _allocator>
 	template<typename _sel_type>
-	Vector<_sel_type> Vector<_type>::Cast() const
+	Vector<_sel_type> Vector<_type, _allocator>::Cast() const
 	{
 		Vector<_sel_type> res;
 		for (auto& element : *this)
@@ -667,9 +709,9 @@ namespace o2
 		return res;
 	}
 
-	template<typename _type>
+	template<typename _type, typename _allocator>
 	template<typename _sel_type>
-	Vector<_sel_type> Vector<_type>::DynamicCast() const
+	Vector<_sel_type> Vector<_type, _allocator>::DynamicCast() const
 	{
 		Vector<_sel_type> res;
 		for (auto& element : *this)
@@ -678,10 +720,10 @@ namespace o2
 		return res;
 	}
 
-	template<typename _type>
-	Vector<_type> Vector<_type>::Take(int count) const
+	template<typename _type, typename _allocator>
+	Vector<_type, _allocator> Vector<_type, _allocator>::Take(int count) const
 	{
-		Vector<_type> res;
+		Vector<_type, _allocator> res;
 		int i = 0;
 		for (auto& element : *this)
 		{
@@ -694,18 +736,18 @@ namespace o2
 		return res;
 	}
 
-	template<typename _type>
-	Vector<_type> Vector<_type>::Take(int begin, int end) const
+	template<typename _type, typename _allocator>
+	Vector<_type, _allocator> Vector<_type, _allocator>::Take(int begin, int end) const
 	{
-		Vector<_type> res;
-		for (int i = begin; i < end && i < (int)std::vector<_type>::size(); i++)
+		Vector<_type, _allocator> res;
+		for (int i = begin; i < end && i < (int)std::vector<_type, _allocator>::size(); i++)
 			res.Add(Get(i));
 
 		return res;
 	}
 
-	template<typename _type>
-	int Vector<_type>::Count(const Function<bool(const _type&)>& match) const
+	template<typename _type, typename _allocator>
+	int Vector<_type, _allocator>::Count(const Function<bool(const _type&)>& match) const
 	{
 		int res = 0;
 		int count = Count();
@@ -718,20 +760,20 @@ namespace o2
 		return res;
 	}
 
-	template<typename _type>
-	void Vector<_type>::RemoveAll(const Function<bool(const _type&)>& match)
+	template<typename _type, typename _allocator>
+	void Vector<_type, _allocator>::RemoveAll(const Function<bool(const _type&)>& match)
 	{
-		for (auto it = std::vector<_type>::begin(); it != std::vector<_type>::end();)
+		for (auto it = std::vector<_type, _allocator>::begin(); it != std::vector<_type, _allocator>::end();)
 		{
 			if (match(*it))
-				it = std::vector<_type>::erase(it);
+				it = std::vector<_type, _allocator>::erase(it);
 			else
 				++it;
 		}
 	}
 
-	template<typename _type>
-	bool Vector<_type>::Contains(const Function<bool(const _type&)>& match) const
+	template<typename _type, typename _allocator>
+	bool Vector<_type, _allocator>::Contains(const Function<bool(const _type&)>& match) const
 	{
 		for (auto& element : *this)
 		{
@@ -742,8 +784,8 @@ namespace o2
 		return false;
 	}
 
-	template<typename _type>
-	const _type* Vector<_type>::Find(const Function<bool(const _type&)>& match) const
+	template<typename _type, typename _allocator>
+	const _type* Vector<_type, _allocator>::Find(const Function<bool(const _type&)>& match) const
 	{
 		for (auto& element : *this)
 		{
@@ -754,8 +796,8 @@ namespace o2
 		return nullptr;
 	}
 
-	template<typename _type>
-	_type* Vector<_type>::Find(const Function<bool(const _type&)>& match)
+	template<typename _type, typename _allocator>
+	_type* Vector<_type, _allocator>::Find(const Function<bool(const _type&)>& match)
 	{
 		for (auto& element : *this)
 		{
@@ -766,8 +808,8 @@ namespace o2
 		return nullptr;
 	}
 
-	template<typename _type>
-	_type Vector<_type>::FindOrDefault(const Function<bool(const _type&)>& match) const
+	template<typename _type, typename _allocator>
+	_type Vector<_type, _allocator>::FindOrDefault(const Function<bool(const _type&)>& match) const
 	{
 		auto fnd = Find(match);
 		if (!fnd)
@@ -776,8 +818,8 @@ namespace o2
 		return *fnd;
 	}
 
-	template<typename _type>
-	int Vector<_type>::IndexOf(const Function<bool(const _type&)>& match) const
+	template<typename _type, typename _allocator>
+	int Vector<_type, _allocator>::IndexOf(const Function<bool(const _type&)>& match) const
 	{
 		int count = Count();
 		for (int i = 0; i < count; i++)
@@ -789,27 +831,27 @@ namespace o2
 		return -1;
 	}
 
-	template<typename _type>
+	template<typename _type, typename _allocator>
 	template<typename _sort_type>
-	void Vector<_type>::SortBy(const Function<_sort_type(const _type&)>& selector)
+	void Vector<_type, _allocator>::SortBy(const Function<_sort_type(const _type&)>& selector)
 	{
 		Sort([&](const _type& l, const _type& r) { return selector(l) < selector(r); });
 	}
 
-	template<typename _type>
-	const _type* Vector<_type>::First(const Function<bool(const _type&)>& match) const
+	template<typename _type, typename _allocator>
+	const _type* Vector<_type, _allocator>::First(const Function<bool(const _type&)>& match) const
 	{
 		return Find(match);
 	}
 
-	template<typename _type>
-	_type* Vector<_type>::First(const Function<bool(const _type&)>& match)
+	template<typename _type, typename _allocator>
+	_type* Vector<_type, _allocator>::First(const Function<bool(const _type&)>& match)
 	{
 		return Find(match);
 	}
 
-	template<typename _type>
-	const _type* Vector<_type>::Last(const Function<bool(const _type&)>& match) const
+	template<typename _type, typename _allocator>
+	const _type* Vector<_type, _allocator>::Last(const Function<bool(const _type&)>& match) const
 	{
 		for (auto& element : *this)
 		{
@@ -820,8 +862,8 @@ namespace o2
 		return nullptr;
 	}
 
-	template<typename _type>
-	_type* Vector<_type>::Last(const Function<bool(const _type&)>& match)
+	template<typename _type, typename _allocator>
+	_type* Vector<_type, _allocator>::Last(const Function<bool(const _type&)>& match)
 	{
 		for (auto& element : *this)
 		{
@@ -832,21 +874,21 @@ namespace o2
 		return nullptr;
 	}
 
-	template<typename _type>
-	int Vector<_type>::LastIndexOf(const Function<bool(const _type&)>& match) const
+	template<typename _type, typename _allocator>
+	int Vector<_type, _allocator>::LastIndexOf(const Function<bool(const _type&)>& match) const
 	{
-		for (auto it = std::vector<_type>::rbegin(); it != std::vector<_type>::rend(); it--)
+		for (auto it = std::vector<_type, _allocator>::rbegin(); it != std::vector<_type, _allocator>::rend(); it--)
 		{
 			if (match(*it))
-				return it - std::vector<_type>::begin();
+				return it - std::vector<_type, _allocator>::begin();
 		}
 
 		return -1;
 	}
 
-	template<typename _type>
+	template<typename _type, typename _allocator>
 	template<typename _sel_type>
-	_type Vector<_type>::Min(const Function<_sel_type(const _type&)>& selector) const
+	_type Vector<_type, _allocator>::Min(const Function<_sel_type(const _type&)>& selector) const
 	{
 		int count = Count();
 		if (count == 0)
@@ -870,9 +912,9 @@ namespace o2
 		return res;
 	}
 
-	template<typename _type>
+	template<typename _type, typename _allocator>
 	template<typename _sel_type>
-	int Vector<_type>::MinIdx(const Function<_sel_type(const _type&)>& selector) const
+	int Vector<_type, _allocator>::MinIdx(const Function<_sel_type(const _type&)>& selector) const
 	{
 		int count = Count();
 		if (count == 0)
@@ -895,9 +937,9 @@ namespace o2
 		return res;
 	}
 
-	template<typename _type>
+	template<typename _type, typename _allocator>
 	template<typename _sel_type>
-	_type Vector<_type>::Max(const Function<_sel_type(const _type&)>& selector) const
+	_type Vector<_type, _allocator>::Max(const Function<_sel_type(const _type&)>& selector) const
 	{
 		int count = Count();
 		if (count == 0)
@@ -921,9 +963,9 @@ namespace o2
 		return *res;
 	}
 
-	template<typename _type>
+	template<typename _type, typename _allocator>
 	template<typename _sel_type>
-	int Vector<_type>::MaxIdx(const Function<_sel_type(const _type&)>& selector) const
+	int Vector<_type, _allocator>::MaxIdx(const Function<_sel_type(const _type&)>& selector) const
 	{
 		int count = Count();
 		if (count == 0)
@@ -946,8 +988,8 @@ namespace o2
 		return res;
 	}
 
-	template<typename _type>
-	bool Vector<_type>::All(const Function<bool(const _type&)>& match) const
+	template<typename _type, typename _allocator>
+	bool Vector<_type, _allocator>::All(const Function<bool(const _type&)>& match) const
 	{
 		for (auto& element : *this)
 		{
@@ -958,8 +1000,8 @@ namespace o2
 		return true;
 	}
 
-	template<typename _type>
-	bool Vector<_type>::Any(const Function<bool(const _type&)>& match) const
+	template<typename _type, typename _allocator>
+	bool Vector<_type, _allocator>::Any(const Function<bool(const _type&)>& match) const
 	{
 		for (auto& element : *this)
 		{
@@ -970,9 +1012,9 @@ namespace o2
 		return false;
 	}
 
-	template<typename _type>
+	template<typename _type, typename _allocator>
 	template<typename _sel_type>
-	_sel_type Vector<_type>::Sum(const Function<_sel_type(const _type&)>& selector) const
+	_sel_type Vector<_type, _allocator>::Sum(const Function<_sel_type(const _type&)>& selector) const
 	{
 		int count = Count();
 		if (count == 0)
@@ -985,22 +1027,22 @@ namespace o2
 		return res;
 	}
 
-	template<typename _type>
-	void Vector<_type>::ForEach(const Function<void(_type&)>& func)
+	template<typename _type, typename _allocator>
+	void Vector<_type, _allocator>::ForEach(const Function<void(_type&)>& func)
 	{
 		for (auto& element : *this)
 			func(element);
 	}
 
-	template<typename _type>
-	void Vector<_type>::ForEach(const Function<void(const _type&)>& func) const
+	template<typename _type, typename _allocator>
+	void Vector<_type, _allocator>::ForEach(const Function<void(const _type&)>& func) const
 	{
 		for (auto& element : *this)
 			func(element);
 	}
 
-	template<typename _type>
-	void Vector<_type>::Reverse()
+	template<typename _type, typename _allocator>
+	void Vector<_type, _allocator>::Reverse()
 	{
 		int c = Count();
 		for (int i = 0; i < c/2; i++)
@@ -1,12 +1,62 @@
 #include "o2/stdafx.h"
 #include "TestApplication.h"
 
+#include "Tests/AnimationBake.h"
+#include "Tests/AnimationBatch.h"
+#include "Tests/ArenaAllocator.h"
+#include "Tests/AssetsBuilding.h"
+#include "Tests/AssetsCache.h"
+#include "Tests/AssetsStreaming.h"
+#include "Tests/Atlas.h"
+#include "Tests/BinaryData.h"
+#include "Tests/Containers.h"
+#include "Tests/Culling.h"
+#include "Tests/CursorAreaPicking.h"
+#include "Tests/DataMembers.h"
+#include "Tests/DrawCommands.h"
+#include "Tests/DrawablesDepth.h"
+#include "Tests/FieldPaths.h"
+#include "Tests/Fonts.h"
+#include "Tests/Jobs.h"
+#include "Tests/JsonStream.h"
+#include "Tests/MemoryManager.h"
+#include "Tests/Particles.h"
+#include "Tests/Profiling.h"
 #include "Tests/Prototypes.h"
+#include "Tests/SceneUpdate.h"
 #include "Tests/Scripts.h"
+#include "Tests/SpatialIndex.h"
+#include "Tests/Transforms.h"
+#include "Tests/TypeHierarchy.h"
 
 void TestApplication::OnStarted()
 {
 	Editor::EditorApplication::OnStarted();
 	TestPrototypes();
 	TestScripts();
+	TestDrawCommandBuffer();
+	TestTransformsStore();
+	TestSmallVectors();
+	TestArenaAllocator();
+	TestDrawablesDepthSorting();
+	TestCameraCulling();
+	TestSceneSpatialIndex();
+	TestJobSystem();
+	TestParallelSceneUpdate();
+	TestProfiler();
+	TestDataMembersIndex();
+	TestBinaryDataFormat();
+	TestJsonStreamSerialization();
+	TestTypeHierarchy();
+	TestFieldPaths();
+	TestAnimationTracksBatch();
+	TestAnimationBaking();
+	TestParticlesPool();
+	TestVectorFontDistanceField();
+	TestAtlasPacking();
+	TestAssetsBuilding();
+	TestAssetsStreamer();
+	TestAssetsCache();
+	TestCursorAreaPicking();
+	TestMemoryManager();
 }
\ No newline at end of file
@@ -0,0 +1,151 @@
+#include "o2/stdafx.h"
+#include "AnimationBake.h"
+
+#include "o2/Animation/AnimationClip.h"
+#include "o2/Animation/AnimationPlayer.h"
+#include "o2/Animation/BakedAnimationClip.h"
+#include "o2/Animation/BakedAnimationPlayer.h"
+#include "o2/Render/Sprite.h"
+#include "o2/Utils/Debug/Debug.h"
+
+using namespace o2;
+
+// Creates test clip with float, Vec2F and Color4 tracks animating sprite
+static AnimationClip CreateTestClip(float duration)
+{
+	AnimationClip clip;
+	clip.SetLoop(Loop::Repeat);
+
+	auto angleTrack = clip.AddTrack<float>("angle");
+	for (int i = 0; i < 7; i++)
+		angleTrack->AddKey(duration*i/6.0f, Math::Random(-3.0f, 3.0f), Math::Random(0.0f, 1.0f));
+
+	*clip.AddTrack<Vec2F>("position") = AnimationTrack<Vec2F>::EaseInOut(Vec2F(-100.0f, 50.0f), Vec2F(200.0f, -30.0f),
+																		   duration);
+
+	auto colorTrack = clip.AddTrack<Color4>("color");
+	for (int i = 0; i < 4; i++)
+	{
+		colorTrack->AddKey(duration*i/3.0f, Color4(Math::Random(0, 255), Math::Random(0, 255),
+												   Math::Random(0, 255), Math::Random(0, 255)));
+	}
+
+	return clip;
+}
+
+// Returns true when sprites values are equal in tolerance, updates maximum error of angle and position
+static bool IsSpritesEqual(const Sprite& source, const Sprite& baked, float tolerance, float& maxError)
+{
+	// Colors are baked normalized, so color tolerance is in 0..255 range with one level of rounding
+	float colorTolerance = tolerance*255.0f + 1.0f;
+
+	Vec2F positionError = source.GetPosition() - baked.GetPosition();
+	Color4 sourceColor = source.GetColor(), bakedColor = baked.GetColor();
+
+	maxError = Math::Max(maxError, Math::Abs(source.GetAngle() - baked.GetAngle()));
+	maxError = Math::Max(maxError, Math::Max(Math::Abs(positionError.x), Math::Abs(positionError.y)));
+
+	return maxError <= tolerance*1.01f &&
+		Math::Abs(sourceColor.r - bakedColor.r) <= colorTolerance &&
+		Math::Abs(sourceColor.g - bakedColor.g) <= colorTolerance &&
+		Math::Abs(sourceColor.b - bakedColor.b) <= colorTolerance &&
+		Math::Abs(sourceColor.a - bakedColor.a) <= colorTolerance;
+}
+
+static void TestBakedAnimationPlayer()
+{
+	const float duration = 3.0f;
+	const int checks = 300;
+
+	AnimationClip clip = CreateTestClip(duration);
+
+	AnimationBakeSettings settings;
+	BakedAnimationClip baked;
+	baked.Bake(clip, settings);
+
+	Sprite sourceSprite, bakedSprite;
+	AnimationPlayer sourcePlayer(&sourceSprite, &clip);
+	BakedAnimationPlayer bakedPlayer(&bakedSprite, &baked);
+
+	float maxError = 0.0f;
+	bool equal = true;
+
+	// Time goes over duration to check loop
+	for (int i = 0; i <= checks; i++)
+	{
+		float time = duration*1.5f*i/checks;
+
+		sourcePlayer.SetTime(time);
+		bakedPlayer.SetTime(time);
+
+		equal = IsSpritesEqual(sourceSprite, bakedSprite, settings.tolerance, maxError) && equal;
+	}
+
+	o2Debug.Log("Animation baking: source tracks " + (String)BakedAnimationClip::GetSourceMemorySize(clip) +
+				" bytes, baked " + (String)baked.GetMemorySize() + " bytes, measured error " +
+				(String)baked.GetMaxError() + ", played error " + (String)maxError);
+
+	if (equal && baked.GetTracks().Count() == 3)
+		o2Debug.Log("Baked animation playback matches source in tolerance - OK");
+	else
+		o2Debug.LogError("Baked animation playback matches source in tolerance - FAILED");
+}
+
+// Plays built animation with stripped source tracks by animation player. Angle track isn't baked, so it's played from
+// source track, other tracks are played from baked clip
+static void TestStrippedAnimationPlayback()
+{
+	const float duration = 3.0f;
+	const int checks = 300;
+
+	AnimationClip clip = CreateTestClip(duration);
+
+	AnimationClip bakedSource = clip;
+	bakedSource.RemoveTrack("angle");
+
+	AnimationBakeSettings settings;
+	BakedAnimationClip baked;
+	baked.Bake(bakedSource, settings);
+
+	AnimationClip stripped = clip;
+	for (auto track : baked.GetTracks())
+		stripped.RemoveTrack(track->path);
+
+	Sprite sourceSprite, strippedSprite;
+	AnimationPlayer sourcePlayer(&sourceSprite, &clip);
+	AnimationPlayer strippedPlayer(&strippedSprite, &stripped);
+	strippedPlayer.SetBakedClip(&baked);
+
+	bool tracksCorrect = stripped.GetTracks().Count() == 1 && strippedPlayer.GetTrackPlayers().Count() == 3 &&
+		Math::Equals(strippedPlayer.GetDuration(), sourcePlayer.GetDuration());
+
+	for (auto trackPlayer : strippedPlayer.GetTrackPlayers())
+	{
+		bool isBaked = trackPlayer->GetTrack() == nullptr;
+		tracksCorrect = tracksCorrect && isBaked == (trackPlayer->GetTrackPath() != "angle");
+	}
+
+	float maxError = 0.0f;
+	bool equal = true;
+
+	for (int i = 0; i <= checks; i++)
+	{
+		float time = duration*1.5f*i/checks;
+
+		sourcePlayer.SetTime(time);
+		strippedPlayer.SetTime(time);
+
+		equal = IsSpritesEqual(sourceSprite, strippedSprite, settings.tolerance, maxError) && equal;
+	}
+
+	if (tracksCorrect && equal)
+		o2Debug.Log("Stripped animation played from baked tracks - OK");
+	else
+		o2Debug.LogError("Stripped animation played from baked tracks - FAILED");
+}
+
+void TestAnimationBaking()
+{
+	TestBakedAnimationPlayer();
+	TestStrippedAnimationPlayback();
+}
@@ -0,0 +1,184 @@
+#include "o2/stdafx.h"
+#include "AnimationBatch.h"
+
+#include "o2/Animation/AnimationTracksBatch.h"
+#include "o2/Utils/Debug/Debug.h"
+#include "o2/Utils/System/Time/Timer.h"
+
+using namespace o2;
+
+void TestAnimationTracksBatch()
+{
+	const int floatTracksCount = 50000;
+	const int vec2TracksCount = 25000;
+	const int colorTracksCount = 25000;
+	const int uniqueTracksCount = 1000;
+	const int iterations = 20;
+	const float duration = 2.0f;
+
+	// Tracks are shared by players, like clips of many animated widgets
+	Vector<AnimationTrack<float>*> floatTracks;
+	Vector<AnimationTrack<Vec2F>*> vec2Tracks;
+	Vector<AnimationTrack<Color4>*> colorTracks;
+	for (int i = 0; i < uniqueTracksCount; i++)
+	{
+		auto floatTrack = mnew AnimationTrack<float>();
+		for (int j = 0; j < 5; j++)
+			floatTrack->AddKey(duration*j/4.0f, Math::Random(-100.0f, 100.0f), Math::Random(0.0f, 1.0f));
+
+		floatTracks.Add(floatTrack);
+
+		Vec2F begin(Math::Random(-100.0f, 100.0f), Math::Random(-100.0f, 100.0f));
+		Vec2F end(Math::Random(-100.0f, 100.0f), Math::Random(-100.0f, 100.0f));
+		vec2Tracks.Add(mnew AnimationTrack<Vec2F>(AnimationTrack<Vec2F>::EaseInOut(begin, end, duration)));
+
+		auto colorTrack = mnew AnimationTrack<Color4>();
+		for (int j = 0; j < 4; j++)
+		{
+			colorTrack->AddKey(duration*j/3.0f, Color4(Math::Random(0, 255), Math::Random(0, 255),
+													   Math::Random(0, 255), Math::Random(0, 255)));
+		}
+
+		colorTracks.Add(colorTrack);
+	}
+
+	// Each type has players evaluated one by one and players evaluated by batch, with own targets
+	struct Players
+	{
+		Vector<AnimationTrack<float>::Player*>  floats;
+		Vector<AnimationTrack<Vec2F>::Player*>  vec2s;
+		Vector<AnimationTrack<Color4>::Player*> colors;
+
+		Vector<float>  floatTargets;
+		Vector<Vec2F>  vec2Targets;
+		Vector<Color4> colorTargets;
+
+		void Create(const Vector<int>& floatIndices, const Vector<int>& vec2Indices, const Vector<int>& colorIndices,
+					const Vector<AnimationTrack<float>*>& floatTracks, const Vector<AnimationTrack<Vec2F>*>& vec2Tracks,
+					const Vector<AnimationTrack<Color4>*>& colorTracks)
+		{
+			floatTargets.Resize(floatIndices.Count());
+			vec2Targets.Resize(vec2Indices.Count());
+			colorTargets.Resize(colorIndices.Count());
+
+			for (int i = 0; i < floatIndices.Count(); i++)
+			{
+				auto player = mnew AnimationTrack<float>::Player();
+				player->SetTrack(floatTracks[floatIndices[i]]);
+				player->SetTarget(&floatTargets[i]);
+				floats.Add(player);
+			}
+
+			for (int i = 0; i < vec2Indices.Count(); i++)
+			{
+				auto player = mnew AnimationTrack<Vec2F>::Player();
+				player->SetTrack(vec2Tracks[vec2Indices[i]]);
+				player->SetTarget(&vec2Targets[i]);
+				vec2s.Add(player);
+			}
+
+			for (int i = 0; i < colorIndices.Count(); i++)
+			{
+				auto player = mnew AnimationTrack<Color4>::Player();
+				player->SetTrack(colorTracks[colorIndices[i]]);
+				player->SetTarget(&colorTargets[i]);
+				colors.Add(player);
+			}
+		}
+
+		void SetTime(float time)
+		{
+			for (auto player : floats)
+				player->ForceSetTime(time, player->GetDuration());
+
+			for (auto player : vec2s)
+				player->ForceSetTime(time, player->GetDuration());
+
+			for (auto player : colors)
+				player->ForceSetTime(time, player->GetDuration());
+		}
+
+		void Destroy()
+		{
+			for (auto player : floats)
+				delete player;
+
+			for (auto player : vec2s)
+				delete player;
+
+			for (auto player : colors)
+				delete player;
+		}
+	};
+
+	Vector<int> floatIndices, vec2Indices, colorIndices;
+	for (int i = 0; i < floatTracksCount; i++)
+		floatIndices.Add(Math::Random(0, uniqueTracksCount - 1));
+
+	for (int i = 0; i < vec2TracksCount; i++)
+		vec2Indices.Add(Math::Random(0, uniqueTracksCount - 1));
+
+	for (int i = 0; i < colorTracksCount; i++)
+		colorIndices.Add(Math::Random(0, uniqueTracksCount - 1));
+
+	Players single, batched;
+	single.Create(floatIndices, vec2Indices, colorIndices, floatTracks, vec2Tracks, colorTracks);
+	batched.Create(floatIndices, vec2Indices, colorIndices, floatTracks, vec2Tracks, colorTracks);
+
+	AnimationTracksBatch batch;
+	Timer timer;
+	float singleTime = 0.0f, batchedTime = 0.0f;
+	bool equal = true;
+
+	// Time goes forward and then backward to check both keys search directions
+	for (int i = 0; i < iterations; i++)
+	{
+		float time = i < iterations/2 ? duration*i/(iterations/2) : duration*(iterations - i)/(iterations/2) - 0.01f;
+
+		timer.Reset();
+		single.SetTime(time);
+		singleTime += timer.GetTime();
+
+		timer.Reset();
+		batch.BeginRecording();
+		batched.SetTime(time);
+		batch.EndRecording();
+		batch.Evaluate();
+		batchedTime += timer.GetTime();
+
+		equal = equal && batch.GetLastEvaluatedCount() == floatTracksCount + vec2TracksCount + colorTracksCount;
+
+		for (int j = 0; j < floatTracksCount && equal; j++)
+			equal = Math::Equals(single.floatTargets[j], batched.floatTargets[j], 0.001f);
+
+		for (int j = 0; j < vec2TracksCount && equal; j++)
+			equal = single.vec2Targets[j] == batched.vec2Targets[j];
+
+		for (int j = 0; j < colorTracksCount && equal; j++)
+		{
+			const Color4& a = single.colorTargets[j];
+			const Color4& b = batched.colorTargets[j];
+			equal = Math::Abs(a.r - b.r) <= 1 && Math::Abs(a.g - b.g) <= 1 && Math::Abs(a.b - b.b) <= 1 &&
+				Math::Abs(a.a - b.a) <= 1;
+		}
+	}
+
+	o2Debug.Log("Animation tracks evaluation of " + (String)(floatTracksCount + vec2TracksCount + colorTracksCount) +
+				" tracks, " + (String)iterations + " iterations: single " + (String)(singleTime*1000.0f) + "ms, batched " +
+				(String)(batchedTime*1000.0f) + "ms");
+
+	if (equal)
+		o2Debug.Log("Batched animation tracks equal to single evaluated - OK");
+	else
+		o2Debug.LogError("Batched animation tracks equal to single evaluated - FAILED");
+
+	single.Destroy();
+	batched.Destroy();
+
+	for (int i = 0; i < uniqueTracksCount; i++)
+	{
+		delete floatTracks[i];
+		delete vec2Tracks[i];
+		delete colorTracks[i];
+	}
+}
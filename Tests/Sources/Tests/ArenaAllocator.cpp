@@ -0,0 +1,143 @@
+#include "o2/stdafx.h"
+#include "ArenaAllocator.h"
+
+#include "o2/Utils/Debug/Debug.h"
+#include "o2/Utils/Memory/Allocators/ArenaAllocator.h"
+#include <string.h>
+
+using namespace o2;
+
+// Allocator, that counts blocks allocations of arena
+class ArenaCountingAllocator: public IAllocator
+{
+public:
+	int allocationsCount = 0;   // Count of allocations
+	int deallocationsCount = 0; // Count of deallocations
+
+public:
+	// Allocates memory and counts it
+	void* Allocate(size_t size) override { allocationsCount++; return malloc(size); }
+
+	// Deallocates memory and counts it
+	void Deallocate(void* ptr) override { deallocationsCount++; free(ptr); }
+
+	// Reallocates memory
+	void* Reallocate(void* ptr, size_t oldSize, size_t newSize) override { return realloc(ptr, newSize); }
+};
+
+// Checks that allocations are aligned and don't overlap
+static bool IsAlignmentCorrect()
+{
+	ArenaAllocator arena(64*1024);
+
+	std::byte* prevEnd = nullptr;
+	for (int size = 1; size < 200; size += 7)
+	{
+		std::byte* ptr = (std::byte*)arena.Allocate(size);
+		if ((size_t)ptr%16 != 0 || (prevEnd && ptr < prevEnd))
+			return false;
+
+		memset(ptr, 0xff, size);
+		prevEnd = ptr + size;
+	}
+
+	// Arrays are default constructed
+	int* values = arena.AllocateArray<int>(100);
+	for (int i = 0; i < 100; i++)
+	{
+		if (values[i] != 0)
+			return false;
+	}
+
+	return (size_t)values%16 == 0;
+}
+
+// Checks allocations, that don't fit in block
+static bool IsOverflowCorrect()
+{
+	ArenaCountingAllocator baseAllocator;
+	bool result = true;
+
+	{
+		ArenaAllocator arena(1024, &baseAllocator);
+		result = result && baseAllocator.allocationsCount == 1;
+
+		// Second allocation doesn't fit in first block
+		std::byte* first = (std::byte*)arena.Allocate(600);
+		std::byte* second = (std::byte*)arena.Allocate(600);
+		memset(first, 1, 600);
+		memset(second, 2, 600);
+
+		result = result && arena.GetCurrentStatistics().blocksCount == 2 && first[599] == (std::byte)1;
+
+		// Allocation bigger than doubled block gets block of its size
+		std::byte* big = (std::byte*)arena.Allocate(100000);
+		memset(big, 3, 100000);
+
+		auto stats = arena.GetCurrentStatistics();
+		result = result && stats.blocksCount == 3 && stats.capacity >= 100000 + 1024 + 2048 &&
+			stats.usedBytes >= 100000 + 1200 && stats.allocationsCount == 3 && second[599] == (std::byte)2;
+
+		// After reset blocks are merged into one, enough for whole previous usage
+		arena.Reset();
+		stats = arena.GetCurrentStatistics();
+		result = result && stats.blocksCount == 1 && stats.capacity >= arena.GetLastResetStatistics().usedBytes &&
+			stats.usedBytes == 0 && stats.allocationsCount == 0;
+
+		// Same usage after merge doesn't allocate blocks
+		int allocationsBefore = baseAllocator.allocationsCount;
+		for (int frame = 0; frame < 10; frame++)
+		{
+			arena.Allocate(600);
+			arena.Allocate(600);
+			arena.Allocate(100000);
+			arena.Reset();
+		}
+
+		result = result && baseAllocator.allocationsCount == allocationsBefore;
+
+		// Big block is shrunk back after small usage
+		arena.Allocate(100);
+		arena.Reset();
+		result = result && arena.GetCurrentStatistics().capacity < 100000 && arena.GetPeakUsedBytes() >= 101200;
+	}
+
+	return result && baseAllocator.allocationsCount == baseAllocator.deallocationsCount;
+}
+
+// Checks deallocation and reallocation of last allocation and reset
+static bool IsResetAndLastAllocationCorrect()
+{
+	ArenaAllocator arena(4096);
+
+	void* first = arena.Allocate(100);
+	void* last = arena.Allocate(100);
+
+	// Only last allocation returns memory
+	arena.Deallocate(first);
+	arena.Deallocate(last);
+	bool result = arena.Allocate(100) == last;
+
+	// Last allocation grows in place, other is copied
+	std::byte* grown = (std::byte*)arena.Reallocate(last, 100, 300);
+	result = result && grown == last;
+
+	memset(first, 7, 100);
+	std::byte* moved = (std::byte*)arena.Reallocate(first, 100, 200);
+	result = result && moved != first && moved[99] == (std::byte)7;
+
+	// Reset releases all memory, allocations start from beginning
+	arena.Reset();
+	result = result && arena.Allocate(100) == first && arena.GetLastResetStatistics().allocationsCount == 4 &&
+		arena.GetLastResetStatistics().blocksCount == 1;
+
+	return result;
+}
+
+void TestArenaAllocator()
+{
+	if (IsAlignmentCorrect() && IsOverflowCorrect() && IsResetAndLastAllocationCorrect())
+		o2Debug.Log("Arena allocator - OK");
+	else
+		o2Debug.LogError("Arena allocator - FAILED");
+}
@@ -0,0 +1,161 @@
+#include "o2/stdafx.h"
+#include "AssetsBuilding.h"
+
+#include "o2/Assets/AssetsTree.h"
+#include "o2/Assets/Builder/AssetsBuilder.h"
+#include "o2/Assets/Types/BinaryAsset.h"
+#include "o2/Utils/Debug/Debug.h"
+#include "o2/Utils/FileSystem/FileSystem.h"
+
+using namespace o2;
+
+static const String testPath = "AssetsBuildingTest/";
+static const String sourcePath = testPath + "Source/";
+static const int filesCount = 20;
+
+// Std converter with changeable version
+class VersionTestAssetConverter: public StdAssetConverter
+{
+public:
+	int version = 1; // Converter version
+
+public:
+	// Returns converter version
+	int GetVersion() const override { return version; }
+};
+
+// Assets builder, converts binary assets with version test converter
+class TestAssetsBuilder: public AssetsBuilder
+{
+public:
+	VersionTestAssetConverter converter; // Binary assets converter
+
+public:
+	// Constructor, replaces binary assets converter
+	TestAssetsBuilder()
+	{
+		converter.SetAssetsBuilder(this);
+		mAssetConverters[&TypeOf(BinaryAsset)] = &converter;
+	}
+
+	// Destructor, removes converter before it is destroyed
+	~TestAssetsBuilder()
+	{
+		mAssetConverters.Remove(&TypeOf(BinaryAsset));
+	}
+};
+
+static String GetSourceFilePath(int idx)
+{
+	return "Data/file" + (String)idx + ".txt";
+}
+
+static void CreateSourceAssets()
+{
+	o2FileSystem.FolderRemove(testPath);
+	o2FileSystem.FolderCreate(sourcePath + "Data");
+
+	for (int i = 0; i < filesCount; i++)
+		o2FileSystem.WriteFile(sourcePath + GetSourceFilePath(i), "Test file " + (String)i);
+}
+
+// Builds source assets into folder, returns modified assets
+static Vector<UID> BuildTestAssets(TestAssetsBuilder& builder, AssetsTree& tree, const String& name, bool forcible = false)
+{
+	return builder.BuildAssets(sourcePath, testPath + name + "/", testPath + name + ".json", &tree, forcible);
+}
+
+static bool IsFilesConverted(const AssetsTree& tree, const Vector<UID>& modifiedAssets)
+{
+	for (int i = 0; i < filesCount; i++)
+	{
+		if (!modifiedAssets.Contains(tree.Find(GetSourceFilePath(i))->meta->ID()))
+			return false;
+	}
+
+	return true;
+}
+
+static void TestAssetsBuildingChanges()
+{
+	AssetsTree tree;
+	TestAssetsBuilder builder;
+
+	BuildTestAssets(builder, tree, "Built", true);
+	UID touchedAsset = tree.Find(GetSourceFilePath(0))->meta->ID();
+	UID changedAsset = tree.Find(GetSourceFilePath(1))->meta->ID();
+
+	// Touching file changes only edit time, content hash is same
+	o2FileSystem.SetFileEditDate(sourcePath + GetSourceFilePath(0), TimeStamp(0, 0, 0, 1, 1, 2000));
+	o2FileSystem.WriteFile(sourcePath + GetSourceFilePath(1), "Changed test file");
+
+	Vector<UID> modifiedAssets = BuildTestAssets(builder, tree, "Built");
+	bool touchCorrect = !modifiedAssets.Contains(touchedAsset) && modifiedAssets.Contains(changedAsset);
+
+	if (touchCorrect)
+		o2Debug.Log("Assets building touched and changed files - OK");
+	else
+		o2Debug.LogError("Assets building touched and changed files - FAILED");
+
+	builder.converter.version++;
+	modifiedAssets = BuildTestAssets(builder, tree, "Built");
+	bool versionCorrect = IsFilesConverted(tree, modifiedAssets);
+
+	modifiedAssets = BuildTestAssets(builder, tree, "Built");
+	versionCorrect = versionCorrect && !modifiedAssets.Contains(touchedAsset);
+
+	if (versionCorrect)
+		o2Debug.Log("Assets building converter version change - OK");
+	else
+		o2Debug.LogError("Assets building converter version change - FAILED");
+}
+
+static bool IsBuiltFilesEqual(const AssetsTree& treeA, const String& pathA, const AssetsTree& treeB, const String& pathB)
+{
+	for (int i = 0; i < filesCount; i++)
+	{
+		if (!treeA.Find(GetSourceFilePath(i)) || !treeB.Find(GetSourceFilePath(i)))
+			return false;
+
+		String fileA = o2FileSystem.ReadFile(testPath + pathA + "/" + GetSourceFilePath(i));
+		String fileB = o2FileSystem.ReadFile(testPath + pathB + "/" + GetSourceFilePath(i));
+		if (fileA.IsEmpty() || fileA != fileB)
+			return false;
+	}
+
+	return true;
+}
+
+static void TestAssetsBuildingParallel()
+{
+	AssetsTree serialTree, parallelTree;
+	TestAssetsBuilder builder;
+
+	builder.SetParallelBuilding(false);
+	Vector<UID> serialAssets = BuildTestAssets(builder, serialTree, "BuiltSerial", true);
+
+	builder.SetParallelBuilding(true);
+	Vector<UID> parallelAssets = BuildTestAssets(builder, parallelTree, "BuiltParallel", true);
+
+	// Trees are compared without built path, it is different for builds
+	serialTree.builtAssetsPath = "";
+	parallelTree.builtAssetsPath = "";
+
+	bool equal = serialAssets == parallelAssets && serialTree.SerializeToString() == parallelTree.SerializeToString() &&
+		IsBuiltFilesEqual(serialTree, "BuiltSerial", parallelTree, "BuiltParallel");
+
+	if (equal)
+		o2Debug.Log("Assets parallel building equal to serial - OK");
+	else
+		o2Debug.LogError("Assets parallel building equal to serial - FAILED");
+}
+
+void TestAssetsBuilding()
+{
+	CreateSourceAssets();
+
+	TestAssetsBuildingChanges();
+	TestAssetsBuildingParallel();
+
+	o2FileSystem.FolderRemove(testPath);
+}
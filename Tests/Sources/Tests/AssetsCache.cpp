@@ -0,0 +1,162 @@
+#include "o2/stdafx.h"
+#include "AssetsCache.h"
+
+#include "o2/Assets/Assets.h"
+#include "o2/Assets/Types/BinaryAsset.h"
+#include "o2/Utils/Debug/Debug.h"
+#include "o2/Utils/FileSystem/FileSystem.h"
+#include <limits>
+
+using namespace o2;
+
+static const String testFolder = "AssetsCacheTest";
+static const int assetsCount = 4;
+
+static String GetTestAssetPath(int idx)
+{
+	return testFolder + "/asset" + (String)idx + ".bin";
+}
+
+// Creates binary assets with same size and builds them
+static void CreateTestAssets()
+{
+	String data;
+	for (int i = 0; i < 64; i++)
+		data += "0123456789abcdef";
+
+	o2FileSystem.FolderCreate(o2Assets.GetAssetsPath() + testFolder);
+	for (int i = 0; i < assetsCount; i++)
+		o2FileSystem.WriteFile(o2Assets.GetAssetsPath() + GetTestAssetPath(i), data);
+
+	o2Assets.RebuildAssets();
+}
+
+// Requests asset, returns true when it was found in cache
+static bool IsRequestedFromCache(const String& path)
+{
+	UInt64 hits = o2Assets.GetAssetsCacheStats().hits;
+	AssetRef asset = o2Assets.GetAssetRef(path);
+	return asset && o2Assets.GetAssetsCacheStats().hits == hits + 1;
+}
+
+// Unloads all unused assets, so test assets are only unused assets after
+static void UnloadUnusedAssets()
+{
+	o2Assets.SetAssetsCacheBudget(0);
+	o2Assets.CheckAssetsUnload();
+	o2Assets.SetAssetsCacheBudget(std::numeric_limits<UInt64>::max());
+}
+
+static void TestAssetsCacheCounters()
+{
+	UnloadUnusedAssets();
+
+	Assets::CacheStats stats = o2Assets.GetAssetsCacheStats();
+	AssetRef first = o2Assets.GetAssetRef(GetTestAssetPath(0));
+	AssetRef second = o2Assets.GetAssetRef(GetTestAssetPath(0));
+	Assets::CacheStats newStats = o2Assets.GetAssetsCacheStats();
+
+	if (first.Get() == second.Get() && newStats.misses == stats.misses + 1 && newStats.hits == stats.hits + 1 &&
+		newStats.cachedCount == stats.cachedCount + 1)
+	{
+		o2Debug.Log("Assets cache hits and misses counters - OK");
+	}
+	else
+		o2Debug.LogError("Assets cache hits and misses counters - FAILED");
+}
+
+static void TestAssetsCacheEviction()
+{
+	UnloadUnusedAssets();
+
+	Vector<AssetRef> assets;
+	for (int i = 0; i < assetsCount; i++)
+		assets.Add(o2Assets.GetAssetRef(GetTestAssetPath(i)));
+
+	// Assets are released in order 2, 0, 3, 1, least recently released are unloaded first
+	int releaseOrder[] = { 2, 0, 3, 1 };
+	for (auto idx : releaseOrder)
+	{
+		assets[idx] = AssetRef();
+		o2Assets.CheckAssetsUnload();
+	}
+
+	Assets::CacheStats stats = o2Assets.GetAssetsCacheStats();
+	UInt64 assetSize = stats.unusedSize/assetsCount;
+
+	o2Assets.SetAssetsCacheBudget(stats.cachedSize - assetSize*2);
+	o2Assets.CheckAssetsUnload();
+	o2Assets.SetAssetsCacheBudget(std::numeric_limits<UInt64>::max());
+
+	Assets::CacheStats newStats = o2Assets.GetAssetsCacheStats();
+	bool countersCorrect = stats.unusedCount == assetsCount && newStats.unusedCount == 2 &&
+		newStats.evictions == stats.evictions + 2 && newStats.cachedCount == stats.cachedCount - 2;
+
+	bool consistent = o2Assets.CheckAssetsCacheConsistency();
+
+	bool orderCorrect = !IsRequestedFromCache(GetTestAssetPath(2)) && !IsRequestedFromCache(GetTestAssetPath(0)) &&
+		IsRequestedFromCache(GetTestAssetPath(3)) && IsRequestedFromCache(GetTestAssetPath(1));
+
+	if (countersCorrect && consistent && orderCorrect)
+		o2Debug.Log("Assets cache least recently used eviction - OK");
+	else
+		o2Debug.LogError("Assets cache least recently used eviction - FAILED");
+}
+
+static void TestAssetsCacheNotUnloadable()
+{
+	UnloadUnusedAssets();
+
+	o2Assets.GetAssetRef(GetTestAssetPath(0))->SetDirty(true);
+
+	// Streaming asset isn't finalized until streaming update, so it stays loading
+	o2Assets.LoadAssetAsync(GetTestAssetPath(1));
+
+	o2Assets.SetAssetsCacheBudget(0);
+	o2Assets.CheckAssetsUnload();
+	o2Assets.SetAssetsCacheBudget(std::numeric_limits<UInt64>::max());
+
+	bool consistent = o2Assets.CheckAssetsCacheConsistency();
+	bool kept = IsRequestedFromCache(GetTestAssetPath(0)) && IsRequestedFromCache(GetTestAssetPath(1));
+
+	o2Assets.GetAssetRef(GetTestAssetPath(0))->SetDirty(false);
+
+	if (consistent && kept)
+		o2Debug.Log("Assets cache keeps dirty and loading assets - OK");
+	else
+		o2Debug.LogError("Assets cache keeps dirty and loading assets - FAILED");
+}
+
+static void TestAssetsCacheDuplicates()
+{
+	AssetRef asset = o2Assets.GetAssetRef(GetTestAssetPath(0));
+
+	// Copy of asset has same path and new id, it replaces asset in cache by path
+	BinaryAsset* duplicate = mnew BinaryAsset(*(BinaryAsset*)asset.Get());
+	bool duplicateConsistent = o2Assets.CheckAssetsCacheConsistency();
+
+	delete duplicate;
+	bool removedConsistent = o2Assets.CheckAssetsCacheConsistency();
+
+	AssetRef assetByPath = o2Assets.GetAssetRef(GetTestAssetPath(0));
+
+	if (duplicateConsistent && removedConsistent && assetByPath.Get() == asset.Get())
+		o2Debug.Log("Assets cache consistency after duplicate removal - OK");
+	else
+		o2Debug.LogError("Assets cache consistency after duplicate removal - FAILED");
+}
+
+void TestAssetsCache()
+{
+	UInt64 budget = o2Assets.GetAssetsCacheBudget();
+
+	CreateTestAssets();
+
+	TestAssetsCacheCounters();
+	TestAssetsCacheEviction();
+	TestAssetsCacheNotUnloadable();
+	TestAssetsCacheDuplicates();
+
+	o2Assets.SetAssetsCacheBudget(budget);
+	o2Assets.RemoveAsset(testFolder);
+}
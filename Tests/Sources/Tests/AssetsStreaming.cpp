@@ -0,0 +1,244 @@
+#include "o2/stdafx.h"
+#include "AssetsStreaming.h"
+
+#include "o2/Assets/Assets.h"
+#include "o2/Assets/AssetsStreamer.h"
+#include "o2/Render/TextureRef.h"
+#include "o2/Utils/Bitmap/Bitmap.h"
+#include "o2/Utils/Debug/Debug.h"
+#include "o2/Utils/FileSystem/FileSystem.h"
+#include <atomic>
+#include <chrono>
+#include <limits>
+
+using namespace o2;
+
+// Waits condition with timeout, returns false when time is out
+static bool WaitFor(const Function<bool()>& condition)
+{
+	for (int i = 0; i < 5000; i++)
+	{
+		if (condition())
+			return true;
+
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+
+	return false;
+}
+
+// Test streaming request. Decoding can be blocked until release, calls are recorded
+struct StreamingTestRequest
+{
+	int               id = 0;             // Request id
+	std::atomic<bool> blocked;            // Is decoding blocked
+	std::atomic<bool> decodeStarted;      // Is decoding started
+	bool              finalized = false;  // Is finalize called
+	bool              cancelled = false;  // Is cancel called
+
+	AssetsStreamer::Request* request = nullptr; // Streamer request
+
+public:
+	// Constructor
+	StreamingTestRequest(int id = 0, bool blocked = false):
+		id(id), blocked(blocked), decodeStarted(false)
+	{}
+
+	// Adds request into streamer, decoding and finalization orders are written into lists
+	void Add(AssetsStreamer& streamer, int priority, Vector<int>* decodeOrder = nullptr, std::mutex* decodeOrderMutex = nullptr,
+			 Vector<int>* finalizeOrder = nullptr)
+	{
+		request = streamer.Add(
+			[=]()
+			{
+				decodeStarted = true;
+				while (blocked)
+					std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+				if (decodeOrder)
+				{
+					std::lock_guard<std::mutex> lock(*decodeOrderMutex);
+					decodeOrder->Add(id);
+				}
+			},
+			[=]()
+			{
+				finalized = true;
+				if (finalizeOrder)
+					finalizeOrder->Add(id);
+
+				return true;
+			},
+			[=]() { cancelled = true; },
+			priority);
+	}
+};
+
+static bool IsStats(const AssetsStreamer::Stats& stats, int queued, int inFlight, int decoded, int finished, int cancelled)
+{
+	return stats.queued == queued && stats.inFlight == inFlight && stats.decoded == decoded &&
+		stats.finished == finished && stats.cancelled == cancelled;
+}
+
+static void TestAssetsStreamerPriorities()
+{
+	AssetsStreamer streamer(1);
+
+	Vector<int> decodeOrder, finalizeOrder;
+	std::mutex decodeOrderMutex;
+
+	// First request blocks streaming thread, so other requests are queued together
+	StreamingTestRequest blocker(0, true);
+	blocker.Add(streamer, 0, &decodeOrder, &decodeOrderMutex, &finalizeOrder);
+	WaitFor([&]() { return (bool)blocker.decodeStarted; });
+
+	StreamingTestRequest requests[] = { { 1 }, { 2 }, { 3 }, { 4 } };
+	int priorities[] = { 0, 5, 1, 5 };
+	for (int i = 0; i < 4; i++)
+		requests[i].Add(streamer, priorities[i], &decodeOrder, &decodeOrderMutex, &finalizeOrder);
+
+	bool statsCorrect = IsStats(streamer.GetStats(), 4, 1, 0, 0, 0);
+
+	blocker.blocked = false;
+	bool decoded = WaitFor([&]() { return streamer.GetStats().decoded == 5; });
+	statsCorrect = statsCorrect && IsStats(streamer.GetStats(), 0, 0, 5, 0, 0);
+
+	streamer.Update(std::numeric_limits<float>::max());
+	statsCorrect = statsCorrect && IsStats(streamer.GetStats(), 0, 0, 0, 5, 0);
+
+	bool orderCorrect = decoded && decodeOrder == Vector<int>({ 0, 2, 4, 3, 1 }) &&
+		finalizeOrder == Vector<int>({ 2, 4, 3, 0, 1 });
+
+	if (orderCorrect && statsCorrect)
+		o2Debug.Log("Assets streamer priorities order and stats - OK");
+	else
+		o2Debug.LogError("Assets streamer priorities order and stats - FAILED");
+}
+
+static void TestAssetsStreamerCancel()
+{
+	AssetsStreamer streamer(1);
+
+	StreamingTestRequest decoding(0, true);
+	decoding.Add(streamer, 0);
+	WaitFor([&]() { return (bool)decoding.decodeStarted; });
+
+	// Queued request is cancelled immediately without decoding
+	StreamingTestRequest queued;
+	queued.Add(streamer, 0);
+	streamer.Cancel(queued.request);
+
+	bool queuedCorrect = queued.cancelled && !queued.decodeStarted && !queued.finalized &&
+		IsStats(streamer.GetStats(), 0, 1, 0, 0, 1);
+
+	// Decoding request is cancelled when it is returned to main thread
+	streamer.Cancel(decoding.request);
+	bool decodingCorrect = !decoding.cancelled;
+
+	decoding.blocked = false;
+	WaitFor([&]() { return streamer.GetStats().decoded == 1; });
+	streamer.Update(std::numeric_limits<float>::max());
+
+	decodingCorrect = decodingCorrect && decoding.cancelled && !decoding.finalized &&
+		IsStats(streamer.GetStats(), 0, 0, 0, 0, 2);
+
+	if (queuedCorrect && decodingCorrect)
+		o2Debug.Log("Assets streamer cancel before and during decoding - OK");
+	else
+		o2Debug.LogError("Assets streamer cancel before and during decoding - FAILED");
+}
+
+static void TestAssetsStreamerFinish()
+{
+	AssetsStreamer streamer(1);
+
+	StreamingTestRequest decoding(0, true);
+	decoding.Add(streamer, 0);
+	WaitFor([&]() { return (bool)decoding.decodeStarted; });
+
+	// Queued request is decoded on calling thread
+	StreamingTestRequest queued;
+	queued.Add(streamer, 0);
+	streamer.Finish(queued.request);
+
+	bool queuedCorrect = queued.finalized && IsStats(streamer.GetStats(), 0, 1, 0, 1, 0);
+
+	// In flight request is waited, decoding is released from other thread
+	std::thread releaseThread([&]()
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(20));
+		decoding.blocked = false;
+	});
+
+	streamer.Finish(decoding.request);
+	releaseThread.join();
+
+	bool inFlightCorrect = decoding.finalized && IsStats(streamer.GetStats(), 0, 0, 0, 2, 0);
+
+	if (queuedCorrect && inFlightCorrect)
+		o2Debug.Log("Assets streamer finish queued and in flight requests - OK");
+	else
+		o2Debug.LogError("Assets streamer finish queued and in flight requests - FAILED");
+}
+
+// Finishes request, which finalization waits other request added earlier, like image waits atlas page texture. Waited
+// request is finalized while finishing, finishing request must be finalized only once and only by Finish
+static void TestAssetsStreamerFinishWaiting()
+{
+	AssetsStreamer streamer(1);
+
+	bool waitedFinalized = false;
+	int finalizeCalls = 0, finishedCalls = 0;
+
+	streamer.Add([]() {}, [&]() { waitedFinalized = true; return true; }, []() {}, std::numeric_limits<int>::max());
+
+	auto request = streamer.Add([]() {},
+								[&]()
+								{
+									finalizeCalls++;
+									if (!waitedFinalized)
+										return false;
+
+									finishedCalls++;
+									return true;
+								},
+								[]() {});
+
+	streamer.Finish(request);
+
+	if (waitedFinalized && finishedCalls == 1 && finalizeCalls >= 2 && IsStats(streamer.GetStats(), 0, 0, 0, 2, 0))
+		o2Debug.Log("Assets streamer finish request waiting other request - OK");
+	else
+		o2Debug.LogError("Assets streamer finish request waiting other request - FAILED");
+}
+
+static void TestTextureStreamingFinish()
+{
+	String fileName = "StreamingTestTexture.png";
+
+	Bitmap bitmap(PixelFormat::R8G8B8A8, Vec2I(16, 16));
+	bitmap.Fill(Color4::Green());
+	bitmap.Save(fileName, Bitmap::ImageType::Png);
+
+	// Synchronous texture request by file name finishes streaming texture
+	TextureRef streamingTexture = o2Assets.LoadTextureAsync(fileName);
+	TextureRef texture(fileName);
+
+	bool correct = texture == streamingTexture && texture->IsReady() && texture->GetSize() == Vec2I(16, 16);
+
+	o2FileSystem.FileDelete(fileName);
+
+	if (correct)
+		o2Debug.Log("Streaming texture finished by file name request - OK");
+	else
+		o2Debug.LogError("Streaming texture finished by file name request - FAILED");
+}
+
+void TestAssetsStreamer()
+{
+	TestAssetsStreamerPriorities();
+	TestAssetsStreamerCancel();
+	TestAssetsStreamerFinish();
+	TestAssetsStreamerFinishWaiting();
+	TestTextureStreamingFinish();
+}
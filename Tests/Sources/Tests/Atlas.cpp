@@ -0,0 +1,74 @@
+#include "o2/stdafx.h"
+#include "Atlas.h"
+
+#include "o2/Utils/Debug/Debug.h"
+#include "o2/Utils/System/Time/Timer.h"
+#include "o2/Utils/Tools/RectPacker.h"
+
+using namespace o2;
+
+// Returns true when packed rectangles are inside page, have their sizes and don't intersect each other
+static bool IsPackingValid(const Vector<RectsPacker::Rect*>& rects, const Vec2F& pageSize)
+{
+	for (int i = 0; i < rects.Count(); i++)
+	{
+		const RectF& rect = rects[i]->rect;
+		Vec2F size = rects[i]->rotated ? Vec2F(rects[i]->size.y, rects[i]->size.x) : rects[i]->size;
+
+		if (rect.left < 0 || rect.bottom < 0 || rect.right > pageSize.x || rect.top > pageSize.y)
+			return false;
+
+		if (!Math::Equals(rect.Width(), size.x) || !Math::Equals(rect.Height(), size.y))
+			return false;
+
+		for (int j = i + 1; j < rects.Count(); j++)
+		{
+			const RectF& other = rects[j]->rect;
+			if (rects[i]->page == rects[j]->page && rect.left < other.right && other.left < rect.right &&
+				rect.bottom < other.top && other.bottom < rect.top)
+			{
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+static void TestAtlasPackingAlgorithm(const Vector<Vec2F>& sizes, const Vec2F& pageSize,
+									  RectsPacker::Algorithm algorithm, bool rotation, const String& name)
+{
+	RectsPacker packer(pageSize);
+	packer.SetAlgorithm(algorithm);
+	packer.SetRotationAllowed(rotation);
+
+	Vector<RectsPacker::Rect*> rects;
+	for (auto& size : sizes)
+		rects.Add(packer.AddRect(size));
+
+	Timer timer;
+	bool packed = packer.Pack();
+	float time = timer.GetTime();
+
+	if (packed && IsPackingValid(rects, pageSize))
+	{
+		o2Debug.Log("Atlas packing " + name + ": " + (String)packer.GetPagesCount() + " pages, efficiency " +
+					(String)packer.GetPackingEfficiency() + ", " + (String)(time*1000.0f) + "ms - OK");
+	}
+	else
+		o2Debug.LogError("Atlas packing " + name + " - FAILED");
+}
+
+void TestAtlasPacking()
+{
+	const int rectsCount = 2000;
+	const Vec2F pageSize(2048, 2048);
+
+	Vector<Vec2F> sizes;
+	for (int i = 0; i < rectsCount; i++)
+		sizes.Add(Vec2F((float)Math::Random(8, 128), (float)Math::Random(8, 128)));
+
+	TestAtlasPackingAlgorithm(sizes, pageSize, RectsPacker::Algorithm::QuadTree, false, "quad tree");
+	TestAtlasPackingAlgorithm(sizes, pageSize, RectsPacker::Algorithm::MaxRects, false, "max rects");
+	TestAtlasPackingAlgorithm(sizes, pageSize, RectsPacker::Algorithm::MaxRects, true, "max rects with rotation");
+}
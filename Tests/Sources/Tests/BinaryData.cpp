@@ -0,0 +1,159 @@
+#include "o2/stdafx.h"
+#include "BinaryData.h"
+
+#include "o2/Utils/Debug/Debug.h"
+#include "o2/Utils/FileSystem/FileSystem.h"
+#include "o2/Utils/Serialization/DataValue.h"
+#include "o2/Utils/System/Time/Timer.h"
+
+using namespace o2;
+
+// Converts JSON to binary and back, returns true when documents and JSON texts are equal
+static bool CheckRoundTrip(const char* json)
+{
+	DataDocument source;
+	if (!source.LoadFromData(json))
+		return false;
+
+	String binary = source.SaveAsString(DataDocument::Format::Binary);
+
+	DataDocument loaded;
+	if (!loaded.LoadFromData(binary, DataDocument::Format::Binary))
+		return false;
+
+	return loaded == source && loaded.SaveAsString() == source.SaveAsString();
+}
+
+// Fills data like serialized actor with transform, components and children, returns count of actors
+static int FillSceneActor(DataValue& data, int depth, int& actorsCount)
+{
+	actorsCount++;
+
+	data["name"] = "Actor " + (String)actorsCount;
+	data["id"] = (UInt64)actorsCount*2654435761ull;
+	data["enabled"] = actorsCount%7 != 0;
+	data["layerName"] = actorsCount%3 == 0 ? "Default" : "Foreground";
+
+	auto& transform = data["transform"];
+	transform["position"]["x"] = Math::Random(-1000.0f, 1000.0f);
+	transform["position"]["y"] = Math::Random(-1000.0f, 1000.0f);
+	transform["size"]["x"] = Math::Random(1.0f, 100.0f);
+	transform["size"]["y"] = Math::Random(1.0f, 100.0f);
+	transform["scale"]["x"] = 1.0f;
+	transform["scale"]["y"] = 1.0f;
+	transform["angle"] = Math::Random(0.0f, 360.0f);
+
+	auto& components = data["components"];
+	components.SetArray();
+	for (int i = 0; i < actorsCount%3; i++)
+	{
+		auto& component = components.AddElement();
+		component["type"] = i == 0 ? "o2::ImageComponent" : "o2::AnimationComponent";
+		component["enabled"] = true;
+		component["value"] = Math::Random(-100000, 100000);
+	}
+
+	auto& children = data["children"];
+	children.SetArray();
+	if (depth < 4)
+	{
+		for (int i = 0; i < 5; i++)
+			FillSceneActor(children.AddElement(), depth + 1, actorsCount);
+	}
+
+	return actorsCount;
+}
+
+void TestBinaryDataFormat()
+{
+	// Round trip of all kinds of values
+	const char* cases[] = {
+		"null",
+		"true",
+		"false",
+		"0",
+		"-1",
+		"2147483647",
+		"-2147483648",
+		"4294967295",
+		"9223372036854775807",
+		"-9223372036854775808",
+		"18446744073709551615",
+		"3.14159",
+		"-1e-300",
+		"\"\"",
+		"\"short\"",
+		"\"long string, that doesn't fit into short string storage of data value\"",
+		"\"unicode \\u044e\\u043d\\u0438\\u043a\\u043e\\u0434\"",
+		"[]",
+		"{}",
+		"[[], {}, [[[]]], {\"a\": {}}]",
+		"[1, -2, 3.5, \"four\", true, false, null, 5000000000, -5000000000]",
+		"{\"name\": \"value\", \"name2\": \"value\", \"nested\": {\"name\": [\"value\", {\"name\": \"name\"}]}}",
+		"{\"same\": 1, \"same\": 2}"
+	};
+
+	bool roundTripsCorrect = true;
+	for (auto json : cases)
+	{
+		if (!CheckRoundTrip(json))
+		{
+			roundTripsCorrect = false;
+			o2Debug.LogError("Binary data round trip failed: " + (String)json);
+		}
+	}
+
+	// Corrupted data must not be parsed
+	DataDocument corruptedSource;
+	corruptedSource.LoadFromData("{\"a\": [1, 2, {\"b\": \"c\"}]}");
+	String corrupted = corruptedSource.SaveAsString(DataDocument::Format::Binary);
+
+	DataDocument corruptedLoaded;
+	bool corruptedRejected = !corruptedLoaded.LoadFromData(corrupted.SubStr(0, corrupted.Length() - 3), DataDocument::Format::Binary) &&
+		!corruptedLoaded.LoadFromData("o2bd", DataDocument::Format::Binary);
+
+	// Large scene saved into files and loaded with JSON parser and memory mapped binary reader
+	DataDocument scene;
+	int actorsCount = 0;
+	FillSceneActor(scene["root"], 0, actorsCount);
+
+	String jsonPath = "binary_data_test.json";
+	String binaryPath = "binary_data_test.o2bd";
+	scene.SaveToFile(jsonPath);
+	scene.SaveToFile(binaryPath, DataDocument::Format::Binary);
+
+	const int loadsCount = 10;
+	Timer timer;
+
+	DataDocument jsonLoaded;
+	for (int i = 0; i < loadsCount; i++)
+		jsonLoaded.LoadFromFile(jsonPath);
+
+	float jsonTime = timer.GetDeltaTime()/loadsCount;
+
+	bool binaryLoadedCorrect = true;
+	float binaryTime = 0.0f;
+
+	// Loaded binary document maps file, so it's destroyed before file is deleted
+	{
+		DataDocument binaryLoaded;
+		for (int i = 0; i < loadsCount; i++)
+			binaryLoadedCorrect = binaryLoaded.LoadFromFile(binaryPath, DataDocument::Format::Binary) && binaryLoadedCorrect;
+
+		binaryTime = timer.GetDeltaTime()/loadsCount;
+
+		binaryLoadedCorrect = binaryLoadedCorrect && binaryLoaded == scene && binaryLoaded == jsonLoaded;
+	}
+
+	o2Debug.Log("Scene of " + (String)actorsCount + " actors load: JSON " + (String)(jsonTime*1000.0f) + "ms, " +
+				(String)(int)(o2FileSystem.GetFileInfo(jsonPath).size/1024) + "KB; binary " + (String)(binaryTime*1000.0f) +
+				"ms, " + (String)(int)(o2FileSystem.GetFileInfo(binaryPath).size/1024) + "KB");
+
+	o2FileSystem.FileDelete(jsonPath);
+	o2FileSystem.FileDelete(binaryPath);
+
+	if (roundTripsCorrect && corruptedRejected && binaryLoadedCorrect)
+		o2Debug.Log("Binary data format - OK");
+	else
+		o2Debug.LogError("Binary data format - FAILED");
+}
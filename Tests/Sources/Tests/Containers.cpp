@@ -0,0 +1,170 @@
+#include "o2/stdafx.h"
+#include "Containers.h"
+
+#include "o2/Scene/Actor.h"
+#include "o2/Scene/Component.h"
+#include "o2/Scene/ISceneDrawable.h"
+#include "o2/Utils/Debug/Debug.h"
+#include "o2/Utils/Memory/Allocators/AllocatorAdapter.h"
+#include "o2/Utils/Serialization/DataValue.h"
+#include "o2/Utils/System/Time/Timer.h"
+#include "o2/Utils/Types/Containers/SmallVector.h"
+
+using namespace o2;
+
+// Allocator, that counts allocations. Used by vectors to count their heap allocations
+class ContainersCountingAllocator: public IAllocator
+{
+public:
+	Int64 allocationsCount = 0; // Count of allocations
+
+public:
+	// Allocates memory and counts it
+	void* Allocate(size_t size) override { allocationsCount++; return malloc(size); }
+
+	// Deallocates memory
+	void Deallocate(void* ptr) override { free(ptr); }
+
+	// Reallocates memory and counts it
+	void* Reallocate(void* ptr, size_t oldSize, size_t newSize) override { allocationsCount++; return realloc(ptr, newSize); }
+};
+
+// Returns true when array elements are stored inside array object
+template<typename _array_type>
+bool IsArrayInline(const _array_type& array)
+{
+	auto data = (const std::byte*)array.data();
+	return data >= (const std::byte*)&array && data < (const std::byte*)&array + sizeof(_array_type);
+}
+
+// Fills arrays with 0-4 elements, like actors children and components. Arrays are copied from empty array
+template<typename _array_type>
+void FillSmallArrays(Vector<_array_type>& arrays, const _array_type& emptyArray, int arraysCount, float& time)
+{
+	Timer timer;
+
+	arrays.Reserve(arraysCount);
+
+	for (int i = 0; i < arraysCount; i++)
+	{
+		arrays.Add(emptyArray);
+		auto& array = arrays.Last();
+
+		for (int j = 0; j < i%5; j++)
+			array.Add(&array);
+	}
+
+	time = timer.GetTime();
+}
+
+void TestSmallVectors()
+{
+	const int arraysCount = 100000;
+	const int actorsCount = 20000;
+	const int iterations = 20;
+
+	// Containers only: count of allocations with heap and inline storage. Vector allocations are counted by
+	// allocator, small vector allocates heap memory only when elements aren't inline
+	ContainersCountingAllocator countingAllocator;
+	typedef Vector<void*, AllocatorAdapter<void*>> CountingVector;
+
+	float vectorTime = 0, smallVectorTime = 0;
+	int vectorAllocations = 0, smallVectorAllocations = 0;
+
+	{
+		Vector<CountingVector> arrays;
+		FillSmallArrays(arrays, CountingVector(AllocatorAdapter<void*>(&countingAllocator)), arraysCount, vectorTime);
+		vectorAllocations = (int)countingAllocator.allocationsCount;
+	}
+
+	{
+		Vector<SmallVector<void*, 4>> arrays;
+		FillSmallArrays(arrays, SmallVector<void*, 4>(), arraysCount, smallVectorTime);
+		smallVectorAllocations = arrays.Count([](const SmallVector<void*, 4>& x) { return !IsArrayInline(x); });
+	}
+
+	o2Debug.Log("Filling " + (String)arraysCount + " arrays with 0-4 elements: Vector " + (String)vectorAllocations +
+				" allocations " + (String)(vectorTime*1000.0f) + "ms, SmallVector " + (String)smallVectorAllocations +
+				" allocations " + (String)(smallVectorTime*1000.0f) + "ms");
+
+	// Scene load: actors hierarchy with components, each actor has few children
+	Timer timer;
+
+	Vector<Actor*> roots, actors;
+	for (int i = 0; i < actorsCount; i++)
+	{
+		Actor* actor = mnew Actor(ActorCreateMode::NotInScene);
+
+		for (int j = 0; j < i%3; j++)
+			actor->AddComponent(mnew Component());
+
+		if (i < actorsCount/100)
+			roots.Add(actor);
+		else
+			actors[i/4]->AddChild(actor);
+
+		actors.Add(actor);
+	}
+
+	float loadTime = timer.GetTime();
+
+	// Children and components arrays memory must be placed inside actors
+	auto isInActor = [](Actor* actor, const void* data) {
+		return (const std::byte*)data >= (const std::byte*)actor && (const std::byte*)data < (const std::byte*)actor + sizeof(Actor);
+	};
+
+	bool childrenInline = true;
+	for (auto actor : actors)
+	{
+		if (!isInActor(actor, actor->GetChildren().data()) || !isInActor(actor, actor->GetComponents().data()))
+			childrenInline = false;
+	}
+
+	// Scene update: no containers should be reallocated
+	timer.Reset();
+
+	for (int i = 0; i < iterations; i++)
+	{
+		for (auto root : roots)
+			root->Update(0.0f);
+
+		for (auto root : roots)
+			root->UpdateChildren(0.0f);
+	}
+
+	float updateTime = timer.GetTime();
+
+	for (auto actor : actors)
+	{
+		if (!isInActor(actor, actor->GetChildren().data()) || !isInActor(actor, actor->GetComponents().data()))
+			childrenInline = false;
+	}
+
+	o2Debug.Log("Scene of " + (String)actorsCount + " actors: load " + (String)(loadTime*1000.0f) + "ms, update " +
+				(String)iterations + " iterations " + (String)(updateTime*1000.0f) + "ms");
+
+	if (childrenInline && smallVectorAllocations < vectorAllocations)
+		o2Debug.Log("Small arrays stored inline - OK");
+	else
+		o2Debug.LogError("Small arrays stored inline - FAILED");
+
+	for (auto root : roots)
+		delete root;
+
+	// Reflection: small vectors are reflected and serialized as vectors
+	bool isReflectedAsVector = GetTypeOf<SmallVector<int, 4>>().GetUsage() == Type::Usage::Vector &&
+		TypeOf(Actor).GetField("mChildren")->GetType()->GetUsage() == Type::Usage::Vector &&
+		TypeOf(Actor).GetField("mComponents")->GetType()->GetUsage() == Type::Usage::Vector &&
+		TypeOf(ISceneDrawable).GetField("mChildrenInheritedDepth")->GetType()->GetUsage() == Type::Usage::Vector;
+
+	SmallVector<int, 4> source = { 1, 2, 3, 4, 5, 6 }, loaded;
+
+	DataDocument data;
+	data.Set(source);
+	data.Get(loaded);
+
+	if (isReflectedAsVector && loaded == source)
+		o2Debug.Log("Small vectors reflection - OK");
+	else
+		o2Debug.LogError("Small vectors reflection - FAILED");
+}
@@ -0,0 +1,147 @@
+#include "o2/stdafx.h"
+#include "Culling.h"
+
+#include "o2/Scene/Actor.h"
+#include "o2/Scene/CameraActor.h"
+#include "o2/Scene/Components/ImageComponent.h"
+#include "o2/Scene/ISceneDrawable.h"
+#include "o2/Scene/Scene.h"
+#include "o2/Scene/SceneLayer.h"
+#include "o2/Utils/Debug/Debug.h"
+
+using namespace o2;
+
+// Drawable with optional bounds, counts draws
+class CullingTestDrawable: public ISceneDrawable
+{
+public:
+	SceneLayer* layer = nullptr;   // Layer of drawable
+	RectF       rect;              // World rectangle of drawable
+	bool        hasBounds = true;  // Is drawable returns bounds
+	int         drawsCount = 0;    // Count of draw calls
+
+public:
+	// Counts draw
+	void Draw() override { drawsCount++; }
+
+protected:
+	// Returns test layer
+	SceneLayer* GetSceneDrawableSceneLayer() const override { return layer; }
+
+	// Returns true, drawable is always enabled
+	bool IsSceneDrawableEnabled() const override { return true; }
+
+	// Returns rectangle basis when drawable has bounds
+	bool GetSceneDrawableBoundsBasis(Basis& basis) const override
+	{
+		basis = Basis(rect);
+		return hasBounds;
+	}
+};
+
+// Checks that image component bounds follow owner actor transform
+static bool IsImageBoundsFollowsActor()
+{
+	Actor* actor = mnew Actor(ActorCreateMode::NotInScene);
+	auto image = actor->AddComponent<ImageComponent>();
+
+	actor->transform->size = Vec2F(20, 10);
+	actor->transform->pivot = Vec2F(0.5f, 0.5f);
+	actor->transform->angle = Math::Deg2rad(30.0f);
+
+	bool result = true;
+	RectF bounds;
+	for (auto position : { Vec2F(0, 0), Vec2F(1000, -500) })
+	{
+		actor->transform->position = position;
+		actor->UpdateTransform();
+
+		RectF expected = actor->transform->GetWorldBasis().AABB();
+		result = result && image->GetDrawableWorldBounds(bounds) && bounds == expected;
+	}
+
+	delete actor;
+	return result;
+}
+
+void TestCameraCulling()
+{
+	const int gridSize = 10;
+	const float cellSize = 100.0f;
+	const float drawableSize = 20.0f;
+
+	SceneLayer* layer = o2Scene.AddLayer("Culling test");
+
+	CameraActor* camera = mnew CameraActor();
+	camera->fillBackground = false;
+	camera->drawLayers.SetLayers(Vector<SceneLayer*>({ layer }));
+	camera->SetFixedSize(Vec2F(400, 300));
+
+	RectF cameraRect = camera->GetRenderCamera().GetAxisAlignedRect();
+
+	// Grid of bounded drawables around camera, only part of them are visible
+	Vector<CullingTestDrawable*> drawables;
+	int expectedVisible = 0;
+	for (int i = 0; i < gridSize; i++)
+	{
+		for (int j = 0; j < gridSize; j++)
+		{
+			auto drawable = mnew CullingTestDrawable();
+			drawable->layer = layer;
+
+			Vec2F center(-450.0f + cellSize*i, -450.0f + cellSize*j);
+			drawable->rect = RectF(center - Vec2F(drawableSize, drawableSize)*0.5f,
+								   center + Vec2F(drawableSize, drawableSize)*0.5f);
+
+			drawable->SetDrawingDepthInheritFromParent(false);
+			drawables.Add(drawable);
+
+			if (drawable->rect.IsIntersects(cameraRect))
+				expectedVisible++;
+		}
+	}
+
+	// Drawable without bounds is far from camera, but must be drawn
+	auto unbounded = mnew CullingTestDrawable();
+	unbounded->layer = layer;
+	unbounded->rect = RectF(10000, 10000, 10010, 10010);
+	unbounded->hasBounds = false;
+	unbounded->SetDrawingDepthInheritFromParent(false);
+	drawables.Add(unbounded);
+
+	camera->SetupAndDraw();
+
+	bool countsCorrect = camera->GetCulledDrawablesCount() == gridSize*gridSize - expectedVisible &&
+		camera->GetCulledDrawablesCount() > 0;
+
+	bool drawsCorrect = unbounded->drawsCount == 1;
+	for (int i = 0; i < drawables.Count() - 1; i++)
+		drawsCorrect = drawsCorrect && drawables[i]->drawsCount == (drawables[i]->rect.IsIntersects(cameraRect) ? 1 : 0);
+
+	// Without culling all drawables are drawn
+	camera->cullDrawables = false;
+	camera->SetupAndDraw();
+
+	bool notCulledCorrect = camera->GetCulledDrawablesCount() == 0;
+	for (auto drawable : drawables)
+		notCulledCorrect = notCulledCorrect && drawable->drawsCount == (drawable->rect.IsIntersects(cameraRect) ? 2 : 1);
+
+	bool imageBoundsCorrect = IsImageBoundsFollowsActor();
+
+	o2Debug.Log("Camera culling: drawn " + (String)(expectedVisible + 1) + " of " + (String)drawables.Count() +
+				" drawables, culled " + (String)(gridSize*gridSize - expectedVisible));
+
+	if (countsCorrect && drawsCorrect && notCulledCorrect && imageBoundsCorrect)
+		o2Debug.Log("Camera culling - OK");
+	else
+		o2Debug.LogError("Camera culling - FAILED");
+
+	for (auto drawable : drawables)
+	{
+		drawable->SetDrawingDepthInheritFromParent(true);
+		delete drawable;
+	}
+
+	delete camera;
+	o2Scene.RemoveLayer(layer);
+}
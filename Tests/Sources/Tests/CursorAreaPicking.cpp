@@ -0,0 +1,148 @@
+#include "o2/stdafx.h"
+#include "CursorAreaPicking.h"
+
+#include "o2/Events/CursorAreaEventsListenersLayer.h"
+#include "o2/Render/Render.h"
+#include "o2/Utils/Debug/Debug.h"
+
+using namespace o2;
+
+// Test cursor listener. Rectangle or circle shaped, rectangle listeners return their bounds, circle listeners are
+// unbounded
+class PickingTestListener: public CursorAreaEventsListener
+{
+public:
+	RectF rect;                 // Listener shape rectangle, circle is inscribed into it
+	bool  isCircle = false;     // Is listener circle shaped and unbounded
+	bool  transparent = false;  // Is listener transparent to input
+
+public:
+	// Sets scissor rect, as it would be set by drawing
+	void SetScissorRect(const RectF& scissorRect)
+	{
+		mScissorRect = scissorRect;
+	}
+
+	// Returns true when listener is picked by point in linear scan
+	bool IsPicked(const Vec2F& point)
+	{
+		return IsUnderPoint(point) && mScissorRect.IsInside(point) && IsInteractable();
+	}
+
+	// Returns true if point is in this object
+	bool IsUnderPoint(const Vec2F& point) override
+	{
+		if (!isCircle)
+			return rect.IsInside(point);
+
+		return (point - rect.Center()).Length() < rect.Width()*0.5f;
+	}
+
+	// Returns rectangle, that contains all points under this object
+	RectF GetCursorAreaBounds() const override
+	{
+		if (isCircle)
+			return CursorAreaEventsListener::GetCursorAreaBounds();
+
+		return rect;
+	}
+
+	// Returns true when input events can be handled by down listeners
+	bool IsInputTransparent() const override
+	{
+		return transparent;
+	}
+};
+
+// Returns random point inside rectangle
+static Vec2F RandomPoint(const RectF& area)
+{
+	return Vec2F(Math::Random(area.left, area.right), Math::Random(area.bottom, area.top));
+}
+
+// Checks that grid picking returns same listeners in same order as linear scan, inside and outside screen. Checks
+// also that input transparent listeners covering other listeners and unbounded listeners are picked, order of them
+// defines which listeners receive events
+static bool IsPickingSameAsLinearScan()
+{
+	const int listenersCount = 500;
+	const int pointsCount = 2000;
+
+	Vec2F halfResolution = (Vec2F)o2Render.GetResolution()*0.5f;
+	RectF screen(-halfResolution.x, halfResolution.y, halfResolution.x, -halfResolution.y);
+	RectF area(screen.left*1.5f, screen.top*1.5f, screen.right*1.5f, screen.bottom*1.5f);
+	RectF unbounded = CursorAreaEventsListener().GetCursorAreaBounds();
+
+	CursorAreaEventListenersLayer layer;
+	Vector<PickingTestListener*> listeners;
+
+	for (int i = 0; i < listenersCount; i++)
+	{
+		auto listener = mnew PickingTestListener();
+
+		Vec2F leftBottom = RandomPoint(area);
+		float maxSize = Math::Random(0, 10) == 0 ? area.Width() : area.Width()*0.05f;
+		float size = Math::Random(1.0f, maxSize);
+		listener->rect = RectF(leftBottom, leftBottom + Vec2F(size, size));
+
+		listener->isCircle = Math::Random(0, 5) == 0;
+		listener->transparent = Math::Random(0, 3) == 0;
+		listener->interactable = Math::Random(0, 10) != 0;
+
+		// Unbounded listeners are clipped by random scissor rectangle or not clipped at all
+		if (Math::Random(0, 3) == 0)
+		{
+			Vec2F scissorLeftBottom = RandomPoint(area);
+			listener->SetScissorRect(RectF(scissorLeftBottom, scissorLeftBottom + area.Size()*0.3f));
+		}
+		else
+			listener->SetScissorRect(unbounded);
+
+		listeners.Add(listener);
+		layer.cursorEventAreaListeners.Add(listener);
+	}
+
+	bool result = true;
+	int transparentCoveringCount = 0, unboundedPickedCount = 0;
+	for (int i = 0; i < pointsCount && result; i++)
+	{
+		Vec2F point = RandomPoint(i%4 == 0 ? area : screen);
+
+		Vector<CursorAreaEventsListener*> expected;
+		for (auto listener : listeners)
+		{
+			if (listener->IsPicked(point))
+				expected.Add(listener);
+		}
+
+		Vector<CursorAreaEventsListener*> picked = layer.GetAllCursorListenersUnderCursor(point);
+
+		result = picked == expected;
+
+		for (int j = 0; j < picked.Count(); j++)
+		{
+			auto listener = (PickingTestListener*)picked[j];
+
+			if (listener->transparent && j < picked.Count() - 1)
+				transparentCoveringCount++;
+
+			if (listener->isCircle)
+				unboundedPickedCount++;
+		}
+	}
+
+	result = result && transparentCoveringCount > 0 && unboundedPickedCount > 0;
+
+	for (auto listener : listeners)
+		delete listener;
+
+	return result;
+}
+
+void TestCursorAreaPicking()
+{
+	if (IsPickingSameAsLinearScan())
+		o2Debug.Log("Cursor area picking - OK");
+	else
+		o2Debug.LogError("Cursor area picking - FAILED");
+}
@@ -0,0 +1,159 @@
+#include "o2/stdafx.h"
+#include "DataMembers.h"
+
+#include "o2/Utils/Debug/Debug.h"
+#include "o2/Utils/Serialization/DataValue.h"
+
+using namespace o2;
+
+// Returns name of test member by index
+static String GetTestMemberName(int idx)
+{
+	return "member" + (String)idx;
+}
+
+// Returns true when members from list are found by name and by name with hash, and have values equal to their indices
+static bool IsMembersFound(const DataValue& data, const Vector<int>& members)
+{
+	for (auto idx : members)
+	{
+		String name = GetTestMemberName(idx);
+
+		auto member = data.FindMember(name.Data());
+		if (!member || member != data.FindMember(name.Data(), DataValue::GetNameHash(name.Data())))
+			return false;
+
+		int value = -1;
+		member->Get(value);
+		if (value != idx)
+			return false;
+	}
+
+	return true;
+}
+
+// Returns true when members from list aren't found
+static bool IsMembersMissing(const DataValue& data, const Vector<int>& members)
+{
+	for (auto idx : members)
+	{
+		String name = GetTestMemberName(idx);
+		if (data.FindMember(name.Data()) || data.FindMember(name.Data(), DataValue::GetNameHash(name.Data())))
+			return false;
+	}
+
+	return true;
+}
+
+// Checks members lookup while object is reallocated: index is rebuilt for each new capacity
+static bool IsIndexRebuiltOnReallocation()
+{
+	DataDocument data;
+	data.SetObject();
+
+	Vector<int> added;
+	for (int i = 0; i < 300; i++)
+	{
+		data.AddMember(GetTestMemberName(i).Data()) = i;
+		added.Add(i);
+
+		// Checking all members on each capacity change is enough, others are checked at the end
+		if ((i & (i + 1)) == 0 && !IsMembersFound(data, added))
+			return false;
+	}
+
+	return IsMembersFound(data, added) && IsMembersMissing(data, { 300, 301, 1000 });
+}
+
+// Checks members lookup after removing: removed slots are filled with backward shift, and last member is moved
+// to the place of removed one
+static bool IsIndexValidAfterRemoving()
+{
+	DataDocument data;
+	data.SetObject();
+
+	Vector<int> kept, removed;
+	for (int i = 0; i < 200; i++)
+		data.AddMember(GetTestMemberName(i).Data()) = i;
+
+	for (int i = 0; i < 200; i++)
+	{
+		if (i%3 == 0)
+		{
+			data.RemoveMember(GetTestMemberName(i).Data());
+			removed.Add(i);
+		}
+		else
+			kept.Add(i);
+	}
+
+	if (!IsMembersFound(data, kept) || !IsMembersMissing(data, removed))
+		return false;
+
+	// Removing by iterator, from the first member while members are left
+	while (data.GetMembersCount() > 10)
+	{
+		auto it = data.BeginMember();
+
+		int value = -1;
+		it->value.Get(value);
+		kept.Remove(value);
+		removed.Add(value);
+
+		data.RemoveMember(it);
+	}
+
+	if (!IsMembersFound(data, kept) || !IsMembersMissing(data, removed))
+		return false;
+
+	// Removed members can be added again
+	for (auto idx : removed)
+		data.AddMember(GetTestMemberName(idx).Data()) = idx;
+
+	return IsMembersFound(data, kept) && IsMembersFound(data, removed);
+}
+
+// Checks members lookup after clearing object: old members aren't found, new members are found
+static bool IsIndexValidAfterClear()
+{
+	DataDocument data;
+	data.SetObject();
+
+	Vector<int> before, after;
+	for (int i = 0; i < 100; i++)
+	{
+		data.AddMember(GetTestMemberName(i).Data()) = i;
+		before.Add(i);
+	}
+
+	data.Clear();
+
+	if (data.GetMembersCount() != 0 || !IsMembersMissing(data, before))
+		return false;
+
+	for (int i = 100; i < 150; i++)
+	{
+		data.AddMember(GetTestMemberName(i).Data()) = i;
+		after.Add(i);
+	}
+
+	return IsMembersFound(data, after) && IsMembersMissing(data, before);
+}
+
+void TestDataMembersIndex()
+{
+	if (IsIndexRebuiltOnReallocation())
+		o2Debug.Log("Data members index rebuilt on reallocation - OK");
+	else
+		o2Debug.LogError("Data members index rebuilt on reallocation - FAILED");
+
+	if (IsIndexValidAfterRemoving())
+		o2Debug.Log("Data members index after removing - OK");
+	else
+		o2Debug.LogError("Data members index after removing - FAILED");
+
+	if (IsIndexValidAfterClear())
+		o2Debug.Log("Data members index after clear - OK");
+	else
+		o2Debug.LogError("Data members index after clear - FAILED");
+}
@@ -0,0 +1,118 @@
+#include "o2/stdafx.h"
+#include "DrawCommands.h"
+
+#include "o2/Render/DrawCommandBuffer.h"
+#include "o2/Render/Texture.h"
+#include "o2/Utils/Debug/Debug.h"
+
+using namespace o2;
+
+// Backend, that stores order of received commands
+class DrawOrderBackend: public IDrawCommandsBackend
+{
+public:
+	Vector<const DrawCommand*> commands; // Received commands in drawing order
+
+public:
+	// Stores command
+	void Draw(const DrawCommand& command, const Vertex* vertices, const UInt16* indexes) override { commands.Add(&command); }
+
+	// Does nothing
+	void Flush() override {}
+};
+
+// Records quad with texture into buffer
+static void AddQuad(DrawCommandBuffer& buffer, const RectF& rect, Texture* texture)
+{
+	static const UInt16 indexes[] = { 0, 1, 2, 0, 2, 3 };
+
+	Vertex vertices[4];
+	vertices[0].Set(rect.left, rect.top, 0xffffffff, 0.0f, 0.0f);
+	vertices[1].Set(rect.right, rect.top, 0xffffffff, 1.0f, 0.0f);
+	vertices[2].Set(rect.right, rect.bottom, 0xffffffff, 1.0f, 1.0f);
+	vertices[3].Set(rect.left, rect.bottom, 0xffffffff, 0.0f, 1.0f);
+
+	buffer.Add(PrimitiveType::Polygon, vertices, 4, indexes, 2, texture, false, RectI());
+}
+
+// Returns true when all overlapping commands are drawn in recording order
+static bool IsOverlappingOrderKept(DrawCommandBuffer& buffer)
+{
+	DrawOrderBackend backend;
+	buffer.Submit(backend);
+
+	// Commands are stored in recording order, so recording index is offset from first command
+	const DrawCommand* recorded = buffer.GetCommands().data();
+	for (int i = 0; i < backend.commands.Count(); i++)
+	{
+		for (int j = i + 1; j < backend.commands.Count(); j++)
+		{
+			auto first = backend.commands[i], second = backend.commands[j];
+			if (first->bounds.IsIntersects(second->bounds) && first - recorded > second - recorded)
+				return false;
+		}
+	}
+
+	return true;
+}
+
+// Submits buffer with and without reordering, returns flushes counts
+static void CountFlushes(DrawCommandBuffer& buffer, int& unsortedFlushes, int& sortedFlushes)
+{
+	DrawCommandsCounterBackend backend;
+
+	buffer.Submit(backend, false);
+	unsortedFlushes = backend.flushesCount;
+
+	backend.Reset();
+	buffer.Submit(backend, true);
+	sortedFlushes = backend.flushesCount;
+}
+
+void TestDrawCommandBuffer()
+{
+	const int itemsCount = 200;
+
+	Texture* backgroundsAtlas = mnew Texture();
+	Texture* iconsAtlas = mnew Texture();
+	Texture* fontTexture = mnew Texture();
+
+	// List of items, like in UI: each item is background, icon and caption with different textures. Items don't
+	// overlap, so all backgrounds, icons and captions can be drawn by three draw calls
+	DrawCommandBuffer listBuffer;
+	for (int i = 0; i < itemsCount; i++)
+	{
+		RectF itemRect(0.0f, i*20.0f + 18.0f, 200.0f, i*20.0f);
+		AddQuad(listBuffer, itemRect, backgroundsAtlas);
+		AddQuad(listBuffer, RectF(2.0f, itemRect.top - 2.0f, 16.0f, itemRect.bottom + 2.0f), iconsAtlas);
+		AddQuad(listBuffer, RectF(20.0f, itemRect.top - 2.0f, 190.0f, itemRect.bottom + 2.0f), fontTexture);
+	}
+
+	int listUnsortedFlushes, listSortedFlushes;
+	CountFlushes(listBuffer, listUnsortedFlushes, listSortedFlushes);
+
+	o2Debug.Log("List of " + (String)itemsCount + " items: " + (String)listUnsortedFlushes + " draw calls in drawing order, " +
+				(String)listSortedFlushes + " draw calls with merging");
+
+	if (listUnsortedFlushes == itemsCount*3 && listSortedFlushes == 3 && IsOverlappingOrderKept(listBuffer))
+		o2Debug.Log("Draw commands merging - OK");
+	else
+		o2Debug.LogError("Draw commands merging - FAILED");
+
+	// Stack of overlapping quads with alternating textures: nothing can be merged without changing the image
+	DrawCommandBuffer stackBuffer;
+	for (int i = 0; i < itemsCount; i++)
+		AddQuad(stackBuffer, RectF(i*1.0f, 100.0f, i*1.0f + 100.0f, 0.0f), i%2 == 0 ? backgroundsAtlas : iconsAtlas);
+
+	int stackUnsortedFlushes, stackSortedFlushes;
+	CountFlushes(stackBuffer, stackUnsortedFlushes, stackSortedFlushes);
+
+	if (stackUnsortedFlushes == itemsCount && stackSortedFlushes == itemsCount && IsOverlappingOrderKept(stackBuffer))
+		o2Debug.Log("Draw commands overlapping order - OK");
+	else
+		o2Debug.LogError("Draw commands overlapping order - FAILED");
+
+	delete backgroundsAtlas;
+	delete iconsAtlas;
+	delete fontTexture;
+}
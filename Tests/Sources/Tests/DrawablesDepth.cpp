@@ -0,0 +1,146 @@
+#include "o2/stdafx.h"
+#include "DrawablesDepth.h"
+
+#include "o2/Scene/ISceneDrawable.h"
+#include "o2/Scene/SceneLayer.h"
+#include "o2/Utils/Debug/Debug.h"
+#include "o2/Utils/System/Time/Timer.h"
+
+using namespace o2;
+
+// Drawable, registered in test layer
+class DepthTestDrawable: public ISceneDrawable
+{
+public:
+	SceneLayer* layer = nullptr; // Layer of drawable
+	UInt64      changeIndex = 0; // Index of last depth change, used for reference order
+
+public:
+	// Returns test layer
+	SceneLayer* GetSceneDrawableSceneLayer() const override { return layer; }
+
+	// Returns true, drawable is always enabled
+	bool IsSceneDrawableEnabled() const override { return true; }
+};
+
+// Reference of previous implementation: each change removes drawable and inserts it into sorted array
+static void ReinsertByDepth(Vector<DepthTestDrawable*>& drawables, DepthTestDrawable* drawable)
+{
+	drawables.Remove(drawable);
+
+	int rangeMin = 0, rangeMax = drawables.Count();
+	while (rangeMin < rangeMax)
+	{
+		int center = (rangeMin + rangeMax) >> 1;
+		if (drawables[center]->GetDrawingDepth() <= drawable->GetDrawingDepth())
+			rangeMin = center + 1;
+		else
+			rangeMax = center;
+	}
+
+	drawables.Insert(drawable, rangeMin);
+}
+
+void TestDrawablesDepthSorting()
+{
+	const int drawablesCount = 20000;
+	const int framesCount = 30;
+	const int depthLevels = 50;
+
+	SceneLayer layer;
+	Vector<DepthTestDrawable*> drawables;
+	Vector<DepthTestDrawable*> referenceDrawables;
+	UInt64 changeIndex = 0;
+	bool orderCorrect = true;
+
+	for (int i = 0; i < drawablesCount; i++)
+	{
+		auto drawable = mnew DepthTestDrawable();
+		drawable->layer = &layer;
+		drawable->changeIndex = ++changeIndex;
+		drawable->SetDrawingDepth((float)Math::Random(0, depthLevels));
+		drawable->SetDrawingDepthInheritFromParent(false);
+
+		drawables.Add(drawable);
+	}
+
+	layer.UpdateDrawablesOrder();
+
+	referenceDrawables = drawables;
+	referenceDrawables.Sort([](DepthTestDrawable* const& a, DepthTestDrawable* const& b) {
+		return a->GetDrawingDepth() < b->GetDrawingDepth() ||
+			(a->GetDrawingDepth() == b->GetDrawingDepth() && a->changeIndex < b->changeIndex); });
+
+	// Changes depth of part of drawables each frame, like animations do. Returns total time of changes
+	// and order updates, reference time is time of previous implementation
+	auto churn = [&](float changedPart, float& referenceTime)
+	{
+		Timer timer;
+		float time = 0;
+		referenceTime = 0;
+
+		for (int frame = 0; frame < framesCount; frame++)
+		{
+			Vector<std::pair<DepthTestDrawable*, float>> changes;
+			for (int i = 0; i < (int)(drawablesCount*changedPart); i++)
+				changes.Add({ drawables[Math::Random(0, drawablesCount - 1)], (float)Math::Random(0, depthLevels) });
+
+			timer.Reset();
+
+			for (auto& change : changes)
+				change.first->SetDrawingDepth(change.second);
+
+			layer.UpdateDrawablesOrder();
+
+			time += timer.GetTime();
+
+			for (auto& change : changes)
+				change.first->changeIndex = ++changeIndex;
+
+			timer.Reset();
+
+			for (auto& change : changes)
+				ReinsertByDepth(referenceDrawables, change.first);
+
+			referenceTime += timer.GetTime();
+
+			// Previous implementation isn't stable, so order is checked by depth and last change
+			auto& enabledDrawables = layer.GetEnabledDrawables();
+			for (int i = 1; i < enabledDrawables.Count() && orderCorrect; i++)
+			{
+				auto prev = dynamic_cast<DepthTestDrawable*>(enabledDrawables[i - 1]);
+				auto current = dynamic_cast<DepthTestDrawable*>(enabledDrawables[i]);
+				if (!prev || !current)
+					continue;
+
+				orderCorrect = prev->GetDrawingDepth() < current->GetDrawingDepth() ||
+					(prev->GetDrawingDepth() == current->GetDrawingDepth() && prev->changeIndex < current->changeIndex);
+			}
+		}
+
+		return time;
+	};
+
+	for (float changedPart : { 0.01f, 0.1f, 0.5f })
+	{
+		float referenceTime = 0;
+		float batchedTime = churn(changedPart, referenceTime);
+
+		o2Debug.Log("Depth churn of " + (String)drawablesCount + " drawables, " + (String)(int)(changedPart*100.0f) +
+					"% changed per frame, " + (String)framesCount + " frames: batched " + (String)(batchedTime*1000.0f) +
+					"ms, insert per change " + (String)(referenceTime*1000.0f) + "ms");
+	}
+
+	// All test drawables and layer root drawables container must be in list
+	bool allInLayer = layer.GetEnabledDrawables().Count() == drawablesCount + 1;
+	if (allInLayer && orderCorrect)
+		o2Debug.Log("Drawables depth sorting - OK");
+	else
+		o2Debug.LogError("Drawables depth sorting - FAILED");
+
+	for (auto drawable : drawables)
+	{
+		drawable->SetDrawingDepthInheritFromParent(true);
+		delete drawable;
+	}
+}
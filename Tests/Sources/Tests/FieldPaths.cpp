@@ -0,0 +1,159 @@
+#include "o2/stdafx.h"
+#include "FieldPaths.h"
+
+#include "o2/Scene/Actor.h"
+#include "o2/Scene/Components/ImageComponent.h"
+#include "o2/Scene/UI/Widget.h"
+#include "o2/Utils/Debug/Debug.h"
+#include "o2/Utils/Reflection/Reflection.h"
+#include "o2/Utils/Tasks/JobSystem.h"
+#include <atomic>
+
+using namespace o2;
+
+// Returns true when field pointer and field info by compiled path are same as expected
+static bool IsPathResolved(const Type& type, void* object, const String& path, void* expected, const FieldInfo* expectedInfo)
+{
+	const FieldInfo* fieldInfo = nullptr;
+	void* ptr = type.GetFieldPtr(object, path, fieldInfo);
+
+	if (!expected)
+		return ptr == nullptr;
+
+	return ptr == expected && fieldInfo == expectedInfo;
+}
+
+// Returns true when compiled path for type gives same result as fields walk of Type::GetFieldPtr for the same object
+static bool IsPathSameAsFieldsWalk(const Type& type, void* object, const String& path)
+{
+	const FieldInfo* expectedInfo = nullptr;
+	void* expected = type.Type::GetFieldPtr(object, path, expectedInfo);
+
+	return expected && IsPathResolved(type, object, path, expected, expectedInfo);
+}
+
+// Checks paths of object, which type doesn't have derived types in primary bases tree, but object's real type is
+// derived from it by secondary base: image component is scene drawable
+static bool IsRealTypeCheckedForSecondaryBase()
+{
+	ImageComponent* image = mnew ImageComponent();
+	ISceneDrawable* drawable = image;
+
+	const FieldInfo* expectedInfo = nullptr;
+	void* expected = TypeOf(ImageComponent).Type::GetFieldPtr(image, "mEnabled", expectedInfo);
+
+	bool res = expected &&
+		IsPathResolved(TypeOf(ISceneDrawable), drawable, "mEnabled", expected, expectedInfo) &&
+		IsPathResolved(TypeOf(ISceneDrawable), drawable, "mEnabled", expected, expectedInfo) &&
+		IsPathSameAsFieldsWalk(TypeOf(ISceneDrawable), drawable, "mDrawingDepth");
+
+	delete image;
+	return res;
+}
+
+// Checks actor fields paths: own fields, vector elements by index, vector count and invalid paths. Paths are
+// resolved twice to check cached paths
+static bool IsActorPathsResolved()
+{
+	Actor* actor = mnew Actor(ActorCreateMode::NotInScene);
+	for (int i = 0; i < 3; i++)
+		actor->AddChild(mnew Actor(ActorCreateMode::NotInScene))->SetName("child" + (String)i);
+
+	bool res = true;
+	for (int i = 0; i < 2; i++)
+	{
+		res = res && IsPathSameAsFieldsWalk(TypeOf(Actor), actor, "mName") &&
+			IsPathSameAsFieldsWalk(TypeOf(Actor), actor, "mLayerName") &&
+			IsPathSameAsFieldsWalk(TypeOf(Actor), actor, "mChildren/count");
+
+		for (int j = 0; j < actor->GetChildren().Count(); j++)
+		{
+			Actor* child = actor->GetChildren()[j];
+
+			const FieldInfo* expectedInfo = nullptr;
+			void* expected = TypeOf(Actor).Type::GetFieldPtr(child, "mName", expectedInfo);
+
+			res = res && IsPathResolved(TypeOf(Actor), actor, "mChildren/" + (String)j + "/mName", expected, expectedInfo);
+		}
+
+		res = res && IsPathResolved(TypeOf(Actor), actor, "mChildren/10/mName", nullptr, nullptr) &&
+			IsPathResolved(TypeOf(Actor), actor, "unknownField", nullptr, nullptr) &&
+			IsPathResolved(TypeOf(Actor), actor, "mName/unknownField", nullptr, nullptr);
+
+		// Elements indices are resolved by current vector
+		actor->RemoveChild(actor->GetChildren()[0]);
+	}
+
+	delete actor;
+	return res;
+}
+
+// Checks cached path, which real type step resolves nested path of the same type: widget parent pointer is actor
+// pointer, but parent real type is widget
+static bool IsSameTypeNestedPathResolved()
+{
+	Widget* parent = mnew Widget(ActorCreateMode::NotInScene);
+	Widget* child = mnew Widget(ActorCreateMode::NotInScene);
+	parent->AddChild(child);
+
+	const FieldInfo* expectedInfo = nullptr;
+	void* expected = TypeOf(Widget).Type::GetFieldPtr(parent, "mName", expectedInfo);
+
+	bool res = expected &&
+		IsPathResolved(TypeOf(Widget), child, "mParent/mName", expected, expectedInfo) &&
+		IsPathResolved(TypeOf(Widget), child, "mParent/mName", expected, expectedInfo);
+
+	delete parent;
+	return res;
+}
+
+// Checks that compiled paths are resolved and cached from several threads at once
+static bool IsPathsResolvedInParallel()
+{
+	Actor* actor = mnew Actor(ActorCreateMode::NotInScene);
+	actor->AddChild(mnew Actor(ActorCreateMode::NotInScene));
+
+	const FieldInfo* nameInfo = nullptr, *childNameInfo = nullptr;
+	void* name = TypeOf(Actor).Type::GetFieldPtr(actor, "mName", nameInfo);
+	void* childName = TypeOf(Actor).Type::GetFieldPtr(actor->GetChildren()[0], "mName", childNameInfo);
+
+	std::atomic<int> failed(0);
+	o2Jobs.ParallelFor(1000, 10, [&](int begin, int end)
+	{
+		for (int i = begin; i < end; i++)
+		{
+			if (!IsPathResolved(TypeOf(Actor), actor, "mName", name, nameInfo) ||
+				!IsPathResolved(TypeOf(Actor), actor, "mChildren/0/mName", childName, childNameInfo) ||
+				!IsPathResolved(TypeOf(Actor), actor, "unknownField" + (String)(i%10), nullptr, nullptr))
+			{
+				failed++;
+			}
+		}
+	});
+
+	delete actor;
+	return failed == 0;
+}
+
+void TestFieldPaths()
+{
+	if (IsRealTypeCheckedForSecondaryBase())
+		o2Debug.Log("Field path real type for secondary base - OK");
+	else
+		o2Debug.LogError("Field path real type for secondary base - FAILED");
+
+	if (IsActorPathsResolved())
+		o2Debug.Log("Field paths same as fields walk - OK");
+	else
+		o2Debug.LogError("Field paths same as fields walk - FAILED");
+
+	if (IsSameTypeNestedPathResolved())
+		o2Debug.Log("Field paths nested in same type - OK");
+	else
+		o2Debug.LogError("Field paths nested in same type - FAILED");
+
+	if (IsPathsResolvedInParallel())
+		o2Debug.Log("Field paths resolving in parallel - OK");
+	else
+		o2Debug.LogError("Field paths resolving in parallel - FAILED");
+}
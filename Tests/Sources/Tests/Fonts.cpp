@@ -0,0 +1,167 @@
+#include "o2/stdafx.h"
+#include "Fonts.h"
+
+#include "o2/Assets/Assets.h"
+#include "o2/Render/VectorFont.h"
+#include "o2/Render/VectorFontEffects.h"
+#include "o2/Utils/Bitmap/Bitmap.h"
+#include "o2/Utils/Debug/Debug.h"
+#include "o2/Utils/System/Time/Timer.h"
+
+using namespace o2;
+
+static WString GetTestCharacters()
+{
+	WString res;
+	for (wchar_t c = 33; c < 127; c++)
+		res += c;
+
+	return res;
+}
+
+// Renders characters of all heights, returns time in seconds
+static float RenderHeights(VectorFont& font, const WString& characters, const Vector<int>& heights)
+{
+	Timer timer;
+	for (auto height : heights)
+		font.CheckCharacters(characters, height);
+
+	return timer.GetTime();
+}
+
+static void TestVectorFontDistanceFieldMetrics(VectorFont& rasterFont, VectorFont& distanceFieldFont,
+											   const WString& characters, const Vector<int>& heights)
+{
+	// Hinting changes advances of small rasterized glyphs, so they are compared with one pixel tolerance
+	bool equal = true;
+	for (auto height : heights)
+	{
+		for (int i = 0; i < characters.Length(); i++)
+		{
+			float rasterAdvance = rasterFont.GetCharacter(characters[i], height).mAdvance;
+			float distanceFieldAdvance = distanceFieldFont.GetCharacter(characters[i], height).mAdvance;
+
+			if (Math::Abs(rasterAdvance - distanceFieldAdvance) > 1.0f)
+				equal = false;
+		}
+	}
+
+	if (equal)
+		o2Debug.Log("Distance field glyphs metrics equal to rasterized - OK");
+	else
+		o2Debug.LogError("Distance field glyphs metrics equal to rasterized - FAILED");
+}
+
+// Vector font with access to packed characters coverage in atlas
+class CoverageTestVectorFont: public VectorFont
+{
+public:
+	using VectorFont::VectorFont;
+
+	// Returns characters coverage areas in pixels and coverage centers relative to characters origins
+	void GetCoverage(const WString& characters, int height, Vector<float>& areas, Vector<Vec2F>& centers)
+	{
+		Bitmap* atlas = mTexture->GetData();
+		Vec2I atlasSize = atlas->GetSize();
+		UInt8* atlasData = atlas->GetData();
+
+		for (int i = 0; i < characters.Length(); i++)
+		{
+			const Character& character = GetCharacter(characters[i], height);
+			RectI rect(Math::RoundToInt(character.mTexSrc.left*atlasSize.x),
+					   Math::RoundToInt((1.0f - character.mTexSrc.top)*atlasSize.y),
+					   Math::RoundToInt(character.mTexSrc.right*atlasSize.x),
+					   Math::RoundToInt((1.0f - character.mTexSrc.bottom)*atlasSize.y));
+
+			float area = 0;
+			Vec2F center;
+			for (int y = rect.bottom; y < rect.top; y++)
+			{
+				for (int x = rect.left; x < rect.right; x++)
+				{
+					float alpha = atlasData[(y*atlasSize.x + x)*4 + 3]/255.0f;
+					area += alpha;
+					center += Vec2F(x - rect.left + 0.5f, y - rect.bottom + 0.5f)*alpha;
+				}
+			}
+
+			areas.Add(area);
+			centers.Add(area > 0 ? center/area - character.mOrigin : Vec2F());
+		}
+
+		delete atlas;
+	}
+};
+
+static void TestVectorFontDistanceFieldCoverage(const String& fontPath, const WString& characters)
+{
+	// Glyphs without effects are compared, area tolerance covers antialiasing and hinting differences
+	Vector<int> heights = { 16, 32, 48 };
+
+	CoverageTestVectorFont rasterFont(fontPath);
+	CoverageTestVectorFont distanceFieldFont(fontPath);
+	distanceFieldFont.SetDistanceFieldMode(true);
+
+	RenderHeights(rasterFont, characters, heights);
+	RenderHeights(distanceFieldFont, characters, heights);
+
+	bool equal = true;
+	for (auto height : heights)
+	{
+		Vector<float> rasterAreas, distanceFieldAreas;
+		Vector<Vec2F> rasterCenters, distanceFieldCenters;
+		rasterFont.GetCoverage(characters, height, rasterAreas, rasterCenters);
+		distanceFieldFont.GetCoverage(characters, height, distanceFieldAreas, distanceFieldCenters);
+
+		for (int i = 0; i < characters.Length(); i++)
+		{
+			if (distanceFieldAreas[i] < 1.0f ||
+				Math::Abs(rasterAreas[i] - distanceFieldAreas[i]) > rasterAreas[i]*0.15f + 3.0f ||
+				(rasterCenters[i] - distanceFieldCenters[i]).Length() > 1.0f)
+			{
+				equal = false;
+			}
+		}
+	}
+
+	if (equal)
+		o2Debug.Log("Distance field glyphs coverage equal to rasterized - OK");
+	else
+		o2Debug.LogError("Distance field glyphs coverage equal to rasterized - FAILED");
+}
+
+void TestVectorFontDistanceField()
+{
+	String fontPath = o2Assets.GetBuiltAssetsPath() + "debugFont.ttf";
+	WString characters = GetTestCharacters();
+	Vector<int> heights = { 10, 11, 12, 14, 16, 18, 20, 24, 28, 32, 40, 48 };
+
+	VectorFont rasterFont(fontPath);
+	rasterFont.AddEffect<FontStrokeEffect>(1.0f);
+	rasterFont.AddEffect<FontShadowEffect>();
+
+	VectorFont distanceFieldFont(fontPath);
+	distanceFieldFont.SetDistanceFieldMode(true);
+	distanceFieldFont.AddEffect<FontStrokeEffect>(1.0f);
+	distanceFieldFont.AddEffect<FontShadowEffect>();
+
+	float rasterTime = RenderHeights(rasterFont, characters, heights);
+	float distanceFieldTime = RenderHeights(distanceFieldFont, characters, heights);
+
+	TestVectorFontDistanceFieldMetrics(rasterFont, distanceFieldFont, characters, heights);
+	TestVectorFontDistanceFieldCoverage(fontPath, characters);
+
+	// New height is built from cached distance fields without rasterization
+	Vector<int> newHeights = { 13, 15, 17, 22 };
+	float rasterNewHeightsTime = RenderHeights(rasterFont, characters, newHeights);
+	float distanceFieldNewHeightsTime = RenderHeights(distanceFieldFont, characters, newHeights);
+
+	o2Debug.Log("Glyphs of " + (String)heights.Count() + " heights: rasterized " + (String)(rasterTime*1000.0f) +
+				"ms, distance field " + (String)(distanceFieldTime*1000.0f) + "ms; new heights: rasterized " +
+				(String)(rasterNewHeightsTime*1000.0f) + "ms, distance field " +
+				(String)(distanceFieldNewHeightsTime*1000.0f) + "ms");
+
+	o2Debug.Log("Glyphs memory: rasterized atlas " + (String)(rasterFont.GetUsedAtlasMemorySize()/1024) +
+				"kb, distance field atlas " + (String)(distanceFieldFont.GetUsedAtlasMemorySize()/1024) +
+				"kb + distance fields " + (String)(distanceFieldFont.GetDistanceFieldsMemorySize()/1024) + "kb");
+}
@@ -0,0 +1,144 @@
+#include "o2/stdafx.h"
+#include "Jobs.h"
+
+#include "o2/Utils/Debug/Debug.h"
+#include "o2/Utils/Tasks/JobSystem.h"
+#include <atomic>
+
+using namespace o2;
+
+// Checks that parallel for calls each index exactly once
+static bool IsParallelForCorrect()
+{
+	const int count = 10000;
+
+	// Each index is written only by its batch, so plain counters are enough
+	Vector<int> calls;
+	calls.Resize(count);
+	for (auto& x : calls)
+		x = 0;
+
+	o2Jobs.ParallelFor(count, 7, [&](int begin, int end)
+	{
+		for (int i = begin; i < end; i++)
+			calls[i]++;
+	});
+
+	for (auto x : calls)
+	{
+		if (x != 1)
+			return false;
+	}
+
+	// Empty range is done immediately
+	bool emptyCalled = false;
+	o2Jobs.ParallelFor(0, 10, [&](int begin, int end) { emptyCalled = true; });
+
+	return !emptyCalled;
+}
+
+// Checks that jobs are executed after all their dependencies
+static bool IsDependenciesOrderCorrect()
+{
+	const int layersCount = 20;
+	const int layerJobsCount = 16;
+
+	std::atomic<int> order(0);
+	Vector<Vector<int>> startOrder, finishOrder;
+	for (int layer = 0; layer < layersCount; layer++)
+	{
+		startOrder.Add(Vector<int>());
+		startOrder.Last().Resize(layerJobsCount);
+		finishOrder.Add(startOrder.Last());
+	}
+
+	// Each layer jobs depend on all jobs of previous layer
+	Vector<JobHandle> previousLayer;
+	for (int layer = 0; layer < layersCount; layer++)
+	{
+		Vector<JobHandle> currentLayer;
+		for (int i = 0; i < layerJobsCount; i++)
+		{
+			currentLayer.Add(o2Jobs.Schedule([&, layer, i]()
+			{
+				startOrder[layer][i] = order++;
+				finishOrder[layer][i] = order++;
+			}, previousLayer));
+		}
+
+		previousLayer = currentLayer;
+	}
+
+	o2Jobs.WaitAll(previousLayer);
+
+	for (int layer = 1; layer < layersCount; layer++)
+	{
+		for (int i = 0; i < layerJobsCount; i++)
+		{
+			for (int j = 0; j < layerJobsCount; j++)
+			{
+				if (startOrder[layer][i] < finishOrder[layer - 1][j])
+					return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+// Checks that job can wait other jobs, executing them on worker thread
+static bool IsNestedWaitCorrect()
+{
+	const int outerCount = 32;
+	const int innerCount = 1000;
+
+	std::atomic<int> sum(0);
+	o2Jobs.ParallelFor(outerCount, 1, [&](int begin, int end)
+	{
+		for (int i = begin; i < end; i++)
+		{
+			o2Jobs.ParallelFor(innerCount, 50, [&](int innerBegin, int innerEnd)
+			{
+				sum += innerEnd - innerBegin;
+			});
+		}
+	});
+
+	return sum == outerCount*innerCount;
+}
+
+// Checks handles states
+static bool IsHandlesCorrect()
+{
+	JobHandle empty;
+	if (empty.IsValid() || !empty.IsDone())
+		return false;
+
+	empty.Wait();
+
+	std::atomic<bool> dependencyDone(false);
+	JobHandle dependency = o2Jobs.Schedule([&]() { dependencyDone = true; });
+	JobHandle dependent = o2Jobs.Schedule([&]() {}, { dependency, empty });
+
+	dependent.Wait();
+
+	// Waiting done job returns immediately
+	dependent.Wait();
+
+	return dependency.IsValid() && dependency.IsDone() && dependent.IsDone() && dependencyDone;
+}
+
+void TestJobSystem()
+{
+	bool parallelFor = IsParallelForCorrect();
+	bool dependencies = IsDependenciesOrderCorrect();
+	bool nestedWait = IsNestedWaitCorrect();
+	bool handles = IsHandlesCorrect();
+
+	o2Debug.Log("Job system: " + (String)o2Jobs.GetThreadsCount() + " threads");
+
+	if (parallelFor && dependencies && nestedWait && handles)
+		o2Debug.Log("Job system - OK");
+	else
+		o2Debug.LogError("Job system - FAILED");
+}
@@ -0,0 +1,249 @@
+#include "o2/stdafx.h"
+#include "JsonStream.h"
+
+#include "o2/Utils/Debug/Debug.h"
+#include "o2/Utils/FileSystem/File.h"
+#include "o2/Utils/FileSystem/FileSystem.h"
+#include "o2/Utils/Serialization/JsonStream.h"
+#include "o2/Utils/Serialization/Serializable.h"
+#include "o2/Utils/System/Time/Timer.h"
+
+using namespace o2;
+
+// Serializable item with fields of different kinds
+class StreamTestItem: public ISerializable
+{
+public:
+	String      name;            // @SERIALIZABLE
+	int         count = 0;       // @SERIALIZABLE
+	float       weight = 0.0f;   // @SERIALIZABLE
+	bool        enabled = false; // @SERIALIZABLE
+	Vec2F       position;        // @SERIALIZABLE
+	Vector<int> values;          // @SERIALIZABLE
+
+	bool operator==(const StreamTestItem& other) const
+	{
+		return name == other.name && count == other.count && weight == other.weight && enabled == other.enabled &&
+			position == other.position && values == other.values;
+	}
+
+	SERIALIZABLE(StreamTestItem);
+};
+
+// Serializable item with deserialization callback, it must be deserialized from data document
+class StreamTestCallbackItem: public ISerializable
+{
+public:
+	int  value = 0;            // @SERIALIZABLE
+	bool deserialized = false;
+
+	SERIALIZABLE(StreamTestCallbackItem);
+
+protected:
+	void OnDeserialized(const DataValue& node) override { deserialized = true; }
+};
+
+// Serializable container with nested objects, vectors and map
+class StreamTestContainer: public ISerializable
+{
+public:
+	String                 name;     // @SERIALIZABLE
+	StreamTestItem         main;     // @SERIALIZABLE
+	Vector<StreamTestItem> items;    // @SERIALIZABLE
+	Map<String, int>       tags;     // @SERIALIZABLE
+	StreamTestCallbackItem callback; // @SERIALIZABLE
+
+	bool operator==(const StreamTestContainer& other) const
+	{
+		return name == other.name && main == other.main && items == other.items && tags == other.tags &&
+			callback.value == other.callback.value;
+	}
+
+	SERIALIZABLE(StreamTestContainer);
+};
+
+CLASS_BASES_META(StreamTestItem)
+{
+	BASE_CLASS(o2::ISerializable);
+}
+END_META;
+CLASS_FIELDS_META(StreamTestItem)
+{
+	FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().NAME(name);
+	FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(0).NAME(count);
+	FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(0.0f).NAME(weight);
+	FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(false).NAME(enabled);
+	FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().NAME(position);
+	FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().NAME(values);
+}
+END_META;
+CLASS_METHODS_META(StreamTestItem)
+{
+}
+END_META;
+
+CLASS_BASES_META(StreamTestCallbackItem)
+{
+	BASE_CLASS(o2::ISerializable);
+}
+END_META;
+CLASS_FIELDS_META(StreamTestCallbackItem)
+{
+	FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(0).NAME(value);
+	FIELD().PUBLIC().DEFAULT_VALUE(false).NAME(deserialized);
+}
+END_META;
+CLASS_METHODS_META(StreamTestCallbackItem)
+{
+
+	FUNCTION().PROTECTED().SIGNATURE(void, OnDeserialized, const DataValue&);
+}
+END_META;
+
+CLASS_BASES_META(StreamTestContainer)
+{
+	BASE_CLASS(o2::ISerializable);
+}
+END_META;
+CLASS_FIELDS_META(StreamTestContainer)
+{
+	FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().NAME(name);
+	FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().NAME(main);
+	FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().NAME(items);
+	FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().NAME(tags);
+	FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().NAME(callback);
+}
+END_META;
+CLASS_METHODS_META(StreamTestContainer)
+{
+}
+END_META;
+
+// Fills item with pseudo random values
+static void FillStreamTestItem(StreamTestItem& item, int idx)
+{
+	item.name = "Item " + (String)idx;
+	item.count = idx*7;
+	item.weight = Math::Random(0.0f, 100.0f);
+	item.enabled = idx%3 != 0;
+	item.position = Vec2F(Math::Random(-1000.0f, 1000.0f), Math::Random(-1000.0f, 1000.0f));
+
+	for (int i = 0; i < idx%8; i++)
+		item.values.Add(idx*i);
+}
+
+// Returns file content
+static String ReadFileText(const String& path)
+{
+	InFile file(path);
+	return file.ReadFullData();
+}
+
+void TestJsonStreamSerialization()
+{
+	StreamTestContainer source;
+	source.name = "Stream test";
+	FillStreamTestItem(source.main, 1);
+	source.callback.value = 5;
+
+	const int itemsCount = 50000;
+	source.items.Resize(itemsCount);
+	for (int i = 0; i < itemsCount; i++)
+	{
+		FillStreamTestItem(source.items[i], i);
+		source.tags["tag" + (String)(i%100)] = i;
+	}
+
+	String domPath = "json_stream_test_dom.json";
+	String streamPath = "json_stream_test_stream.json";
+	const int repeatsCount = 3;
+	Timer timer;
+
+	// Saving through data document
+	size_t domSaveMemory = 0;
+	for (int i = 0; i < repeatsCount; i++)
+	{
+		DataDocument data;
+		data.Set(source);
+		String text = data.SaveAsString();
+
+		OutFile file(domPath);
+		file.WriteData(text.Data(), text.Length());
+
+		domSaveMemory = data.GetAllocatedMemory() + text.Length();
+	}
+
+	float domSaveTime = timer.GetDeltaTime()/repeatsCount;
+
+	// Saving directly into file stream
+	size_t streamSaveMemory = 0;
+	for (int i = 0; i < repeatsCount; i++)
+	{
+		JsonFileWriteStream stream(streamPath);
+		JsonStreamWriter writer(stream);
+		source.SerializeStream(writer);
+
+		streamSaveMemory = JsonFileWriteStream::bufferSize + writer.GetPeakScratchMemory();
+	}
+
+	float streamSaveTime = timer.GetDeltaTime()/repeatsCount;
+
+	bool textsEquals = ReadFileText(domPath) == ReadFileText(streamPath);
+
+	// Loading through data document
+	StreamTestContainer domLoaded;
+	size_t domLoadMemory = 0;
+	for (int i = 0; i < repeatsCount; i++)
+	{
+		DataDocument data;
+		data.LoadFromFile(streamPath);
+		domLoaded = StreamTestContainer();
+		domLoaded.Deserialize(data);
+
+		domLoadMemory = data.GetAllocatedMemory();
+	}
+
+	float domLoadTime = timer.GetDeltaTime()/repeatsCount;
+
+	// Loading from parser events
+	StreamTestContainer streamLoaded;
+	size_t streamLoadMemory = 0;
+	bool streamParsed = true;
+	for (int i = 0; i < repeatsCount; i++)
+	{
+		streamLoaded = StreamTestContainer();
+
+		JsonFileReadStream stream(streamPath);
+		JsonStreamDeserializeHandler handler(streamLoaded);
+		streamParsed = handler.Parse(stream) && streamParsed;
+
+		streamLoadMemory = JsonFileReadStream::bufferSize + handler.GetPeakScratchMemory();
+	}
+
+	float streamLoadTime = timer.GetDeltaTime()/repeatsCount;
+
+	StreamTestContainer simpleLoaded;
+	bool simpleLoadCorrect = LoadJsonStream(simpleLoaded, domPath) && simpleLoaded == source;
+
+	bool loadedCorrect = streamParsed && domLoaded == source && streamLoaded == source && streamLoaded.callback.deserialized;
+
+	o2Debug.Log("Json of " + (String)itemsCount + " items, " + (String)(int)(o2FileSystem.GetFileInfo(streamPath).size/1024) +
+				"KB. Save: DOM " + (String)(domSaveTime*1000.0f) + "ms, " + (String)(int)(domSaveMemory/1024) + "KB; stream " +
+				(String)(streamSaveTime*1000.0f) + "ms, " + (String)(int)(streamSaveMemory/1024) + "KB. Load: DOM " +
+				(String)(domLoadTime*1000.0f) + "ms, " + (String)(int)(domLoadMemory/1024) + "KB; stream " +
+				(String)(streamLoadTime*1000.0f) + "ms, " + (String)(int)(streamLoadMemory/1024) + "KB");
+
+	o2FileSystem.FileDelete(domPath);
+	o2FileSystem.FileDelete(streamPath);
+
+	if (textsEquals && loadedCorrect && simpleLoadCorrect)
+		o2Debug.Log("Json stream serialization - OK");
+	else
+		o2Debug.LogError("Json stream serialization - FAILED");
+}
+
+DECLARE_CLASS(StreamTestItem);
+
+DECLARE_CLASS(StreamTestCallbackItem);
+
+DECLARE_CLASS(StreamTestContainer);
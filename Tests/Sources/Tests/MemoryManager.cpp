@@ -0,0 +1,228 @@
+#include "o2/stdafx.h"
+#include "MemoryManager.h"
+
+#include "o2/Utils/Debug/Debug.h"
+#include "o2/Utils/Memory/MemoryManager.h"
+#include <thread>
+
+using namespace o2;
+
+// Memory manager with open registration functions. Registers fake memory pointers, so statistics aren't mixed with
+// engine allocations
+class OpenMemoryManager: public MemoryManager
+{
+public:
+	using MemoryManager::OnMemoryAllocate;
+	using MemoryManager::OnMemoryRelease;
+
+	// Returns true when some shard linked next segment
+	bool IsTableGrown() const
+	{
+		for (int i = 0; i < shardsCount; i++)
+		{
+			if (mShards[i].first->next.load() != nullptr)
+				return true;
+		}
+
+		return false;
+	}
+};
+
+static const char* const testSource = "MemoryManagerTest.cpp";
+
+// Returns statistics of location from snapshot, or nullptr when there is no such location
+static const MemoryManager::LocationStats* FindLocation(const std::vector<MemoryManager::LocationStats>& locations,
+														const char* source, int line)
+{
+	for (auto& stats : locations)
+	{
+		if (stats.source == source && stats.line == line)
+			return &stats;
+	}
+
+	return nullptr;
+}
+
+// Returns fake memory pointer of allocation. Pointers are unique by thread and allocation index
+static void* GetTestMemory(int thread, int idx)
+{
+	return (void*)(size_t)(0x10000000 + ((size_t)thread << 24) + (size_t)idx*16);
+}
+
+// Returns size of allocation by index
+static size_t GetTestSize(int idx)
+{
+	return (idx%7 + 1)*8;
+}
+
+// Runs function in threads with thread index and waits them
+template<typename _func>
+static void RunThreads(int threadsCount, const _func& func)
+{
+	std::vector<std::thread> threads;
+	for (int t = 0; t < threadsCount; t++)
+		threads.emplace_back([&func, t]() { func(t); });
+
+	for (auto& thread : threads)
+		thread.join();
+}
+
+// Allocates from several threads so much memory that table grows past first segments, then releases half of
+// allocations from threads. Checks total and locations statistics, then releases rest allocations
+static bool IsThreadsAllocationsCounted(OpenMemoryManager& manager)
+{
+	const int threadsCount = 4;
+	const int allocsCount = 20000;
+
+	RunThreads(threadsCount, [&](int t) {
+		for (int i = 0; i < allocsCount; i++)
+			manager.OnMemoryAllocate(GetTestMemory(t, i), GetTestSize(i), testSource, 100 + t);
+	});
+
+	// Live allocations are more than count of shards multiplied by filled first segment size
+	bool correct = manager.IsTableGrown() && manager.GetAllocationsCount() == allocsCount*threadsCount;
+
+	RunThreads(threadsCount, [&](int t) {
+		for (int i = 0; i < allocsCount; i += 2)
+			manager.OnMemoryRelease(GetTestMemory(t, i));
+	});
+
+	Int64 threadBytes = 0, threadPeakBytes = 0;
+	for (int i = 0; i < allocsCount; i++)
+	{
+		threadPeakBytes += GetTestSize(i);
+
+		if (i%2 == 1)
+			threadBytes += GetTestSize(i);
+	}
+
+	correct = correct && manager.GetAllocatedBytes() == threadBytes*threadsCount &&
+		manager.GetAllocationsCount() == allocsCount/2*threadsCount &&
+		manager.GetPeakAllocatedBytes() == threadPeakBytes*threadsCount;
+
+	auto snapshot = manager.MakeSnapshot();
+	for (int t = 0; t < threadsCount; t++)
+	{
+		auto stats = FindLocation(snapshot.locations, testSource, 100 + t);
+		correct = correct && stats && stats->bytes == threadBytes && stats->count == allocsCount/2 &&
+			stats->totalCount == allocsCount && stats->peakBytes == threadPeakBytes;
+	}
+
+	// Allocations in grown segments are found when releasing
+	for (int t = 0; t < threadsCount; t++)
+	{
+		for (int i = 1; i < allocsCount; i += 2)
+			manager.OnMemoryRelease(GetTestMemory(t, i));
+	}
+
+	return correct && manager.GetAllocatedBytes() == 0 && manager.GetAllocationsCount() == 0;
+}
+
+// Checks that snapshot with peaks reset returns peak of period, and next snapshot has peak of next period
+static bool IsPeaksReset(OpenMemoryManager& manager)
+{
+	manager.MakeSnapshot(true);
+
+	manager.OnMemoryAllocate(GetTestMemory(0, 1), 1000, testSource, 200);
+	manager.OnMemoryAllocate(GetTestMemory(0, 2), 24, testSource, 200);
+	manager.OnMemoryRelease(GetTestMemory(0, 1));
+
+	auto first = manager.MakeSnapshot(true);
+	auto firstStats = FindLocation(first.locations, testSource, 200);
+
+	manager.OnMemoryAllocate(GetTestMemory(0, 3), 100, testSource, 200);
+	manager.OnMemoryRelease(GetTestMemory(0, 3));
+
+	auto second = manager.MakeSnapshot(true);
+	auto secondStats = FindLocation(second.locations, testSource, 200);
+
+	manager.OnMemoryRelease(GetTestMemory(0, 2));
+
+	return firstStats && firstStats->peakBytes == 1024 && firstStats->bytes == 24 && first.peakBytes == 1024 &&
+		secondStats && secondStats->peakBytes == 124 && secondStats->bytes == 24 && second.peakBytes == 124;
+}
+
+// Checks that difference between snapshots contains only changed locations with growth of bytes and counts
+static bool IsSnapshotsDiffCorrect(OpenMemoryManager& manager)
+{
+	manager.OnMemoryAllocate(GetTestMemory(1, 1), 64, testSource, 300);
+
+	auto from = manager.MakeSnapshot(true);
+
+	manager.OnMemoryAllocate(GetTestMemory(1, 2), 100, testSource, 301);
+	manager.OnMemoryAllocate(GetTestMemory(1, 3), 100, testSource, 301);
+	manager.OnMemoryRelease(GetTestMemory(1, 2));
+
+	manager.OnMemoryAllocate(GetTestMemory(1, 4), 50, testSource, 302);
+	manager.OnMemoryRelease(GetTestMemory(1, 4));
+
+	auto to = manager.MakeSnapshot(true);
+	auto diff = MemoryManager::Diff(from, to);
+
+	auto unchanged = FindLocation(diff, testSource, 300);
+	auto grown = FindLocation(diff, testSource, 301);
+	auto temporary = FindLocation(diff, testSource, 302);
+
+	manager.OnMemoryRelease(GetTestMemory(1, 1));
+	manager.OnMemoryRelease(GetTestMemory(1, 3));
+
+	return !unchanged &&
+		grown && grown->bytes == 100 && grown->count == 1 && grown->totalCount == 2 && grown->peakBytes == 200 &&
+		temporary && temporary->bytes == 0 && temporary->count == 0 && temporary->totalCount == 1 &&
+		temporary->peakBytes == 50;
+}
+
+// Checks that lines, which can't be packed into location key, are collected into overflow location and aren't mixed
+// with other lines
+static bool IsBigLinesNotCollided(OpenMemoryManager& manager)
+{
+	const int bigLine = 70000;
+	const int collidedLine = bigLine & 0xFFFF;
+
+	manager.OnMemoryAllocate(GetTestMemory(2, 1), 16, testSource, collidedLine);
+	manager.OnMemoryAllocate(GetTestMemory(2, 2), 32, testSource, bigLine);
+
+	auto snapshot = manager.MakeSnapshot();
+	auto collided = FindLocation(snapshot.locations, testSource, collidedLine);
+
+	bool overflowed = false;
+	for (auto& stats : snapshot.locations)
+	{
+		if (strcmp(stats.source, "<other locations>") == 0)
+			overflowed = stats.bytes == 32 && stats.count == 1;
+	}
+
+	manager.OnMemoryRelease(GetTestMemory(2, 1));
+	manager.OnMemoryRelease(GetTestMemory(2, 2));
+
+	// On 32-bit platforms line isn't clamped, so it has own location
+	bool bigLineRegistered = sizeof(void*) == 8 ? overflowed :
+		FindLocation(snapshot.locations, testSource, bigLine) != nullptr;
+
+	return collided && collided->bytes == 16 && collided->count == 1 && bigLineRegistered;
+}
+
+void TestMemoryManager()
+{
+	OpenMemoryManager manager;
+
+	if (IsThreadsAllocationsCounted(manager))
+		o2Debug.Log("Memory manager allocations from threads - OK");
+	else
+		o2Debug.LogError("Memory manager allocations from threads - FAILED");
+
+	if (IsPeaksReset(manager))
+		o2Debug.Log("Memory manager peaks reset - OK");
+	else
+		o2Debug.LogError("Memory manager peaks reset - FAILED");
+
+	if (IsSnapshotsDiffCorrect(manager))
+		o2Debug.Log("Memory manager snapshots diff - OK");
+	else
+		o2Debug.LogError("Memory manager snapshots diff - FAILED");
+
+	if (IsBigLinesNotCollided(manager))
+		o2Debug.Log("Memory manager big source lines - OK");
+	else
+		o2Debug.LogError("Memory manager big source lines - FAILED");
+}
@@ -0,0 +1,290 @@
+#include "o2/stdafx.h"
+#include "Particles.h"
+
+#include "o2/Render/ParticlesPool.h"
+#include "o2/Scene/Actor.h"
+#include "o2/Scene/Components/ParticlesEmitterComponent.h"
+#include "o2/Scene/Scene.h"
+#include "o2/Utils/Debug/Debug.h"
+#include "o2/Utils/System/Time/Timer.h"
+
+using namespace o2;
+
+static Particle RandomParticle(float lifetime)
+{
+	Particle p;
+	p.position.Set(Math::Random(-500.0f, 500.0f), Math::Random(-500.0f, 500.0f));
+	p.velocity.Set(Math::Random(-50.0f, 50.0f), Math::Random(-50.0f, 50.0f));
+	p.angle = Math::Random(0.0f, 6.28f);
+	p.angleSpeed = Math::Random(-3.0f, 3.0f);
+	p.size.Set(Math::Random(5.0f, 20.0f), Math::Random(5.0f, 20.0f));
+	p.color = Color4(Math::Random(0, 255), Math::Random(0, 255), Math::Random(0, 255), Math::Random(0, 255));
+	p.time = Math::Random(0.0f, lifetime);
+	p.alive = true;
+
+	return p;
+}
+
+// Reference particles update, same as emitter did with array of particles structures
+static void UpdateReference(Vector<Particle>& particles, const Vec2F& gravity, float dt)
+{
+	for (auto& p : particles)
+		p.velocity += gravity*dt;
+
+	for (auto& p : particles)
+	{
+		p.position += p.velocity*dt;
+		p.angle += p.angleSpeed*dt;
+		p.time -= dt;
+	}
+
+	int idx = 0;
+	while (idx < particles.Count())
+	{
+		if (particles[idx].time < 0)
+		{
+			particles[idx] = particles.Last();
+			particles.PopBack();
+		}
+		else
+			idx++;
+	}
+}
+
+// Reference quad vertices of particle, same as emitter did particle by particle
+static void BuildReferenceQuad(const Particle& particle, Vertex* quad)
+{
+	float sn = Math::Sin(particle.angle), cs = Math::Cos(particle.angle);
+	Vec2F hs = particle.size*0.5f;
+	Vec2F xv(cs*hs.x, sn*hs.x);
+	Vec2F yv(-sn*hs.y, cs*hs.y);
+	Vec2F o(particle.position);
+	Color32Bit color = particle.color.ARGB();
+
+	quad[0].Set(o - xv + yv, color, 0.0f, 1.0f);
+	quad[1].Set(o + xv + yv, color, 1.0f, 1.0f);
+	quad[2].Set(o + xv - yv, color, 1.0f, 0.0f);
+	quad[3].Set(o - xv - yv, color, 0.0f, 0.0f);
+}
+
+static bool IsVerticesEqual(const Vertex& a, const Vertex& b)
+{
+	return Math::Equals(a.x, b.x, 0.001f) && Math::Equals(a.y, b.y, 0.001f) && a.color == b.color &&
+		a.tu == b.tu && a.tv == b.tv;
+}
+
+static void TestParticlesPoolEquality()
+{
+	const int particlesCount = 1003;
+	const int frames = 60;
+	const float dt = 1.0f/60.0f;
+	const Vec2F gravity(0, -98.0f);
+
+	ParticlesPool pool;
+	Vector<Particle> reference;
+	for (int i = 0; i < particlesCount; i++)
+	{
+		Particle p = RandomParticle(1.0f);
+		pool.Add(p);
+		reference.Add(p);
+	}
+
+	bool equal = true;
+	for (int i = 0; i < frames && equal; i++)
+	{
+		pool.AddVelocity(gravity*dt);
+		pool.Integrate(dt);
+		pool.RemoveExpired();
+
+		UpdateReference(reference, gravity, dt);
+
+		equal = pool.GetCount() == reference.Count();
+		for (int j = 0; j < reference.Count() && equal; j++)
+		{
+			Particle p = pool.Get(j);
+			const Particle& r = reference[j];
+
+			equal = Math::Equals(p.position.x, r.position.x, 0.001f) && Math::Equals(p.position.y, r.position.y, 0.001f) &&
+				Math::Equals(p.velocity.x, r.velocity.x, 0.001f) && Math::Equals(p.velocity.y, r.velocity.y, 0.001f) &&
+				Math::Equals(p.angle, r.angle, 0.001f) && Math::Equals(p.time, r.time, 0.001f) && p.color == r.color;
+		}
+
+		Vector<Vertex> vertices;
+		vertices.Resize(pool.GetCount()*4);
+		pool.BuildQuads(0, pool.GetCount(), vertices.Data(), 0.0f, 1.0f, 1.0f, 0.0f);
+
+		Vertex quad[4];
+		for (int j = 0; j < reference.Count() && equal; j++)
+		{
+			BuildReferenceQuad(reference[j], quad);
+			for (int k = 0; k < 4; k++)
+				equal = equal && IsVerticesEqual(vertices[j*4 + k], quad[k]);
+		}
+	}
+
+	if (equal)
+		o2Debug.Log("Particles pool update equal to reference - OK");
+	else
+		o2Debug.LogError("Particles pool update equal to reference - FAILED");
+}
+
+static void TestParticlesPoolPerformance()
+{
+	const int particlesCount = 1000000;
+	const int frames = 10;
+	const int meshParticlesCount = 16384;
+	const float dt = 1.0f/60.0f;
+	const Vec2F gravity(0, -98.0f);
+
+	ParticlesPool pool;
+	Vector<Particle> reference;
+	pool.Reserve(particlesCount);
+	reference.Reserve(particlesCount);
+
+	// Particles live longer than benchmark, so particles count is constant
+	for (int i = 0; i < particlesCount; i++)
+	{
+		Particle p = RandomParticle(100.0f);
+		p.time += 1.0f;
+		pool.Add(p);
+		reference.Add(p);
+	}
+
+	// Quads are built by chunks, like meshes with 16 bit indexes
+	Vector<Vertex> vertices;
+	vertices.Resize(meshParticlesCount*4);
+
+	Timer timer;
+	for (int i = 0; i < frames; i++)
+	{
+		UpdateReference(reference, gravity, dt);
+
+		for (int j = 0; j < reference.Count(); j += meshParticlesCount)
+		{
+			int count = Math::Min(meshParticlesCount, reference.Count() - j);
+			for (int k = 0; k < count; k++)
+				BuildReferenceQuad(reference[j + k], vertices.Data() + k*4);
+		}
+	}
+
+	float referenceTime = timer.GetTime();
+
+	timer.Reset();
+	for (int i = 0; i < frames; i++)
+	{
+		pool.AddVelocity(gravity*dt);
+		pool.Integrate(dt);
+		pool.RemoveExpired();
+
+		for (int j = 0; j < pool.GetCount(); j += meshParticlesCount)
+		{
+			int count = Math::Min(meshParticlesCount, pool.GetCount() - j);
+			pool.BuildQuads(j, count, vertices.Data(), 0.0f, 1.0f, 1.0f, 0.0f);
+		}
+	}
+
+	float poolTime = timer.GetTime();
+
+	o2Debug.Log("Particles update and quads of " + (String)particlesCount + " particles per frame: structures " +
+				(String)(referenceTime*1000.0f/frames) + "ms, pool " + (String)(poolTime*1000.0f/frames) + "ms");
+}
+
+// Creates emitters with explicit seeds, updates scene frames with components or scene parallel pass, returns particles
+static Vector<Particle> UpdateTestEmitters(bool parallel)
+{
+	const int emittersCount = 64;
+	const int framesCount = 30;
+	const float dt = 1.0f/60.0f;
+
+	o2Scene.SetParallelParticlesUpdate(parallel);
+
+	Vector<Actor*> actors;
+	Vector<ParticlesEmitterComponent*> emitters;
+	for (int i = 0; i < emittersCount; i++)
+	{
+		Actor* actor = mnew Actor();
+		actor->transform->position = Vec2F((float)(i%8)*50.0f, (float)(i/8)*50.0f);
+
+		auto emitter = actor->AddComponent<ParticlesEmitterComponent>();
+		emitter->SetRandomSeed(i + 1);
+		emitter->SetLoop(true);
+		emitter->SetEmitParticlesPerSecond(100.0f + (float)i);
+		emitter->SetEmitParticlesSizeRange(Vec2F(5, 5));
+
+		actors.Add(actor);
+		emitters.Add(emitter);
+	}
+
+	for (int i = 0; i < framesCount; i++)
+		o2Scene.Update(dt);
+
+	Vector<Particle> res;
+	for (auto emitter : emitters)
+	{
+		const ParticlesPool& particles = emitter->GetParticles();
+		for (int i = 0; i < particles.GetCount(); i++)
+			res.Add(particles.Get(i));
+	}
+
+	for (auto actor : actors)
+		delete actor;
+
+	return res;
+}
+
+static void TestParticlesEmittersParallelUpdate()
+{
+	bool wasParallel = o2Scene.IsParallelParticlesUpdate();
+
+	Vector<Particle> serialParticles = UpdateTestEmitters(false);
+	Vector<Particle> parallelParticles = UpdateTestEmitters(true);
+
+	o2Scene.SetParallelParticlesUpdate(wasParallel);
+
+	if (!serialParticles.IsEmpty() && serialParticles == parallelParticles)
+		o2Debug.Log("Particles emitters parallel update equal to serial - OK");
+	else
+		o2Debug.LogError("Particles emitters parallel update equal to serial - FAILED");
+}
+
+// Returns first particles of emitter after few frames
+static Vector<Particle> EmitTestParticles(ParticlesEmitter& emitter)
+{
+	for (int i = 0; i < 10; i++)
+		emitter.Update(1.0f/60.0f);
+
+	Vector<Particle> res;
+	for (int i = 0; i < emitter.GetParticles().GetCount(); i++)
+		res.Add(emitter.GetParticles().Get(i));
+
+	return res;
+}
+
+static void TestParticlesEmitterSeeds()
+{
+	ParticlesEmitter randomEmitter;
+	randomEmitter.SetEmitParticlesPerSecond(100.0f);
+
+	ParticlesEmitter randomCopy(randomEmitter);
+	bool randomCorrect = randomCopy.GetRandomSeed() == 0 && EmitTestParticles(randomEmitter) != EmitTestParticles(randomCopy);
+
+	ParticlesEmitter seededEmitter;
+	seededEmitter.SetEmitParticlesPerSecond(100.0f);
+	seededEmitter.SetRandomSeed(12345);
+
+	ParticlesEmitter seededCopy(seededEmitter);
+	bool seededCorrect = seededCopy.GetRandomSeed() == 12345 && EmitTestParticles(seededEmitter) == EmitTestParticles(seededCopy);
+
+	if (randomCorrect && seededCorrect)
+		o2Debug.Log("Particles emitter copy seeds - OK");
+	else
+		o2Debug.LogError("Particles emitter copy seeds - FAILED");
+}
+
+void TestParticlesPool()
+{
+	TestParticlesPoolEquality();
+	TestParticlesPoolPerformance();
+	TestParticlesEmittersParallelUpdate();
+	TestParticlesEmitterSeeds();
+}
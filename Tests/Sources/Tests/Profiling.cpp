@@ -0,0 +1,111 @@
+#include "o2/stdafx.h"
+#include "Profiling.h"
+
+#include "o2/Utils/Debug/Debug.h"
+#include "o2/Utils/Debug/Profiler.h"
+#include <thread>
+
+using namespace o2;
+
+// Returns zone with name, or nullptr when there is no such zone
+static const Profiler::Zone* FindZone(const Vector<Profiler::Zone>& zones, const char* name)
+{
+	return zones.Find([=](const Profiler::Zone& zone) { return strcmp(zone.name, name) == 0; });
+}
+
+// Returns true when zone is placed inside parent zone in the same thread with next depth
+static bool IsZoneNested(const Profiler::Zone* zone, const Profiler::Zone* parent)
+{
+	return zone && parent && zone->threadId == parent->threadId && zone->depth == parent->depth + 1 &&
+		zone->begin >= parent->begin && zone->end <= parent->end;
+}
+
+// Checks that zones are nested by scopes and collected by frame from all threads
+static bool IsZonesCollected()
+{
+	o2Profiler.BeginFrame();
+
+	{
+		ProfilerZone outer("ProfilerTest::Outer");
+
+		{
+			ProfilerZone inner("ProfilerTest::Inner");
+			ProfilerZone innermost("ProfilerTest::Innermost");
+		}
+
+		{
+			ProfilerZone second("ProfilerTest::SecondInner");
+		}
+	}
+
+	std::thread thread([]() { ProfilerZone zone("ProfilerTest::Thread"); });
+	thread.join();
+
+	o2Profiler.EndFrame();
+
+	auto frames = o2Profiler.GetFrames();
+	if (frames.IsEmpty())
+		return false;
+
+	auto zones = o2Profiler.GetZones(frames.Last().begin, frames.Last().end);
+
+	auto outer = FindZone(zones, "ProfilerTest::Outer");
+	auto inner = FindZone(zones, "ProfilerTest::Inner");
+	auto innermost = FindZone(zones, "ProfilerTest::Innermost");
+	auto second = FindZone(zones, "ProfilerTest::SecondInner");
+	auto threadZone = FindZone(zones, "ProfilerTest::Thread");
+
+	if (!outer || !IsZoneNested(inner, outer) || !IsZoneNested(innermost, inner) || !IsZoneNested(second, outer))
+		return false;
+
+	// Sibling zones follow each other
+	if (second->begin < inner->end)
+		return false;
+
+	return threadZone && threadZone->threadId != outer->threadId && threadZone->depth == 0;
+}
+
+// Checks that zones aren't recorded while profiler is disabled, and zones begun when disabled aren't finished
+static bool IsDisabledProfilerSkipsZones()
+{
+	o2Profiler.SetEnabled(false);
+	o2Profiler.BeginFrame();
+
+	{
+		ProfilerZone zone("ProfilerTest::Disabled");
+		o2Profiler.SetEnabled(true);
+	}
+
+	{
+		ProfilerZone zone("ProfilerTest::Enabled");
+	}
+
+	o2Profiler.EndFrame();
+
+	auto frames = o2Profiler.GetFrames();
+	auto zones = o2Profiler.GetZones(frames.Last().begin, frames.Last().end);
+
+	auto enabledZone = FindZone(zones, "ProfilerTest::Enabled");
+	return !FindZone(zones, "ProfilerTest::Disabled") && enabledZone && enabledZone->depth == 0;
+}
+
+void TestProfiler()
+{
+	bool wasEnabled = o2Profiler.IsEnabled();
+	o2Profiler.SetEnabled(true);
+
+	bool collected = IsZonesCollected();
+	bool disabledSkips = IsDisabledProfilerSkipsZones();
+
+	o2Profiler.SetEnabled(wasEnabled);
+
+	if (collected)
+		o2Debug.Log("Profiler zones nesting and collecting - OK");
+	else
+		o2Debug.LogError("Profiler zones nesting and collecting - FAILED");
+
+	if (disabledSkips)
+		o2Debug.Log("Disabled profiler skips zones - OK");
+	else
+		o2Debug.LogError("Disabled profiler skips zones - FAILED");
+}
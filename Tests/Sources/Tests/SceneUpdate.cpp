@@ -0,0 +1,196 @@
+#include "o2/stdafx.h"
+#include "SceneUpdate.h"
+
+#include "o2/Scene/Actor.h"
+#include "o2/Scene/Component.h"
+#include "o2/Scene/Scene.h"
+#include "o2/Utils/Debug/Debug.h"
+#include "o2/Utils/Tasks/JobSystem.h"
+#include <atomic>
+
+using namespace o2;
+
+// Counter of components updates, used to check updates order
+static std::atomic<int> updatesCounter(0);
+
+// Thread safe component, moves and rotates owner actor
+class ParallelUpdateTestComponent: public Component
+{
+public:
+	Vec2F velocity;          // Owner moving velocity
+	float angularSpeed = 0;  // Owner rotation speed
+	int   updateIndex = -1;  // Index of last update
+
+public:
+	// Moves and rotates owner actor
+	void Update(float dt) override
+	{
+		updateIndex = updatesCounter++;
+		mOwner->transform->position = mOwner->transform->position + velocity*dt;
+		mOwner->transform->angle = mOwner->transform->angle + angularSpeed*dt;
+	}
+
+	// Returns true, changes only owner actor
+	bool IsUpdateThreadSafe() const override { return true; }
+
+	SERIALIZABLE(ParallelUpdateTestComponent);
+};
+
+// Not thread safe component, moves owner actor
+class SerialUpdateTestComponent: public ParallelUpdateTestComponent
+{
+public:
+	// Returns false, subtree is updated on main thread
+	bool IsUpdateThreadSafe() const override { return false; }
+
+	SERIALIZABLE(SerialUpdateTestComponent);
+};
+
+CLASS_BASES_META(ParallelUpdateTestComponent)
+{
+	BASE_CLASS(o2::Component);
+}
+END_META;
+CLASS_FIELDS_META(ParallelUpdateTestComponent)
+{
+	FIELD().PUBLIC().NAME(velocity);
+	FIELD().PUBLIC().DEFAULT_VALUE(0).NAME(angularSpeed);
+	FIELD().PUBLIC().DEFAULT_VALUE(-1).NAME(updateIndex);
+}
+END_META;
+CLASS_METHODS_META(ParallelUpdateTestComponent)
+{
+
+	FUNCTION().PUBLIC().SIGNATURE(void, Update, float);
+	FUNCTION().PUBLIC().SIGNATURE(bool, IsUpdateThreadSafe);
+}
+END_META;
+
+CLASS_BASES_META(SerialUpdateTestComponent)
+{
+	BASE_CLASS(ParallelUpdateTestComponent);
+}
+END_META;
+CLASS_FIELDS_META(SerialUpdateTestComponent)
+{
+}
+END_META;
+CLASS_METHODS_META(SerialUpdateTestComponent)
+{
+
+	FUNCTION().PUBLIC().SIGNATURE(bool, IsUpdateThreadSafe);
+}
+END_META;
+
+// Test actors hierarchy. Same seed gives same hierarchy
+struct SceneUpdateTestHierarchy
+{
+	Vector<Actor*>                       roots;      // Root actors
+	Vector<Actor*>                       actors;     // All actors in creation order
+	Vector<ParallelUpdateTestComponent*> components; // Components of actors
+
+	// Creates roots with children chains, part of roots are not thread safe
+	void Create(int rootsCount, int depth)
+	{
+		for (int i = 0; i < rootsCount; i++)
+		{
+			Actor* parent = nullptr;
+			for (int j = 0; j < depth; j++)
+			{
+				Actor* actor = mnew Actor();
+				actor->transform->size = Vec2F(10, 10);
+				actor->transform->position = Vec2F((float)i, (float)j);
+
+				ParallelUpdateTestComponent* component = i%5 == 0 ? mnew SerialUpdateTestComponent() :
+					mnew ParallelUpdateTestComponent();
+
+				component->velocity = Vec2F((float)(i%7) - 3.0f, (float)(j%3) - 1.0f);
+				component->angularSpeed = 0.1f*(float)((i + j)%5);
+				actor->AddComponent(component);
+
+				if (parent)
+					parent->AddChild(actor);
+				else
+					roots.Add(actor);
+
+				actors.Add(actor);
+				components.Add(component);
+
+				parent = actor;
+			}
+		}
+	}
+
+	// Returns true when all roots were updated before all children on last frame
+	bool IsRootsUpdatedFirst() const
+	{
+		int lastRootUpdate = -1, firstChildUpdate = INT_MAX;
+		for (int i = 0; i < components.Count(); i++)
+		{
+			if (!actors[i]->GetParent())
+				lastRootUpdate = Math::Max(lastRootUpdate, components[i]->updateIndex);
+			else
+				firstChildUpdate = Math::Min(firstChildUpdate, components[i]->updateIndex);
+		}
+
+		return lastRootUpdate < firstChildUpdate;
+	}
+
+	// Destroys actors
+	void Destroy()
+	{
+		for (auto root : roots)
+			delete root;
+	}
+};
+
+// Updates scene frames in serial or parallel mode, returns actors world bases. Checks roots and children order
+static Vector<Basis> UpdateTestHierarchy(bool parallel, bool& orderCorrect)
+{
+	const int framesCount = 20;
+	const float dt = 1.0f/60.0f;
+
+	o2Scene.SetParallelUpdate(parallel);
+
+	SceneUpdateTestHierarchy hierarchy;
+	hierarchy.Create(200, 6);
+
+	for (int i = 0; i < framesCount; i++)
+	{
+		o2Scene.Update(dt);
+		orderCorrect = orderCorrect && hierarchy.IsRootsUpdatedFirst();
+	}
+
+	Vector<Basis> res;
+	for (auto actor : hierarchy.actors)
+		res.Add(actor->transform->GetWorldBasis());
+
+	hierarchy.Destroy();
+
+	return res;
+}
+
+void TestParallelSceneUpdate()
+{
+	bool wasParallel = o2Scene.IsParallelUpdate();
+
+	bool orderCorrect = true;
+	Vector<Basis> serialBases = UpdateTestHierarchy(false, orderCorrect);
+	Vector<Basis> parallelBases = UpdateTestHierarchy(true, orderCorrect);
+
+	o2Scene.SetParallelUpdate(wasParallel);
+
+	bool basesEqual = serialBases == parallelBases;
+
+	o2Debug.Log("Parallel scene update: " + (String)serialBases.Count() + " actors, " +
+				(String)o2Jobs.GetThreadsCount() + " threads");
+
+	if (orderCorrect && basesEqual)
+		o2Debug.Log("Parallel scene update - OK");
+	else
+		o2Debug.LogError("Parallel scene update - FAILED");
+}
+
+DECLARE_CLASS(ParallelUpdateTestComponent);
+
+DECLARE_CLASS(SerialUpdateTestComponent);
@@ -0,0 +1,147 @@
+#include "o2/stdafx.h"
+#include "SpatialIndex.h"
+
+#include "o2/Scene/Actor.h"
+#include "o2/Scene/Scene.h"
+#include "o2/Scene/SceneSpatialIndex.h"
+#include "o2/Utils/Debug/Debug.h"
+
+using namespace o2;
+
+// Returns random rectangle. Part of rectangles are large, they are stored in large items list
+static RectF RandomRect()
+{
+	Vec2F leftBottom(Math::Random(-5000.0f, 5000.0f), Math::Random(-5000.0f, 5000.0f));
+	float maxSize = Math::Random(0, 20) == 0 ? 5000.0f : 300.0f;
+	return RectF(leftBottom, leftBottom + Vec2F(Math::Random(0.0f, maxSize), Math::Random(0.0f, maxSize)));
+}
+
+// Returns true when query result contains exactly actors which bounds intersects rectangle
+static bool IsQueryCorrect(const SceneSpatialIndex& index, const Vector<Actor*>& actors, const Vector<int>& items,
+						   const RectF& rect)
+{
+	Vector<Actor*> result;
+	index.QueryRect(rect, result);
+
+	int expectedCount = 0;
+	for (int i = 0; i < actors.Count(); i++)
+	{
+		if (items[i] < 0 || !index.GetBounds(items[i]).IsIntersects(rect))
+			continue;
+
+		expectedCount++;
+		if (!result.Contains(actors[i]))
+			return false;
+	}
+
+	return result.Count() == expectedCount;
+}
+
+// Checks index queries against linear scan after adding, updating and removing items, and after cells rebuild
+static bool IsIndexQueriesCorrect()
+{
+	const int actorsCount = 2000;
+	const int queriesCount = 200;
+
+	SceneSpatialIndex index(256.0f, 64);
+	Vector<Actor*> actors;
+	Vector<int> items;
+
+	for (int i = 0; i < actorsCount; i++)
+	{
+		actors.Add(mnew Actor(ActorCreateMode::NotInScene));
+		items.Add(index.Add(actors.Last(), RandomRect()));
+	}
+
+	bool result = index.GetActorsCount() == actorsCount;
+
+	auto checkQueries = [&]()
+	{
+		for (int i = 0; i < queriesCount && result; i++)
+			result = IsQueryCorrect(index, actors, items, RandomRect());
+
+		Vector<Actor*> pointResult;
+		Vec2F point(Math::Random(-5000.0f, 5000.0f), Math::Random(-5000.0f, 5000.0f));
+		index.QueryPoint(point, pointResult);
+		for (auto actor : pointResult)
+			result = result && index.GetBounds(items[actors.IndexOf(actor)]).IsIntersects(RectF(point, point));
+	};
+
+	checkQueries();
+
+	// Move part of items, some of them change cells, some become large or small
+	for (int i = 0; i < actorsCount/2; i++)
+	{
+		int idx = Math::Random(0, actorsCount - 1);
+		index.Update(items[idx], RandomRect());
+	}
+
+	checkQueries();
+
+	// Remove part of items and add new ones, reusing free items
+	for (int i = 0; i < actorsCount/4; i++)
+	{
+		int idx = Math::Random(0, actorsCount - 1);
+		if (items[idx] < 0)
+			continue;
+
+		index.Remove(items[idx]);
+		result = result && index.GetActor(items[idx]) == nullptr;
+		items[idx] = -1;
+	}
+
+	for (int i = 0; i < actorsCount/8; i++)
+	{
+		int idx = items.IndexOf(-1);
+		items[idx] = index.Add(actors[idx], RandomRect());
+	}
+
+	result = result && index.GetActorsCount() == items.Count([](int x) { return x >= 0; });
+	checkQueries();
+
+	index.SetCellSize(100.0f);
+	checkQueries();
+
+	for (auto actor : actors)
+		delete actor;
+
+	return result;
+}
+
+// Checks that scene actors are indexed while they are on scene and follow transform changes
+static bool IsSceneActorsIndexed()
+{
+	Actor* actor = mnew Actor(ActorCreateMode::NotInScene);
+	actor->transform->size = Vec2F(10, 10);
+	actor->transform->pivot = Vec2F(0.5f, 0.5f);
+	actor->transform->position = Vec2F(10000, 10000);
+
+	bool result = !o2Scene.QueryPoint(Vec2F(10000, 10000)).Contains(actor);
+
+	actor->AddToScene();
+	result = result && o2Scene.QueryPoint(Vec2F(10000, 10000)).Contains(actor);
+
+	actor->transform->position = Vec2F(-10000, 10000);
+	actor->UpdateTransform();
+	result = result && !o2Scene.QueryPoint(Vec2F(10000, 10000)).Contains(actor) &&
+		o2Scene.QueryRect(RectF(-10010, 9990, -9990, 10010)).Contains(actor);
+
+	actor->RemoveFromScene();
+	result = result && !o2Scene.QueryPoint(Vec2F(-10000, 10000)).Contains(actor);
+
+	// Moving actor out of scene doesn't touch index
+	actor->transform->position = Vec2F(10000, 10000);
+	actor->UpdateTransform();
+	result = result && !o2Scene.QueryPoint(Vec2F(10000, 10000)).Contains(actor);
+
+	delete actor;
+	return result;
+}
+
+void TestSceneSpatialIndex()
+{
+	if (IsIndexQueriesCorrect() && IsSceneActorsIndexed())
+		o2Debug.Log("Scene spatial index - OK");
+	else
+		o2Debug.LogError("Scene spatial index - FAILED");
+}
@@ -0,0 +1,90 @@
+#include "o2/stdafx.h"
+#include "Transforms.h"
+
+#include "o2/Scene/Actor.h"
+#include "o2/Scene/ActorTransformsStore.h"
+#include "o2/Utils/Debug/Debug.h"
+#include "o2/Utils/System/Time/Timer.h"
+
+using namespace o2;
+
+void TestTransformsStore()
+{
+	const int actorsCount = 50000;
+	const int rootsCount = 50;
+	const int iterations = 20;
+
+	// Build random hierarchy, each actor is attached to random previous actor
+	Vector<Actor*> roots, actors;
+	for (int i = 0; i < actorsCount; i++)
+	{
+		Actor* actor = mnew Actor(ActorCreateMode::NotInScene);
+		actor->transform->position = Vec2F(Math::Random(-100.0f, 100.0f), Math::Random(-100.0f, 100.0f));
+		actor->transform->size = Vec2F(Math::Random(1.0f, 50.0f), Math::Random(1.0f, 50.0f));
+		actor->transform->scale = Vec2F(Math::Random(0.5f, 1.5f), Math::Random(0.5f, 1.5f));
+		actor->transform->pivot = Vec2F(Math::Random(0.0f, 1.0f), Math::Random(0.0f, 1.0f));
+		actor->transform->angle = Math::Random(0.0f, 6.28f);
+		actor->transform->shear = Math::Random(-0.3f, 0.3f);
+
+		if (i < rootsCount)
+			roots.Add(actor);
+		else
+			actors[Math::Random(0, i - 1)]->AddChild(actor);
+
+		actors.Add(actor);
+	}
+
+	Timer timer;
+
+	// Current recursive path: actors update dirty transforms and mark children dirty
+	timer.Reset();
+	for (int i = 0; i < iterations; i++)
+	{
+		for (auto root : roots)
+			root->transform->SetDirty(true);
+
+		for (auto root : roots)
+			root->Update(0.0f);
+
+		for (auto root : roots)
+			root->UpdateChildren(0.0f);
+	}
+	float recursiveTime = timer.GetTime();
+
+	Vector<Basis> recursiveBases;
+	for (auto actor : actors)
+		recursiveBases.Add(actor->transform->GetWorldBasis());
+
+	// Batched path: one flat pass over structure of arrays storage
+	ActorTransformsStore store;
+
+	timer.Reset();
+	store.Build(roots);
+	float buildTime = timer.GetTime();
+
+	timer.Reset();
+	for (int i = 0; i < iterations; i++)
+	{
+		for (auto root : roots)
+			root->transform->SetDirty(true);
+
+		store.Update();
+	}
+	float batchedTime = timer.GetTime();
+
+	bool equal = store.GetLastUpdatedCount() == actorsCount;
+	for (int i = 0; i < actors.Count() && equal; i++)
+		equal = actors[i]->transform->GetWorldBasis() == recursiveBases[i];
+
+	o2Debug.Log("Transforms update of " + (String)actorsCount + " actors, " + (String)iterations + " iterations: recursive " +
+				(String)(recursiveTime*1000.0f) + "ms, batched " + (String)(batchedTime*1000.0f) + "ms, storage build " +
+				(String)(buildTime*1000.0f) + "ms");
+
+	if (equal)
+		o2Debug.Log("Batched transforms equal to recursive - OK");
+	else
+		o2Debug.LogError("Batched transforms equal to recursive - FAILED");
+
+	for (auto root : roots)
+		delete root;
+}
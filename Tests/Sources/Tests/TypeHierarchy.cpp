@@ -0,0 +1,271 @@
+#include "o2/stdafx.h"
+#include "TypeHierarchy.h"
+
+#include "o2/Render/Sprite.h"
+#include "o2/Scene/Actor.h"
+#include "o2/Scene/Component.h"
+#include "o2/Scene/Components/EditorTestComponent.h"
+#include "o2/Scene/Components/ImageComponent.h"
+#include "o2/Utils/Debug/Debug.h"
+#include "o2/Utils/Reflection/Reflection.h"
+#include "o2/Utils/System/Time/Timer.h"
+
+using namespace o2;
+
+// First component of deep components hierarchy
+class HierarchyTestComponentA: public Component
+{
+public:
+	int a = 1; // @SERIALIZABLE
+
+	SERIALIZABLE(HierarchyTestComponentA);
+};
+
+// Second component of deep components hierarchy
+class HierarchyTestComponentB: public HierarchyTestComponentA
+{
+public:
+	int b = 2; // @SERIALIZABLE
+
+	SERIALIZABLE(HierarchyTestComponentB);
+};
+
+// Third component of deep components hierarchy
+class HierarchyTestComponentC: public HierarchyTestComponentB
+{
+public:
+	int c = 3; // @SERIALIZABLE
+
+	SERIALIZABLE(HierarchyTestComponentC);
+};
+
+// Fourth component of deep components hierarchy
+class HierarchyTestComponentD: public HierarchyTestComponentC
+{
+public:
+	int d = 4; // @SERIALIZABLE
+
+	SERIALIZABLE(HierarchyTestComponentD);
+};
+
+// Last component of deep components hierarchy
+class HierarchyTestComponentE: public HierarchyTestComponentD
+{
+public:
+	int e = 5; // @SERIALIZABLE
+
+	SERIALIZABLE(HierarchyTestComponentE);
+};
+
+CLASS_BASES_META(HierarchyTestComponentA)
+{
+	BASE_CLASS(o2::Component);
+}
+END_META;
+CLASS_FIELDS_META(HierarchyTestComponentA)
+{
+	FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(1).NAME(a);
+}
+END_META;
+CLASS_METHODS_META(HierarchyTestComponentA)
+{
+}
+END_META;
+
+CLASS_BASES_META(HierarchyTestComponentB)
+{
+	BASE_CLASS(HierarchyTestComponentA);
+}
+END_META;
+CLASS_FIELDS_META(HierarchyTestComponentB)
+{
+	FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(2).NAME(b);
+}
+END_META;
+CLASS_METHODS_META(HierarchyTestComponentB)
+{
+}
+END_META;
+
+CLASS_BASES_META(HierarchyTestComponentC)
+{
+	BASE_CLASS(HierarchyTestComponentB);
+}
+END_META;
+CLASS_FIELDS_META(HierarchyTestComponentC)
+{
+	FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(3).NAME(c);
+}
+END_META;
+CLASS_METHODS_META(HierarchyTestComponentC)
+{
+}
+END_META;
+
+CLASS_BASES_META(HierarchyTestComponentD)
+{
+	BASE_CLASS(HierarchyTestComponentC);
+}
+END_META;
+CLASS_FIELDS_META(HierarchyTestComponentD)
+{
+	FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(4).NAME(d);
+}
+END_META;
+CLASS_METHODS_META(HierarchyTestComponentD)
+{
+}
+END_META;
+
+CLASS_BASES_META(HierarchyTestComponentE)
+{
+	BASE_CLASS(HierarchyTestComponentD);
+}
+END_META;
+CLASS_FIELDS_META(HierarchyTestComponentE)
+{
+	FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(5).NAME(e);
+}
+END_META;
+CLASS_METHODS_META(HierarchyTestComponentE)
+{
+}
+END_META;
+
+// Checks is type based on other by walking through base types, as it was before hierarchy intervals
+static bool IsBasedOnByBaseTypes(const Type& type, const Type& other)
+{
+	if (type == other)
+		return true;
+
+	for (auto& baseType : type.GetBaseTypes())
+	{
+		if (IsBasedOnByBaseTypes(*baseType.type, other))
+			return true;
+	}
+
+	return false;
+}
+
+// Casts object to base type by walking through base types cast functions
+static void* CastToBaseByBaseTypes(void* object, const Type& type, const Type& baseType)
+{
+	if (type == baseType)
+		return object;
+
+	for (auto& base : type.GetBaseTypes())
+	{
+		if (auto res = CastToBaseByBaseTypes((*base.dynamicCastUpFunc)(object), *base.type, baseType))
+			return res;
+	}
+
+	return nullptr;
+}
+
+// Checks hierarchy checks of all object types pairs and casts of test objects
+static bool CheckTypeHierarchyCorrectness(HierarchyTestComponentE* deepComponent, ImageComponent* imageComponent)
+{
+	Vector<const Type*> objectTypes;
+	for (auto& kv : Reflection::GetTypes())
+	{
+		if (kv.second->GetUsage() == Type::Usage::Object)
+			objectTypes.Add(kv.second);
+	}
+
+	for (auto type : objectTypes)
+	{
+		for (auto otherType : objectTypes)
+		{
+			if (type->IsBasedOn(*otherType) != IsBasedOnByBaseTypes(*type, *otherType))
+			{
+				o2Debug.LogError("Wrong hierarchy check: " + type->GetName() + " based on " + otherType->GetName());
+				return false;
+			}
+		}
+	}
+
+	const Type& deepType = TypeOf(HierarchyTestComponentE);
+	const Type& imageType = TypeOf(ImageComponent);
+
+	return deepType.CastToBaseType(deepComponent, TypeOf(HierarchyTestComponentA)) == static_cast<HierarchyTestComponentA*>(deepComponent) &&
+		deepType.CastToBaseType(deepComponent, TypeOf(Component)) == static_cast<Component*>(deepComponent) &&
+		deepType.CastToBaseType(deepComponent, TypeOf(ISerializable)) == static_cast<ISerializable*>(deepComponent) &&
+		deepType.CastToBaseType(deepComponent, TypeOf(IObject)) == static_cast<IObject*>(deepComponent) &&
+		deepType.CastToBaseType(deepComponent, TypeOf(Sprite)) == nullptr &&
+		imageType.CastToBaseType(imageComponent, TypeOf(Sprite)) == static_cast<Sprite*>(imageComponent) &&
+		imageType.CastToBaseType(imageComponent, TypeOf(DrawableComponent)) == static_cast<DrawableComponent*>(imageComponent) &&
+		imageType.CastToBaseType(imageComponent, TypeOf(Component)) == static_cast<Component*>(imageComponent) &&
+		imageType.IsBasedOn(TypeOf(Sprite)) && !TypeOf(Sprite).IsBasedOn(imageType);
+}
+
+void TestTypeHierarchy()
+{
+	auto deepComponent = mnew HierarchyTestComponentE();
+	auto imageComponent = mnew ImageComponent();
+	Actor* actor = mnew Actor({ mnew EditorTestComponent(), imageComponent, deepComponent });
+
+	bool correct = CheckTypeHierarchyCorrectness(deepComponent, imageComponent);
+
+	const Type& deepType = TypeOf(HierarchyTestComponentE);
+	const Vector<const Type*> checkTypes = { &TypeOf(HierarchyTestComponentA), &TypeOf(Component), &TypeOf(ISerializable),
+											 &TypeOf(Sprite), &TypeOf(Actor) };
+
+	const int repeatsCount = 1000000;
+	int basedCount = 0, oldBasedCount = 0;
+	Timer timer;
+
+	// Hierarchy checks
+	for (int i = 0; i < repeatsCount; i++)
+		basedCount += deepType.IsBasedOn(*checkTypes[i%checkTypes.Count()]) ? 1 : 0;
+
+	float isBasedOnTime = timer.GetDeltaTime();
+
+	for (int i = 0; i < repeatsCount; i++)
+		oldBasedCount += IsBasedOnByBaseTypes(deepType, *checkTypes[i%checkTypes.Count()]) ? 1 : 0;
+
+	float oldIsBasedOnTime = timer.GetDeltaTime();
+
+	// Casts to base types
+	void* castResult = nullptr;
+	for (int i = 0; i < repeatsCount; i++)
+		castResult = deepType.CastToBaseType(deepComponent, *checkTypes[i%3]);
+
+	float castTime = timer.GetDeltaTime();
+
+	void* oldCastResult = nullptr;
+	for (int i = 0; i < repeatsCount; i++)
+		oldCastResult = CastToBaseByBaseTypes(deepComponent, deepType, *checkTypes[i%3]);
+
+	float oldCastTime = timer.GetDeltaTime();
+
+	// Components search
+	HierarchyTestComponentA* foundComponent = nullptr;
+	for (int i = 0; i < repeatsCount; i++)
+		foundComponent = actor->GetComponent<HierarchyTestComponentA>();
+
+	float getComponentTime = timer.GetDeltaTime();
+
+	correct = correct && basedCount == oldBasedCount && castResult == oldCastResult &&
+		foundComponent == static_cast<HierarchyTestComponentA*>(deepComponent);
+
+	o2Debug.Log("Type hierarchy, " + (String)repeatsCount + " calls. IsBasedOn: intervals " + (String)(isBasedOnTime*1000.0f) +
+				"ms, base types walk " + (String)(oldIsBasedOnTime*1000.0f) + "ms. Casts: cached " + (String)(castTime*1000.0f) +
+				"ms, cast functions " + (String)(oldCastTime*1000.0f) + "ms. GetComponent: " + (String)(getComponentTime*1000.0f) + "ms");
+
+	delete actor;
+
+	if (correct)
+		o2Debug.Log("Type hierarchy - OK");
+	else
+		o2Debug.LogError("Type hierarchy - FAILED");
+}
+
+DECLARE_CLASS(HierarchyTestComponentA);
+
+DECLARE_CLASS(HierarchyTestComponentB);
+
+DECLARE_CLASS(HierarchyTestComponentC);
+
+DECLARE_CLASS(HierarchyTestComponentD);
+
+DECLARE_CLASS(HierarchyTestComponentE);